@@ -239,7 +239,10 @@ void ParallelRenderingApp::Init()
                 rhi::ProgramBindings& cube_program_bindings = frame.cubes_program_bindings[cube_index];
                 cube_program_bindings = rhi::ProgramBindings(frame.cubes_program_bindings[0], {}, frame.index);
                 frame.cubes_uniform_argument_binding_ptrs[cube_index] = &cube_program_bindings.Get({ rhi::ShaderType::All, "g_uniforms" });
-                cube_program_bindings.SetName(fmt::format("Cube {} Bindings {}", cube_index, frame.index));
+                cube_program_bindings.SetLazyName([cube_index, frame_index = frame.index]()
+                {
+                    return fmt::format("Cube {} Bindings {}", cube_index, frame_index);
+                });
             }
 #else // ROOT_CONSTANTS_ENABLED
             [&frame, &cube_array_buffers](const uint32_t cube_index)
@@ -253,7 +256,10 @@ void ParallelRenderingApp::Init()
                             uniform_data_size)
                     }
                 }, frame.index);
-                cube_program_bindings.SetName(fmt::format("Cube {} Bindings {}", cube_index, frame.index));
+                cube_program_bindings.SetLazyName([cube_index, frame_index = frame.index]()
+                {
+                    return fmt::format("Cube {} Bindings {}", cube_index, frame_index);
+                });
             }
 #endif // ROOT_CONSTANTS_ENABLED
         );
@@ -295,6 +301,7 @@ void ParallelRenderingApp::Init()
 
     // Initialize cube parameters
     m_cube_array_parameters = InitializeCubeArrayParameters();
+    InitializeCubeTransforms();
 
     // Update initial resource states before asteroids drawing without applying barriers on GPU to let automatic state propagation from Common state work
     m_cube_array_buffers_ptr->CreateBeginningResourceBarriers().ApplyTransitions();
@@ -332,11 +339,9 @@ ParallelRenderingApp::CubeArrayParameters ParallelRenderingApp::InitializeCubeAr
             const float tz = static_cast<float>(cube_index / cbrt_count_sqr) - cbrt_count_half;
             const float cs = cube_scale_distribution(rng);
 
-            const hlslpp::float4x4 scale_matrix = hlslpp::float4x4::scale(cs);
-            const hlslpp::float4x4 translation_matrix = hlslpp::float4x4::translation(tx * ts, ty * ts, tz * ts);
-
             CubeParameters& cube_params = cube_array_parameters[cube_index];
-            cube_params.model_matrix = hlslpp::mul(scale_matrix, translation_matrix);
+            cube_params.position = hlslpp::float3(tx * ts, ty * ts, tz * ts);
+            cube_params.scale = cs;
             cube_params.rotation_speed_y = rotation_speed_distribution(rng);
             cube_params.rotation_speed_z = rotation_speed_distribution(rng);
 
@@ -344,30 +349,32 @@ ParallelRenderingApp::CubeArrayParameters ParallelRenderingApp::InitializeCubeAr
             cube_params.thread_index = thread_index_distribution(rng);
         });
 
-    // Sort cubes parameters by thread index
-    // to make sure that actual cubes distribution by render threads will match thread_index in parameters
-    // NOTE-1: thread index is displayed on cube faces as text label using an element of Texture 2D Array.
-    // NOTE-2: Sorting also improves rendering performance because it ensures using one texture for all cubes per thread.
+    // Sort cubes parameters by random thread index to shuffle cubes order in space,
+    // so that contiguous ranges of visible cubes rendered by each thread are spread across the scene.
+    // NOTE: actual render thread index is assigned to visible cubes in Update, since cubes are split between threads after culling.
     tf::Task sort_task = task_flow.sort(cube_array_parameters.begin(), cube_array_parameters.end(),
                    [](const CubeParameters& left, const CubeParameters& right)
                    { return left.thread_index < right.thread_index; });
 
-    // Fixup even distribution of cubes between threads
-    const auto cubes_count_per_thread = static_cast<uint32_t>(std::ceil(static_cast<double>(cubes_count) / m_settings.render_thread_count));
-    tf::Task even_task = task_flow.for_each_index(0U, cubes_count, 1U,
-        [&cube_array_parameters, cubes_count_per_thread](const uint32_t cube_index)
-        {
-            cube_array_parameters[cube_index].thread_index = cube_index / cubes_count_per_thread;
-        });
-
     init_task.precede(sort_task);
-    sort_task.precede(even_task);
 
     // Execute parallel initialization of cube array parameters
     GetRenderContext().GetParallelExecutor().run(task_flow).get();
     return cube_array_parameters;
 }
 
+void ParallelRenderingApp::InitializeCubeTransforms()
+{
+    META_FUNCTION_TASK();
+    const auto cubes_count = static_cast<uint32_t>(m_cube_array_parameters.size());
+    m_cube_transforms.Resize(cubes_count);
+    for(uint32_t cube_index = 0U; cube_index < cubes_count; ++cube_index)
+    {
+        const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
+        m_cube_transforms.SetTransform(cube_index, cube_params.position, hlslpp::float4(0.F, 0.F, 0.F, 1.F), cube_params.scale);
+    }
+}
+
 bool ParallelRenderingApp::Animate(double, double delta_seconds)
 {
     META_FUNCTION_TASK();
@@ -375,14 +382,18 @@ bool ParallelRenderingApp::Animate(double, double delta_seconds)
 
     const double delta_angle_rad = delta_seconds * std::numbers::pi;
     tf::Taskflow task_flow;
-    task_flow.for_each(m_cube_array_parameters.begin(), m_cube_array_parameters.end(),
-        [delta_angle_rad](CubeParameters& cube_params)
+    task_flow.for_each_index(0U, static_cast<uint32_t>(m_cube_array_parameters.size()), 1U,
+        [this, delta_angle_rad](const uint32_t cube_index)
         {
-            const hlslpp::float4x4 rotate_matrix = hlslpp::mul(
-                hlslpp::float4x4::rotation_z(static_cast<float>(delta_angle_rad * cube_params.rotation_speed_z)),
-                hlslpp::float4x4::rotation_y(static_cast<float>(delta_angle_rad * cube_params.rotation_speed_y))
+            const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
+            const hlslpp::float4 delta_rotation = gfx::InstanceTransformSystem::CombineRotations(
+                gfx::InstanceTransformSystem::GetAxisRotation(hlslpp::float3(0.F, 0.F, 1.F), static_cast<float>(delta_angle_rad * cube_params.rotation_speed_z)),
+                gfx::InstanceTransformSystem::GetAxisRotation(hlslpp::float3(0.F, 1.F, 0.F), static_cast<float>(delta_angle_rad * cube_params.rotation_speed_y))
             );
-            cube_params.model_matrix = hlslpp::mul(rotate_matrix, cube_params.model_matrix);
+            // Rotation quaternion is normalized to prevent accumulation of rounding errors
+            m_cube_transforms.SetRotation(cube_index, hlslpp::normalize(
+                gfx::InstanceTransformSystem::CombineRotations(delta_rotation, m_cube_transforms.GetRotation(cube_index))
+            ));
         });
 
     GetRenderContext().GetParallelExecutor().run(task_flow).get();
@@ -408,26 +419,33 @@ bool ParallelRenderingApp::Update()
 
     const ParallelRenderingFrame& frame  = GetCurrentFrame();
 
-    // Update MVP-matrices for all cube instances so that they are positioned in a cube grid
+    // Cull cube instances by camera frustum and compose MVP-matrices of visible cubes in parallel chunks
+    tf::Executor& parallel_executor = GetRenderContext().GetParallelExecutor();
+    m_cube_transforms.Update(m_camera, parallel_executor);
+
+    // Visible cubes are split between render threads in contiguous ranges, the same way as in Render
+    const uint32_t visible_cubes_count = m_cube_transforms.GetVisibleInstancesCount();
+    const uint32_t visible_cubes_per_thread = std::max(1U, Data::DivCeil(visible_cubes_count, m_settings.GetActiveRenderThreadCount()));
+
+    // Update uniforms of visible cube instances, which are compacted to the beginning of instances list
+    // NOTE: index of the thread rendering cube is displayed on cube faces as text label using an element of Texture 2D Array.
     tf::Taskflow task_flow;
-    task_flow.for_each_index(0U, static_cast<uint32_t>(m_cube_array_parameters.size()), 1U,
-        [this, &frame](const uint32_t cube_index)
+    task_flow.for_each_index(0U, visible_cubes_count, 1U,
+        [this, &frame, visible_cubes_per_thread](const uint32_t visible_index)
         {
-            const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
-
             hlslpp::Uniforms uniforms{};
-            uniforms.mvp_matrix = hlslpp::transpose(hlslpp::mul(cube_params.model_matrix, m_camera.GetViewProjMatrix()));
-            uniforms.texture_index = cube_params.thread_index;
+            uniforms.mvp_matrix = m_cube_transforms.GetVisibleMvpMatrices()[visible_index];
+            uniforms.texture_index = visible_index / visible_cubes_per_thread;
 
 #ifdef ROOT_CONSTANTS_ENABLED
-            frame.cubes_uniform_argument_binding_ptrs[cube_index]->SetRootConstant(rhi::RootConstant(uniforms));
+            frame.cubes_uniform_argument_binding_ptrs[visible_index]->SetRootConstant(rhi::RootConstant(uniforms));
 #else // ROOT_CONSTANTS_ENABLED
             META_UNUSED(frame);
-            m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
+            m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), visible_index);
 #endif // ROOT_CONSTANTS_ENABLED
         });
 
-    GetRenderContext().GetParallelExecutor().run(task_flow).get();
+    parallel_executor.run(task_flow).get();
     return true;
 }
 
@@ -448,6 +466,9 @@ bool ParallelRenderingApp::Render()
     const auto& cubes_program_bindings = frame.cubes_array.program_bindings_per_instance;
 #endif // ROOT_CONSTANTS_ENABLED
 
+    // Only visible cube instances are rendered
+    const uint32_t visible_cubes_count = m_cube_transforms.GetVisibleInstancesCount();
+
     // Render cube instances of 'CUBE_MAP_ARRAY_SIZE' count
     if (m_settings.parallel_rendering_enabled)
     {
@@ -457,15 +478,15 @@ bool ParallelRenderingApp::Render()
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
         const std::vector<rhi::RenderCommandList>& render_cmd_lists = frame.parallel_render_cmd_list.GetParallelCommandLists();
-        const uint32_t instance_count_per_command_list = Data::DivCeil(m_cube_array_buffers_ptr->GetInstanceCount(), static_cast<uint32_t>(render_cmd_lists.size()));
+        const uint32_t instance_count_per_command_list = Data::DivCeil(visible_cubes_count, static_cast<uint32_t>(render_cmd_lists.size()));
 
         // Generate thread tasks for each of parallel render command lists to encode cubes rendering commands
         tf::Taskflow render_task_flow;
         render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
-            [this, &cubes_program_bindings, &render_cmd_lists, instance_count_per_command_list](const uint32_t cmd_list_index)
+            [this, &cubes_program_bindings, &render_cmd_lists, instance_count_per_command_list, visible_cubes_count](const uint32_t cmd_list_index)
             {
-                const uint32_t begin_instance_index = cmd_list_index * instance_count_per_command_list;
-                const uint32_t end_instance_index = std::min(begin_instance_index + instance_count_per_command_list, m_cube_array_buffers_ptr->GetInstanceCount());
+                const uint32_t begin_instance_index = std::min(cmd_list_index * instance_count_per_command_list, visible_cubes_count);
+                const uint32_t end_instance_index = std::min(begin_instance_index + instance_count_per_command_list, visible_cubes_count);
                 RenderCubesRange(render_cmd_lists[cmd_list_index], cubes_program_bindings, begin_instance_index, end_instance_index);
             }
         );
@@ -474,7 +495,8 @@ bool ParallelRenderingApp::Render()
         GetRenderContext().GetParallelExecutor().run(render_task_flow).get();
 #else // EXPLICIT_PARALLEL_RENDERING_ENABLED
         // The same parallel rendering is done inside MeshBuffers::DrawParallel helper function
-        m_cube_array_buffers_ptr->DrawParallel(frame.parallel_render_cmd_list, cubes_program_bindings);
+        m_cube_array_buffers_ptr->DrawParallel(frame.parallel_render_cmd_list, cubes_program_bindings.begin(),
+                                               cubes_program_bindings.begin() + visible_cubes_count);
 #endif // EXPLICIT_PARALLEL_RENDERING_ENABLED
 
         RenderOverlay(frame.parallel_render_cmd_list.GetParallelCommandLists().back());
@@ -487,9 +509,10 @@ bool ParallelRenderingApp::Render()
         frame.serial_render_cmd_list.SetViewState(GetViewState());
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
-        RenderCubesRange(frame.serial_render_cmd_list, cubes_program_bindings, 0U, m_cube_array_buffers_ptr->GetInstanceCount());
+        RenderCubesRange(frame.serial_render_cmd_list, cubes_program_bindings, 0U, visible_cubes_count);
 #else // EXPLICIT_PARALLEL_RENDERING_ENABLED
-        m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, cubes_program_bindings);
+        m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, cubes_program_bindings.begin(),
+                                       cubes_program_bindings.begin() + visible_cubes_count);
 #endif // EXPLICIT_PARALLEL_RENDERING_ENABLED
 
         RenderOverlay(frame.serial_render_cmd_list);
@@ -25,6 +25,7 @@ Tutorial demonstrating parallel rendering with Methane graphics API
 
 #include <Methane/Kit.h>
 #include <Methane/UserInterface/App.hpp>
+#include <Methane/Graphics/InstanceTransformSystem.h>
 
 #include <thread>
 
@@ -95,7 +96,8 @@ public:
 private:
     struct CubeParameters
     {
-        hlslpp::float4x4 model_matrix;
+        hlslpp::float3   position;
+        float            scale = 1.F;
         double           rotation_speed_y = 0.25f;
         double           rotation_speed_z = 0.5f;
         uint32_t         thread_index = 0;
@@ -105,6 +107,7 @@ private:
     using MeshBuffers = gfx::MeshBuffers<hlslpp::Uniforms>;
 
     CubeArrayParameters InitializeCubeArrayParameters() const;
+    void InitializeCubeTransforms();
     bool Animate(double elapsed_seconds, double delta_seconds);
     void RenderCubesRange(const rhi::RenderCommandList& remder_cmd_list,
                           const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
@@ -113,13 +116,14 @@ private:
     // IContextCallback override
     void OnContextReleased(rhi::IContext& context) override;
 
-    Settings            m_settings;
-    gfx::Camera         m_camera;
-    rhi::RenderState    m_render_state;
-    rhi::Texture        m_texture_array;
-    rhi::Sampler        m_texture_sampler;
-    Ptr<MeshBuffers>    m_cube_array_buffers_ptr;
-    CubeArrayParameters m_cube_array_parameters;
+    Settings                     m_settings;
+    gfx::Camera                  m_camera;
+    rhi::RenderState             m_render_state;
+    rhi::Texture                 m_texture_array;
+    rhi::Sampler                 m_texture_sampler;
+    Ptr<MeshBuffers>             m_cube_array_buffers_ptr;
+    CubeArrayParameters          m_cube_array_parameters;
+    gfx::InstanceTransformSystem m_cube_transforms{ 0.87F }; // bounding sphere radius of unit cube is sqrt(3)/2
 };
 
 } // namespace Methane::Tutorials
@@ -22,14 +22,20 @@ Tutorial demonstrating "game of life" computing on GPU in console application
 ******************************************************************************/
 
 #include "ConsoleComputeApp.h"
+#include "GameOfLifeCpu.h"
 #include "Shaders/GameOfLifeRules.h"
 
 #include <Methane/Data/AppShadersProvider.h>
 #include <Methane/Data/Math.hpp>
+#include <Methane/Timer.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <magic_enum/magic_enum.hpp>
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
 #include <random>
+#include <iostream>
+#include <algorithm>
 
 namespace gfx = Methane::Graphics;
 namespace data = Methane::Data;
@@ -53,6 +59,16 @@ static const rhi::Devices& GetComputeDevices()
     return s_compute_devices;
 }
 
+static void PrintBenchmarkResult(std::string_view compute_name, uint32_t generations_count, const gfx::FrameSize& field_size,
+                                 double elapsed_seconds, uint32_t alive_cells_count)
+{
+    const double generations_per_second = elapsed_seconds > 0.0 ? generations_count / elapsed_seconds : 0.0;
+    const double mega_cells_per_second  = generations_per_second * static_cast<double>(field_size.GetPixelsCount()) / 1000000.0;
+    std::cout << fmt::format("  {:<32} {:>9.3f} sec, {:>9.1f} gen/sec, {:>10.1f} Mcells/sec, {} alive cells",
+                             compute_name, elapsed_seconds, generations_per_second, mega_cells_per_second, alive_cells_count)
+              << std::endl;
+}
+
 static Methane::Data::Bytes GetRandomFrameData(std::mt19937& random_engine, const gfx::FrameSize& frame_size, double initial_cells_ratio)
 {
     META_FUNCTION_TASK();
@@ -103,6 +119,64 @@ int ConsoleComputeApp::Run()
     return ConsoleApp::Run();
 }
 
+int ConsoleComputeApp::RunBenchmark(uint32_t generations_count)
+{
+    META_FUNCTION_TASK();
+    const gfx::FrameSize& field_size   = GetFieldSize();
+    const auto            game_rule_id = static_cast<uint32_t>(GetGameRuleIndex());
+
+    // Fixed seed makes initial state reproducible between benchmark runs and equal for CPU and GPU computations
+    std::mt19937 benchmark_random_engine(field_size.GetPixelsCount());
+    const data::Bytes initial_cells = GetRandomFrameData(benchmark_random_engine, field_size, GetInitialCellsRatio());
+
+    std::cout << fmt::format("Game of Life benchmark: {} generations of {} x {} cells field with rule {}",
+                             generations_count, field_size.GetWidth(), field_size.GetHeight(), g_gol_rule_labels[game_rule_id])
+              << std::endl;
+
+    GameOfLifeCpu game_of_life_cpu(field_size);
+    game_of_life_cpu.SetCells(initial_cells);
+
+    Timer cpu_timer;
+    for(uint32_t generation = 0U; generation < generations_count; ++generation)
+    {
+        game_of_life_cpu.Step(game_rule_id, m_parallel_executor);
+    }
+    PrintBenchmarkResult(fmt::format("CPU ({} threads)", m_parallel_executor.num_workers()), generations_count, field_size,
+                         cpu_timer.GetElapsedSecondsD(), game_of_life_cpu.GetAliveCellsCount());
+
+    if (!m_compute_context.IsInitialized())
+    {
+        std::cout << fmt::format("  {:<32} not available", "GPU") << std::endl;
+        return 0;
+    }
+
+    const rhi::CommandQueue& compute_cmd_queue = m_compute_context.GetComputeCommandKit().GetQueue();
+    m_frame_texture_index = 0U;
+    GetFrameTexture().SetData(compute_cmd_queue, { rhi::SubResource(data::Bytes(initial_cells)) });
+    m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
+
+    // All generations are encoded in one command list and executed with a single wait for GPU completion
+    Timer gpu_timer;
+    DispatchGenerations(generations_count);
+    const double gpu_elapsed_seconds = gpu_timer.GetElapsedSecondsD();
+
+    m_frame_data = GetFrameTexture().GetData(compute_cmd_queue);
+    const uint8_t* cells = m_frame_data.GetDataPtr<uint8_t>();
+    const auto alive_cells_count = static_cast<uint32_t>(std::count_if(cells, cells + field_size.GetPixelsCount(),
+                                                                       [](uint8_t cell) { return cell != 0U; }));
+    PrintBenchmarkResult(fmt::format("GPU ({})", GetComputeDeviceName()), generations_count, field_size,
+                         gpu_elapsed_seconds, alive_cells_count);
+
+    // CPU and GPU implementations have the same semantics with dead cells outside of the field,
+    // so the final generation computed on CPU is used as a reference for cross-checking GPU results
+    data::Bytes cpu_cells;
+    game_of_life_cpu.GetCells(cpu_cells);
+    const bool is_gpu_result_valid = std::equal(cpu_cells.begin(), cpu_cells.end(), cells, cells + field_size.GetPixelsCount(),
+                                                [](std::byte cpu_cell, uint8_t gpu_cell) { return (cpu_cell != std::byte()) == (gpu_cell != 0U); });
+    std::cout << fmt::format("  {:<32} {}", "CPU and GPU results", is_gpu_result_valid ? "match" : "MISMATCH") << std::endl;
+    return is_gpu_result_valid ? 0 : 1;
+}
+
 std::string_view ConsoleComputeApp::GetGraphicsApiName() const
 {
     return magic_enum::enum_name(rhi::System::GetNativeApi());
@@ -145,6 +219,9 @@ void ConsoleComputeApp::Init()
 {
     META_FUNCTION_TASK();
     const rhi::Device* device_ptr = GetComputeDevice();
+    if (!device_ptr)
+        return;
+
     m_compute_context = device_ptr->CreateComputeContext(m_parallel_executor, {});
     m_compute_context.SetName("Game of Life");
 
@@ -176,15 +253,28 @@ void ConsoleComputeApp::Init()
             rhi::ResourceUsage::ReadBack
         }
     );
-    m_frame_texture = m_compute_context.CreateTexture(frame_texture_settings);
-    m_frame_texture.SetName("Game of Life Frame Texture");
+    for(uint32_t frame_index = 0U; frame_index < m_frame_textures.size(); ++frame_index)
+    {
+        m_frame_textures[frame_index] = m_compute_context.CreateTexture(frame_texture_settings);
+        m_frame_textures[frame_index].SetName(fmt::format("Game of Life Frame Texture {}", frame_index));
+    }
 
-    const Constants game_constants{ static_cast<uint>(GetGameRuleIndex()) };
-    m_compute_bindings = m_compute_state.GetProgram().CreateBindings({
-        { { rhi::ShaderType::Compute, "g_constants"     }, rhi::RootConstant(game_constants) },
-        { { rhi::ShaderType::Compute, "g_frame_texture" }, m_frame_texture.GetResourceView() }
+    // Both frame textures stay in unordered access state, so generation dispatches are synchronized with UAV barriers
+    m_generation_barriers = rhi::ResourceBarriers({
+        { m_frame_textures[0].GetInterface(), rhi::ResourceState::UnorderedAccess, rhi::ResourceState::UnorderedAccess },
+        { m_frame_textures[1].GetInterface(), rhi::ResourceState::UnorderedAccess, rhi::ResourceState::UnorderedAccess },
     });
-    m_compute_bindings.SetName("Game of Life Compute Bindings");
+
+    const Constants game_constants{ static_cast<uint>(GetGameRuleIndex()) };
+    for(uint32_t frame_index = 0U; frame_index < m_compute_bindings.size(); ++frame_index)
+    {
+        m_compute_bindings[frame_index] = m_compute_state.GetProgram().CreateBindings({
+            { { rhi::ShaderType::Compute, "g_constants"          }, rhi::RootConstant(game_constants) },
+            { { rhi::ShaderType::Compute, "g_frame_texture"      }, m_frame_textures[frame_index].GetResourceView() },
+            { { rhi::ShaderType::Compute, "g_next_frame_texture" }, m_frame_textures[1U - frame_index].GetResourceView() }
+        });
+        m_compute_bindings[frame_index].SetName(fmt::format("Game of Life Compute Bindings {}", frame_index));
+    }
 
     RandomizeFrameData();
 
@@ -195,12 +285,16 @@ void ConsoleComputeApp::Init()
 void ConsoleComputeApp::Release()
 {
     META_FUNCTION_TASK();
-    m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
+    if (m_compute_context.IsInitialized())
+    {
+        m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
+    }
 
     m_compute_cmd_list_set = {};
     m_compute_cmd_list     = {};
     m_compute_bindings     = {};
-    m_frame_texture        = {};
+    m_generation_barriers  = {};
+    m_frame_textures       = {};
     m_compute_state        = {};
     m_compute_context      = {};
 }
@@ -208,22 +302,8 @@ void ConsoleComputeApp::Release()
 void ConsoleComputeApp::Compute()
 {
     META_FUNCTION_TASK();
-    const data::FrameSize&       field_size        = GetFieldSize();
-    const rhi::CommandQueue&     compute_cmd_queue = m_compute_context.GetComputeCommandKit().GetQueue();
-    const rhi::ThreadGroupSize&  thread_group_size = m_compute_state.GetSettings().thread_group_size;
-    const rhi::ThreadGroupsCount thread_groups_count(data::DivCeil(field_size.GetWidth(), thread_group_size.GetWidth()),
-                                                     data::DivCeil(field_size.GetHeight(), thread_group_size.GetHeight()),
-                                                     1U);
-
-    META_DEBUG_GROUP_VAR(s_debum_group, "Compute Frame");
-    m_compute_cmd_list.ResetWithState(m_compute_state, &s_debum_group);
-    m_compute_cmd_list.SetProgramBindings(m_compute_bindings);
-    m_compute_cmd_list.Dispatch(thread_groups_count);
-    m_compute_cmd_list.Commit();
-
-    compute_cmd_queue.Execute(m_compute_cmd_list_set);
-    m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
-    m_frame_data = m_frame_texture.GetData(compute_cmd_queue);
+    DispatchGenerations(1U);
+    m_frame_data = GetFrameTexture().GetData(m_compute_context.GetComputeCommandKit().GetQueue());
     m_fps_counter.OnCpuFrameReadyToPresent();
 }
 
@@ -264,8 +344,39 @@ void ConsoleComputeApp::Restart()
 void ConsoleComputeApp::ResetRules()
 {
     const Constants game_constants{ static_cast<uint>(GetGameRuleIndex()) };
-    m_compute_bindings.Get({ rhi::ShaderType::Compute, "g_constants" })
-                      .SetRootConstant(rhi::RootConstant(game_constants));
+    for(const rhi::ProgramBindings& compute_bindings : m_compute_bindings)
+    {
+        compute_bindings.Get({ rhi::ShaderType::Compute, "g_constants" })
+                        .SetRootConstant(rhi::RootConstant(game_constants));
+    }
+}
+
+void ConsoleComputeApp::DispatchGenerations(uint32_t generations_count)
+{
+    META_FUNCTION_TASK();
+    const data::FrameSize&       field_size        = GetFieldSize();
+    const rhi::CommandQueue&     compute_cmd_queue = m_compute_context.GetComputeCommandKit().GetQueue();
+    const rhi::ThreadGroupSize&  thread_group_size = m_compute_state.GetSettings().thread_group_size;
+    const rhi::ThreadGroupsCount thread_groups_count(data::DivCeil(field_size.GetWidth(), thread_group_size.GetWidth()),
+                                                     data::DivCeil(field_size.GetHeight(), thread_group_size.GetHeight()),
+                                                     1U);
+
+    META_DEBUG_GROUP_VAR(s_debum_group, "Compute Frame");
+    m_compute_cmd_list.ResetWithState(m_compute_state, &s_debum_group);
+    for(uint32_t generation = 0U; generation < generations_count; ++generation)
+    {
+        // Previous generation writes have to complete before they are read and before the read texture is overwritten
+        if (generation > 0U)
+            m_compute_cmd_list.SetResourceBarriers(m_generation_barriers);
+
+        m_compute_cmd_list.SetProgramBindings(m_compute_bindings[m_frame_texture_index]);
+        m_compute_cmd_list.Dispatch(thread_groups_count);
+        m_frame_texture_index = 1U - m_frame_texture_index;
+    }
+    m_compute_cmd_list.Commit();
+
+    compute_cmd_queue.Execute(m_compute_cmd_list_set);
+    m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
 }
 
 void ConsoleComputeApp::RandomizeFrameData()
@@ -276,12 +387,19 @@ void ConsoleComputeApp::RandomizeFrameData()
     m_frame_data = rhi::SubResource(GetRandomFrameData(m_random_engine, GetFieldSize(), GetInitialCellsRatio()));
 
     // Set frame texture data
-    m_frame_texture.SetData(m_compute_context.GetComputeCommandKit().GetQueue(), { m_frame_data });
+    GetFrameTexture().SetData(m_compute_context.GetComputeCommandKit().GetQueue(), { m_frame_data });
 }
 
 } // namespace Methane::Tutorials
 
-int main(int, const char*[])
+int main(int argc, const char* argv[])
 {
-    return Methane::Tutorials::ConsoleComputeApp().Run();
+    CLI::App cli("Methane Console Compute: Game of Life computed on GPU");
+    uint32_t benchmark_generations_count = 0U;
+    cli.add_option("-b,--benchmark", benchmark_generations_count,
+                   "Compute given number of generations on CPU and GPU without UI and print performance stats");
+    CLI11_PARSE(cli, argc, argv);
+
+    Methane::Tutorials::ConsoleComputeApp app;
+    return benchmark_generations_count ? app.RunBenchmark(benchmark_generations_count) : app.Run();
 }
\ No newline at end of file
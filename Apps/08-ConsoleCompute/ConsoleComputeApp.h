@@ -31,6 +31,7 @@ Tutorial demonstrating "game of life" computing on GPU in console application
 #include <taskflow/taskflow.hpp>
 #include <string>
 #include <random>
+#include <array>
 
 namespace rhi = Methane::Graphics::Rhi;
 
@@ -45,6 +46,9 @@ public:
 
     const rhi::Device* GetComputeDevice() const;
 
+    // Computes given number of generations on CPU and GPU from the same initial state and prints performance stats
+    int RunBenchmark(uint32_t generations_count);
+
     // ConsoleApp overrides
     int Run() override;
     std::string_view                GetGraphicsApiName() const override;
@@ -62,7 +66,14 @@ protected:
     void ResetRules() override;
 
 private:
+    // Generations are computed with ping-pong of two frame textures: one is read and another one is written
+    using FrameTextures   = std::array<rhi::Texture, 2>;
+    using ComputeBindings = std::array<rhi::ProgramBindings, 2>;
+
+    const rhi::Texture& GetFrameTexture() const noexcept { return m_frame_textures[m_frame_texture_index]; }
+
     void RandomizeFrameData();
+    void DispatchGenerations(uint32_t generations_count);
 
     std::mt19937            m_random_engine;
     tf::Executor            m_parallel_executor;
@@ -70,8 +81,10 @@ private:
     rhi::ComputeState       m_compute_state;
     rhi::ComputeCommandList m_compute_cmd_list;
     rhi::CommandListSet     m_compute_cmd_list_set;
-    rhi::Texture            m_frame_texture;
-    rhi::ProgramBindings    m_compute_bindings;
+    FrameTextures           m_frame_textures;
+    ComputeBindings         m_compute_bindings; // bindings with index i read frame texture i and write the other one
+    rhi::ResourceBarriers   m_generation_barriers;
+    uint32_t                m_frame_texture_index{ 0U };
     rhi::SubResource        m_frame_data;
     Data::FpsCounter        m_fps_counter{ 60U };
     uint32_t                m_visible_cells_count{ 0U };
@@ -0,0 +1,198 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: GameOfLifeCpu.cpp
+Game of Life computing on CPU with bit-packed cells field: 64 cells are stored in one word
+and updated simultaneously with bit-sliced neighbours counting, rows are updated in parallel.
+
+******************************************************************************/
+
+#include "GameOfLifeCpu.h"
+#include "Shaders/GameOfLifeRules.h"
+
+#include <Methane/Data/Math.hpp>
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/algorithm/for_each.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <numeric>
+
+namespace Methane::Tutorials
+{
+
+static constexpr uint32_t g_word_bits_count        = 64U;
+static constexpr uint32_t g_max_neighbours_count   = 8U;
+static constexpr uint32_t g_count_bit_planes_count = 4U; // enough to count up to 8 neighbours
+
+GameOfLifeCpu::GameOfLifeCpu(const data::FrameSize& field_size)
+    : m_field_size(field_size)
+    , m_row_words_count(data::DivCeil(field_size.GetWidth(), g_word_bits_count))
+    , m_last_word_mask(field_size.GetWidth() % g_word_bits_count
+                       ? (Word(1U) << (field_size.GetWidth() % g_word_bits_count)) - 1U
+                       : ~Word(0U))
+    , m_cells(static_cast<size_t>(m_row_words_count) * field_size.GetHeight(), Word(0U))
+    , m_next_cells(m_cells.size(), Word(0U))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(field_size.GetPixelsCount(), "game of life field can not be empty");
+}
+
+void GameOfLifeCpu::SetCells(const data::Bytes& cells)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL(cells.size(), m_field_size.GetPixelsCount());
+    std::fill(m_cells.begin(), m_cells.end(), Word(0U));
+
+    const uint32_t width = m_field_size.GetWidth();
+    for(uint32_t y = 0U; y < m_field_size.GetHeight(); ++y)
+    {
+        const std::byte* row_cells = cells.data() + static_cast<size_t>(y) * width;
+        Word*            row_words = m_cells.data() + static_cast<size_t>(y) * m_row_words_count;
+        for(uint32_t x = 0U; x < width; ++x)
+        {
+            if (row_cells[x] != std::byte())
+                row_words[x / g_word_bits_count] |= Word(1U) << (x % g_word_bits_count);
+        }
+    }
+}
+
+void GameOfLifeCpu::GetCells(data::Bytes& cells) const
+{
+    META_FUNCTION_TASK();
+    cells.resize(m_field_size.GetPixelsCount());
+
+    const uint32_t width = m_field_size.GetWidth();
+    for(uint32_t y = 0U; y < m_field_size.GetHeight(); ++y)
+    {
+        std::byte*  row_cells = cells.data() + static_cast<size_t>(y) * width;
+        const Word* row_words = m_cells.data() + static_cast<size_t>(y) * m_row_words_count;
+        for(uint32_t x = 0U; x < width; ++x)
+        {
+            row_cells[x] = static_cast<std::byte>((row_words[x / g_word_bits_count] >> (x % g_word_bits_count)) & 1U);
+        }
+    }
+}
+
+void GameOfLifeCpu::Step(uint32_t game_rule_id, tf::Executor& parallel_executor)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(game_rule_id, g_gol_rule_masks.size());
+    const GameOfLifeRuleMasks& rule_masks = g_gol_rule_masks[game_rule_id];
+
+    // Expand rule masks to full-word selectors, so that rules are applied without branches
+    std::array<Word, g_max_neighbours_count + 1U> born_selectors{};
+    std::array<Word, g_max_neighbours_count + 1U> survived_selectors{};
+    for(uint32_t count = 0U; count <= g_max_neighbours_count; ++count)
+    {
+        born_selectors[count]     = (rule_masks.born_mask     >> count) & 1U ? ~Word(0U) : Word(0U);
+        survived_selectors[count] = (rule_masks.survived_mask >> count) & 1U ? ~Word(0U) : Word(0U);
+    }
+
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(0U, m_field_size.GetHeight(), 1U,
+        [this, &born_selectors, &survived_selectors](const uint32_t row_index)
+        { StepRow(row_index, born_selectors.data(), survived_selectors.data()); },
+        tf::StaticPartitioner()
+    );
+    parallel_executor.run(task_flow).get();
+
+    std::swap(m_cells, m_next_cells);
+}
+
+uint32_t GameOfLifeCpu::GetAliveCellsCount() const
+{
+    META_FUNCTION_TASK();
+    return std::accumulate(m_cells.begin(), m_cells.end(), 0U,
+                           [](uint32_t count, Word word) { return count + static_cast<uint32_t>(std::popcount(word)); });
+}
+
+void GameOfLifeCpu::StepRow(uint32_t row_index, const Word* born_selectors, const Word* survived_selectors)
+{
+    const size_t row_offset = static_cast<size_t>(row_index) * m_row_words_count;
+    const Word*  curr_row   = m_cells.data() + row_offset;
+    const Word*  upper_row  = row_index > 0U ? curr_row - m_row_words_count : nullptr;
+    const Word*  lower_row  = row_index + 1U < m_field_size.GetHeight() ? curr_row + m_row_words_count : nullptr;
+    Word*        next_row   = m_next_cells.data() + row_offset;
+
+    for(uint32_t word_index = 0U; word_index < m_row_words_count; ++word_index)
+    {
+        // Neighbour cells are aligned with current cells by shifting words with carry of boundary bits
+        // from adjacent words, cells outside of the field are dead
+        const auto get_neighbour_words = [word_index, this](const Word* row, std::array<Word, 3>& words)
+        {
+            if (!row)
+            {
+                words = {};
+                return;
+            }
+            const Word center = row[word_index];
+            const Word prev   = word_index > 0U ? row[word_index - 1U] : Word(0U);
+            const Word next   = word_index + 1U < m_row_words_count ? row[word_index + 1U] : Word(0U);
+            words[0] = (center << 1U) | (prev >> (g_word_bits_count - 1U)); // west neighbours
+            words[1] = center;
+            words[2] = (center >> 1U) | (next << (g_word_bits_count - 1U)); // east neighbours
+        };
+
+        std::array<Word, 3> upper_words{};
+        std::array<Word, 3> curr_words{};
+        std::array<Word, 3> lower_words{};
+        get_neighbour_words(upper_row, upper_words);
+        get_neighbour_words(curr_row,  curr_words);
+        get_neighbour_words(lower_row, lower_words);
+
+        const std::array<Word, g_max_neighbours_count> neighbour_words{
+            upper_words[0], upper_words[1], upper_words[2],
+            curr_words[0],                  curr_words[2],
+            lower_words[0], lower_words[1], lower_words[2]
+        };
+
+        // Bit-sliced counting of alive neighbours for 64 cells at once:
+        // bit N of count_planes[K] is the K-th bit of neighbours count for N-th cell in word
+        std::array<Word, g_count_bit_planes_count> count_planes{};
+        for(const Word neighbour_word : neighbour_words)
+        {
+            Word carry = neighbour_word;
+            for(Word& count_plane : count_planes)
+            {
+                const Word plane_carry = count_plane & carry;
+                count_plane ^= carry;
+                carry = plane_carry;
+            }
+        }
+
+        const Word alive_cells = curr_words[1];
+        Word next_cells = 0U;
+        for(uint32_t count = 0U; count <= g_max_neighbours_count; ++count)
+        {
+            Word count_match = ~Word(0U);
+            for(uint32_t plane_index = 0U; plane_index < g_count_bit_planes_count; ++plane_index)
+            {
+                count_match &= (count >> plane_index) & 1U ? count_planes[plane_index] : ~count_planes[plane_index];
+            }
+            next_cells |= count_match & ((alive_cells & survived_selectors[count]) | (~alive_cells & born_selectors[count]));
+        }
+
+        next_row[word_index] = word_index + 1U == m_row_words_count ? next_cells & m_last_word_mask : next_cells;
+    }
+}
+
+} // namespace Methane::Tutorials
@@ -0,0 +1,69 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: GameOfLifeCpu.h
+Game of Life computing on CPU with bit-packed cells field: 64 cells are stored in one word
+and updated simultaneously with bit-sliced neighbours counting, rows are updated in parallel.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+#include <Methane/Data/Rect.hpp>
+
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <cstdint>
+
+namespace Methane::Tutorials
+{
+
+namespace data = Methane::Data;
+
+class GameOfLifeCpu
+{
+public:
+    explicit GameOfLifeCpu(const data::FrameSize& field_size);
+
+    const data::FrameSize& GetFieldSize() const noexcept { return m_field_size; }
+
+    // Cells are converted from and to field of bytes, one byte per cell with non-zero value for alive cell
+    void SetCells(const data::Bytes& cells);
+    void GetCells(data::Bytes& cells) const;
+
+    // Computes next generation with rule from "Shaders/GameOfLifeRules.h", cells outside of the field are dead
+    void Step(uint32_t game_rule_id, tf::Executor& parallel_executor);
+
+    uint32_t GetAliveCellsCount() const;
+
+private:
+    using Word = uint64_t;
+    using Words = std::vector<Word>;
+
+    void StepRow(uint32_t row_index, const Word* born_selectors, const Word* survived_selectors);
+
+    data::FrameSize m_field_size;
+    uint32_t        m_row_words_count;
+    Word            m_last_word_mask;
+    Words           m_cells;
+    Words           m_next_cells;
+};
+
+} // namespace Methane::Tutorials
@@ -24,19 +24,21 @@ Compute shader for Conway's Game of Life
 #include "GameOfLifeRules.h"
 
 [[vk::push_constant]]
-ConstantBuffer<Constants> g_constants     : register(b0, META_ARG_CONSTANT);
-RWTexture2D<uint>         g_frame_texture : register(u0, META_ARG_MUTABLE);
+ConstantBuffer<Constants> g_constants          : register(b0, META_ARG_CONSTANT);
+RWTexture2D<uint>         g_frame_texture      : register(u0, META_ARG_MUTABLE);
+RWTexture2D<uint>         g_next_frame_texture : register(u1, META_ARG_MUTABLE);
 
 [numthreads(16, 16, 1)]
 void MainCS(uint3 id : SV_DispatchThreadID)
 {
     uint2 frame_texture_size;
     g_frame_texture.GetDimensions(frame_texture_size.x, frame_texture_size.y);
-    if (id.x > frame_texture_size.x || id.y > frame_texture_size.y)
+    if (id.x >= frame_texture_size.x || id.y >= frame_texture_size.y)
         return;
 
     // For a cell at id.xy compute number live neighbours,
     // which are 8 cells that are horizontally, vertically, or diagonally adjacent.
+    // Cells outside of the field are dead, same as in CPU implementation.
     uint alive_neighbors_count = 0;
     for (int x = -1; x <= 1; x++)
     {
@@ -46,13 +48,15 @@ void MainCS(uint3 id : SV_DispatchThreadID)
                 continue;
 
             uint2 neighbor_pos = uint2(id.x + x, id.y + y);
-            if (g_frame_texture[neighbor_pos.xy] > 0)
+            if (neighbor_pos.x < frame_texture_size.x && neighbor_pos.y < frame_texture_size.y &&
+                g_frame_texture[neighbor_pos.xy] > 0)
                 alive_neighbors_count++;
         }
     }
 
-    g_frame_texture[id.xy] = ( g_frame_texture[id.xy] > 0
-                               ? IsCellSurvived(g_constants.game_rule_id, alive_neighbors_count)
-                               : IsCellBorn(g_constants.game_rule_id, alive_neighbors_count)
-                             ) ? 1 : 0;
+    // Next generation is written to another texture, so that all cells are computed from the same generation
+    g_next_frame_texture[id.xy] = ( g_frame_texture[id.xy] > 0
+                                    ? IsCellSurvived(g_constants.game_rule_id, alive_neighbors_count)
+                                    : IsCellBorn(g_constants.game_rule_id, alive_neighbors_count)
+                                  ) ? 1 : 0;
 }
@@ -27,18 +27,38 @@ Game of Life Rules constants
 #ifdef __cplusplus
 #include <vector>
 #include <string>
+#include <array>
+#include <cstdint>
 
 // Game of Life alternative rules:
 // https://conwaylife.com/wiki/List_of_Life-like_rules
 // NOTE: indices of rules should match constants in "Shaders/GameOfLifeRules.h"
 static const std::vector<std::string> g_gol_rule_labels{
     "Classic (B3/S23)",
+    "Flock (B3/S12)",
     "Star Trek (B3/S0248)",
     "Coral (B3/S45678)",
     "Geology (B3578/S24678)",
     "Vote (B5678/S45678)"
 };
 
+// Masks of alive neighbours counts (bit N is set for N neighbours) for cells birth and survival,
+// which are used by CPU implementation and should match IsCellBorn and IsCellSurvived functions below
+struct GameOfLifeRuleMasks
+{
+    uint32_t born_mask;
+    uint32_t survived_mask;
+};
+
+static const std::vector<GameOfLifeRuleMasks> g_gol_rule_masks{
+    { 0b000001000U, 0b000001100U }, // Classic    B3/S23
+    { 0b000001000U, 0b000000110U }, // Flock      B3/S12
+    { 0b000001000U, 0b100010101U }, // Star Trek  B3/S0248
+    { 0b000001000U, 0b111110000U }, // Coral      B3/S45678
+    { 0b110101000U, 0b111010100U }, // Geology    B3578/S24678
+    { 0b111100000U, 0b111110000U }, // Vote       B5678/S45678
+};
+
 using uint = uint32_t;
 using uint3 = std::array<uint, 3>;
 
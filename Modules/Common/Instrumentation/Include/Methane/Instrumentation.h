@@ -31,6 +31,7 @@ NOTE:
 
 #include "IttApiHelper.h"
 #include "ScopeTimer.h"
+#include "TraceEvents.h"
 
 #if defined(__GNUC__) && !defined(__llvm__) && !defined(__INTEL_COMPILER)
 #define __GCC_COMPILER__
@@ -52,7 +53,7 @@ NOTE:
 
 #include <string_view>
 
-#if defined(ITT_INSTRUMENTATION_ENABLED) || defined(TRACY_ENABLE)
+#if defined(ITT_INSTRUMENTATION_ENABLED) || defined(TRACY_ENABLE) || defined(METHANE_TRACE_EVENTS_ENABLED)
 #define META_INSTRUMENTATION_ENABLED
 #endif
 
@@ -102,6 +103,7 @@ ITT_DOMAIN_EXTERN();
 
 #define META_CPU_FRAME_DELIMITER(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index) \
     FrameMark; \
+    TRACE_EVENTS_FRAME(frame_buffer_index, frame_index); \
     ITT_PROCESS_MARKER("Methane-Frame-Delimiter"); \
     ITT_MARKER_ARG("Frame-Buffer-Index", static_cast<int64_t>(frame_buffer_index)); \
     ITT_MARKER_ARG("Frame-Index", static_cast<int64_t>(frame_index))
@@ -114,10 +116,12 @@ ITT_DOMAIN_EXTERN();
 
 #define META_SCOPE_TASK(/*const char* */name) \
     TRACY_ZONE_SCOPED_NAME(name); \
+    TRACE_EVENTS_SCOPE(name); \
     ITT_SCOPE_TASK(name)
 
 #define META_FUNCTION_TASK() \
     TRACY_ZONE_SCOPED(); \
+    TRACE_EVENTS_SCOPE(__FUNCTION__); \
     ITT_FUNCTION_TASK()
 
 #define META_GLOBAL_MARKER(/*const char* */name) \
@@ -140,6 +144,7 @@ ITT_DOMAIN_EXTERN();
 
 #define META_THREAD_NAME(/*const char* */name) \
     TRACY_SET_THREAD_NAME(name); \
+    TRACE_EVENTS_THREAD_NAME(name); \
     ITT_THREAD_NAME(name); \
     Methane::SetThreadName(name)
 
@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/ScopeTimer.h
-Code scope measurement timer with aggregating and averaging of timings.
+Code scope measurement timer with per-thread aggregation of timings
+to latency histograms, per-frame windows and text, JSON or CSV reports.
 
 ******************************************************************************/
 
@@ -26,11 +27,19 @@ Code scope measurement timer with aggregating and averaging of timings.
 #include "ILogger.h"
 
 #include <Methane/IttApiHelper.h>
+#include <Methane/ThreadBuffers.hpp>
 #include <Methane/Timer.hpp>
 #include <Methane/Memory.hpp>
 
-#include <string>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace Methane
 {
@@ -39,11 +48,46 @@ class ScopeTimer : public Timer // NOSONAR - custom destructor is required
 {
 public:
     using ScopeId = uint32_t;
+    using Counter = ITT_COUNTER_TYPE(uint64_t);
 
+    // Registration keeps the scope counter address, so that timings are reported to the counter without locking
     struct Registration
     {
-        const char* name;
-        ScopeId     id;
+        const char*    name;
+        ScopeId        id;
+        const Counter* counter_ptr;
+    };
+
+    // Log-linear histogram of values in the style of HDR histogram: every power of two range of values
+    // is split to equal linear sub-buckets, so percentiles are reported with bounded relative error
+    class Histogram
+    {
+    public:
+        static constexpr uint32_t sub_buckets_bits  = 4U;
+        static constexpr uint32_t sub_buckets_count = 1U << sub_buckets_bits;
+        static constexpr uint32_t buckets_count     = (64U - sub_buckets_bits + 1U) * sub_buckets_count;
+
+        [[nodiscard]] static uint32_t GetBucketIndex(uint64_t value) noexcept;
+        [[nodiscard]] static uint64_t GetBucketMaxValue(uint32_t bucket_index) noexcept;
+
+        void Add(uint64_t value) noexcept;
+        void Merge(const Histogram& other) noexcept;
+        void Reset() noexcept;
+
+        [[nodiscard]] uint64_t GetCount() const noexcept      { return m_count; }
+        [[nodiscard]] uint64_t GetTotalValue() const noexcept { return m_total_value; }
+        [[nodiscard]] uint64_t GetMinValue() const noexcept   { return m_count ? m_min_value : 0U; }
+        [[nodiscard]] uint64_t GetMaxValue() const noexcept   { return m_max_value; }
+
+        // Returns upper bound of the bucket containing given percentile (0..100] of values, clamped to the max value
+        [[nodiscard]] uint64_t GetPercentileValue(double percentile) const noexcept;
+
+    private:
+        std::array<uint32_t, buckets_count> m_bucket_counts{ };
+        uint64_t m_count       = 0U;
+        uint64_t m_total_value = 0U;
+        uint64_t m_min_value   = std::numeric_limits<uint64_t>::max();
+        uint64_t m_max_value   = 0U;
     };
 
     class Aggregator // NOSONAR - custom destructor is required
@@ -51,12 +95,31 @@ public:
         friend class ScopeTimer;
 
     public:
-        struct Timing
+        struct ScopeStatistics
         {
-            TimeDuration duration;
-            uint32_t     count    = 0U;
+            const char*  scope_name;
+            uint64_t     count;
+            TimeDuration total_duration;
+            TimeDuration min_duration;
+            TimeDuration max_duration;
+            TimeDuration p50_duration;
+            TimeDuration p95_duration;
+            TimeDuration p99_duration;
+
+            [[nodiscard]] TimeDuration GetAverageDuration() const noexcept { return count ? total_duration / static_cast<TimeDuration::rep>(count) : TimeDuration{}; }
         };
 
+        struct FrameTiming
+        {
+            uint64_t     frame_index  = 0U;
+            uint32_t     count        = 0U;
+            TimeDuration duration     { };
+            TimeDuration max_duration { };
+        };
+
+        using Statistics   = std::vector<ScopeStatistics>; // index == ScopeId
+        using FrameTimings = std::vector<FrameTiming>;     // ordered from the oldest to the latest frame
+
         [[nodiscard]] static Aggregator& Get() noexcept;
 
         Aggregator(const Aggregator&) = delete;
@@ -69,25 +132,59 @@ public:
         void SetLogger(Ptr<ILogger> logger_ptr) noexcept             { m_logger_ptr = std::move(logger_ptr); }
         [[nodiscard]] const Ptr<ILogger>& GetLogger() const noexcept { return m_logger_ptr; }
 
+        void SetFrameWindowsCount(uint32_t frame_windows_count);
+        [[nodiscard]] uint32_t GetFrameWindowsCount() const noexcept { return m_frame_windows_count; }
+
+        // Scope registrations are kept for the whole application lifetime, so they can be cached by the callers
+        Registration RegisterScope(const char* scope_name);
+
+        // Merges timings of all threads to aggregated statistics and to the window of the completed frame
+        void CompleteFrame();
+
+        [[nodiscard]] Statistics   GetStatistics();
+        [[nodiscard]] FrameTimings GetFrameTimings(ScopeId scope_id);
+
         void LogTimings(ILogger& logger) noexcept;
+        void WriteJson(std::ostream& output_stream);
+        void WriteCsv(std::ostream& output_stream);
+
+        // Resets aggregated timings and frame windows, but keeps scope registrations
+        void Reset();
         void Flush() noexcept;
 
     protected:
-        Registration RegisterScope(const char* scope_name);
         void AddScopeTiming(const Registration& scope_registration, TimeDuration duration) noexcept;
 
     private:
-        Aggregator() = default;
+        struct ThreadTimings;
 
-        using ScopeIdByName = std::map<const char*, ScopeId>;
-        using ScopeTimings  = std::vector<Timing>; // index == ScopeId
-        using ScopeCounters = std::vector<ITT_COUNTER_TYPE(uint64_t)>; // index == ScopeId
+        struct ScopeTimings
+        {
+            Histogram    histogram;
+            FrameTiming  frame_timing;
+            FrameTimings frame_timings;
+        };
 
-        ScopeId       m_new_scope_id = 0U;
-        ScopeIdByName m_scope_id_by_name;
-        ScopeTimings  m_timing_by_scope_id;
-        ScopeCounters m_counters_by_scope_id;
-        Ptr<ILogger>  m_logger_ptr;
+        Aggregator();
+
+        void MergeThreadTimings();
+        Statistics GetStatisticsNoLock() const;
+
+        using ScopeIdByName        = std::map<std::string, ScopeId, std::less<>>;
+        using ScopeNames           = std::vector<const char*>; // index == ScopeId
+        using ScopeTimingsById     = std::vector<ScopeTimings>; // index == ScopeId
+        using ScopeCounters        = std::deque<Counter>; // index == ScopeId, deque keeps addresses of counters stable
+        using ThreadTimingsBuffers = ThreadBuffers<ThreadTimings>;
+
+        mutable std::mutex   m_mutex;
+        ScopeIdByName        m_scope_id_by_name;
+        ScopeNames           m_scope_names;
+        ScopeTimingsById     m_scope_timings;
+        ScopeCounters        m_counters_by_scope_id;
+        ThreadTimingsBuffers m_thread_timings;
+        uint64_t             m_frame_index         = 0U;
+        uint32_t             m_frame_windows_count = 120U;
+        Ptr<ILogger>         m_logger_ptr;
     };
 
     template<typename TLogger>
@@ -97,6 +194,7 @@ public:
     }
 
     explicit ScopeTimer(const char* scope_name);
+    explicit ScopeTimer(const Registration& scope_registration);
     ScopeTimer(const ScopeTimer&) = delete;
     ScopeTimer(ScopeTimer&&) = delete;
     ~ScopeTimer();
@@ -120,8 +218,11 @@ private:
 #ifdef METHANE_SCOPE_TIMERS_ENABLED
 
 #define META_SCOPE_TIMERS_INITIALIZE(LOGGER_TYPE) Methane::ScopeTimer::InitializeLogger<LOGGER_TYPE>()
-#define META_SCOPE_TIMER(SCOPE_NAME) Methane::ScopeTimer scope_timer(SCOPE_NAME)
+#define META_SCOPE_TIMER(SCOPE_NAME) \
+    static const Methane::ScopeTimer::Registration s_scope_timer_registration = Methane::ScopeTimer::Aggregator::Get().RegisterScope(SCOPE_NAME); \
+    Methane::ScopeTimer scope_timer(s_scope_timer_registration)
 #define META_FUNCTION_TIMER() META_SCOPE_TIMER(__func__)
+#define META_SCOPE_TIMERS_FRAME_COMPLETE() Methane::ScopeTimer::Aggregator::Get().CompleteFrame()
 #define META_SCOPE_TIMERS_FLUSH() Methane::ScopeTimer::Aggregator::Get().Flush()
 
 #else // ifdef METHANE_SCOPE_TIMERS_ENABLED
@@ -129,6 +230,7 @@ private:
 #define META_SCOPE_TIMERS_INITIALIZE(LOGGER_TYPE)
 #define META_SCOPE_TIMER(SCOPE_NAME)
 #define META_FUNCTION_TIMER()
+#define META_SCOPE_TIMERS_FRAME_COMPLETE()
 #define META_SCOPE_TIMERS_FLUSH()
 
 #endif // ifdef METHANE_SCOPE_TIMERS_ENABLED
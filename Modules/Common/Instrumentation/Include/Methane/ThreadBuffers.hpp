@@ -0,0 +1,122 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/ThreadBuffers.hpp
+Registry of per-thread buffers written by the owning threads without contention
+and read by other threads under the buffer spin lock.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Methane
+{
+
+// Buffer data is written only by the owning thread without contention,
+// the lock flag is taken by other threads only when buffer data is read
+struct ThreadBuffer
+{
+    std::atomic_flag lock_flag;
+    uint32_t         thread_index = 0U; // order of the thread buffer registration
+};
+
+class ThreadBufferLock
+{
+public:
+    explicit ThreadBufferLock(ThreadBuffer& thread_buffer) noexcept
+        : m_lock_flag(thread_buffer.lock_flag)
+    {
+        while (m_lock_flag.test_and_set(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ~ThreadBufferLock()
+    {
+        m_lock_flag.clear(std::memory_order_release);
+    }
+
+    ThreadBufferLock(const ThreadBufferLock&) = delete;
+    ThreadBufferLock(ThreadBufferLock&&) = delete;
+    ThreadBufferLock& operator=(const ThreadBufferLock&) = delete;
+    ThreadBufferLock& operator=(ThreadBufferLock&&) = delete;
+
+private:
+    std::atomic_flag& m_lock_flag;
+};
+
+// Thread buffers are owned by the registry and are never released, so data of the finished threads is still read.
+// Buffer of the current thread is cached in thread local storage per buffer type,
+// so a single registry of every buffer type is supported, which is owned by the singleton.
+template<typename ThreadBufferType>
+class ThreadBuffers
+{
+public:
+    // Returns buffer of the current thread or null, when it was not created yet
+    [[nodiscard]] ThreadBufferType* GetCurrentThreadBufferPtr() const noexcept
+    {
+        return GetCachedBufferPtr();
+    }
+
+    // Returns buffer of the current thread, which is created on the first call in this thread
+    ThreadBufferType& GetCurrentThreadBuffer()
+    {
+        ThreadBufferType*& buffer_ptr = GetCachedBufferPtr();
+        if (buffer_ptr)
+            return *buffer_ptr;
+
+        std::scoped_lock lock(m_mutex);
+        auto new_buffer_ptr = std::make_unique<ThreadBufferType>();
+        new_buffer_ptr->thread_index = static_cast<uint32_t>(m_buffer_ptrs.size());
+        buffer_ptr = m_buffer_ptrs.emplace_back(std::move(new_buffer_ptr)).get();
+        return *buffer_ptr;
+    }
+
+    // Calls function for every thread buffer locked with the spin lock
+    template<typename FunctionType>
+    void ForEachLocked(const FunctionType& function)
+    {
+        std::scoped_lock lock(m_mutex);
+        for (const UniquePtr<ThreadBufferType>& buffer_ptr : m_buffer_ptrs)
+        {
+            ThreadBufferLock buffer_lock(*buffer_ptr);
+            function(*buffer_ptr);
+        }
+    }
+
+private:
+    [[nodiscard]] static ThreadBufferType*& GetCachedBufferPtr() noexcept
+    {
+        thread_local ThreadBufferType* s_buffer_ptr = nullptr;
+        return s_buffer_ptr;
+    }
+
+    std::mutex                               m_mutex;
+    std::vector<UniquePtr<ThreadBufferType>> m_buffer_ptrs;
+};
+
+} // namespace Methane
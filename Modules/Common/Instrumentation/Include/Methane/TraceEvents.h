@@ -0,0 +1,163 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TraceEvents.h
+Built-in trace events recorder of instrumented scopes and frame delimiters
+to per-thread ring buffers with export to Chrome / Perfetto JSON trace format.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/ThreadBuffers.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Methane
+{
+
+class TraceEventsRecorder
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class EventType : uint8_t
+    {
+        Scope,
+        Frame
+    };
+
+    struct Event
+    {
+        const char* name;         // string with static storage duration
+        uint64_t    start_ns;     // time since recorder creation
+        uint64_t    duration_ns;  // zero for frame events
+        uint32_t    frame_index;
+        uint32_t    frame_buffer_index;
+        EventType   type;
+    };
+
+    using Events = std::vector<Event>;
+
+    // Ring buffer of every thread keeps only the latest events, when its capacity is exceeded
+    static constexpr uint32_t thread_events_capacity = 1U << 14U;
+
+    // Recorder singleton is never destroyed to let instrumented code run in static destructors,
+    // trace events are flushed to the output file on exit by a separate static object
+    [[nodiscard]] static TraceEventsRecorder& Get() noexcept;
+
+    TraceEventsRecorder(const TraceEventsRecorder&) = delete;
+    TraceEventsRecorder(TraceEventsRecorder&&) = delete;
+
+    TraceEventsRecorder& operator=(const TraceEventsRecorder&) = delete;
+    TraceEventsRecorder& operator=(TraceEventsRecorder&&) = delete;
+
+    // Trace events are written to the output file on flush or when application exits
+    void SetOutputFilePath(std::string_view file_path);
+    [[nodiscard]] std::string GetOutputFilePath() const;
+
+    [[nodiscard]] uint64_t GetTimestamp() const noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start_time).count());
+    }
+
+    // Events buffer of the current thread is allocated on registration, by setting thread name or adding frame event;
+    // scope events are added without allocation and are dropped in threads without events buffer
+    void RegisterThread();
+    void SetThreadName(std::string_view thread_name);
+    void AddScopeEvent(const char* name, uint64_t start_ns, uint64_t end_ns) noexcept;
+    void AddFrameEvent(uint32_t frame_buffer_index, uint32_t frame_index);
+
+    // Returns events of the current thread ordered from the oldest to the latest one
+    [[nodiscard]] Events GetCurrentThreadEvents();
+
+    void WriteChromeJson(std::ostream& output_stream);
+    void Clear();
+    void Flush() noexcept;
+
+private:
+    struct ThreadEvents;
+
+    TraceEventsRecorder();
+
+    using ThreadEventsBuffers = ThreadBuffers<ThreadEvents>;
+
+    const Clock::time_point m_start_time = Clock::now();
+    mutable std::mutex      m_mutex;
+    ThreadEventsBuffers     m_thread_events;
+    std::string             m_output_file_path;
+};
+
+class TraceEventsScope // NOSONAR - custom destructor is required
+{
+public:
+    explicit TraceEventsScope(const char* name)
+        : m_recorder(TraceEventsRecorder::Get())
+        , m_name(name)
+        , m_start_ns(m_recorder.GetTimestamp())
+    {
+        // Events buffer is allocated on scope entry, so that scope event is added on exit without allocation
+        m_recorder.RegisterThread();
+    }
+
+    ~TraceEventsScope()
+    {
+        m_recorder.AddScopeEvent(m_name, m_start_ns, m_recorder.GetTimestamp());
+    }
+
+    TraceEventsScope(const TraceEventsScope&) = delete;
+    TraceEventsScope(TraceEventsScope&&) = delete;
+    TraceEventsScope& operator=(const TraceEventsScope&) = delete;
+    TraceEventsScope& operator=(TraceEventsScope&&) = delete;
+
+private:
+    TraceEventsRecorder& m_recorder;
+    const char*          m_name;
+    const uint64_t       m_start_ns;
+};
+
+} // namespace Methane
+
+#ifdef METHANE_TRACE_EVENTS_ENABLED
+
+#define TRACE_EVENTS_SCOPE(/*const char* */name) \
+    const Methane::TraceEventsScope trace_events_scope(name)
+#define TRACE_EVENTS_FRAME(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index) \
+    Methane::TraceEventsRecorder::Get().AddFrameEvent(frame_buffer_index, frame_index)
+#define TRACE_EVENTS_THREAD_NAME(/*const char* */name) \
+    Methane::TraceEventsRecorder::Get().SetThreadName(name)
+#define META_TRACE_EVENTS_OUTPUT_FILE(/*std::string_view*/file_path) \
+    Methane::TraceEventsRecorder::Get().SetOutputFilePath(file_path)
+#define META_TRACE_EVENTS_FLUSH() \
+    Methane::TraceEventsRecorder::Get().Flush()
+
+#else // ifdef METHANE_TRACE_EVENTS_ENABLED
+
+#define TRACE_EVENTS_SCOPE(/*const char* */name)
+#define TRACE_EVENTS_FRAME(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index)
+#define TRACE_EVENTS_THREAD_NAME(/*const char* */name)
+#define META_TRACE_EVENTS_OUTPUT_FILE(/*std::string_view*/file_path)
+#define META_TRACE_EVENTS_FLUSH()
+
+#endif // ifdef METHANE_TRACE_EVENTS_ENABLED
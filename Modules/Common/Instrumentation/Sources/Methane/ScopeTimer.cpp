@@ -17,20 +17,156 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/ScopeTimer.cpp
-Code scope measurement timer with aggregating and averaging of timings.
+Code scope measurement timer with per-thread aggregation of timings
+to latency histograms, per-frame windows and text, JSON or CSV reports.
 
 ******************************************************************************/
 
 #include <Methane/ScopeTimer.h>
 #include <Methane/Instrumentation.h>
 
-#include <sstream>
-#include <chrono>
+#include <algorithm>
+#include <bit>
 #include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string_view>
 
 namespace Methane
 {
 
+struct ScopeTimer::Aggregator::ThreadTimings : ThreadBuffer
+{
+    std::vector<Histogram> histograms; // index == ScopeId
+};
+
+namespace
+{
+
+[[nodiscard]] uint64_t GetNanoseconds(Timer::TimeDuration duration) noexcept
+{
+    return static_cast<uint64_t>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+}
+
+[[nodiscard]] Timer::TimeDuration GetDuration(uint64_t nanoseconds) noexcept
+{
+    return std::chrono::duration_cast<Timer::TimeDuration>(std::chrono::nanoseconds(nanoseconds));
+}
+
+[[nodiscard]] double GetMilliseconds(Timer::TimeDuration duration) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+}
+
+void WriteJsonString(std::ostream& output_stream, std::string_view text)
+{
+    output_stream << '"';
+    for (const char character : text)
+    {
+        switch (character)
+        {
+        case '"':  output_stream << "\\\""; break;
+        case '\\': output_stream << "\\\\"; break;
+        case '\n': output_stream << "\\n";  break;
+        case '\t': output_stream << "\\t";  break;
+        default:   output_stream << character;
+        }
+    }
+    output_stream << '"';
+}
+
+void WriteCsvString(std::ostream& output_stream, std::string_view text)
+{
+    output_stream << '"';
+    for (const char character : text)
+    {
+        if (character == '"')
+            output_stream << '"';
+        output_stream << character;
+    }
+    output_stream << '"';
+}
+
+} // anonymous namespace
+
+uint32_t ScopeTimer::Histogram::GetBucketIndex(uint64_t value) noexcept
+{
+    if (value < sub_buckets_count)
+        return static_cast<uint32_t>(value);
+
+    // Values of each power of two range [2^msb, 2^(msb+1)) are split to sub-buckets by the highest bits following the most significant bit
+    const auto     msb_index = static_cast<uint32_t>(std::bit_width(value)) - 1U;
+    const uint32_t shift     = msb_index - sub_buckets_bits;
+    const auto     sub_index = static_cast<uint32_t>(value >> shift) - sub_buckets_count;
+    return (shift + 1U) * sub_buckets_count + sub_index;
+}
+
+uint64_t ScopeTimer::Histogram::GetBucketMaxValue(uint32_t bucket_index) noexcept
+{
+    if (bucket_index < sub_buckets_count)
+        return bucket_index;
+
+    const uint32_t shift     = bucket_index / sub_buckets_count - 1U;
+    const uint64_t sub_value = sub_buckets_count + bucket_index % sub_buckets_count;
+    return ((sub_value + 1U) << shift) - 1U; // wraps to the max value for the last bucket
+}
+
+void ScopeTimer::Histogram::Add(uint64_t value) noexcept
+{
+    m_bucket_counts[GetBucketIndex(value)]++;
+    m_count++;
+    m_total_value += value;
+    m_min_value = std::min(m_min_value, value);
+    m_max_value = std::max(m_max_value, value);
+}
+
+void ScopeTimer::Histogram::Merge(const Histogram& other) noexcept
+{
+    if (!other.m_count)
+        return;
+
+    for (uint32_t bucket_index = 0U; bucket_index < buckets_count; ++bucket_index)
+    {
+        m_bucket_counts[bucket_index] += other.m_bucket_counts[bucket_index];
+    }
+    m_count       += other.m_count;
+    m_total_value += other.m_total_value;
+    m_min_value    = std::min(m_min_value, other.m_min_value);
+    m_max_value    = std::max(m_max_value, other.m_max_value);
+}
+
+void ScopeTimer::Histogram::Reset() noexcept
+{
+    if (!m_count)
+        return;
+
+    m_bucket_counts.fill(0U);
+    m_count       = 0U;
+    m_total_value = 0U;
+    m_min_value   = std::numeric_limits<uint64_t>::max();
+    m_max_value   = 0U;
+}
+
+uint64_t ScopeTimer::Histogram::GetPercentileValue(double percentile) const noexcept
+{
+    if (!m_count)
+        return 0U;
+
+    const double   clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+    const auto     target_count       = std::max<uint64_t>(1U, static_cast<uint64_t>(std::ceil(clamped_percentile * static_cast<double>(m_count) / 100.0)));
+    uint64_t       accumulated_count  = 0U;
+    for (uint32_t bucket_index = 0U; bucket_index < buckets_count; ++bucket_index)
+    {
+        accumulated_count += m_bucket_counts[bucket_index];
+        if (accumulated_count >= target_count)
+            return std::clamp(GetBucketMaxValue(bucket_index), GetMinValue(), m_max_value);
+    }
+    return m_max_value;
+}
+
 ScopeTimer::Aggregator& ScopeTimer::Aggregator::Get() noexcept
 {
     META_FUNCTION_TASK();
@@ -38,91 +174,290 @@ ScopeTimer::Aggregator& ScopeTimer::Aggregator::Get() noexcept
     return s_scope_aggregator;
 }
 
+ScopeTimer::Aggregator::Aggregator() = default;
+
 ScopeTimer::Aggregator::~Aggregator()
 {
     META_FUNCTION_TASK();
     Flush();
 }
 
-void ScopeTimer::Aggregator::Flush() noexcept
+void ScopeTimer::Aggregator::SetFrameWindowsCount(uint32_t frame_windows_count)
 {
     META_FUNCTION_TASK();
-    if (m_logger_ptr)
+    std::scoped_lock lock(m_mutex);
+    m_frame_windows_count = frame_windows_count;
+    for (ScopeTimings& scope_timings : m_scope_timings)
     {
-        LogTimings(*m_logger_ptr);
+        if (scope_timings.frame_timings.size() > frame_windows_count)
+        {
+            scope_timings.frame_timings.erase(scope_timings.frame_timings.begin(),
+                                              scope_timings.frame_timings.end() - frame_windows_count);
+        }
     }
+}
+
+ScopeTimer::Registration ScopeTimer::Aggregator::RegisterScope(const char* scope_name)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    if (const auto scope_id_it = m_scope_id_by_name.find(std::string_view(scope_name));
+        scope_id_it != m_scope_id_by_name.end())
+        return Registration{ scope_id_it->first.c_str(), scope_id_it->second, &m_counters_by_scope_id[scope_id_it->second] };
 
-    m_timing_by_scope_id.clear();
-    m_scope_id_by_name.clear();
-    m_new_scope_id = 0U;
+    const auto scope_id = static_cast<ScopeId>(m_scope_names.size());
+    const auto [ scope_name_and_id_it, scope_added ] = m_scope_id_by_name.try_emplace(scope_name, scope_id);
+    assert(scope_added);
+
+    const char* registered_scope_name = scope_name_and_id_it->first.c_str();
+    m_scope_names.push_back(registered_scope_name);
+    m_scope_timings.emplace_back();
+    const Counter& scope_counter = m_counters_by_scope_id.emplace_back(ITT_COUNTER_INIT(registered_scope_name, g_methane_itt_domain_name));
+#ifdef TRACY_ENABLE
+    TracyPlotConfig(registered_scope_name, tracy::PlotFormatType::Number, false, false, 0);
+#endif
+    return Registration{ registered_scope_name, scope_id, &scope_counter };
+}
+
+void ScopeTimer::Aggregator::AddScopeTiming(const Registration& scope_registration, TimeDuration duration) noexcept
+{
+    META_FUNCTION_TASK();
+    const uint64_t duration_ns = GetNanoseconds(duration);
+
+    ITT_COUNTER_VALUE((*scope_registration.counter_ptr), duration_ns);
+
+#ifdef TRACY_ENABLE
+    TracyPlot(scope_registration.name, static_cast<int64_t>(duration_ns));
+#endif
+
+    ThreadTimings& thread_timings = m_thread_timings.GetCurrentThreadBuffer();
+    ThreadBufferLock thread_lock(thread_timings);
+    if (scope_registration.id >= thread_timings.histograms.size())
+    {
+        thread_timings.histograms.resize(scope_registration.id + 1U);
+    }
+    thread_timings.histograms[scope_registration.id].Add(duration_ns);
+}
+
+void ScopeTimer::Aggregator::CompleteFrame()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    MergeThreadTimings();
+
+    for (ScopeTimings& scope_timings : m_scope_timings)
+    {
+        FrameTiming& frame_timing = scope_timings.frame_timing;
+        if (!frame_timing.count || !m_frame_windows_count)
+        {
+            frame_timing = {};
+            continue;
+        }
+
+        frame_timing.frame_index = m_frame_index;
+        if (scope_timings.frame_timings.size() >= m_frame_windows_count)
+        {
+            scope_timings.frame_timings.erase(scope_timings.frame_timings.begin());
+        }
+        scope_timings.frame_timings.push_back(frame_timing);
+        frame_timing = {};
+    }
+    m_frame_index++;
+}
+
+ScopeTimer::Aggregator::Statistics ScopeTimer::Aggregator::GetStatistics()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    MergeThreadTimings();
+    return GetStatisticsNoLock();
+}
+
+ScopeTimer::Aggregator::FrameTimings ScopeTimer::Aggregator::GetFrameTimings(ScopeId scope_id)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    return scope_id < m_scope_timings.size() ? m_scope_timings[scope_id].frame_timings : FrameTimings{};
 }
 
 void ScopeTimer::Aggregator::LogTimings(ILogger& logger) noexcept
 {
     META_FUNCTION_TASK();
-    if (m_timing_by_scope_id.empty())
+    const Statistics statistics = GetStatistics();
+    if (std::ranges::none_of(statistics, [](const ScopeStatistics& scope_statistics) { return scope_statistics.count > 0U; }))
         return;
 
     std::stringstream ss;
     ss << std::endl << "Aggregated performance timings:" << std::endl;
 
-    for (const auto& [scope_name, scope_id] : m_scope_id_by_name)
+    for (const ScopeStatistics& scope_statistics : statistics)
     {
-        if (scope_id >= m_timing_by_scope_id.size())
+        if (!scope_statistics.count)
             continue;
 
-        const Timing& scope_timing = m_timing_by_scope_id[scope_id];
-        const double total_duration_sec = std::chrono::duration_cast<std::chrono::duration<double>>(scope_timing.duration).count();
-        const double average_duration_ms = total_duration_sec * 1000.0 / scope_timing.count;
-
-        ss << "  - "       << scope_name
-           << ": "         << std::fixed << average_duration_ms
-           << " ms. with " << scope_timing.count
+        ss << "  - "         << scope_statistics.scope_name
+           << ": "           << std::fixed << GetMilliseconds(scope_statistics.GetAverageDuration())
+           << " ms. avg, "   << GetMilliseconds(scope_statistics.p50_duration)
+           << " ms. p50, "   << GetMilliseconds(scope_statistics.p95_duration)
+           << " ms. p95, "   << GetMilliseconds(scope_statistics.p99_duration)
+           << " ms. p99, "   << GetMilliseconds(scope_statistics.max_duration)
+           << " ms. max with " << scope_statistics.count
            << " invocations count;" << std::endl;
     }
 
     logger.Log(ss.str());
 }
 
-ScopeTimer::Registration ScopeTimer::Aggregator::RegisterScope(const char* scope_name)
+void ScopeTimer::Aggregator::WriteJson(std::ostream& output_stream)
 {
     META_FUNCTION_TASK();
-    const auto [ scope_name_and_id_it, scope_added ] = m_scope_id_by_name.try_emplace(scope_name, m_new_scope_id);
-    if (scope_added)
+    std::scoped_lock lock(m_mutex);
+    MergeThreadTimings();
+
+    const Statistics statistics = GetStatisticsNoLock();
+    output_stream << std::fixed << std::setprecision(6)
+                  << "{\"frames_count\":" << m_frame_index << ",\"scopes\":[";
+
+    bool is_first_scope = true;
+    for (ScopeId scope_id = 0U; scope_id < statistics.size(); ++scope_id)
     {
-        m_new_scope_id++;
-        m_timing_by_scope_id.resize(m_new_scope_id);
-        m_counters_by_scope_id.emplace_back(ITT_COUNTER_INIT(scope_name_and_id_it->first, g_methane_itt_domain_name));
-#ifdef TRACY_ENABLE
-        TracyPlotConfig(scope_name_and_id_it->first, tracy::PlotFormatType::Number, false, false, 0);
-#endif
+        const ScopeStatistics& scope_statistics = statistics[scope_id];
+        if (!scope_statistics.count)
+            continue;
+
+        output_stream << (is_first_scope ? "" : ",") << "{\"name\":";
+        WriteJsonString(output_stream, scope_statistics.scope_name);
+        output_stream << ",\"count\":"      << scope_statistics.count
+                      << ",\"total_ms\":"   << GetMilliseconds(scope_statistics.total_duration)
+                      << ",\"average_ms\":" << GetMilliseconds(scope_statistics.GetAverageDuration())
+                      << ",\"min_ms\":"     << GetMilliseconds(scope_statistics.min_duration)
+                      << ",\"p50_ms\":"     << GetMilliseconds(scope_statistics.p50_duration)
+                      << ",\"p95_ms\":"     << GetMilliseconds(scope_statistics.p95_duration)
+                      << ",\"p99_ms\":"     << GetMilliseconds(scope_statistics.p99_duration)
+                      << ",\"max_ms\":"     << GetMilliseconds(scope_statistics.max_duration)
+                      << ",\"frames\":[";
+
+        bool is_first_frame = true;
+        for (const FrameTiming& frame_timing : m_scope_timings[scope_id].frame_timings)
+        {
+            output_stream << (is_first_frame ? "" : ",")
+                          << "{\"frame\":"    << frame_timing.frame_index
+                          << ",\"count\":"    << frame_timing.count
+                          << ",\"total_ms\":" << GetMilliseconds(frame_timing.duration)
+                          << ",\"max_ms\":"   << GetMilliseconds(frame_timing.max_duration)
+                          << "}";
+            is_first_frame = false;
+        }
+        output_stream << "]}";
+        is_first_scope = false;
     }
-    return Registration{ scope_name_and_id_it->first, scope_name_and_id_it->second };
+    output_stream << "]}";
 }
 
-void ScopeTimer::Aggregator::AddScopeTiming(const Registration& scope_registration, TimeDuration duration) noexcept
+void ScopeTimer::Aggregator::WriteCsv(std::ostream& output_stream)
 {
     META_FUNCTION_TASK();
-    ITT_COUNTER_VALUE(m_counters_by_scope_id[scope_registration.id], std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    const Statistics statistics = GetStatistics();
+    output_stream << std::fixed << std::setprecision(6)
+                  << "scope,count,total_ms,average_ms,min_ms,p50_ms,p95_ms,p99_ms,max_ms" << std::endl;
 
-#ifdef TRACY_ENABLE
-    TracyPlot(scope_registration.name, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
-#endif
+    for (const ScopeStatistics& scope_statistics : statistics)
+    {
+        if (!scope_statistics.count)
+            continue;
+
+        WriteCsvString(output_stream, scope_statistics.scope_name);
+        output_stream << ',' << scope_statistics.count
+                      << ',' << GetMilliseconds(scope_statistics.total_duration)
+                      << ',' << GetMilliseconds(scope_statistics.GetAverageDuration())
+                      << ',' << GetMilliseconds(scope_statistics.min_duration)
+                      << ',' << GetMilliseconds(scope_statistics.p50_duration)
+                      << ',' << GetMilliseconds(scope_statistics.p95_duration)
+                      << ',' << GetMilliseconds(scope_statistics.p99_duration)
+                      << ',' << GetMilliseconds(scope_statistics.max_duration)
+                      << std::endl;
+    }
+}
+
+void ScopeTimer::Aggregator::Reset()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    MergeThreadTimings();
 
-    if (scope_registration.id >= m_timing_by_scope_id.size())
+    for (ScopeTimings& scope_timings : m_scope_timings)
     {
-        assert(false);
-        return;
+        scope_timings.histogram.Reset();
+        scope_timings.frame_timing = {};
+        scope_timings.frame_timings.clear();
     }
+    m_frame_index = 0U;
+}
 
-    Timing& scope_timing = m_timing_by_scope_id[scope_registration.id];
-    scope_timing.count++;
-    scope_timing.duration += duration;
+void ScopeTimer::Aggregator::Flush() noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_logger_ptr)
+    {
+        LogTimings(*m_logger_ptr);
+    }
+    Reset();
+}
+
+void ScopeTimer::Aggregator::MergeThreadTimings()
+{
+    META_FUNCTION_TASK();
+    m_thread_timings.ForEachLocked([this](ThreadTimings& thread_timings)
+    {
+        std::vector<Histogram>& thread_histograms = thread_timings.histograms;
+        for (ScopeId scope_id = 0U; scope_id < thread_histograms.size(); ++scope_id)
+        {
+            Histogram& thread_histogram = thread_histograms[scope_id];
+            if (!thread_histogram.GetCount() || scope_id >= m_scope_timings.size())
+                continue;
+
+            ScopeTimings& scope_timings = m_scope_timings[scope_id];
+            scope_timings.histogram.Merge(thread_histogram);
+
+            FrameTiming& frame_timing = scope_timings.frame_timing;
+            frame_timing.count       += static_cast<uint32_t>(thread_histogram.GetCount());
+            frame_timing.duration    += GetDuration(thread_histogram.GetTotalValue());
+            frame_timing.max_duration = std::max(frame_timing.max_duration, GetDuration(thread_histogram.GetMaxValue()));
+
+            thread_histogram.Reset();
+        }
+    });
+}
+
+ScopeTimer::Aggregator::Statistics ScopeTimer::Aggregator::GetStatisticsNoLock() const
+{
+    META_FUNCTION_TASK();
+    Statistics statistics;
+    statistics.reserve(m_scope_timings.size());
+    for (ScopeId scope_id = 0U; scope_id < m_scope_timings.size(); ++scope_id)
+    {
+        const Histogram& histogram = m_scope_timings[scope_id].histogram;
+        statistics.push_back(ScopeStatistics{
+            m_scope_names[scope_id],
+            histogram.GetCount(),
+            GetDuration(histogram.GetTotalValue()),
+            GetDuration(histogram.GetMinValue()),
+            GetDuration(histogram.GetMaxValue()),
+            GetDuration(histogram.GetPercentileValue(50.0)),
+            GetDuration(histogram.GetPercentileValue(95.0)),
+            GetDuration(histogram.GetPercentileValue(99.0))
+        });
+    }
+    return statistics;
 }
 
 ScopeTimer::ScopeTimer(const char* scope_name)
+    : ScopeTimer(Aggregator::Get().RegisterScope(scope_name))
+{ }
+
+ScopeTimer::ScopeTimer(const Registration& scope_registration)
     : Timer()
-    , m_registration(Aggregator::Get().RegisterScope(scope_name))
+    , m_registration(scope_registration)
 { }
 
 ScopeTimer::~ScopeTimer()
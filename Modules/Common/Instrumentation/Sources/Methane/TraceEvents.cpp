@@ -0,0 +1,260 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TraceEvents.cpp
+Built-in trace events recorder of instrumented scopes and frame delimiters
+to per-thread ring buffers with export to Chrome / Perfetto JSON trace format.
+
+NOTE:
+    Functions of this file are not instrumented with META_FUNCTION_TASK,
+    since they are called from the instrumentation macros themselves.
+
+******************************************************************************/
+
+#include <Methane/TraceEvents.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <tuple>
+
+namespace Methane
+{
+
+struct TraceEventsRecorder::ThreadEvents : ThreadBuffer
+{
+    ThreadEvents()
+        : events(thread_events_capacity)
+    { }
+
+    [[nodiscard]] Events GetOrderedEvents() const
+    {
+        const auto events_count = static_cast<uint32_t>(std::min<uint64_t>(written_count, thread_events_capacity));
+        Events ordered_events;
+        ordered_events.reserve(events_count);
+        for (uint64_t event_index = written_count - events_count; event_index < written_count; ++event_index)
+        {
+            ordered_events.push_back(events[event_index % thread_events_capacity]);
+        }
+        return ordered_events;
+    }
+
+    void AddEvent(const Event& event) noexcept
+    {
+        events[written_count % thread_events_capacity] = event;
+        written_count++;
+    }
+
+    std::string thread_name;
+    Events      events;
+    uint64_t    written_count = 0U;
+};
+
+namespace
+{
+
+class TraceEventsExitFlusher // NOSONAR - custom destructor is required
+{
+public:
+    explicit TraceEventsExitFlusher(TraceEventsRecorder& recorder) noexcept
+        : m_recorder(recorder)
+    { }
+
+    ~TraceEventsExitFlusher() { m_recorder.Flush(); }
+
+    TraceEventsExitFlusher(const TraceEventsExitFlusher&) = delete;
+    TraceEventsExitFlusher(TraceEventsExitFlusher&&) = delete;
+    TraceEventsExitFlusher& operator=(const TraceEventsExitFlusher&) = delete;
+    TraceEventsExitFlusher& operator=(TraceEventsExitFlusher&&) = delete;
+
+private:
+    TraceEventsRecorder& m_recorder;
+};
+
+// Chrome trace event timestamps and durations are measured in microseconds
+[[nodiscard]] double GetMicroseconds(uint64_t nanoseconds) noexcept
+{
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+
+void WriteJsonString(std::ostream& output_stream, std::string_view text)
+{
+    output_stream << '"';
+    for (const char character : text)
+    {
+        switch (character)
+        {
+        case '"':  output_stream << "\\\""; break;
+        case '\\': output_stream << "\\\\"; break;
+        case '\n': output_stream << "\\n";  break;
+        case '\t': output_stream << "\\t";  break;
+        default:   output_stream << character;
+        }
+    }
+    output_stream << '"';
+}
+
+} // anonymous namespace
+
+TraceEventsRecorder& TraceEventsRecorder::Get() noexcept
+{
+    static TraceEventsRecorder* const s_recorder_ptr = new TraceEventsRecorder(); // NOSONAR - intentionally never deleted
+    static const TraceEventsExitFlusher s_exit_flusher(*s_recorder_ptr);
+    return *s_recorder_ptr;
+}
+
+TraceEventsRecorder::TraceEventsRecorder() = default;
+
+void TraceEventsRecorder::SetOutputFilePath(std::string_view file_path)
+{
+    std::scoped_lock lock(m_mutex);
+    m_output_file_path = file_path;
+}
+
+std::string TraceEventsRecorder::GetOutputFilePath() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_output_file_path;
+}
+
+void TraceEventsRecorder::RegisterThread()
+{
+    std::ignore = m_thread_events.GetCurrentThreadBuffer();
+}
+
+void TraceEventsRecorder::SetThreadName(std::string_view thread_name)
+{
+    ThreadEvents& thread_events = m_thread_events.GetCurrentThreadBuffer();
+    ThreadBufferLock thread_lock(thread_events);
+    thread_events.thread_name = thread_name;
+}
+
+void TraceEventsRecorder::AddScopeEvent(const char* name, uint64_t start_ns, uint64_t end_ns) noexcept
+{
+    // Scope event is dropped when events buffer was not allocated for this thread, since it can not be allocated here
+    ThreadEvents* thread_events_ptr = m_thread_events.GetCurrentThreadBufferPtr();
+    if (!thread_events_ptr)
+        return;
+
+    ThreadBufferLock thread_lock(*thread_events_ptr);
+    thread_events_ptr->AddEvent(Event{
+        name, start_ns, end_ns > start_ns ? end_ns - start_ns : 0U, 0U, 0U, EventType::Scope
+    });
+}
+
+void TraceEventsRecorder::AddFrameEvent(uint32_t frame_buffer_index, uint32_t frame_index)
+{
+    const uint64_t timestamp_ns = GetTimestamp();
+    ThreadEvents& thread_events = m_thread_events.GetCurrentThreadBuffer();
+    ThreadBufferLock thread_lock(thread_events);
+    thread_events.AddEvent(Event{
+        "Frame", timestamp_ns, 0U, frame_index, frame_buffer_index, EventType::Frame
+    });
+}
+
+TraceEventsRecorder::Events TraceEventsRecorder::GetCurrentThreadEvents()
+{
+    ThreadEvents& thread_events = m_thread_events.GetCurrentThreadBuffer();
+    ThreadBufferLock thread_lock(thread_events);
+    return thread_events.GetOrderedEvents();
+}
+
+void TraceEventsRecorder::WriteChromeJson(std::ostream& output_stream)
+{
+    // Thread events are copied to release thread locks before writing to the stream
+    struct ThreadEventsCopy
+    {
+        uint32_t    thread_id;
+        std::string thread_name;
+        Events      events;
+    };
+    std::vector<ThreadEventsCopy> threads_events;
+    m_thread_events.ForEachLocked([&threads_events](const ThreadEvents& thread_events)
+    {
+        threads_events.push_back({ thread_events.thread_index + 1U, thread_events.thread_name, thread_events.GetOrderedEvents() });
+    });
+
+    output_stream << std::fixed << std::setprecision(3)
+                  << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool is_first_event = true;
+    for (const auto& [thread_id, thread_name, events] : threads_events)
+    {
+        if (!thread_name.empty())
+        {
+            output_stream << (is_first_event ? "" : ",")
+                          << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread_id
+                          << ",\"args\":{\"name\":";
+            WriteJsonString(output_stream, thread_name);
+            output_stream << "}}";
+            is_first_event = false;
+        }
+
+        for (const Event& event : events)
+        {
+            output_stream << (is_first_event ? "" : ",") << "{\"name\":";
+            WriteJsonString(output_stream, event.name ? event.name : "");
+            switch (event.type)
+            {
+            case EventType::Scope:
+                output_stream << ",\"cat\":\"Methane\",\"ph\":\"X\",\"ts\":" << GetMicroseconds(event.start_ns)
+                              << ",\"dur\":" << GetMicroseconds(event.duration_ns);
+                break;
+            case EventType::Frame:
+                output_stream << ",\"cat\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":" << GetMicroseconds(event.start_ns)
+                              << ",\"args\":{\"frame_index\":" << event.frame_index
+                              << ",\"frame_buffer_index\":" << event.frame_buffer_index << "}";
+                break;
+            }
+            output_stream << ",\"pid\":1,\"tid\":" << thread_id << "}";
+            is_first_event = false;
+        }
+    }
+    output_stream << "]}";
+}
+
+void TraceEventsRecorder::Clear()
+{
+    m_thread_events.ForEachLocked([](ThreadEvents& thread_events)
+    {
+        thread_events.written_count = 0U;
+    });
+}
+
+void TraceEventsRecorder::Flush() noexcept
+{
+    try
+    {
+        const std::string output_file_path = GetOutputFilePath();
+        if (output_file_path.empty())
+            return;
+
+        std::ofstream output_file(output_file_path);
+        if (output_file.is_open())
+        {
+            WriteChromeJson(output_file);
+        }
+    }
+    catch(...)
+    {
+        // Trace events can not be written, but application exit should not be interrupted
+    }
+}
+
+} // namespace Methane
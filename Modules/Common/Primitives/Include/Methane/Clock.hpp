@@ -0,0 +1,126 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Clock.hpp
+Pluggable time sources for timers and animations: real-time clock,
+fixed time-step clock for deterministic simulation and recorded clock for frame replay.
+
+******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+namespace Methane
+{
+
+struct IClock
+{
+    using StdClock     = std::chrono::high_resolution_clock;
+    using TimePoint    = StdClock::time_point;
+    using TimeDuration = StdClock::duration;
+
+    [[nodiscard]] virtual TimePoint Now() const noexcept = 0;
+
+    // Called once per frame by the owner of the clock to advance simulation time
+    virtual void Tick() { /* real-time clock advances by itself */ }
+
+    virtual ~IClock() = default;
+};
+
+class RealClock final
+    : public IClock
+{
+public:
+    [[nodiscard]] static const RealClock& Get() noexcept
+    {
+        static const RealClock s_real_clock;
+        return s_real_clock;
+    }
+
+    [[nodiscard]] TimePoint Now() const noexcept override { return StdClock::now(); }
+};
+
+class FixedStepClock final
+    : public IClock
+{
+public:
+    explicit FixedStepClock(TimeDuration time_step) noexcept
+        : m_time_step(time_step)
+    { }
+
+    [[nodiscard]] TimeDuration GetTimeStep() const noexcept { return m_time_step; }
+    [[nodiscard]] TimePoint    Now() const noexcept override { return m_time; }
+
+    void Tick() noexcept override { m_time += m_time_step; }
+
+private:
+    TimeDuration m_time_step;
+    TimePoint    m_time{ };
+};
+
+class RecordedClock final
+    : public IClock
+{
+public:
+    using TimeSteps = std::vector<TimeDuration>;
+
+    // Recording mode: time is quantized by frame ticks of the source clock, which frame time steps are recorded
+    explicit RecordedClock(const IClock& source_clock = RealClock::Get())
+        : m_source_clock_ptr(&source_clock)
+        , m_source_time(source_clock.Now())
+    { }
+
+    // Replay mode: time is advanced by previously recorded frame time steps
+    explicit RecordedClock(TimeSteps recorded_time_steps) noexcept
+        : m_time_steps(std::move(recorded_time_steps))
+    { }
+
+    [[nodiscard]] bool             IsReplaying() const noexcept       { return !m_source_clock_ptr; }
+    [[nodiscard]] bool             IsReplayCompleted() const noexcept { return IsReplaying() && m_replay_step_index >= m_time_steps.size(); }
+    [[nodiscard]] const TimeSteps& GetTimeSteps() const noexcept      { return m_time_steps; }
+    [[nodiscard]] TimePoint        Now() const noexcept override      { return m_time; }
+
+    void Tick() override
+    {
+        if (IsReplaying())
+        {
+            if (m_replay_step_index < m_time_steps.size())
+                m_time += m_time_steps[m_replay_step_index++];
+            return;
+        }
+
+        const TimePoint    source_time = m_source_clock_ptr->Now();
+        const TimeDuration time_step   = source_time - m_source_time;
+        m_source_time = source_time;
+        m_time       += time_step;
+        m_time_steps.push_back(time_step);
+    }
+
+private:
+    const IClock* m_source_clock_ptr = nullptr;
+    TimePoint     m_source_time{ };
+    TimePoint     m_time{ };
+    TimeSteps     m_time_steps;
+    size_t        m_replay_step_index = 0U;
+};
+
+} // namespace Methane
@@ -17,12 +17,14 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Data/Timer.hpp
-Basic animation timer for measuring elapsed time since start.
+Basic animation timer for measuring elapsed time since start by real-time or simulation clock.
 
 ******************************************************************************/
 
 #pragma once
 
+#include "Clock.hpp"
+
 #include <chrono>
 
 namespace Methane
@@ -31,14 +33,22 @@ namespace Methane
 class Timer
 {
 public:
-    using Clock        = std::chrono::high_resolution_clock;
-    using TimePoint    = Clock::time_point;
-    using TimeDuration = Clock::duration;
+    using Clock        = IClock::StdClock;
+    using TimePoint    = IClock::TimePoint;
+    using TimeDuration = IClock::TimeDuration;
 
     Timer() = default;
 
+    // Timer measures time of the given clock, which must outlive the timer
+    explicit Timer(const IClock& clock) noexcept
+        : m_clock_ptr(&clock)
+        , m_start_time(clock.Now())
+    { }
+
+    [[nodiscard]] const IClock& GetClock() const noexcept          { return *m_clock_ptr; }
+    [[nodiscard]] TimePoint    GetClockTime() const noexcept       { return m_clock_ptr->Now(); }
     [[nodiscard]] TimePoint    GetStartTime() const noexcept       { return m_start_time; }
-    [[nodiscard]] TimeDuration GetElapsedDuration() const noexcept { return Clock::now() - m_start_time; }
+    [[nodiscard]] TimeDuration GetElapsedDuration() const noexcept { return GetClockTime() - m_start_time; }
     [[nodiscard]] uint32_t     GetElapsedSecondsU() const noexcept { return GetElapsedSeconds<uint32_t>(); }
     [[nodiscard]] double       GetElapsedSecondsD() const noexcept { return GetElapsedSeconds<double>(); }
     [[nodiscard]] float        GetElapsedSecondsF() const noexcept { return GetElapsedSeconds<float>(); }
@@ -51,12 +61,20 @@ public:
 
     void Reset() noexcept
     {
-        Reset(Clock::now());
+        Reset(GetClockTime());
     }
 
     void Reset(TimeDuration duration) noexcept
     {
-        Reset(Clock::now() - duration);
+        Reset(GetClockTime() - duration);
+    }
+
+    // Switches timer to another clock with preserving elapsed duration
+    void SetClock(const IClock& clock) noexcept
+    {
+        const TimeDuration elapsed_duration = GetElapsedDuration();
+        m_clock_ptr  = &clock;
+        m_start_time = clock.Now() - elapsed_duration;
     }
 
     template<typename T> requires std::is_arithmetic_v<T>
@@ -72,7 +90,8 @@ protected:
     }
 
 private:
-    TimePoint m_start_time = Clock::now();
+    const IClock* m_clock_ptr  = &RealClock::Get();
+    TimePoint     m_start_time = m_clock_ptr->Now();
 };
 
 } // namespace Methane::Data
@@ -24,6 +24,7 @@ Pool of animations for centralized updating, adding and removing in application.
 #pragma once
 
 #include <Methane/Memory.hpp>
+#include <Methane/Clock.hpp>
 
 #include "Animation.h"
 
@@ -49,7 +50,13 @@ public:
 
     void SetDryUpdateOnPauseEnabled(bool enabled) noexcept  { m_is_dry_update_on_pause_enabled = enabled; }
 
+    // All animations of the pool are switched to the pool clock on update, which allows to run them
+    // with fixed-step or recorded simulation time instead of real time; clock must outlive the pool
+    [[nodiscard]] const IClock& GetClock() const noexcept { return *m_clock_ptr; }
+    void SetClock(const IClock& clock);
+
 private:
+    const IClock* m_clock_ptr = &RealClock::Get();
     bool m_is_paused = false;
     bool m_is_dry_update_on_pause_enabled = false;
 };
@@ -0,0 +1,244 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/InterpolationAnimations.hpp
+Data-oriented system of linear value interpolation animations with structure-of-arrays storage,
+batched interpolation in parallel chunks and swap-remove of completed animations.
+System is an animation itself, so it is updated by AnimationsPool with one virtual call for all values.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Animation.h"
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <concepts>
+
+namespace Methane::Data
+{
+
+template<typename ValueType>
+concept InterpolatableValue = std::copyable<ValueType> && requires(const ValueType& value, float factor)
+{
+    { value + (value - value) * factor } -> std::convertible_to<ValueType>;
+};
+
+template<InterpolatableValue ValueType>
+class InterpolationAnimations final
+    : public Animation
+{
+public:
+    using Id = uint32_t;
+
+    static constexpr Id     invalid_id        = std::numeric_limits<Id>::max();
+    static constexpr size_t update_chunk_size = 1024U;
+
+    // Animations are updated in parallel chunks with executor when it is provided and there are more than one chunk of animations
+    explicit InterpolationAnimations(tf::Executor* parallel_executor_ptr = nullptr)
+        : m_parallel_executor_ptr(parallel_executor_ptr)
+    { }
+
+    [[nodiscard]] size_t GetCount() const noexcept { return m_ids.size(); }
+    [[nodiscard]] bool   IsEmpty() const noexcept  { return m_ids.empty(); }
+
+    void Reserve(size_t animations_count)
+    {
+        META_FUNCTION_TASK();
+        m_target_ptrs.reserve(animations_count);
+        m_start_values.reserve(animations_count);
+        m_end_values.reserve(animations_count);
+        m_start_times.reserve(animations_count);
+        m_inv_durations.reserve(animations_count);
+        m_progress.reserve(animations_count);
+        m_ids.reserve(animations_count);
+    }
+
+    // Starts interpolation of the target value from its current value to the end value during given duration,
+    // target value must outlive its animation, which is removed on completion or with Remove call
+    Id Add(ValueType& target_value, const ValueType& end_value, double duration_sec)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_GREATER_DESCR(duration_sec, 0.0, "interpolation animation duration must be positive");
+
+        Id id = invalid_id;
+        if (m_free_ids.empty())
+        {
+            id = static_cast<Id>(m_index_by_id.size());
+            m_index_by_id.push_back(0U);
+        }
+        else
+        {
+            id = m_free_ids.back();
+            m_free_ids.pop_back();
+        }
+
+        m_index_by_id[id] = static_cast<uint32_t>(m_ids.size());
+        m_target_ptrs.push_back(&target_value);
+        m_start_values.push_back(target_value);
+        m_end_values.push_back(end_value);
+        m_start_times.push_back(GetElapsedSecondsD());
+        m_inv_durations.push_back(1.0 / duration_sec);
+        m_progress.push_back(0.F);
+        m_ids.push_back(id);
+        return id;
+    }
+
+    // Removes animation without completing interpolation, returns false if animation is already completed
+    bool Remove(Id id)
+    {
+        META_FUNCTION_TASK();
+        if (!IsRunning(id))
+            return false;
+
+        SwapRemove(m_index_by_id[id]);
+        return true;
+    }
+
+    [[nodiscard]] bool IsRunning(Id id) const noexcept
+    {
+        return id < m_index_by_id.size() && m_index_by_id[id] < m_ids.size() && m_ids[m_index_by_id[id]] == id;
+    }
+
+    // Animation overrides
+
+    bool Update() override
+    {
+        META_FUNCTION_TASK();
+        if (GetState() != State::Running)
+            return false;
+
+        const double elapsed_seconds = GetElapsedSecondsD();
+        const size_t animations_count = m_ids.size();
+        const size_t chunks_count = (animations_count + update_chunk_size - 1U) / update_chunk_size;
+        if (m_parallel_executor_ptr && chunks_count > 1U)
+        {
+            tf::Taskflow update_task_flow;
+            update_task_flow.for_each_index(size_t(0U), chunks_count, size_t(1U),
+                [this, elapsed_seconds, animations_count](const size_t chunk_index)
+                {
+                    const size_t begin_index = chunk_index * update_chunk_size;
+                    UpdateRange(begin_index, std::min(begin_index + update_chunk_size, animations_count), elapsed_seconds);
+                },
+                tf::StaticPartitioner()
+            );
+            m_parallel_executor_ptr->run(update_task_flow).get();
+        }
+        else
+        {
+            UpdateRange(0U, animations_count, elapsed_seconds);
+        }
+
+        RemoveCompleted();
+        return true;
+    }
+
+    void DryUpdate() override
+    {
+        META_FUNCTION_TASK();
+        for(size_t index = 0U; index < m_ids.size(); ++index)
+        {
+            *m_target_ptrs[index] = Interpolate(index);
+        }
+    }
+
+private:
+    [[nodiscard]] ValueType Interpolate(size_t index) const
+    {
+        return m_start_values[index] + (m_end_values[index] - m_start_values[index]) * m_progress[index];
+    }
+
+    void UpdateRange(size_t begin_index, size_t end_index, double elapsed_seconds)
+    {
+        META_FUNCTION_TASK();
+        // Progress and interpolated values are computed in separate passes over contiguous arrays,
+        // so that each pass is a tight loop which compiler can vectorize
+        for(size_t index = begin_index; index < end_index; ++index)
+        {
+            const double progress = (elapsed_seconds - m_start_times[index]) * m_inv_durations[index];
+            m_progress[index] = static_cast<float>(std::clamp(progress, 0.0, 1.0));
+        }
+        for(size_t index = begin_index; index < end_index; ++index)
+        {
+            *m_target_ptrs[index] = Interpolate(index);
+        }
+    }
+
+    void RemoveCompleted()
+    {
+        META_FUNCTION_TASK();
+        for(size_t index = 0U; index < m_ids.size();)
+        {
+            if (m_progress[index] >= 1.F)
+                SwapRemove(index);
+            else
+                ++index;
+        }
+    }
+
+    void SwapRemove(size_t index)
+    {
+        const size_t last_index = m_ids.size() - 1U;
+        m_free_ids.push_back(m_ids[index]);
+        if (index != last_index)
+        {
+            m_target_ptrs[index]   = m_target_ptrs[last_index];
+            m_start_values[index]  = std::move(m_start_values[last_index]);
+            m_end_values[index]    = std::move(m_end_values[last_index]);
+            m_start_times[index]   = m_start_times[last_index];
+            m_inv_durations[index] = m_inv_durations[last_index];
+            m_progress[index]      = m_progress[last_index];
+            m_ids[index]           = m_ids[last_index];
+            m_index_by_id[m_ids[index]] = static_cast<uint32_t>(index);
+        }
+        m_target_ptrs.pop_back();
+        m_start_values.pop_back();
+        m_end_values.pop_back();
+        m_start_times.pop_back();
+        m_inv_durations.pop_back();
+        m_progress.pop_back();
+        m_ids.pop_back();
+    }
+
+    tf::Executor*           m_parallel_executor_ptr;
+    std::vector<ValueType*> m_target_ptrs;
+    std::vector<ValueType>  m_start_values;
+    std::vector<ValueType>  m_end_values;
+    std::vector<double>     m_start_times;
+    std::vector<double>     m_inv_durations;
+    std::vector<float>      m_progress;
+    std::vector<Id>         m_ids;
+    std::vector<uint32_t>   m_index_by_id;
+    std::vector<Id>         m_free_ids;
+};
+
+template<InterpolatableValue ValueType>
+Ptr<InterpolationAnimations<ValueType>> MakeInterpolationAnimationsPtr(tf::Executor* parallel_executor_ptr = nullptr)
+{
+    return std::make_shared<InterpolationAnimations<ValueType>>(parallel_executor_ptr);
+}
+
+} // namespace Methane::Data
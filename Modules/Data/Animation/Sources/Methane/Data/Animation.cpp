@@ -69,7 +69,7 @@ void Animation::Resume()
     META_CHECK_EQUAL_DESCR(m_state, State::Paused, "only paused animation can be resumed");
 
     m_state = State::Running;
-    Reset(Clock::now() - m_paused_duration);
+    Reset(GetClockTime() - m_paused_duration);
 }
 
 } // namespace Methane::Data
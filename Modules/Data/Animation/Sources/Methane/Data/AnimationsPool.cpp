@@ -24,8 +24,6 @@ Pool of animations for centralized updating, adding and removing in application.
 #include <Methane/Data/AnimationsPool.h>
 #include <Methane/Instrumentation.h>
 
-#include <vector>
-
 namespace Methane::Data
 {
 
@@ -42,22 +40,25 @@ void AnimationsPool::Update()
         return;
     }
 
-    std::vector<size_t> completed_animation_indices;
+    // Completed animations are removed in a single compaction pass without extra allocations,
+    // animations are accessed by index since new animations can be added to the pool during update
+    size_t running_animations_count = 0U;
     for (size_t animation_index = 0; animation_index < size(); ++animation_index)
     {
-        if (const Ptr<Animation>& animation_ptr = (*this)[animation_index];
-            !animation_ptr || !animation_ptr->Update())
-        {
-            completed_animation_indices.push_back(animation_index);
-        }
-    }
+        Ptr<Animation>& animation_ptr = (*this)[animation_index];
+        if (animation_ptr && &animation_ptr->GetClock() != m_clock_ptr)
+            animation_ptr->SetClock(*m_clock_ptr);
 
-    for (auto animation_index_it = completed_animation_indices.rbegin();
-              animation_index_it != completed_animation_indices.rend(); 
-            ++animation_index_it)
-    {
-        erase(begin() + *animation_index_it);
+        if (!animation_ptr || !animation_ptr->Update())
+            continue;
+
+        if (running_animations_count != animation_index)
+            (*this)[running_animations_count] = std::move(animation_ptr);
+
+        ++running_animations_count;
     }
+
+    erase(begin() + static_cast<Animations::difference_type>(running_animations_count), end());
 }
 
 void AnimationsPool::DryUpdate() const
@@ -102,4 +103,15 @@ void AnimationsPool::Resume()
     m_is_paused = false;
 }
 
+void AnimationsPool::SetClock(const IClock& clock)
+{
+    META_FUNCTION_TASK();
+    m_clock_ptr = &clock;
+    for(const Ptr<Animation>& animation_ptr : *this)
+    {
+        if (animation_ptr)
+            animation_ptr->SetClock(clock);
+    }
+}
+
 } // namespace Methane::Data
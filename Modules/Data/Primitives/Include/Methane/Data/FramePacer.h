@@ -0,0 +1,99 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FramePacer.h
+Frame pacer tracks CPU frame phase timings and input-to-GPU-completion latency
+of frames in flight and calculates frame start delay targeting the given latency.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Clock.hpp>
+
+#include <deque>
+#include <cstdint>
+
+namespace Methane::Data
+{
+
+class FramePacer
+{
+public:
+    struct FrameTimings
+    {
+        uint32_t frame_index    = 0U;
+        bool     is_completed   = false; // GPU completion of the frame was observed on CPU
+        double   start_delay_ms = 0.0;   // CPU sleep before frame start targeting the latency
+        double   update_time_ms = 0.0;   // CPU update from frame start to render start
+        double   wait_time_ms   = 0.0;   // CPU wait for completion of GPU frames in flight
+        double   render_time_ms = 0.0;   // CPU commands encoding, submission and present
+        double   latency_ms     = 0.0;   // from frame start with input sampling to observed GPU frame completion
+    };
+
+    using FramesTimings = std::deque<FrameTimings>;
+
+    static constexpr uint32_t default_history_size    = 1000U;
+    static constexpr double   latency_correction_gain = 0.5;
+
+    explicit FramePacer(const IClock& clock = RealClock::Get());
+
+    // Zero frames in flight count means that it is not limited by frame pacer
+    void SetMaxFramesInFlight(uint32_t max_frames_in_flight) noexcept { m_max_frames_in_flight = max_frames_in_flight; }
+    void SetTargetLatency(double target_latency_ms);
+    void SetHistorySize(uint32_t history_size);
+    void Reset();
+
+    [[nodiscard]] uint32_t             GetMaxFramesInFlight() const noexcept  { return m_max_frames_in_flight; }
+    [[nodiscard]] double               GetTargetLatencyMs() const noexcept    { return m_target_latency_ms; }
+    [[nodiscard]] double               GetStartDelayMs() const noexcept       { return m_start_delay_ms; }
+    [[nodiscard]] uint32_t             GetFramesInFlightCount() const noexcept { return static_cast<uint32_t>(m_frames_in_flight.size()); }
+    [[nodiscard]] const FramesTimings& GetFramesTimings() const noexcept      { return m_frames_timings; }
+    [[nodiscard]] FrameTimings         GetAverageFrameTimings() const noexcept;
+
+    // Frame phases are reported in order of execution: start delay is expected to be slept before frame start,
+    // wait completion reports the number of frames which may still be in flight on GPU after the wait
+    void OnFrameStarted();
+    void OnFrameRenderStarted() noexcept;
+    void OnFrameWaitCompleted(uint32_t frames_in_flight_count);
+
+private:
+    struct FrameInFlight
+    {
+        uint32_t          frame_index;
+        IClock::TimePoint start_time;
+    };
+
+    FrameTimings* GetFrameTimings(uint32_t frame_index) noexcept;
+    void UpdateStartDelay(double latency_ms, double wait_time_ms) noexcept;
+
+    const IClock*             m_clock_ptr;
+    uint32_t                  m_max_frames_in_flight = 0U;
+    double                    m_target_latency_ms    = 0.0;
+    double                    m_start_delay_ms       = 0.0;
+    uint32_t                  m_history_size         = default_history_size;
+    uint32_t                  m_frame_index          = 0U;
+    bool                      m_is_frame_started     = false;
+    IClock::TimePoint         m_frame_start_time;
+    IClock::TimePoint         m_render_start_time;
+    IClock::TimePoint         m_wait_end_time;
+    std::deque<FrameInFlight> m_frames_in_flight;
+    FramesTimings             m_frames_timings;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,192 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FramePacer.cpp
+Frame pacer tracks CPU frame phase timings and input-to-GPU-completion latency
+of frames in flight and calculates frame start delay targeting the given latency.
+
+******************************************************************************/
+
+#include <Methane/Data/FramePacer.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+
+namespace Methane::Data
+{
+
+FramePacer::FramePacer(const IClock& clock)
+    : m_clock_ptr(&clock)
+    , m_frame_start_time(clock.Now())
+    , m_render_start_time(m_frame_start_time)
+    , m_wait_end_time(m_frame_start_time)
+{ }
+
+void FramePacer::SetTargetLatency(double target_latency_ms)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_OR_EQUAL_DESCR(target_latency_ms, 0.0, "target frame latency can not be negative");
+    m_target_latency_ms = target_latency_ms;
+    if (m_target_latency_ms == 0.0)
+        m_start_delay_ms = 0.0;
+}
+
+void FramePacer::SetHistorySize(uint32_t history_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_DESCR(history_size, 0U, "frame timings history size must be positive");
+    m_history_size = history_size;
+    while (m_frames_timings.size() > m_history_size)
+    {
+        m_frames_timings.pop_front();
+    }
+}
+
+void FramePacer::Reset()
+{
+    META_FUNCTION_TASK();
+    m_start_delay_ms   = 0.0;
+    m_frame_index      = 0U;
+    m_is_frame_started = false;
+    m_frames_in_flight.clear();
+    m_frames_timings.clear();
+}
+
+FramePacer::FrameTimings FramePacer::GetAverageFrameTimings() const noexcept
+{
+    META_FUNCTION_TASK();
+    FrameTimings average_timings;
+    uint32_t     completed_frames_count = 0U;
+    for (const FrameTimings& frame_timings : m_frames_timings)
+    {
+        if (!frame_timings.is_completed)
+            continue;
+
+        average_timings.start_delay_ms += frame_timings.start_delay_ms;
+        average_timings.update_time_ms += frame_timings.update_time_ms;
+        average_timings.wait_time_ms   += frame_timings.wait_time_ms;
+        average_timings.render_time_ms += frame_timings.render_time_ms;
+        average_timings.latency_ms     += frame_timings.latency_ms;
+        completed_frames_count++;
+    }
+
+    if (!completed_frames_count)
+        return average_timings;
+
+    const auto frames_count = static_cast<double>(completed_frames_count);
+    average_timings.is_completed    = true;
+    average_timings.start_delay_ms /= frames_count;
+    average_timings.update_time_ms /= frames_count;
+    average_timings.wait_time_ms   /= frames_count;
+    average_timings.render_time_ms /= frames_count;
+    average_timings.latency_ms     /= frames_count;
+    return average_timings;
+}
+
+void FramePacer::OnFrameStarted()
+{
+    META_FUNCTION_TASK();
+    const IClock::TimePoint frame_start_time = m_clock_ptr->Now();
+
+    // Render phase of the previous frame lasts until the start of next frame, since present is the last frame phase
+    if (m_is_frame_started)
+    {
+        if (FrameTimings* prev_frame_timings_ptr = GetFrameTimings(m_frame_index - 1U))
+            prev_frame_timings_ptr->render_time_ms = std::chrono::duration<double, std::milli>(frame_start_time - m_wait_end_time).count();
+    }
+
+    m_frame_start_time  = frame_start_time;
+    m_render_start_time = frame_start_time;
+    m_wait_end_time     = frame_start_time;
+    m_is_frame_started  = true;
+
+    m_frames_in_flight.push_back({ m_frame_index, frame_start_time });
+    m_frames_timings.push_back({ m_frame_index, false, m_start_delay_ms });
+    if (m_frames_timings.size() > m_history_size)
+        m_frames_timings.pop_front();
+
+    m_frame_index++;
+}
+
+void FramePacer::OnFrameRenderStarted() noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_is_frame_started)
+        return;
+
+    m_render_start_time = m_clock_ptr->Now();
+    if (FrameTimings* frame_timings_ptr = GetFrameTimings(m_frame_index - 1U))
+        frame_timings_ptr->update_time_ms = std::chrono::duration<double, std::milli>(m_render_start_time - m_frame_start_time).count();
+}
+
+void FramePacer::OnFrameWaitCompleted(uint32_t frames_in_flight_count)
+{
+    META_FUNCTION_TASK();
+    if (!m_is_frame_started)
+        return;
+
+    m_wait_end_time = m_clock_ptr->Now();
+    const double wait_time_ms = std::chrono::duration<double, std::milli>(m_wait_end_time - m_render_start_time).count();
+    if (FrameTimings* frame_timings_ptr = GetFrameTimings(m_frame_index - 1U))
+        frame_timings_ptr->wait_time_ms = wait_time_ms;
+
+    // Frames started before the in-flight window are completed on GPU by the end of wait,
+    // so their latency is measured up to the moment when completion is observed on CPU
+    double completed_latency_ms = -1.0;
+    while (!m_frames_in_flight.empty() && m_frames_in_flight.front().frame_index + frames_in_flight_count < m_frame_index)
+    {
+        const FrameInFlight& completed_frame = m_frames_in_flight.front();
+        completed_latency_ms = std::chrono::duration<double, std::milli>(m_wait_end_time - completed_frame.start_time).count();
+        if (FrameTimings* completed_frame_timings_ptr = GetFrameTimings(completed_frame.frame_index))
+        {
+            completed_frame_timings_ptr->is_completed = true;
+            completed_frame_timings_ptr->latency_ms   = completed_latency_ms;
+        }
+        m_frames_in_flight.pop_front();
+    }
+
+    if (completed_latency_ms >= 0.0)
+        UpdateStartDelay(completed_latency_ms, wait_time_ms);
+}
+
+FramePacer::FrameTimings* FramePacer::GetFrameTimings(uint32_t frame_index) noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_frames_timings.empty() || frame_index < m_frames_timings.front().frame_index)
+        return nullptr;
+
+    const uint32_t timings_index = frame_index - m_frames_timings.front().frame_index;
+    return timings_index < m_frames_timings.size() ? &m_frames_timings[timings_index] : nullptr;
+}
+
+void FramePacer::UpdateStartDelay(double latency_ms, double wait_time_ms) noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_target_latency_ms == 0.0)
+        return;
+
+    // Start delay moves CPU wait for GPU before input sampling at frame start,
+    // so it can not exceed the current delay plus the time which is still spent waiting for GPU
+    const double latency_error_ms = latency_ms - m_target_latency_ms;
+    m_start_delay_ms = std::clamp(m_start_delay_ms + latency_error_ms * latency_correction_gain,
+                                  0.0, m_start_delay_ms + wait_time_ms);
+}
+
+} // namespace Methane::Data
@@ -67,7 +67,8 @@ public:
         fs.seekg(0,std::ios::beg);
         fs.read(reinterpret_cast<char*>(buffer.data()), buffer.size()); // NOSONAR
 
-        return Data::Chunk(std::move(buffer));
+        // File data is shared without copying between all chunks referencing it
+        return Data::Chunk(Data::SharedChunk(std::move(buffer)));
     }
 
     [[nodiscard]] std::vector<std::string> GetFiles(const std::string&) const override
@@ -17,13 +17,14 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Data/Chunk.h
-Data chunk representing owning or non-owning memory container
+Data chunk representing owning, shared or non-owning memory container
 
 ******************************************************************************/
 
 #pragma once
 
 #include "Types.h"
+#include "SharedChunk.hpp"
 
 #include <concepts>
 
@@ -45,13 +46,20 @@ public:
         , m_data_size(static_cast<Size>(m_data_storage.size()))
     { }
 
-    template<typename T> requires(!std::derived_from<T, Chunk>)
+    // Shared chunk data is referenced without copying and kept alive by the chunk and all of its copies
+    explicit Chunk(const SharedChunk& shared_chunk) noexcept
+        : m_data_owner_ptr(shared_chunk.GetOwnerPtr())
+        , m_data_ptr(shared_chunk.GetDataPtr())
+        , m_data_size(shared_chunk.GetDataSize())
+    { }
+
+    template<typename T> requires(!std::derived_from<T, Chunk> && !std::same_as<std::remove_cv_t<T>, SharedChunk>)
     explicit Chunk(T& value)
         : m_data_ptr(GetByteAddress(value))
         , m_data_size(static_cast<Size>(sizeof(T)))
     { }
 
-    template<typename T> requires(!std::derived_from<T, Chunk>)
+    template<typename T> requires(!std::derived_from<std::remove_cvref_t<T>, Chunk> && !std::same_as<std::remove_cvref_t<T>, SharedChunk>)
     explicit Chunk(T&& value)
         : m_data_storage(GetByteAddress(std::forward<T>(value)),
                          GetByteAddress(std::forward<T>(value)) + sizeof(T))
@@ -61,29 +69,36 @@ public:
 
     explicit Chunk(const Chunk& other)
         : m_data_storage(other.m_data_storage)
+        , m_data_owner_ptr(other.m_data_owner_ptr)
         , m_data_ptr(m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data())
         , m_data_size(m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size()))
-    { }
+    {
+        ChunkCopyCounter::AddCopiedBytes(m_data_storage.size());
+    }
 
     explicit Chunk(Chunk&& other) noexcept
         : m_data_storage(std::move(other.m_data_storage))
+        , m_data_owner_ptr(std::move(other.m_data_owner_ptr))
         , m_data_ptr(m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data())
         , m_data_size(m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size()))
     { }
 
     Chunk& operator=(const Chunk& other) noexcept
     {
-        m_data_storage = other.m_data_storage;
-        m_data_ptr     = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
-        m_data_size    = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
+        m_data_storage   = other.m_data_storage;
+        m_data_owner_ptr = other.m_data_owner_ptr;
+        m_data_ptr       = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
+        m_data_size      = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
+        ChunkCopyCounter::AddCopiedBytes(m_data_storage.size());
         return *this;
     }
 
     Chunk& operator=(Chunk&& other) noexcept
     {
-        m_data_storage = std::move(other.m_data_storage);
-        m_data_ptr     = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
-        m_data_size    = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
+        m_data_storage   = std::move(other.m_data_storage);
+        m_data_owner_ptr = std::move(other.m_data_owner_ptr);
+        m_data_ptr       = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
+        m_data_size      = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
         return *this;
     }
 
@@ -102,12 +117,28 @@ public:
 
     [[nodiscard]] bool IsEmptyOrNull() const noexcept { return !m_data_ptr || !m_data_size; }
     [[nodiscard]] bool IsDataStored() const noexcept  { return !m_data_storage.empty(); }
+    [[nodiscard]] bool IsDataShared() const noexcept  { return !!m_data_owner_ptr; }
 
     static Chunk StoreFrom(const Chunk& other)
     {
+        ChunkCopyCounter::AddCopiedBytes(other.GetDataSize());
         return Chunk(Bytes(other.GetDataPtr(), other.GetDataEndPtr()));
     }
 
+    // Returns shared chunk referencing the same data without copying, when data is stored or shared;
+    // non-owned data is referenced without ownership, so it must outlive the returned chunk
+    [[nodiscard]] SharedChunk Share() &&
+    {
+        SharedChunk shared_chunk = IsDataStored()
+                                 ? SharedChunk(std::move(m_data_storage))
+                                 : SharedChunk(m_data_ptr, m_data_size, std::move(m_data_owner_ptr));
+        m_data_storage.clear();
+        m_data_owner_ptr.reset();
+        m_data_ptr  = nullptr;
+        m_data_size = 0U;
+        return shared_chunk;
+    }
+
     template<typename T = Byte>
     [[nodiscard]] Size GetDataSize() const noexcept
     {
@@ -141,9 +172,10 @@ private:
 
     // Data storage is used only when m_data_storage is not managed by m_data_storage provider and
     // returned with chunk (when m_data_storage is loaded from file, for example)
-    Bytes       m_data_storage;
-    ConstRawPtr m_data_ptr  = nullptr;
-    Size        m_data_size = 0U;
+    Bytes              m_data_storage;
+    SharedChunk::Owner m_data_owner_ptr;
+    ConstRawPtr        m_data_ptr  = nullptr;
+    Size               m_data_size = 0U;
 };
 
 } // namespace Methane::Data
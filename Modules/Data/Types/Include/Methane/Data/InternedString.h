@@ -0,0 +1,77 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/InternedString.h
+String interned in the global thread-safe table with stable id and storage,
+which is compared and hashed by id without comparing string characters.
+
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <functional>
+
+namespace Methane::Data
+{
+
+class InternedString
+{
+public:
+    using Id = uint32_t;
+    static constexpr Id empty_id = 0U;
+
+    InternedString() noexcept;
+
+    // Finds string in the intern table or adds it, interned strings are never released
+    explicit InternedString(std::string_view str);
+
+    // Finds string in the intern table without adding it
+    [[nodiscard]] static std::optional<InternedString> Find(std::string_view str);
+    [[nodiscard]] static size_t GetInternedCount();
+
+    [[nodiscard]] Id                 GetId() const noexcept     { return m_id; }
+    [[nodiscard]] const std::string& GetString() const noexcept { return *m_string_ptr; }
+    [[nodiscard]] std::string_view   GetView() const noexcept   { return *m_string_ptr; }
+    [[nodiscard]] bool               IsEmpty() const noexcept   { return m_id == empty_id; }
+
+    operator std::string_view() const noexcept { return *m_string_ptr; } // NOSONAR - implicit conversion is intended
+
+    friend bool operator==(const InternedString& left, const InternedString& right) noexcept { return left.m_id == right.m_id; }
+    friend bool operator==(const InternedString& left, std::string_view right) noexcept      { return left.GetView() == right; }
+
+private:
+    InternedString(Id id, const std::string& str) noexcept;
+
+    Id                 m_id;
+    const std::string* m_string_ptr;
+};
+
+} // namespace Methane::Data
+
+template<>
+struct std::hash<Methane::Data::InternedString>
+{
+    [[nodiscard]] size_t operator()(const Methane::Data::InternedString& str) const noexcept
+    {
+        return std::hash<Methane::Data::InternedString::Id>()(str.GetId());
+    }
+};
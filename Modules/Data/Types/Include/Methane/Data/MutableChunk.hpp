@@ -36,7 +36,9 @@ public:
     MutableChunk(ConstRawPtr data_ptr, Size size) noexcept
         : m_data(data_ptr, data_ptr + size)
         , m_chunk(m_data.data(), static_cast<Size>(m_data.size()))
-    { }
+    {
+        ChunkCopyCounter::AddCopiedBytes(m_data.size());
+    }
 
     explicit MutableChunk(Bytes&& data) noexcept
         : m_data(std::move(data))
@@ -46,7 +48,9 @@ public:
     explicit MutableChunk(const Chunk& chunk) noexcept
         : m_data(chunk.GetDataPtr(), chunk.GetDataEndPtr())
         , m_chunk(m_data.data(), static_cast<Size>(m_data.size()))
-    { }
+    {
+        ChunkCopyCounter::AddCopiedBytes(m_data.size());
+    }
 
     explicit MutableChunk(MutableChunk&& other) noexcept
         : m_data(std::move(other.m_data))
@@ -56,7 +60,9 @@ public:
     MutableChunk(const MutableChunk& other) noexcept
         : m_data(other.m_data)
         , m_chunk(m_data.data(), static_cast<Size>(m_data.size()))
-    { }
+    {
+        ChunkCopyCounter::AddCopiedBytes(m_data.size());
+    }
 
     ~MutableChunk() = default;
 
@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/SharedChunk.hpp
+Reference counted immutable data chunk with zero-copy slicing
+and counter of bytes copied between data chunks.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Types.h"
+
+#include <Methane/Checks.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace Methane::Data
+{
+
+// Counts bytes copied by data chunks on the current thread,
+// so that data copies can be measured per asset load
+class ChunkCopyCounter
+{
+public:
+    static void AddCopiedBytes(size_t bytes_count) noexcept { s_thread_copied_bytes += bytes_count; }
+    [[nodiscard]] static uint64_t GetThreadCopiedBytes() noexcept { return s_thread_copied_bytes; }
+
+private:
+    inline static thread_local uint64_t s_thread_copied_bytes = 0U;
+};
+
+// Measures bytes copied by data chunks on the current thread during the scope lifetime
+class ChunkCopyScope
+{
+public:
+    ChunkCopyScope() noexcept = default;
+
+    [[nodiscard]] uint64_t GetCopiedBytes() const noexcept
+    {
+        return ChunkCopyCounter::GetThreadCopiedBytes() - m_start_copied_bytes;
+    }
+
+private:
+    const uint64_t m_start_copied_bytes = ChunkCopyCounter::GetThreadCopiedBytes();
+};
+
+class SharedChunk
+{
+public:
+    // Owner keeps memory alive while any shared chunk or its slice references it
+    using Owner = std::shared_ptr<const void>;
+
+    SharedChunk() = default;
+    SharedChunk(ConstRawPtr data_ptr, Size size, Owner owner_ptr) noexcept
+        : m_owner_ptr(std::move(owner_ptr))
+        , m_data_ptr(data_ptr)
+        , m_data_size(size)
+    { }
+
+    // Takes ownership of the bytes container without copying its data
+    explicit SharedChunk(Bytes&& data)
+    {
+        auto bytes_ptr = std::make_shared<const Bytes>(std::move(data));
+        m_data_ptr  = bytes_ptr->empty() ? nullptr : bytes_ptr->data();
+        m_data_size = static_cast<Size>(bytes_ptr->size());
+        m_owner_ptr = std::move(bytes_ptr);
+    }
+
+    // Takes ownership of externally allocated memory, which is released with custom deleter
+    // when the last reference is gone: stbi_image_free for decoded images, munmap for mapped files, arena release, etc.
+    template<typename DeleterType>
+    [[nodiscard]] static SharedChunk Own(ConstRawPtr data_ptr, Size size, DeleterType&& deleter)
+    {
+        return SharedChunk(data_ptr, size, Owner(data_ptr, std::forward<DeleterType>(deleter)));
+    }
+
+    // Copies data to the owned storage, copied bytes are counted
+    [[nodiscard]] static SharedChunk CopyFrom(ConstRawPtr data_ptr, Size size)
+    {
+        ChunkCopyCounter::AddCopiedBytes(size);
+        return SharedChunk(Bytes(data_ptr, data_ptr + size));
+    }
+
+    // Returns sub-range of data referencing the same owner without copying
+    [[nodiscard]] SharedChunk Slice(Size offset, Size size) const
+    {
+        META_CHECK_LESS_OR_EQUAL_DESCR(offset, m_data_size, "slice offset is out of data chunk bounds");
+        META_CHECK_LESS_OR_EQUAL_DESCR(size, m_data_size - offset, "slice size is out of data chunk bounds");
+        return SharedChunk(m_data_ptr + offset, size, m_owner_ptr);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return !IsEmptyOrNull();
+    }
+
+    [[nodiscard]] bool         IsEmptyOrNull() const noexcept { return !m_data_ptr || !m_data_size; }
+    [[nodiscard]] const Owner& GetOwnerPtr() const noexcept   { return m_owner_ptr; }
+    [[nodiscard]] long         GetOwnersCount() const noexcept { return m_owner_ptr.use_count(); }
+
+    template<typename T = Byte>
+    [[nodiscard]] Size GetDataSize() const noexcept
+    {
+        if constexpr (std::is_same_v<T, Byte>)
+            return m_data_size;
+        else
+            return m_data_size / sizeof(T);
+    }
+
+    template<typename T = Byte>
+    [[nodiscard]] const T* GetDataPtr() const noexcept
+    {
+        if constexpr (std::is_same_v<T, Byte>)
+            return m_data_ptr;
+        else
+            return reinterpret_cast<const T*>(m_data_ptr); // NOSONAR
+    }
+
+    template<typename T = Byte>
+    [[nodiscard]] const T* GetDataEndPtr() const noexcept
+    {
+        return GetDataPtr<T>() + GetDataSize<T>();
+    }
+
+private:
+    Owner       m_owner_ptr;
+    ConstRawPtr m_data_ptr  = nullptr;
+    Size        m_data_size = 0U;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,126 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/InternedString.cpp
+String interned in the global thread-safe table with stable id and storage,
+which is compared and hashed by id without comparing string characters.
+
+******************************************************************************/
+
+#include <Methane/Data/InternedString.h>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Methane::Data
+{
+
+class StringInternTable
+{
+public:
+    struct Entry
+    {
+        InternedString::Id id;
+        const std::string* string_ptr;
+    };
+
+    static StringInternTable& Get()
+    {
+        static StringInternTable s_intern_table;
+        return s_intern_table;
+    }
+
+    Entry Intern(std::string_view str)
+    {
+        if (const std::optional<Entry> entry_opt = Find(str); entry_opt)
+            return *entry_opt;
+
+        std::scoped_lock lock(m_mutex);
+        if (const auto id_by_string_it = m_id_by_string.find(str);
+            id_by_string_it != m_id_by_string.end())
+            return GetEntry(id_by_string_it->second);
+
+        // Deque keeps references to the interned strings stable on growth,
+        // so that string views of the stored strings are used as map keys
+        const auto id = static_cast<InternedString::Id>(m_strings.size());
+        const std::string& interned_str = m_strings.emplace_back(str);
+        m_id_by_string.emplace(interned_str, id);
+        return Entry{ id, &interned_str };
+    }
+
+    std::optional<Entry> Find(std::string_view str) const
+    {
+        std::shared_lock lock(m_mutex);
+        const auto id_by_string_it = m_id_by_string.find(str);
+        return id_by_string_it == m_id_by_string.end()
+             ? std::optional<Entry>()
+             : GetEntry(id_by_string_it->second);
+    }
+
+    size_t GetCount() const
+    {
+        std::shared_lock lock(m_mutex);
+        return m_strings.size();
+    }
+
+    const std::string& GetEmptyString() const noexcept { return m_strings.front(); }
+
+private:
+    StringInternTable()
+    {
+        m_strings.emplace_back();
+        m_id_by_string.emplace(m_strings.front(), InternedString::empty_id);
+    }
+
+    Entry GetEntry(InternedString::Id id) const noexcept { return Entry{ id, &m_strings[id] }; }
+
+    mutable std::shared_mutex                                m_mutex;
+    std::deque<std::string>                                  m_strings;
+    std::unordered_map<std::string_view, InternedString::Id> m_id_by_string;
+};
+
+InternedString::InternedString() noexcept
+    : InternedString(empty_id, StringInternTable::Get().GetEmptyString())
+{ }
+
+InternedString::InternedString(std::string_view str)
+{
+    const StringInternTable::Entry entry = StringInternTable::Get().Intern(str);
+    m_id         = entry.id;
+    m_string_ptr = entry.string_ptr;
+}
+
+InternedString::InternedString(Id id, const std::string& str) noexcept
+    : m_id(id)
+    , m_string_ptr(&str)
+{ }
+
+std::optional<InternedString> InternedString::Find(std::string_view str)
+{
+    const std::optional<StringInternTable::Entry> entry_opt = StringInternTable::Get().Find(str);
+    return entry_opt ? InternedString(entry_opt->id, *entry_opt->string_ptr) : std::optional<InternedString>();
+}
+
+size_t InternedString::GetInternedCount()
+{
+    return StringInternTable::Get().GetCount();
+}
+
+} // namespace Methane::Data
@@ -97,7 +97,7 @@ public:
             FrameT& frame = m_frames.emplace_back(frame_index);
 
             // Create color texture for frame buffer
-            frame.screen_texture = render_context.CreateTexture(Rhi::TextureSettings::ForFrameBuffer(render_context.GetSettings(), frame.index));
+            frame.screen_texture = render_context.CreateTexture(GetFrameBufferSettings(frame.index));
             frame.screen_texture.SetName(fmt::format("Frame Buffer {}", frame.index));
 
             // Configure render pass: color, depth, stencil attachments and shader access
@@ -129,7 +129,7 @@ public:
         for (FrameT& frame : m_frames)
         {
             ResourceRestoreInfo& frame_restore_info = frame_restore_infos[frame.index];
-            frame.screen_texture = GetRenderContext().CreateTexture(Rhi::TextureSettings::ForFrameBuffer(GetRenderContext().GetSettings(), frame.index));
+            frame.screen_texture = GetRenderContext().CreateTexture(GetFrameBufferSettings(frame.index));
             frame.screen_texture.RestoreDescriptorViews(frame_restore_info.descriptor_by_view_id);
             frame.screen_texture.SetName(frame_restore_info.name);
             frame.screen_pass.Update({
@@ -147,6 +147,15 @@ public:
     bool  SetAnimationsEnabled(bool animations_enabled) override                     { return SetBaseAnimationsEnabled(animations_enabled); }
 
 protected:
+    void OnHeadlessFrameRendered(uint32_t frame_index) override
+    {
+        META_FUNCTION_TASK();
+        if (IsFramesDumpEnabled() && !GetHeadlessDumpDir().empty())
+        {
+            DumpFrameTexture(m_frames.at(GetRenderedFrameBufferIndex()).screen_texture, frame_index);
+        }
+    }
+
     void OnContextReleased(Rhi::IContext& context) override
     {
         META_FUNCTION_TASK();
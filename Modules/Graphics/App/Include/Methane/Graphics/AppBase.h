@@ -28,6 +28,7 @@ Base implementation of the Methane graphics application.
 
 #include <Methane/Data/IProvider.h>
 #include <Methane/Data/AnimationsPool.h>
+#include <Methane/Data/FramePacer.h>
 #include <Methane/Data/Receiver.hpp>
 #include <Methane/Platform/App.h>
 #include <Methane/Graphics/RHI/RenderContext.h>
@@ -35,6 +36,7 @@ Base implementation of the Methane graphics application.
 #include <Methane/Graphics/RHI/RenderPass.h>
 #include <Methane/Graphics/RHI/RenderPattern.h>
 #include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Fence.h>
 #include <Methane/Graphics/ImageLoader.h>
 #include <Methane/Checks.hpp>
 
@@ -82,6 +84,7 @@ protected:
     };
 
     Rhi::Device GetDefaultDevice() const;
+    Rhi::TextureSettings GetFrameBufferSettings(Data::Index frame_index) const;
     Rhi::TextureViews GetScreenPassAttachments(const Rhi::Texture& frame_buffer_texture) const;
     Rhi::RenderPass   CreateScreenRenderPass(const Rhi::Texture& frame_buffer_texture) const;
     Opt<ResourceRestoreInfo> ReleaseDepthTexture();
@@ -94,6 +97,14 @@ protected:
     void CompleteInitialization() const;
     void WaitForRenderComplete() const;
 
+    // Headless frame dumping: frame texture is read back and saved to PNG file in the dump directory
+    bool        IsFramesDumpEnabled() const noexcept         { return m_frames_dump_enabled && IsHeadless(); }
+    Data::Index GetRenderedFrameBufferIndex() const noexcept { return m_rendered_frame_buffer_index; }
+    void        DumpFrameTexture(const Rhi::Texture& frame_texture, uint32_t frame_index) const;
+
+    // Frame pacing: limits count of frames in flight on GPU and delays frame start to target input latency
+    const Data::FramePacer& GetFramePacer() const noexcept { return m_frame_pacer; }
+
     // Platform::AppBase interface
     Platform::AppView GetView() const override { return m_context.GetAppView(); }
 
@@ -102,6 +113,10 @@ protected:
     void OnContextUploadingResources(Rhi::IContext&) override { /* no event handling logic is needed here */ }
     void OnContextInitialized(Rhi::IContext&) override;
 
+    // Platform::AppBase overrides
+    void WaitForFrameStart() override;
+    void OnHeadlessRunCompleted() override;
+
     const Rhi::RenderContextSettings& GetInitialContextSettings() const noexcept  { return m_initial_context_settings; }
     Rhi::IRenderPattern::Settings&    GetScreenRenderPatternSettings() noexcept   { return m_screen_pass_pattern_settings; }
     const Rhi::RenderContext&         GetRenderContext() const noexcept           { return m_context; }
@@ -113,6 +128,8 @@ protected:
     Data::AnimationsPool&             GetAnimations() noexcept                    { return m_animations; }
 
 private:
+    void WaitForFramesInFlight();
+
     Graphics::IApp::Settings   m_settings;
     Rhi::RenderContextSettings m_initial_context_settings;
     Rhi::RenderPatternSettings m_screen_pass_pattern_settings;
@@ -124,6 +141,12 @@ private:
     Rhi::RenderPattern         m_screen_render_pattern;
     Rhi::ViewState             m_view_state;
     bool                       m_restore_animations_enabled = true;
+    bool                       m_frames_dump_enabled = false;
+    Data::Index                m_rendered_frame_buffer_index = 0U;
+    Data::FramePacer           m_frame_pacer;
+    double                     m_target_latency_ms = 0.0;
+    std::vector<Rhi::Fence>    m_frame_fences;
+    uint32_t                   m_rendered_frames_count = 0U;
 };
 
 } // namespace Methane::Graphics
\ No newline at end of file
@@ -26,12 +26,17 @@ Base implementation of the Methane graphics application.
 #include <Methane/Graphics/AppContextController.h>
 #include <Methane/Graphics/RHI/System.h>
 #include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/ImageSaver.h>
 #include <Methane/Data/IProvider.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <fmt/format.h>
 #include <magic_enum/magic_enum.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <thread>
 
 namespace Methane::Graphics
@@ -56,6 +61,11 @@ AppBase::AppBase(const CombinedAppSettings& settings, Data::IProvider& textures_
     add_option("-d,--device", m_settings.default_device_index, "Render at adapter index, use -1 for software adapter");
     add_option("-v,--vsync", m_initial_context_settings.vsync_enabled, "Vertical synchronization");
     add_option("-b,--frame-buffers", m_initial_context_settings.frame_buffers_count, "Frame buffers count in swap-chain");
+    add_flag("--dump-frames", m_frames_dump_enabled, "Save rendered frames as PNG images to the dump directory in headless mode");
+    add_option_function<uint32_t>("--max-frames-in-flight",
+                                  [this](uint32_t max_frames_in_flight) { m_frame_pacer.SetMaxFramesInFlight(max_frames_in_flight); },
+                                  "Maximum count of frames rendered by GPU while CPU prepares next frame, 0 - limited by frame buffers count");
+    add_option("--target-latency", m_target_latency_ms, "Delay frame start to target input to GPU frame completion latency in milliseconds, 0 - disabled");
 
 #ifdef _WIN32
     add_flag("-e,--emulated-render-pass",
@@ -97,8 +107,24 @@ void AppBase::InitContext(const Platform::AppEnvironment& env, const FrameSize&
     META_FUNCTION_TASK();
     META_LOG("\n====================== CONTEXT INITIALIZATION ======================");
 
-    // Get default device for rendering
-    Rhi::System::Get().UpdateGpuDevices(env, m_settings.device_capabilities);
+    // Render context without window is supported by Null backend and by Vulkan backend on Linux and Windows only
+#if defined META_GFX_NULL
+    constexpr bool is_headless_supported = true;
+#elif defined __APPLE__
+    constexpr bool is_headless_supported = false;
+#else
+    const bool is_headless_supported = Rhi::ISystem::GetNativeApi() == Rhi::NativeApi::Vulkan;
+#endif
+    META_CHECK_FALSE_DESCR(IsHeadless() && !is_headless_supported,
+                           "headless mode is not supported with {} graphics API, since its render context requires window",
+                           magic_enum::enum_name(Rhi::ISystem::GetNativeApi()));
+
+    // Get default device for rendering, devices are not required to present to window in headless mode
+    Rhi::DeviceCaps device_capabilities = m_settings.device_capabilities;
+    if (IsHeadless())
+        device_capabilities.features.SetBitOff(Rhi::DeviceFeature::PresentToWindow);
+
+    Rhi::System::Get().UpdateGpuDevices(env, device_capabilities);
     const Rhi::Device device = GetDefaultDevice();
     META_CHECK_TRUE(device.IsInitialized());
 
@@ -110,7 +136,7 @@ void AppBase::InitContext(const Platform::AppEnvironment& env, const FrameSize&
 
     // Fill initial screen render-pass pattern settings
     m_screen_pass_pattern_settings.shader_access = m_settings.screen_pass_access;
-    m_screen_pass_pattern_settings.is_final_pass = true;
+    m_screen_pass_pattern_settings.is_final_pass = !IsHeadless(); // offscreen frame is not presented in headless mode
 
     // Final frame color attachment
     Data::Index attachment_index = 0U;
@@ -151,6 +177,11 @@ void AppBase::Init()
     META_FUNCTION_TASK();
     META_LOG("\n======================== APP INITIALIZATION ========================");
 
+    // Animations are driven by the frame clock, which is fixed-step or recorded for deterministic runs
+    m_animations.SetClock(GetFrameClock());
+
+    m_frame_pacer.SetTargetLatency(m_target_latency_ms);
+
     if (!m_settings.animations_enabled)
     {
         m_settings.animations_enabled = true;
@@ -222,7 +253,7 @@ bool AppBase::Update()
     Rhi::ISystem::Get().CheckForChanges();
 
     // Update HUD info in window title
-    if (m_settings.show_hud_in_window_title &&
+    if (m_settings.show_hud_in_window_title && !IsHeadless() &&
         m_title_update_timer.GetElapsedSecondsD() >= g_title_update_interval_sec)
     {
         UpdateWindowTitle();
@@ -251,10 +282,58 @@ bool AppBase::Render()
     META_LOG("\n========================= FRAME {} RENDERING =========================", m_context.GetFrameIndex());
 
     // Wait for previous frame rendering is completed and switch to next frame
+    m_frame_pacer.OnFrameRenderStarted();
+    WaitForFramesInFlight();
     m_context.WaitForGpu(Rhi::IContext::WaitFor::FramePresented);
+
+    const uint32_t frame_buffers_count = m_context.GetSettings().frame_buffers_count;
+    const uint32_t max_frames_in_flight = m_frame_pacer.GetMaxFramesInFlight();
+    m_frame_pacer.OnFrameWaitCompleted(max_frames_in_flight ? std::min(max_frames_in_flight, frame_buffers_count) : frame_buffers_count);
+    m_rendered_frame_buffer_index = m_context.GetFrameBufferIndex();
+    m_rendered_frames_count++;
     return true;
 }
 
+void AppBase::WaitForFrameStart()
+{
+    META_FUNCTION_TASK();
+    if (Platform::App::IsMinimized() || !m_context.IsInitialized())
+        return;
+
+    // Frame start is delayed instead of waiting for GPU after input sampling to reduce input latency
+    if (const double start_delay_ms = m_frame_pacer.GetStartDelayMs(); start_delay_ms > 0.0)
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(start_delay_ms));
+
+    m_frame_pacer.OnFrameStarted();
+}
+
+void AppBase::WaitForFramesInFlight()
+{
+    META_FUNCTION_TASK();
+    const uint32_t max_frames_in_flight = m_frame_pacer.GetMaxFramesInFlight();
+    if (!max_frames_in_flight)
+        return;
+
+    if (m_frame_fences.size() != max_frames_in_flight)
+    {
+        const Rhi::CommandQueue render_cmd_queue = m_context.GetRenderCommandKit().GetQueue();
+        m_frame_fences.clear();
+        for (uint32_t fence_index = 0U; fence_index < max_frames_in_flight; ++fence_index)
+        {
+            Rhi::Fence& frame_fence = m_frame_fences.emplace_back(render_cmd_queue.CreateFence());
+            frame_fence.SetName(fmt::format("Frame Pacing Fence {}", fence_index));
+        }
+    }
+
+    // Previous frame is submitted and presented at this point, so it is marked with the fence signalled in the render queue
+    if (m_rendered_frames_count > 0U)
+        m_frame_fences[(m_rendered_frames_count - 1U) % max_frames_in_flight].Signal();
+
+    // Fence of the current frame slot was signalled after the frame rendered max frames in flight before the current one
+    if (m_rendered_frames_count >= max_frames_in_flight)
+        m_frame_fences[m_rendered_frames_count % max_frames_in_flight].WaitOnCpu();
+}
+
 bool AppBase::SetFullScreen(bool is_full_screen)
 {
     META_FUNCTION_TASK();
@@ -300,6 +379,20 @@ void AppBase::SetShowHudInWindowTitle(bool show_hud_in_window_title)
     UpdateWindowTitle();
 }
 
+Rhi::TextureSettings AppBase::GetFrameBufferSettings(Data::Index frame_index) const
+{
+    META_FUNCTION_TASK();
+    const Rhi::RenderContextSettings& context_settings = m_context.GetSettings();
+    if (!IsHeadless())
+        return Rhi::TextureSettings::ForFrameBuffer(context_settings, frame_index);
+
+    // Offscreen render target is used instead of swap-chain frame buffer in headless mode
+    return Rhi::TextureSettings::ForImage(
+        Dimensions(context_settings.frame_size), std::nullopt, context_settings.color_format, false,
+        Rhi::ResourceUsageMask{ Rhi::ResourceUsage::RenderTarget, Rhi::ResourceUsage::ReadBack }
+    );
+}
+
 Rhi::TextureViews AppBase::GetScreenPassAttachments(const Rhi::Texture& frame_buffer_texture) const
 {
     META_FUNCTION_TASK();
@@ -356,10 +449,12 @@ void AppBase::UpdateWindowTitle()
     const Data::IFpsCounter&          fps_counter      = m_context.GetFpsCounter();
     const uint32_t                    average_fps      = fps_counter.GetFramesPerSecond();
     const Data::FrameTiming       average_frame_timing = fps_counter.GetAverageFrameTiming();
+    const Data::FramePacer::FrameTimings average_pacing_timings = m_frame_pacer.GetAverageFrameTimings();
 
-    const std::string title = fmt::format("{:s}        {:d} FPS, {:.2f} ms, {:.2f}% CPU |  {:d} x {:d}  |  {:d} FB  |  VSync {:s}  |  {:s}  |  {:s}  |  F1 - help",
+    const std::string title = fmt::format("{:s}        {:d} FPS, {:.2f} ms, {:.2f}% CPU, {:.1f} ms latency |  {:d} x {:d}  |  {:d} FB  |  VSync {:s}  |  {:s}  |  {:s}  |  F1 - help",
                                           GetPlatformAppSettings().name,
                                           average_fps, average_frame_timing.GetTotalTimeMSec(), average_frame_timing.GetCpuTimePercent(),
+                                          average_pacing_timings.latency_ms,
                                           context_settings.frame_size.GetWidth(), context_settings.frame_size.GetHeight(),
                                           context_settings.frame_buffers_count, (context_settings.vsync_enabled ? "ON" : "OFF"),
                                           m_context.GetDevice().GetAdapterName(),
@@ -386,6 +481,36 @@ void AppBase::WaitForRenderComplete() const
     }
 }
 
+void AppBase::DumpFrameTexture(const Rhi::Texture& frame_texture, uint32_t frame_index) const
+{
+    META_FUNCTION_TASK();
+    const Rhi::TextureSettings& frame_settings = frame_texture.GetSettings();
+    META_CHECK_EQUAL_DESCR(GetPixelSize(frame_settings.pixel_format), 4U, "only frame textures with 4 bytes per pixel can be dumped");
+
+    WaitForRenderComplete();
+    const Rhi::SubResource frame_data = frame_texture.GetData(m_context.GetRenderCommandKit().GetQueue());
+
+    // Backends without rasterization may return no frame data, which is dumped as black image
+    const Dimensions& frame_dimensions = frame_settings.dimensions;
+    Data::Bytes frame_pixels(frame_data.GetDataPtr(), frame_data.GetDataEndPtr());
+    frame_pixels.resize(static_cast<size_t>(frame_dimensions.GetWidth()) * frame_dimensions.GetHeight() * 4U, std::byte{});
+
+    if (frame_settings.pixel_format == PixelFormat::BGRA8Unorm ||
+        frame_settings.pixel_format == PixelFormat::BGRA8Unorm_sRGB)
+    {
+        for (size_t pixel_offset = 0U; pixel_offset < frame_pixels.size(); pixel_offset += 4U)
+        {
+            std::swap(frame_pixels[pixel_offset], frame_pixels[pixel_offset + 2U]);
+        }
+    }
+
+    const std::filesystem::path dump_dir_path(GetHeadlessDumpDir());
+    std::filesystem::create_directories(dump_dir_path);
+    const std::filesystem::path frame_file_path = dump_dir_path / fmt::format("frame_{:05d}.png", frame_index);
+    ImageSaver::SaveImageToPngFile(frame_file_path.string(), Dimensions(frame_dimensions.GetWidth(), frame_dimensions.GetHeight()),
+                                   4U, frame_pixels.data());
+}
+
 void AppBase::OnContextReleased(Rhi::IContext&)
 {
     META_FUNCTION_TASK();
@@ -396,10 +521,35 @@ void AppBase::OnContextReleased(Rhi::IContext&)
     m_screen_render_pattern = {};
     m_depth_texture = {};
     m_view_state = {};
+    m_frame_fences.clear();
+    m_rendered_frames_count = 0U;
+    m_frame_pacer.Reset();
 
     Deinitialize();
 }
 
+void AppBase::OnHeadlessRunCompleted()
+{
+    META_FUNCTION_TASK();
+    if (GetHeadlessDumpDir().empty())
+        return;
+
+    const std::filesystem::path dump_dir_path(GetHeadlessDumpDir());
+    std::filesystem::create_directories(dump_dir_path);
+
+    const std::filesystem::path pacing_file_path = dump_dir_path / "frame_pacing.csv";
+    std::ofstream pacing_file(pacing_file_path);
+    META_CHECK_TRUE_DESCR(pacing_file.is_open(), "failed to open frame pacing file '{}'", pacing_file_path.string());
+
+    pacing_file << "frame,start_delay_ms,update_ms,wait_ms,render_ms,latency_ms" << std::endl;
+    for (const Data::FramePacer::FrameTimings& frame_timings : m_frame_pacer.GetFramesTimings())
+    {
+        pacing_file << fmt::format("{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f}", frame_timings.frame_index,
+                                   frame_timings.start_delay_ms, frame_timings.update_time_ms, frame_timings.wait_time_ms,
+                                   frame_timings.render_time_ms, frame_timings.latency_ms) << std::endl;
+    }
+}
+
 void AppBase::OnContextInitialized(Rhi::IContext&)
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,115 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/InstanceTransformSystem.h
+System of instance transformations with structure-of-arrays storage of positions, rotations and scales,
+batched composition of model-view-projection matrices and frustum culling in parallel chunks.
+
+******************************************************************************/
+
+#pragma once
+
+#include <hlsl++_vector_float.h>
+#include <hlsl++_matrix_float.h>
+
+#include <vector>
+#include <array>
+#include <cstdint>
+
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+class Camera;
+
+class InstanceTransformSystem
+{
+public:
+    using InstanceIndex   = uint32_t;
+    using InstanceIndices = std::vector<InstanceIndex>;
+    using Matrices        = std::vector<hlslpp::float4x4>;
+
+    static constexpr uint32_t chunk_size = 4096U;
+
+    // Instances are culled by bounding sphere of the given radius in local instance space
+    explicit InstanceTransformSystem(float bounding_sphere_radius = 1.F);
+
+    [[nodiscard]] uint32_t GetInstancesCount() const noexcept { return static_cast<uint32_t>(m_scales.size()); }
+    [[nodiscard]] float    GetBoundingSphereRadius() const noexcept { return m_bounding_sphere_radius; }
+
+    // New instances are initialized with identity transformation
+    void Resize(uint32_t instances_count);
+
+    // Rotation is a unit quaternion stored as (x, y, z, w) vector,
+    // transformation is applied to instance mesh in order: scale, rotation, translation
+    void SetTransform(InstanceIndex instance_index, const hlslpp::float3& position, const hlslpp::float4& rotation, float scale);
+    void SetPosition(InstanceIndex instance_index, const hlslpp::float3& position);
+    void SetRotation(InstanceIndex instance_index, const hlslpp::float4& rotation);
+    void SetScale(InstanceIndex instance_index, float scale);
+
+    [[nodiscard]] hlslpp::float3 GetPosition(InstanceIndex instance_index) const;
+    [[nodiscard]] hlslpp::float4 GetRotation(InstanceIndex instance_index) const;
+    [[nodiscard]] float          GetScale(InstanceIndex instance_index) const;
+
+    // Culls instances by view frustum, composes MVP matrices of visible instances
+    // and compacts them in the original instances order
+    void Update(const hlslpp::float4x4& view_proj_matrix, tf::Executor& parallel_executor);
+    void Update(const Camera& camera, tf::Executor& parallel_executor);
+
+    // Visible instance MVP matrices are transposed to be used in shader uniforms as is
+    [[nodiscard]] uint32_t               GetVisibleInstancesCount() const noexcept { return static_cast<uint32_t>(m_visible_instances.size()); }
+    [[nodiscard]] const InstanceIndices& GetVisibleInstances() const noexcept      { return m_visible_instances; }
+    [[nodiscard]] const Matrices&        GetVisibleMvpMatrices() const noexcept    { return m_visible_mvp_matrices; }
+
+    [[nodiscard]] static hlslpp::float4 GetAxisRotation(const hlslpp::float3& axis, float angle_rad);
+    [[nodiscard]] static hlslpp::float4 CombineRotations(const hlslpp::float4& first_rotation, const hlslpp::float4& second_rotation);
+
+private:
+    using Floats = std::vector<float>;
+    using Plane  = std::array<float, 4>;
+    using Planes = std::array<Plane, 6>;
+    using Matrix = std::array<std::array<float, 4>, 4>;
+
+    [[nodiscard]] static Matrix GetMatrixRows(const hlslpp::float4x4& matrix);
+    [[nodiscard]] static Planes GetFrustumPlanes(const Matrix& view_proj);
+
+    void CullChunk(uint32_t chunk_index, const Planes& frustum_planes);
+    void ComposeChunk(uint32_t chunk_index, const Matrix& view_proj);
+
+    const float           m_bounding_sphere_radius;
+    Floats                m_positions_x;
+    Floats                m_positions_y;
+    Floats                m_positions_z;
+    Floats                m_rotations_x;
+    Floats                m_rotations_y;
+    Floats                m_rotations_z;
+    Floats                m_rotations_w;
+    Floats                m_scales;
+    std::vector<uint8_t>  m_visibility;
+    std::vector<uint32_t> m_visible_count_per_chunk;
+    std::vector<uint32_t> m_visible_offset_per_chunk;
+    InstanceIndices       m_visible_instances;
+    Matrices              m_visible_mvp_matrices;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,318 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/InstanceTransformSystem.cpp
+System of instance transformations with structure-of-arrays storage of positions, rotations and scales,
+batched composition of model-view-projection matrices and frustum culling in parallel chunks.
+
+******************************************************************************/
+
+#include <Methane/Graphics/InstanceTransformSystem.h>
+#include <Methane/Graphics/Camera.h>
+
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+InstanceTransformSystem::Matrix InstanceTransformSystem::GetMatrixRows(const hlslpp::float4x4& matrix)
+{
+    META_FUNCTION_TASK();
+    const std::array<hlslpp::float4, 4> basis_rows{
+        hlslpp::float4(1.F, 0.F, 0.F, 0.F),
+        hlslpp::float4(0.F, 1.F, 0.F, 0.F),
+        hlslpp::float4(0.F, 0.F, 1.F, 0.F),
+        hlslpp::float4(0.F, 0.F, 0.F, 1.F),
+    };
+    Matrix matrix_rows{};
+    for(size_t row_index = 0U; row_index < matrix_rows.size(); ++row_index)
+    {
+        const hlslpp::float4 row = hlslpp::mul(basis_rows[row_index], matrix);
+        matrix_rows[row_index] = { row.x, row.y, row.z, row.w };
+    }
+    return matrix_rows;
+}
+
+// Frustum planes are extracted from columns of view-projection matrix, which transforms row vectors to clip space
+// with depth clipped to [0, w] range; planes are normalized to get distances from points to planes
+InstanceTransformSystem::Planes InstanceTransformSystem::GetFrustumPlanes(const Matrix& view_proj)
+{
+    META_FUNCTION_TASK();
+    const auto get_column = [&view_proj](size_t column_index, float sign)
+    {
+        return Plane{
+            sign * view_proj[0][column_index], sign * view_proj[1][column_index],
+            sign * view_proj[2][column_index], sign * view_proj[3][column_index]
+        };
+    };
+    const auto add_planes = [](const Plane& left, const Plane& right)
+    {
+        return Plane{ left[0] + right[0], left[1] + right[1], left[2] + right[2], left[3] + right[3] };
+    };
+
+    Planes planes{
+        add_planes(get_column(3U, 1.F), get_column(0U,  1.F)), // left
+        add_planes(get_column(3U, 1.F), get_column(0U, -1.F)), // right
+        add_planes(get_column(3U, 1.F), get_column(1U,  1.F)), // bottom
+        add_planes(get_column(3U, 1.F), get_column(1U, -1.F)), // top
+        get_column(2U, 1.F),                                   // near
+        add_planes(get_column(3U, 1.F), get_column(2U, -1.F)), // far
+    };
+    for(Plane& plane : planes)
+    {
+        const float normal_length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (normal_length <= 0.F)
+            continue;
+
+        for(float& plane_component : plane)
+            plane_component /= normal_length;
+    }
+    return planes;
+}
+
+InstanceTransformSystem::InstanceTransformSystem(float bounding_sphere_radius)
+    : m_bounding_sphere_radius(bounding_sphere_radius)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_OR_EQUAL(bounding_sphere_radius, 0.F);
+}
+
+void InstanceTransformSystem::Resize(uint32_t instances_count)
+{
+    META_FUNCTION_TASK();
+    m_positions_x.resize(instances_count, 0.F);
+    m_positions_y.resize(instances_count, 0.F);
+    m_positions_z.resize(instances_count, 0.F);
+    m_rotations_x.resize(instances_count, 0.F);
+    m_rotations_y.resize(instances_count, 0.F);
+    m_rotations_z.resize(instances_count, 0.F);
+    m_rotations_w.resize(instances_count, 1.F);
+    m_scales.resize(instances_count, 1.F);
+    m_visibility.resize(instances_count, 0U);
+}
+
+void InstanceTransformSystem::SetTransform(InstanceIndex instance_index, const hlslpp::float3& position, const hlslpp::float4& rotation, float scale)
+{
+    META_FUNCTION_TASK();
+    SetPosition(instance_index, position);
+    SetRotation(instance_index, rotation);
+    SetScale(instance_index, scale);
+}
+
+void InstanceTransformSystem::SetPosition(InstanceIndex instance_index, const hlslpp::float3& position)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(instance_index, GetInstancesCount());
+    m_positions_x[instance_index] = position.x;
+    m_positions_y[instance_index] = position.y;
+    m_positions_z[instance_index] = position.z;
+}
+
+void InstanceTransformSystem::SetRotation(InstanceIndex instance_index, const hlslpp::float4& rotation)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(instance_index, GetInstancesCount());
+    m_rotations_x[instance_index] = rotation.x;
+    m_rotations_y[instance_index] = rotation.y;
+    m_rotations_z[instance_index] = rotation.z;
+    m_rotations_w[instance_index] = rotation.w;
+}
+
+void InstanceTransformSystem::SetScale(InstanceIndex instance_index, float scale)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(instance_index, GetInstancesCount());
+    m_scales[instance_index] = scale;
+}
+
+hlslpp::float3 InstanceTransformSystem::GetPosition(InstanceIndex instance_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(instance_index, GetInstancesCount());
+    return hlslpp::float3(m_positions_x[instance_index], m_positions_y[instance_index], m_positions_z[instance_index]);
+}
+
+hlslpp::float4 InstanceTransformSystem::GetRotation(InstanceIndex instance_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(instance_index, GetInstancesCount());
+    return hlslpp::float4(m_rotations_x[instance_index], m_rotations_y[instance_index],
+                          m_rotations_z[instance_index], m_rotations_w[instance_index]);
+}
+
+float InstanceTransformSystem::GetScale(InstanceIndex instance_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(instance_index, GetInstancesCount());
+    return m_scales[instance_index];
+}
+
+void InstanceTransformSystem::Update(const Camera& camera, tf::Executor& parallel_executor)
+{
+    META_FUNCTION_TASK();
+    Update(camera.GetViewProjMatrix(), parallel_executor);
+}
+
+void InstanceTransformSystem::Update(const hlslpp::float4x4& view_proj_matrix, tf::Executor& parallel_executor)
+{
+    META_FUNCTION_TASK();
+    const uint32_t chunks_count = Data::DivCeil(GetInstancesCount(), chunk_size);
+    const Matrix   view_proj    = GetMatrixRows(view_proj_matrix);
+    const Planes   frustum_planes = GetFrustumPlanes(view_proj);
+    m_visible_count_per_chunk.assign(chunks_count, 0U);
+    m_visible_offset_per_chunk.assign(chunks_count, 0U);
+
+    // Visible instances are counted per chunk in parallel
+    tf::Taskflow cull_task_flow;
+    cull_task_flow.for_each_index(0U, chunks_count, 1U,
+        [this, &frustum_planes](const uint32_t chunk_index)
+        { CullChunk(chunk_index, frustum_planes); },
+        tf::StaticPartitioner()
+    );
+    parallel_executor.run(cull_task_flow).get();
+
+    // Chunk offsets in compacted list of visible instances are calculated with prefix sum of visible counts
+    uint32_t visible_instances_count = 0U;
+    for(uint32_t chunk_index = 0U; chunk_index < chunks_count; ++chunk_index)
+    {
+        m_visible_offset_per_chunk[chunk_index] = visible_instances_count;
+        visible_instances_count += m_visible_count_per_chunk[chunk_index];
+    }
+    m_visible_instances.resize(visible_instances_count);
+    m_visible_mvp_matrices.resize(visible_instances_count);
+
+    // MVP matrices of visible instances are composed and written to compacted list in parallel
+    tf::Taskflow compose_task_flow;
+    compose_task_flow.for_each_index(0U, chunks_count, 1U,
+        [this, &view_proj](const uint32_t chunk_index)
+        { ComposeChunk(chunk_index, view_proj); },
+        tf::StaticPartitioner()
+    );
+    parallel_executor.run(compose_task_flow).get();
+}
+
+hlslpp::float4 InstanceTransformSystem::GetAxisRotation(const hlslpp::float3& axis, float angle_rad)
+{
+    META_FUNCTION_TASK();
+    const float half_angle_rad = angle_rad / 2.F;
+    return hlslpp::float4(hlslpp::normalize(axis) * std::sin(half_angle_rad), std::cos(half_angle_rad));
+}
+
+hlslpp::float4 InstanceTransformSystem::CombineRotations(const hlslpp::float4& first_rotation, const hlslpp::float4& second_rotation)
+{
+    META_FUNCTION_TASK();
+    // Quaternion product 'second * first' rotates with the first rotation and then with the second one
+    const hlslpp::float3 first_vec  = first_rotation.xyz;
+    const hlslpp::float3 second_vec = second_rotation.xyz;
+    const float          first_w    = first_rotation.w;
+    const float          second_w   = second_rotation.w;
+    return hlslpp::float4(second_w * first_vec + first_w * second_vec + hlslpp::cross(second_vec, first_vec),
+                          second_w * first_w - static_cast<float>(hlslpp::dot(second_vec, first_vec)));
+}
+
+void InstanceTransformSystem::CullChunk(uint32_t chunk_index, const Planes& frustum_planes)
+{
+    META_FUNCTION_TASK();
+    const uint32_t begin_index = chunk_index * chunk_size;
+    const uint32_t end_index   = std::min(begin_index + chunk_size, GetInstancesCount());
+
+    // Bounding spheres are tested against all frustum planes in a branch-free loop over arrays,
+    // which is vectorized by compiler
+    const float*   positions_x = m_positions_x.data();
+    const float*   positions_y = m_positions_y.data();
+    const float*   positions_z = m_positions_z.data();
+    const float*   scales      = m_scales.data();
+    uint8_t*       visibility  = m_visibility.data();
+    for(uint32_t index = begin_index; index < end_index; ++index)
+    {
+        const float neg_radius = -m_bounding_sphere_radius * std::abs(scales[index]);
+        uint8_t is_visible = 1U;
+        for(const Plane& plane : frustum_planes)
+        {
+            const float distance = plane[0] * positions_x[index] + plane[1] * positions_y[index] + plane[2] * positions_z[index] + plane[3];
+            is_visible &= static_cast<uint8_t>(distance >= neg_radius);
+        }
+        visibility[index] = is_visible;
+    }
+
+    uint32_t visible_count = 0U;
+    for(uint32_t index = begin_index; index < end_index; ++index)
+    {
+        visible_count += visibility[index];
+    }
+    m_visible_count_per_chunk[chunk_index] = visible_count;
+}
+
+void InstanceTransformSystem::ComposeChunk(uint32_t chunk_index, const Matrix& view_proj)
+{
+    META_FUNCTION_TASK();
+    const uint32_t begin_index = chunk_index * chunk_size;
+    const uint32_t end_index   = std::min(begin_index + chunk_size, GetInstancesCount());
+    uint32_t       visible_index = m_visible_offset_per_chunk[chunk_index];
+
+    for(uint32_t index = begin_index; index < end_index; ++index)
+    {
+        if (!m_visibility[index])
+            continue;
+
+        // Model matrix rows for row vectors: scaled rotation matrix from quaternion and translation
+        const float x = m_rotations_x[index];
+        const float y = m_rotations_y[index];
+        const float z = m_rotations_z[index];
+        const float w = m_rotations_w[index];
+        const float s = m_scales[index];
+        const std::array<std::array<float, 3>, 4> model{{
+            { s * (1.F - 2.F * (y * y + z * z)), s * 2.F * (x * y + z * w),         s * 2.F * (x * z - y * w)         },
+            { s * 2.F * (x * y - z * w),         s * (1.F - 2.F * (x * x + z * z)), s * 2.F * (y * z + x * w)         },
+            { s * 2.F * (x * z + y * w),         s * 2.F * (y * z - x * w),         s * (1.F - 2.F * (x * x + y * y)) },
+            { m_positions_x[index],              m_positions_y[index],              m_positions_z[index]              },
+        }};
+
+        // MVP = Model * ViewProj is transposed on composition for shader uniforms
+        Matrix mvp_transposed{};
+        for(size_t column_index = 0U; column_index < 4U; ++column_index)
+        {
+            for(size_t row_index = 0U; row_index < 4U; ++row_index)
+            {
+                mvp_transposed[column_index][row_index] = model[row_index][0] * view_proj[0][column_index]
+                                                        + model[row_index][1] * view_proj[1][column_index]
+                                                        + model[row_index][2] * view_proj[2][column_index]
+                                                        + (row_index == 3U ? view_proj[3][column_index] : 0.F);
+            }
+        }
+
+        m_visible_instances[visible_index] = index;
+        m_visible_mvp_matrices[visible_index] = hlslpp::float4x4(
+            mvp_transposed[0][0], mvp_transposed[0][1], mvp_transposed[0][2], mvp_transposed[0][3],
+            mvp_transposed[1][0], mvp_transposed[1][1], mvp_transposed[1][2], mvp_transposed[1][3],
+            mvp_transposed[2][0], mvp_transposed[2][1], mvp_transposed[2][2], mvp_transposed[2][3],
+            mvp_transposed[3][0], mvp_transposed[3][1], mvp_transposed[3][2], mvp_transposed[3][3]
+        );
+        ++visible_index;
+    }
+}
+
+} // namespace Methane::Graphics
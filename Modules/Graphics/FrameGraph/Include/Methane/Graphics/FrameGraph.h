@@ -0,0 +1,211 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrameGraph.h
+Frame graph of render passes declaring their resource reads and writes:
+graph is compiled to execution order with culled unused passes, resource state transitions
+and transient textures aliased across non-overlapping lifetimes.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/ITexture.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Memory.hpp>
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics::Rhi
+{
+struct IContext;
+struct ICommandList;
+}
+
+namespace Methane::Graphics
+{
+
+class FrameGraph;
+
+class FrameGraphPassContext
+{
+public:
+    FrameGraphPassContext(const FrameGraph& frame_graph, uint32_t pass_id) noexcept;
+
+    [[nodiscard]] uint32_t           GetPassId() const noexcept { return m_pass_id; }
+    [[nodiscard]] const std::string& GetPassName() const;
+
+    // Returns physical texture of the resource, which must be declared in pass reads or writes
+    [[nodiscard]] Rhi::ITexture& GetTexture(uint32_t resource_id) const;
+
+    // Sets resource barriers of pass state transitions, which must be done before any pass commands encoding
+    void SetResourceBarriers(Rhi::ICommandList& command_list) const;
+
+private:
+    const FrameGraph& m_frame_graph;
+    const uint32_t    m_pass_id;
+};
+
+class FrameGraph
+{
+public:
+    using ResourceId  = uint32_t;
+    using PassId      = uint32_t;
+    using PassContext = FrameGraphPassContext;
+
+    // Pass execution function encodes commands to the command list and returns it,
+    // returned command list is executed in the order of frame graph passes; null may be returned for passes without commands
+    using ExecuteFunction = std::function<Rhi::ICommandList*(const PassContext&)>;
+
+    struct ResourceAccess
+    {
+        ResourceId         resource_id;
+        Rhi::ResourceState state;
+    };
+
+    using ResourceAccesses = std::vector<ResourceAccess>;
+
+    struct PassSettings
+    {
+        std::string      name;
+        ResourceAccesses reads;
+        ResourceAccesses writes;
+        bool             has_side_effects = false; // pass is never culled, even when its writes are not used
+    };
+
+    struct StateTransition
+    {
+        ResourceId              resource_id;
+        Opt<Rhi::ResourceState> state_before_opt; // empty on first access of physical texture in frame, when its state is known only on execution
+        Rhi::ResourceState      state_after;
+
+        [[nodiscard]] friend bool operator==(const StateTransition& left, const StateTransition& right) = default;
+    };
+
+    using StateTransitions = std::vector<StateTransition>;
+
+    struct MemoryReport
+    {
+        uint32_t   transient_textures_count = 0U;
+        uint32_t   allocated_textures_count = 0U;
+        Data::Size transient_memory_size    = 0U;
+        Data::Size allocated_memory_size    = 0U;
+
+        [[nodiscard]] Data::Size  GetSavedMemorySize() const noexcept { return transient_memory_size - allocated_memory_size; }
+        [[nodiscard]] std::string ToString() const;
+    };
+
+    static constexpr ResourceId invalid_id = std::numeric_limits<ResourceId>::max();
+
+    // Estimated memory size of texture with given settings, which does not include backend specific alignment
+    [[nodiscard]] static Data::Size GetTextureMemorySize(const Rhi::TextureSettings& settings);
+
+    // Graph declaration: compiled graph is invalidated on any declaration change
+    [[nodiscard]] ResourceId AddTexture(const std::string& name, const Rhi::TextureSettings& settings);
+    [[nodiscard]] ResourceId ImportTexture(const std::string& name, Rhi::ITexture& texture);
+    PassId AddPass(PassSettings settings, ExecuteFunction execute_function);
+    void   MarkOutput(ResourceId resource_id);
+    void   Clear();
+
+    // Graph compilation: passes are culled, ordered by dependency levels, transient textures lifetimes are aliased
+    void Compile();
+
+    [[nodiscard]] bool                       IsCompiled() const noexcept         { return m_is_compiled; }
+    [[nodiscard]] uint32_t                   GetPassesCount() const noexcept     { return static_cast<uint32_t>(m_passes.size()); }
+    [[nodiscard]] uint32_t                   GetResourcesCount() const noexcept  { return static_cast<uint32_t>(m_resources.size()); }
+    [[nodiscard]] uint32_t                   GetLevelsCount() const noexcept     { return m_levels_count; }
+    [[nodiscard]] const std::string&         GetPassName(PassId pass_id) const;
+    [[nodiscard]] const std::string&         GetResourceName(ResourceId resource_id) const;
+    [[nodiscard]] bool                       IsPassCulled(PassId pass_id) const;
+    [[nodiscard]] uint32_t                   GetPassLevel(PassId pass_id) const;
+    [[nodiscard]] const std::vector<PassId>& GetExecutionOrder() const;
+    [[nodiscard]] const StateTransitions&    GetPassTransitions(PassId pass_id) const;
+    [[nodiscard]] uint32_t                   GetTextureAllocationIndex(ResourceId resource_id) const;
+    [[nodiscard]] uint32_t                   GetTextureAllocationsCount() const;
+    [[nodiscard]] MemoryReport               GetMemoryReport() const;
+
+    // Graph execution: transient textures are created once per compiled graph,
+    // independent passes of each dependency level are encoded in parallel
+    void CreateTransientTextures(const Rhi::IContext& context);
+    [[nodiscard]] Refs<Rhi::ICommandList> Execute(tf::Executor& parallel_executor);
+
+    [[nodiscard]] Rhi::ITexture& GetTexture(ResourceId resource_id) const;
+
+private:
+    friend class FrameGraphPassContext;
+
+    struct Resource
+    {
+        std::string          name;
+        Rhi::TextureSettings settings;
+        Rhi::ITexture*       imported_texture_ptr = nullptr;
+        bool                 is_output            = false;
+        uint32_t             first_level          = 0U;
+        uint32_t             last_level           = 0U;
+        bool                 is_used              = false;
+        uint32_t             allocation_index     = invalid_id;
+    };
+
+    struct Pass
+    {
+        PassSettings                settings;
+        ExecuteFunction             execute_function;
+        std::vector<PassId>         data_dependencies;
+        std::vector<PassId>         order_dependencies;
+        bool                        is_culled = false;
+        uint32_t                    level     = 0U;
+        StateTransitions            transitions;
+        Ptr<Rhi::IResourceBarriers> barriers_ptr;
+    };
+
+    struct Allocation
+    {
+        Rhi::TextureSettings settings;
+        uint32_t             last_level = 0U;
+        Ptr<Rhi::ITexture>   texture_ptr;
+    };
+
+    [[nodiscard]] const Pass&     GetPass(PassId pass_id) const;
+    [[nodiscard]] const Resource& GetResource(ResourceId resource_id) const;
+    void CheckCompiled() const;
+    void Invalidate();
+    void BuildDependencies();
+    void CullPasses();
+    void AssignLevels();
+    void AliasTransientTextures();
+    void BuildStateTransitions();
+
+    std::vector<Resource>   m_resources;
+    std::vector<Pass>       m_passes;
+    std::vector<PassId>     m_execution_order;
+    std::vector<Allocation> m_allocations;
+    uint32_t                m_levels_count = 0U;
+    bool                    m_is_compiled  = false;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,571 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrameGraph.cpp
+Frame graph of render passes declaring their resource reads and writes:
+graph is compiled to execution order with culled unused passes, resource state transitions
+and transient textures aliased across non-overlapping lifetimes.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrameGraph.h>
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Graphics/RHI/ICommandList.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace Methane::Graphics
+{
+
+FrameGraphPassContext::FrameGraphPassContext(const FrameGraph& frame_graph, uint32_t pass_id) noexcept
+    : m_frame_graph(frame_graph)
+    , m_pass_id(pass_id)
+{ }
+
+const std::string& FrameGraphPassContext::GetPassName() const
+{
+    META_FUNCTION_TASK();
+    return m_frame_graph.GetPassName(m_pass_id);
+}
+
+Rhi::ITexture& FrameGraphPassContext::GetTexture(uint32_t resource_id) const
+{
+    META_FUNCTION_TASK();
+    const FrameGraph::PassSettings& pass_settings = m_frame_graph.GetPass(m_pass_id).settings;
+    const auto is_resource_accessed = [resource_id](const FrameGraph::ResourceAccess& access)
+    { return access.resource_id == resource_id; };
+    META_CHECK_TRUE_DESCR(std::ranges::any_of(pass_settings.reads, is_resource_accessed) ||
+                          std::ranges::any_of(pass_settings.writes, is_resource_accessed),
+                          "frame graph pass '{}' does not declare access to resource '{}'",
+                          pass_settings.name, m_frame_graph.GetResourceName(resource_id));
+    return m_frame_graph.GetTexture(resource_id);
+}
+
+void FrameGraphPassContext::SetResourceBarriers(Rhi::ICommandList& command_list) const
+{
+    META_FUNCTION_TASK();
+    const Ptr<Rhi::IResourceBarriers>& barriers_ptr = m_frame_graph.GetPass(m_pass_id).barriers_ptr;
+    if (barriers_ptr && !barriers_ptr->IsEmpty())
+    {
+        command_list.SetResourceBarriers(*barriers_ptr);
+    }
+}
+
+std::string FrameGraph::MemoryReport::ToString() const
+{
+    META_FUNCTION_TASK();
+    return fmt::format("{} transient textures of {} bytes are aliased to {} textures of {} bytes, saving {} bytes",
+                       transient_textures_count, transient_memory_size,
+                       allocated_textures_count, allocated_memory_size,
+                       GetSavedMemorySize());
+}
+
+Data::Size FrameGraph::GetTextureMemorySize(const Rhi::TextureSettings& settings)
+{
+    META_FUNCTION_TASK();
+    const bool is_volume = settings.dimension_type == Rhi::TextureDimensionType::Tex3D;
+    uint32_t   width     = settings.dimensions.GetWidth();
+    uint32_t   height    = settings.dimensions.GetHeight();
+    uint32_t   depth     = settings.dimensions.GetDepth();
+    Data::Size pixels_count = 0U;
+    while (true)
+    {
+        pixels_count += width * height * depth;
+        if (!settings.mipmapped || (width == 1U && height == 1U && (!is_volume || depth == 1U)))
+            break;
+
+        width  = std::max(1U, width / 2U);
+        height = std::max(1U, height / 2U);
+        depth  = is_volume ? std::max(1U, depth / 2U) : depth;
+    }
+    return pixels_count * settings.array_length * GetPixelSize(settings.pixel_format);
+}
+
+FrameGraph::ResourceId FrameGraph::AddTexture(const std::string& name, const Rhi::TextureSettings& settings)
+{
+    META_FUNCTION_TASK();
+    Invalidate();
+    m_resources.push_back(Resource{ .name = name, .settings = settings });
+    return static_cast<ResourceId>(m_resources.size() - 1U);
+}
+
+FrameGraph::ResourceId FrameGraph::ImportTexture(const std::string& name, Rhi::ITexture& texture)
+{
+    META_FUNCTION_TASK();
+    Invalidate();
+    m_resources.push_back(Resource{ .name = name, .settings = texture.GetSettings(), .imported_texture_ptr = &texture });
+    return static_cast<ResourceId>(m_resources.size() - 1U);
+}
+
+FrameGraph::PassId FrameGraph::AddPass(PassSettings settings, ExecuteFunction execute_function)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(execute_function, "frame graph pass '{}' execute function is not set", settings.name);
+
+    // Resource can be accessed by the pass only in a single state, even when it is both read and written
+    ResourceAccesses accesses = settings.reads;
+    accesses.insert(accesses.end(), settings.writes.begin(), settings.writes.end());
+    for (const ResourceAccess& access : accesses)
+    {
+        META_CHECK_LESS_DESCR(access.resource_id, GetResourcesCount(), "frame graph pass '{}' accesses unknown resource", settings.name);
+        META_CHECK_TRUE_DESCR(std::ranges::all_of(accesses, [&access](const ResourceAccess& other_access)
+                                                  { return other_access.resource_id != access.resource_id || other_access.state == access.state; }),
+                              "frame graph pass '{}' accesses resource '{}' in different states",
+                              settings.name, m_resources[access.resource_id].name);
+    }
+
+    Invalidate();
+    Pass& pass = m_passes.emplace_back();
+    pass.settings         = std::move(settings);
+    pass.execute_function = std::move(execute_function);
+    return static_cast<PassId>(m_passes.size() - 1U);
+}
+
+void FrameGraph::MarkOutput(ResourceId resource_id)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(resource_id, GetResourcesCount());
+    Invalidate();
+    m_resources[resource_id].is_output = true;
+}
+
+void FrameGraph::Clear()
+{
+    META_FUNCTION_TASK();
+    Invalidate();
+    m_resources.clear();
+    m_passes.clear();
+}
+
+void FrameGraph::Compile()
+{
+    META_FUNCTION_TASK();
+    Invalidate();
+    BuildDependencies();
+    CullPasses();
+    AssignLevels();
+    AliasTransientTextures();
+    BuildStateTransitions();
+    m_is_compiled = true;
+}
+
+const std::string& FrameGraph::GetPassName(PassId pass_id) const
+{
+    META_FUNCTION_TASK();
+    return GetPass(pass_id).settings.name;
+}
+
+const std::string& FrameGraph::GetResourceName(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    return GetResource(resource_id).name;
+}
+
+bool FrameGraph::IsPassCulled(PassId pass_id) const
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    return GetPass(pass_id).is_culled;
+}
+
+uint32_t FrameGraph::GetPassLevel(PassId pass_id) const
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    return GetPass(pass_id).level;
+}
+
+const std::vector<FrameGraph::PassId>& FrameGraph::GetExecutionOrder() const
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    return m_execution_order;
+}
+
+const FrameGraph::StateTransitions& FrameGraph::GetPassTransitions(PassId pass_id) const
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    return GetPass(pass_id).transitions;
+}
+
+uint32_t FrameGraph::GetTextureAllocationIndex(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    return GetResource(resource_id).allocation_index;
+}
+
+uint32_t FrameGraph::GetTextureAllocationsCount() const
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    return static_cast<uint32_t>(m_allocations.size());
+}
+
+FrameGraph::MemoryReport FrameGraph::GetMemoryReport() const
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    MemoryReport report;
+    for (const Resource& resource : m_resources)
+    {
+        if (resource.imported_texture_ptr || !resource.is_used)
+            continue;
+
+        report.transient_textures_count++;
+        report.transient_memory_size += GetTextureMemorySize(resource.settings);
+    }
+    for (const Allocation& allocation : m_allocations)
+    {
+        report.allocated_textures_count++;
+        report.allocated_memory_size += GetTextureMemorySize(allocation.settings);
+    }
+    return report;
+}
+
+void FrameGraph::CreateTransientTextures(const Rhi::IContext& context)
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+    for (uint32_t allocation_index = 0U; allocation_index < m_allocations.size(); ++allocation_index)
+    {
+        Allocation& allocation = m_allocations[allocation_index];
+        allocation.texture_ptr = Rhi::ITexture::Create(context, allocation.settings);
+        allocation.texture_ptr->SetName(fmt::format("Frame Graph Transient Texture {}", allocation_index));
+    }
+    for (Pass& pass : m_passes)
+    {
+        // Barriers hold references to the textures of previous allocations, so they are recreated on next execution
+        pass.barriers_ptr.reset();
+    }
+}
+
+Refs<Rhi::ICommandList> FrameGraph::Execute(tf::Executor& parallel_executor)
+{
+    META_FUNCTION_TASK();
+    CheckCompiled();
+
+    std::vector<Rhi::ICommandList*> pass_command_lists(m_execution_order.size(), nullptr);
+    auto level_begin_it = m_execution_order.begin();
+    while (level_begin_it != m_execution_order.end())
+    {
+        const uint32_t level = m_passes[*level_begin_it].level;
+        const auto level_end_it = std::find_if(level_begin_it, m_execution_order.end(),
+                                               [this, level](PassId pass_id) { return m_passes[pass_id].level != level; });
+
+        // Resource states are updated sequentially before encoding of each level, so that state tracking
+        // of the render passes and program bindings encoded in the pass functions is consistent with graph transitions
+        for (auto pass_it = level_begin_it; pass_it != level_end_it; ++pass_it)
+        {
+            Pass& pass = m_passes[*pass_it];
+            for (const StateTransition& transition : pass.transitions)
+            {
+                GetTexture(transition.resource_id).SetState(transition.state_after, pass.barriers_ptr);
+            }
+        }
+
+        // Passes of the same level do not depend on each other and never access the same physical texture in different states,
+        // since readers of the resource in different states are ordered by dependencies
+        const auto level_offset = static_cast<size_t>(std::distance(m_execution_order.begin(), level_begin_it));
+        tf::Taskflow execute_task_flow;
+        execute_task_flow.for_each_index(size_t(0), static_cast<size_t>(std::distance(level_begin_it, level_end_it)), size_t(1),
+            [this, level_offset, &pass_command_lists](const size_t level_pass_index)
+            {
+                META_FUNCTION_TASK();
+                const size_t order_index = level_offset + level_pass_index;
+                const PassId pass_id     = m_execution_order[order_index];
+                pass_command_lists[order_index] = m_passes[pass_id].execute_function(PassContext(*this, pass_id));
+            });
+        parallel_executor.run(execute_task_flow).get();
+        level_begin_it = level_end_it;
+    }
+
+    Refs<Rhi::ICommandList> command_lists;
+    for (Rhi::ICommandList* command_list_ptr : pass_command_lists)
+    {
+        if (command_list_ptr)
+            command_lists.emplace_back(*command_list_ptr);
+    }
+    return command_lists;
+}
+
+Rhi::ITexture& FrameGraph::GetTexture(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    const Resource& resource = GetResource(resource_id);
+    if (resource.imported_texture_ptr)
+        return *resource.imported_texture_ptr;
+
+    META_CHECK_NOT_EQUAL_DESCR(resource.allocation_index, invalid_id, "frame graph texture '{}' is not used by any pass", resource.name);
+    const Ptr<Rhi::ITexture>& texture_ptr = m_allocations[resource.allocation_index].texture_ptr;
+    META_CHECK_NOT_NULL_DESCR(texture_ptr, "frame graph transient textures were not created");
+    return *texture_ptr;
+}
+
+const FrameGraph::Pass& FrameGraph::GetPass(PassId pass_id) const
+{
+    META_CHECK_LESS(pass_id, GetPassesCount());
+    return m_passes[pass_id];
+}
+
+const FrameGraph::Resource& FrameGraph::GetResource(ResourceId resource_id) const
+{
+    META_CHECK_LESS(resource_id, GetResourcesCount());
+    return m_resources[resource_id];
+}
+
+void FrameGraph::CheckCompiled() const
+{
+    META_CHECK_TRUE_DESCR(m_is_compiled, "frame graph is not compiled");
+}
+
+void FrameGraph::Invalidate()
+{
+    META_FUNCTION_TASK();
+    m_is_compiled = false;
+    m_execution_order.clear();
+    m_allocations.clear();
+    m_levels_count = 0U;
+}
+
+void FrameGraph::BuildDependencies()
+{
+    META_FUNCTION_TASK();
+    // Passes are declared in submission order, so dependencies always refer to previously declared passes:
+    // data dependencies (read after write, write after write) propagate usage of pass results,
+    // while order dependencies also include write after read hazards and reads of the same resource in different states,
+    // so that passes of one level never access the same texture in different states
+    struct ResourceReader
+    {
+        PassId             pass_id;
+        Rhi::ResourceState state;
+    };
+
+    std::vector<PassId>                      last_writers(m_resources.size(), invalid_id);
+    std::vector<std::vector<ResourceReader>> readers_after_write(m_resources.size());
+
+    for (PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+    {
+        Pass& pass = m_passes[pass_id];
+        pass.data_dependencies.clear();
+        pass.order_dependencies.clear();
+
+        for (const ResourceAccess& read : pass.settings.reads)
+        {
+            if (last_writers[read.resource_id] != invalid_id)
+                pass.data_dependencies.push_back(last_writers[read.resource_id]);
+
+            for (const ResourceReader& reader : readers_after_write[read.resource_id])
+            {
+                if (reader.pass_id != pass_id && reader.state != read.state)
+                    pass.order_dependencies.push_back(reader.pass_id);
+            }
+        }
+        for (const ResourceAccess& write : pass.settings.writes)
+        {
+            if (last_writers[write.resource_id] != invalid_id)
+                pass.data_dependencies.push_back(last_writers[write.resource_id]);
+
+            for (const ResourceReader& reader : readers_after_write[write.resource_id])
+            {
+                if (reader.pass_id != pass_id)
+                    pass.order_dependencies.push_back(reader.pass_id);
+            }
+        }
+        pass.order_dependencies.insert(pass.order_dependencies.end(), pass.data_dependencies.begin(), pass.data_dependencies.end());
+
+        for (std::vector<PassId>* dependencies : { &pass.data_dependencies, &pass.order_dependencies })
+        {
+            std::ranges::sort(*dependencies);
+            const auto [unique_end_it, end_it] = std::ranges::unique(*dependencies);
+            dependencies->erase(unique_end_it, end_it);
+        }
+
+        for (const ResourceAccess& read : pass.settings.reads)
+        {
+            readers_after_write[read.resource_id].push_back({ pass_id, read.state });
+        }
+        for (const ResourceAccess& write : pass.settings.writes)
+        {
+            last_writers[write.resource_id] = pass_id;
+            readers_after_write[write.resource_id].clear();
+        }
+    }
+
+    for (ResourceId resource_id = 0U; resource_id < m_resources.size(); ++resource_id)
+    {
+        if (m_resources[resource_id].is_output)
+        {
+            META_CHECK_NOT_EQUAL_DESCR(last_writers[resource_id], invalid_id, "frame graph output resource '{}' is not written by any pass",
+                                       m_resources[resource_id].name);
+        }
+    }
+}
+
+void FrameGraph::CullPasses()
+{
+    META_FUNCTION_TASK();
+    std::vector<PassId> used_pass_ids;
+    for (PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+    {
+        Pass& pass = m_passes[pass_id];
+        pass.is_culled = !pass.settings.has_side_effects &&
+                         std::ranges::none_of(pass.settings.writes, [this](const ResourceAccess& write)
+                                              { return m_resources[write.resource_id].is_output; });
+        if (!pass.is_culled)
+            used_pass_ids.push_back(pass_id);
+    }
+
+    // Usage is propagated from output and side-effect passes to the passes producing their data
+    while (!used_pass_ids.empty())
+    {
+        const PassId pass_id = used_pass_ids.back();
+        used_pass_ids.pop_back();
+        for (const PassId dependency_pass_id : m_passes[pass_id].data_dependencies)
+        {
+            if (Pass& dependency_pass = m_passes[dependency_pass_id];
+                dependency_pass.is_culled)
+            {
+                dependency_pass.is_culled = false;
+                used_pass_ids.push_back(dependency_pass_id);
+            }
+        }
+    }
+}
+
+void FrameGraph::AssignLevels()
+{
+    META_FUNCTION_TASK();
+    for (PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+    {
+        Pass& pass = m_passes[pass_id];
+        pass.level = 0U;
+        if (pass.is_culled)
+            continue;
+
+        for (const PassId dependency_pass_id : pass.order_dependencies)
+        {
+            if (const Pass& dependency_pass = m_passes[dependency_pass_id];
+                !dependency_pass.is_culled)
+                pass.level = std::max(pass.level, dependency_pass.level + 1U);
+        }
+        m_execution_order.push_back(pass_id);
+        m_levels_count = std::max(m_levels_count, pass.level + 1U);
+    }
+
+    // Stable sort keeps declaration order of the passes in each level
+    std::ranges::stable_sort(m_execution_order, [this](PassId left_pass_id, PassId right_pass_id)
+                             { return m_passes[left_pass_id].level < m_passes[right_pass_id].level; });
+}
+
+void FrameGraph::AliasTransientTextures()
+{
+    META_FUNCTION_TASK();
+    std::vector<ResourceId> transient_resource_ids;
+    for (ResourceId resource_id = 0U; resource_id < m_resources.size(); ++resource_id)
+    {
+        Resource& resource = m_resources[resource_id];
+        resource.is_used          = false;
+        resource.allocation_index = invalid_id;
+        for (const PassId pass_id : m_execution_order)
+        {
+            const Pass& pass = m_passes[pass_id];
+            const auto is_resource_accessed = [resource_id](const ResourceAccess& access) { return access.resource_id == resource_id; };
+            if (std::ranges::none_of(pass.settings.reads, is_resource_accessed) &&
+                std::ranges::none_of(pass.settings.writes, is_resource_accessed))
+                continue;
+
+            resource.first_level = resource.is_used ? std::min(resource.first_level, pass.level) : pass.level;
+            resource.last_level  = resource.is_used ? std::max(resource.last_level, pass.level) : pass.level;
+            resource.is_used     = true;
+        }
+
+        // Transient output textures are alive until the end of frame and are never aliased after their last use
+        if (resource.is_output)
+            resource.last_level = std::numeric_limits<uint32_t>::max();
+
+        if (resource.is_used && !resource.imported_texture_ptr)
+            transient_resource_ids.push_back(resource_id);
+    }
+
+    // Textures with identical settings and non-overlapping lifetime levels share the same allocation
+    std::ranges::stable_sort(transient_resource_ids, [this](ResourceId left_resource_id, ResourceId right_resource_id)
+                             { return m_resources[left_resource_id].first_level < m_resources[right_resource_id].first_level; });
+    for (const ResourceId resource_id : transient_resource_ids)
+    {
+        Resource& resource = m_resources[resource_id];
+        const auto allocation_it = std::ranges::find_if(m_allocations, [&resource](const Allocation& allocation)
+                                                        { return allocation.last_level < resource.first_level && allocation.settings == resource.settings; });
+        if (allocation_it == m_allocations.end())
+        {
+            resource.allocation_index = static_cast<uint32_t>(m_allocations.size());
+            Allocation& allocation = m_allocations.emplace_back();
+            allocation.settings   = resource.settings;
+            allocation.last_level = resource.last_level;
+        }
+        else
+        {
+            resource.allocation_index  = static_cast<uint32_t>(std::distance(m_allocations.begin(), allocation_it));
+            allocation_it->last_level = resource.last_level;
+        }
+    }
+}
+
+void FrameGraph::BuildStateTransitions()
+{
+    META_FUNCTION_TASK();
+    // States are tracked per physical texture: imported resource or transient textures allocation
+    std::vector<Opt<Rhi::ResourceState>> imported_states(m_resources.size());
+    std::vector<Opt<Rhi::ResourceState>> allocation_states(m_allocations.size());
+
+    for (Pass& pass : m_passes)
+    {
+        pass.transitions.clear();
+        pass.barriers_ptr.reset();
+    }
+
+    for (const PassId pass_id : m_execution_order)
+    {
+        Pass& pass = m_passes[pass_id];
+        for (const ResourceAccesses* accesses : { &pass.settings.reads, &pass.settings.writes })
+        {
+            for (const ResourceAccess& access : *accesses)
+            {
+                const Resource& resource = m_resources[access.resource_id];
+                Opt<Rhi::ResourceState>& physical_state = resource.imported_texture_ptr
+                                                        ? imported_states[access.resource_id]
+                                                        : allocation_states[resource.allocation_index];
+                if (physical_state == access.state)
+                    continue;
+
+                pass.transitions.push_back(StateTransition{ access.resource_id, physical_state, access.state });
+                physical_state = access.state;
+            }
+        }
+    }
+}
+
+} // namespace Methane::Graphics
@@ -35,23 +35,22 @@ by decoding them from popular image formats.
 namespace Methane::Graphics
 {
 
-class ImageData // NOSONAR
+class ImageData
 {
 public:
-    ImageData(const Dimensions& dimensions, uint32_t channels_count, Data::Chunk&& pixels) noexcept;
-    ImageData(ImageData&& other) noexcept;
-    ImageData(const ImageData& other) noexcept = delete;
-    ~ImageData();
+    // Pixels data is shared without copying, decoded image memory is released with the last reference to it
+    ImageData(const Dimensions& dimensions, uint32_t channels_count, Data::SharedChunk pixels, uint64_t copied_bytes = 0U) noexcept;
 
-    [[nodiscard]] const Dimensions&  GetDimensions() const noexcept    { return m_dimensions; }
-    [[nodiscard]] uint32_t           GetChannelsCount() const noexcept { return m_channels_count; }
-    [[nodiscard]] const Data::Chunk& GetPixels() const noexcept        { return m_pixels; }
+    [[nodiscard]] const Dimensions&        GetDimensions() const noexcept    { return m_dimensions; }
+    [[nodiscard]] uint32_t                 GetChannelsCount() const noexcept { return m_channels_count; }
+    [[nodiscard]] const Data::SharedChunk& GetPixels() const noexcept        { return m_pixels; }
+    [[nodiscard]] uint64_t                 GetCopiedBytes() const noexcept   { return m_copied_bytes; } // bytes copied while loading image
 
 private:
-    Dimensions  m_dimensions;
-    uint32_t    m_channels_count;
-    Data::Chunk m_pixels;
-    const bool  m_pixels_release_required;
+    Dimensions        m_dimensions;
+    uint32_t          m_channels_count;
+    Data::SharedChunk m_pixels;
+    uint64_t          m_copied_bytes;
 };
 
 enum class ImageOption : uint32_t
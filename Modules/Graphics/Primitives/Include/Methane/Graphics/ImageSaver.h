@@ -0,0 +1,44 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ImageSaver.h
+Image Saver encodes image pixels to popular image formats and writes them to files.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Types.h>
+#include <Methane/Data/Types.h>
+
+#include <string>
+
+namespace Methane::Graphics
+{
+
+class ImageSaver final
+{
+public:
+    ImageSaver() = delete;
+
+    // Pixels with 8 bits per channel are stored row by row without padding
+    static void SaveImageToPngFile(const std::string& file_path, const Dimensions& dimensions,
+                                   uint32_t channels_count, Data::ConstRawPtr pixels_ptr);
+};
+
+} // namespace Methane::Graphics
@@ -96,6 +96,12 @@ public:
                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
                       bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
+    void DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
+                      const ProgramBindingsIteratorType& instance_program_bindings_begin,
+                      const ProgramBindingsIteratorType& instance_program_bindings_end,
+                      Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                      bool retain_bindings_once = false, bool set_resource_barriers = true) const;
+
 protected:
     [[nodiscard]]
     virtual Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const { return instance_index; }
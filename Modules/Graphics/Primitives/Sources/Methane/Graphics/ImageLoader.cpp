@@ -54,33 +54,13 @@ static PixelFormat GetDefaultImageFormat(bool srgb)
     return srgb ? PixelFormat::RGBA8Unorm_sRGB : PixelFormat::RGBA8Unorm;
 }
 
-ImageData::ImageData(const Dimensions& dimensions, uint32_t channels_count, Data::Chunk&& pixels) noexcept
+ImageData::ImageData(const Dimensions& dimensions, uint32_t channels_count, Data::SharedChunk pixels, uint64_t copied_bytes) noexcept
     : m_dimensions(dimensions)
     , m_channels_count(channels_count)
     , m_pixels(std::move(pixels))
-    , m_pixels_release_required(!m_pixels.IsDataStored() && !m_pixels.IsEmptyOrNull())
+    , m_copied_bytes(copied_bytes)
 { }
 
-ImageData::ImageData(ImageData&& other) noexcept
-    : m_dimensions(other.m_dimensions)
-    , m_channels_count(other.m_channels_count)
-    , m_pixels(std::move(other.m_pixels))
-    , m_pixels_release_required(other.m_pixels_release_required)
-{ }
-
-ImageData::~ImageData()
-{
-    META_FUNCTION_TASK();
-
-#ifndef USE_OPEN_IMAGE_IO
-    if (m_pixels_release_required)
-    {
-        // We assume that image data was loaded with STB load call and was not copied to container, so it must be freed
-        stbi_image_free(const_cast<Data::RawPtr>(m_pixels.GetDataPtr())); // NOSONAR
-    }
-#endif
-}
-
 ImageLoader::ImageLoader(Data::IProvider& data_provider)
     : m_data_provider(data_provider)
 { }
@@ -89,7 +69,8 @@ ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size c
 {
     META_FUNCTION_TASK();
 
-    Data::Chunk raw_image_data = m_data_provider.GetData(image_path);
+    const Data::ChunkCopyScope copy_scope;
+    const Data::Chunk raw_image_data = m_data_provider.GetData(image_path);
 
 #ifdef USE_OPEN_IMAGE_IO
 
@@ -119,7 +100,8 @@ ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size c
 
     return ImageData(Dimensions(static_cast<uint32_t>(image_spec.GetWidth()), static_cast<uint32_t>(image_spec.GetHeight())),
                                 static_cast<uint32_t>(channels_count),
-                                Data::Chunk(std::move(texture_data)));
+                                Data::SharedChunk(std::move(texture_data)),
+                                copy_scope.GetCopiedBytes());
 
 #else
     int image_width = 0;
@@ -141,20 +123,22 @@ ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size c
                                  static_cast<Data::Size>(image_height) *
                                  channels_count;
 
+    Data::SharedChunk image_pixels;
     if (create_copy)
     {
-        Data::Bytes image_data_copy(reinterpret_cast<Data::ConstRawPtr>(image_data_ptr), // NOSONAR
-                                    reinterpret_cast<Data::ConstRawPtr>(image_data_ptr + image_data_size)); // NOSONAR
-        ImageData image_data(image_dimensions, static_cast<uint32_t>(image_channels_count), Data::Chunk(std::move(image_data_copy)));
+        image_pixels = Data::SharedChunk::CopyFrom(reinterpret_cast<Data::ConstRawPtr>(image_data_ptr), image_data_size); // NOSONAR
         stbi_image_free(image_data_ptr);
-        return image_data;
     }
     else
     {
-        return ImageData(image_dimensions, static_cast<uint32_t>(image_channels_count),
-                         Data::Chunk(reinterpret_cast<Data::ConstRawPtr>(image_data_ptr), image_data_size)); // NOSONAR
+        // Decoded image memory is owned by shared chunk and released with STB when the last reference is gone
+        image_pixels = Data::SharedChunk::Own(reinterpret_cast<Data::ConstRawPtr>(image_data_ptr), image_data_size, // NOSONAR
+                                              [](Data::ConstRawPtr pixels_ptr) { stbi_image_free(const_cast<Data::RawPtr>(pixels_ptr)); }); // NOSONAR
     }
 
+    return ImageData(image_dimensions, static_cast<uint32_t>(image_channels_count), std::move(image_pixels),
+                     copy_scope.GetCopiedBytes());
+
 #endif
 }
 
@@ -170,7 +154,7 @@ Rhi::Texture ImageLoader::LoadImageToTexture2D(const Rhi::CommandQueue& target_c
                              image_data.GetDimensions(), std::nullopt, image_format,
                              options.HasAnyBit(ImageOption::Mipmapped)));
     texture.SetName(texture_name);
-    texture.SetData(target_cmd_queue, { { image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize() } });
+    texture.SetData(target_cmd_queue, { Rhi::SubResource(image_data.GetPixels()) });
 
     return texture;
 }
@@ -190,10 +174,9 @@ Rhi::Texture ImageLoader::LoadImagesToTextureCube(const Rhi::CommandQueue& targe
         [this, &image_paths, &face_images_data, &data_mutex](const uint32_t face_index)
         {
             META_FUNCTION_TASK();
-            // We create a copy of the loaded image data (via 3-rd argument of LoadImageData)
-            // to resolve a problem of STB image loader which requires an image data to be freed before next image is loaded
+            // Decoded face image data is shared with sub-resources without copying
             constexpr uint32_t desired_channels_count = 4;
-            ImageData image_data = LoadImageData(image_paths[face_index], desired_channels_count, true);
+            ImageData image_data = LoadImageData(image_paths[face_index], desired_channels_count, false);
 
             std::scoped_lock data_lock(data_mutex);
             face_images_data.emplace_back(face_index, std::move(image_data));
@@ -213,7 +196,7 @@ Rhi::Texture ImageLoader::LoadImagesToTextureCube(const Rhi::CommandQueue& targe
     {
         META_CHECK_EQUAL_DESCR(face_dimensions,     image_data.GetDimensions(),    "all face image of cube texture must have equal dimensions");
         META_CHECK_EQUAL_DESCR(face_channels_count, image_data.GetChannelsCount(), "all face image of cube texture must have equal channels count");
-        face_sub_resources.emplace_back(image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize(), Rhi::IResource::SubResource::Index(face_index));
+        face_sub_resources.emplace_back(image_data.GetPixels(), Rhi::IResource::SubResource::Index(face_index));
     }
 
     // Load face images to cube texture
@@ -0,0 +1,74 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ImageSaver.cpp
+Image Saver encodes image pixels to popular image formats and writes them to files.
+
+******************************************************************************/
+
+#include <Methane/Graphics/ImageSaver.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#ifdef USE_OPEN_IMAGE_IO
+
+#include <OpenImageIO/imageio.h>
+
+#else // USE_OPEN_IMAGE_IO
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_STATIC
+#include <stb_image_write.h>
+
+#endif // USE_OPEN_IMAGE_IO
+
+namespace Methane::Graphics
+{
+
+void ImageSaver::SaveImageToPngFile(const std::string& file_path, const Dimensions& dimensions,
+                                    uint32_t channels_count, Data::ConstRawPtr pixels_ptr)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL(pixels_ptr);
+    META_CHECK_RANGE(channels_count, 1U, 5U);
+    META_CHECK_EQUAL_DESCR(dimensions.GetDepth(), 1U, "only 2D images can be saved to PNG file");
+
+#ifdef USE_OPEN_IMAGE_IO
+
+    std::unique_ptr<OIIO::ImageOutput> image_output_ptr = OIIO::ImageOutput::create(file_path);
+    META_CHECK_NOT_NULL_DESCR(image_output_ptr, "failed to create image output for file '{}'", file_path);
+
+    const OIIO::ImageSpec image_spec(static_cast<int>(dimensions.GetWidth()), static_cast<int>(dimensions.GetHeight()),
+                                     static_cast<int>(channels_count), OIIO::TypeDesc::UINT8);
+    const bool image_saved = image_output_ptr->open(file_path, image_spec) &&
+                             image_output_ptr->write_image(OIIO::TypeDesc::UINT8, pixels_ptr) &&
+                             image_output_ptr->close();
+    META_CHECK_TRUE_DESCR(image_saved, "failed to save image to file '{}': {}", file_path, image_output_ptr->geterror());
+
+#else // USE_OPEN_IMAGE_IO
+
+    const int image_saved = stbi_write_png(file_path.c_str(),
+                                           static_cast<int>(dimensions.GetWidth()), static_cast<int>(dimensions.GetHeight()),
+                                           static_cast<int>(channels_count), pixels_ptr,
+                                           static_cast<int>(dimensions.GetWidth() * channels_count));
+    META_CHECK_TRUE_DESCR(image_saved != 0, "failed to save image to file '{}'", file_path);
+
+#endif // USE_OPEN_IMAGE_IO
+}
+
+} // namespace Methane::Graphics
@@ -162,27 +162,38 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
 }
 
 void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
-                                   const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                                   const InstancedProgramBindings& instance_program_bindings,
+                                   Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                                   bool retain_bindings_once, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    DrawParallel(parallel_cmd_list, instance_program_bindings.begin(), instance_program_bindings.end(),
+                 bindings_apply_behavior, retain_bindings_once, set_resource_barriers);
+}
+
+void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
+                                   const ProgramBindingsIteratorType& instance_program_bindings_begin,
+                                   const ProgramBindingsIteratorType& instance_program_bindings_end,
                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
                                    bool retain_bindings_once, bool set_resource_barriers) const
 {
     META_FUNCTION_TASK();
     const std::vector<Rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
-    const auto instances_count_per_command_list = static_cast<uint32_t>(Data::DivCeil(instance_program_bindings.size(), render_cmd_lists.size()));
+    const auto instances_count = static_cast<uint32_t>(std::distance(instance_program_bindings_begin, instance_program_bindings_end));
+    const auto instances_count_per_command_list = Data::DivCeil(instances_count, static_cast<uint32_t>(render_cmd_lists.size()));
 
     tf::Taskflow render_task_flow;
     render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
-        [this, &render_cmd_lists, instances_count_per_command_list, &instance_program_bindings,
+        [this, &render_cmd_lists, instances_count, instances_count_per_command_list, &instance_program_bindings_begin,
         bindings_apply_behavior, retain_bindings_once, set_resource_barriers](const uint32_t cmd_list_index)
         {
             const Rhi::RenderCommandList& render_cmd_list = render_cmd_lists[cmd_list_index];
-            const uint32_t begin_instance_index = cmd_list_index * instances_count_per_command_list;
-            const uint32_t end_instance_index = std::min(begin_instance_index + instances_count_per_command_list,
-                                                         static_cast<uint32_t>(instance_program_bindings.size()));
+            const uint32_t begin_instance_index = std::min(cmd_list_index * instances_count_per_command_list, instances_count);
+            const uint32_t end_instance_index = std::min(begin_instance_index + instances_count_per_command_list, instances_count);
 
             Draw(render_cmd_list,
-                 instance_program_bindings.begin() + begin_instance_index,
-                 instance_program_bindings.begin() + end_instance_index,
+                 instance_program_bindings_begin + begin_instance_index,
+                 instance_program_bindings_begin + end_instance_index,
                  bindings_apply_behavior, begin_instance_index,
                  retain_bindings_once, set_resource_barriers);
         }
@@ -0,0 +1,144 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/BufferHeap.h
+Buffer heap used for sub-allocation of small buffers in aligned ranges
+of large backing buffers of the same type.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Graphics/RHI/ResourceView.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Data/Chunk.hpp>
+#include <Methane/Data/RangeSet.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IContext;
+struct ICommandQueue;
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::Graphics::Base
+{
+
+class BufferHeap;
+
+class BufferHeapAllocation // NOSONAR - custom destructor is required
+{
+public:
+    using Range = Data::Range<Data::Index>;
+
+    BufferHeapAllocation(BufferHeap& heap, Data::Index block_index, const Range& buffer_range, Data::Size data_size);
+    BufferHeapAllocation(const BufferHeapAllocation&) = delete;
+    BufferHeapAllocation(BufferHeapAllocation&&) = delete;
+    ~BufferHeapAllocation();
+
+    BufferHeapAllocation& operator=(const BufferHeapAllocation&) = delete;
+    BufferHeapAllocation& operator=(BufferHeapAllocation&&) = delete;
+
+    [[nodiscard]] Data::Index       GetBlockIndex() const noexcept  { return m_block_index; }
+    [[nodiscard]] const Range&      GetBufferRange() const noexcept { return m_buffer_range; }
+    [[nodiscard]] Data::Size        GetDataSize() const noexcept    { return m_data_size; }
+    [[nodiscard]] Data::Size        GetDataOffset() const noexcept  { return m_buffer_range.GetStart(); }
+    [[nodiscard]] Rhi::IBuffer&     GetBuffer() const;
+    [[nodiscard]] Rhi::ResourceView GetResourceView() const;
+
+    void SetData(Rhi::ICommandQueue& target_cmd_queue, const Data::Chunk& data) const;
+
+private:
+    Ptr<BufferHeap> m_heap_ptr;
+    Data::Index     m_block_index;
+    Range           m_buffer_range; // aligned memory range in the block buffer
+    Data::Size      m_data_size;    // unaligned original size
+};
+
+class BufferHeap
+    : public std::enable_shared_from_this<BufferHeap>
+{
+public:
+    using Allocation = BufferHeapAllocation;
+
+    struct Settings
+    {
+        Rhi::BufferSettings block_settings; // settings of the backing buffers, block size is defined by buffer size
+        Data::Size          alignment = 256U;
+    };
+
+    struct Statistics
+    {
+        uint32_t   blocks_count            = 0U;
+        uint32_t   allocations_count       = 0U;
+        Data::Size reserved_size           = 0U; // total size of the backing buffers
+        Data::Size allocated_size          = 0U; // total aligned size of the allocations
+        Data::Size free_size               = 0U;
+        Data::Size largest_free_range_size = 0U;
+        uint32_t   free_ranges_count       = 0U;
+
+        // Fragmentation of the free memory in range [0, 1], where 0 means that all free memory is continuous
+        [[nodiscard]] float GetFragmentation() const noexcept;
+    };
+
+    [[nodiscard]] static Ptr<BufferHeap> Create(const Rhi::IContext& context, const Settings& settings);
+
+    [[nodiscard]] UniquePtr<Allocation> Allocate(Data::Size data_size);
+    [[nodiscard]] const Settings&       GetSettings() const noexcept { return m_settings; }
+    [[nodiscard]] Statistics            GetStatistics() const;
+    [[nodiscard]] Rhi::IBuffer&         GetBlockBuffer(Data::Index block_index) const;
+
+    // Releases backing buffers of the blocks without allocations, except the first block
+    uint32_t ReleaseEmptyBlocks();
+
+protected:
+    BufferHeap(const Rhi::IContext& context, const Settings& settings);
+
+private:
+    friend class BufferHeapAllocation;
+
+    using RangeSet = Data::RangeSet<Data::Index>;
+    using Range    = Allocation::Range;
+
+    struct Block
+    {
+        Ptr<Rhi::IBuffer> buffer_ptr;
+        Data::Size        size = 0U;
+        RangeSet          free_ranges;
+        uint32_t          allocations_count = 0U;
+    };
+
+    void ReleaseAllocation(const Allocation& allocation);
+    Data::Index AddBlock(Data::Size block_size);
+
+    static Range ReserveBestFitRange(RangeSet& free_ranges, Data::Size aligned_size);
+
+    const Rhi::IContext& m_context;
+    const Settings       m_settings;
+    std::vector<Block>   m_blocks;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
@@ -24,6 +24,7 @@ Base implementation of the command list interface.
 #pragma once
 
 #include "Object.h"
+#include "ResourceBarriersBatch.h"
 
 #include <Methane/Graphics/RHI/IProgram.h>
 #include <Methane/Graphics/RHI/ICommandList.h>
@@ -38,6 +39,8 @@ Base implementation of the command list interface.
 #endif
 
 #include <stack>
+#include <string>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 
@@ -91,11 +94,20 @@ public:
     void PushOpenDebugGroup(IDebugGroup& debug_group);
     void ClearOpenDebugGroups();
 
+    // Resolved GPU timings of command list and its debug groups are added to the command queue timing report,
+    // called from command queue thread before command list completion
+    virtual void CompleteGpuTimings(const Opt<Data::Index>& frame_index);
+
     CommandQueue&          GetBaseCommandQueue();
     const CommandQueue&    GetBaseCommandQueue() const;
     const ProgramBindings* GetProgramBindingsPtr() const noexcept { return GetCommandState().program_bindings_ptr; }
     Ptr<CommandList>       GetCommandListPtr()                    { return GetPtr<CommandList>(); }
 
+    // Resource barriers are accumulated in batch and set to command list before the next draw or dispatch
+    void AddResourceBarriers(const Rhi::IResourceBarriers& resource_barriers);
+    void FlushResourceBarriers();
+    const ResourceBarriersBatch::Statistics& GetResourceBarriersStatistics() const noexcept { return m_resource_barriers_batch.GetStatistics(); }
+
     inline void RetainResource(const Ptr<Object>& resource_ptr)   { if (resource_ptr) m_command_state.retained_resources.emplace_back(resource_ptr); }
     inline void RetainResource(Object& resource)                  { m_command_state.retained_resources.emplace_back(resource.GetBasePtr()); }
     inline void ReleaseRetainedResources()                        { m_command_state.retained_resources.clear(); }
@@ -111,6 +123,12 @@ protected:
     virtual void ResetCommandState();
     virtual void ApplyProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior);
 
+    // Encoding of commands can be deferred by derived command lists (see RenderCommandList command stream mode),
+    // pending commands are encoded before commands which are encoded to the native command list immediately
+    virtual void EncodeProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior);
+    virtual void EncodePendingCommands() { /* no deferred commands by default */ }
+    void UpdateProgramBindingsState(const ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior);
+
     CommandState&       GetCommandState()        { return m_command_state; }
     const CommandState& GetCommandState() const  { return m_command_state; }
 
@@ -130,13 +148,16 @@ private:
     using DebugGroupStack  = std::stack<Ptr<DebugGroup>>;
 
     void CompleteInternal();
+    void BeginDebugGroupGpuZone(const IDebugGroup& debug_group);
+    void EndDebugGroupGpuZone();
 
-    const Type        m_type;
-    Ptr<CommandQueue> m_command_queue_ptr;
-    CommandState      m_command_state;
-    DebugGroupStack   m_open_debug_groups;
-    CompletedCallback m_completed_callback;
-    State             m_state = State::Pending;
+    const Type            m_type;
+    Ptr<CommandQueue>     m_command_queue_ptr;
+    CommandState          m_command_state;
+    ResourceBarriersBatch m_resource_barriers_batch;
+    DebugGroupStack       m_open_debug_groups;
+    CompletedCallback     m_completed_callback;
+    State                 m_state = State::Pending;
 
     mutable TracyLockable(std::recursive_mutex, m_state_mutex);
     TracyLockable(std::mutex,   m_state_change_mutex);
@@ -144,8 +165,22 @@ private:
     TRACY_GPU_SCOPE_TYPE        m_tracy_gpu_scope;
 
 #ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
+    struct DebugGroupTimestampQueries
+    {
+        std::string               name;
+        uint32_t                  depth = 0U;
+        Ptr<Rhi::ITimestampQuery> begin_timestamp_query_ptr;
+        Ptr<Rhi::ITimestampQuery> end_timestamp_query_ptr;
+        bool                      is_resolved = false;
+    };
+
     Ptr<Rhi::ITimestampQuery> m_begin_timestamp_query_ptr;
     Ptr<Rhi::ITimestampQuery> m_end_timestamp_query_ptr;
+
+    // Timestamp queries of debug groups are reused between command list encodings
+    std::vector<DebugGroupTimestampQueries> m_debug_group_timestamp_queries;
+    size_t                                  m_debug_group_timestamp_queries_count = 0U;
+    std::stack<size_t>                      m_open_debug_group_timestamp_indices;
 #endif
 };
 
@@ -27,6 +27,7 @@ Base implementation of the command queue interface.
 #include "CommandList.h"
 
 #include <Methane/Graphics/RHI/ICommandQueue.h>
+#include <Methane/Graphics/RHI/GpuTimingReport.h>
 #include <Methane/TracyGpu.hpp>
 
 #include <list>
@@ -54,8 +55,10 @@ public:
 
     // ICommandQueue overrides
     [[nodiscard]] Ptr<Rhi::ICommandKit> CreateCommandKit() final;
+    [[nodiscard]] Ptr<Rhi::IRenderCommandBundle> CreateRenderCommandBundle(Rhi::IRenderCommandBundle::RecordFunction record_function) override;
     [[nodiscard]] const Rhi::IContext& GetContext() const noexcept final;
     Rhi::CommandListType GetCommandListType() const noexcept final { return m_command_lists_type; }
+    const Rhi::GpuTimingReport& GetGpuTimingReport() const noexcept final { return m_gpu_timing_report; }
     void Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) override;
 
     const Context&     GetBaseContext() const noexcept     { return m_context; }
@@ -64,6 +67,9 @@ public:
     Tracy::GpuContext* GetTracyContextPtr() const noexcept { return m_tracy_gpu_context_ptr.get(); }
     Tracy::GpuContext& GetTracyContext() const;
 
+    // Called from command queue thread on completion of the command lists execution
+    void AddGpuTimings(const Opt<Data::Index>& frame_index, Rhi::GpuTimingReport::Timings&& gpu_timings);
+
 protected:
     void InitializeTracyGpuContext(const Tracy::GpuContext::Settings& tracy_settings);
 
@@ -72,6 +78,7 @@ private:
     const Ptr<Device>            m_device_ptr;
     const Rhi::CommandListType   m_command_lists_type;
     UniquePtr<Tracy::GpuContext> m_tracy_gpu_context_ptr;
+    Rhi::GpuTimingReport         m_gpu_timing_report;
 };
 
 } // namespace Methane::Graphics::Base
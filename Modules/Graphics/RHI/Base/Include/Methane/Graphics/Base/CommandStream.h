@@ -0,0 +1,231 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/CommandStream.h
+Backend agnostic stream of validated render commands recorded in compact linear memory
+by render command list and encoded to the native command lists at commit or on execution.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IRenderCommandList.h>
+#include <Methane/Graphics/RHI/IProgramBindings.h>
+#include <Methane/Memory.hpp>
+
+#include <vector>
+#include <unordered_map>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IParallelRenderCommandList;
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::Graphics::Base
+{
+
+class Object;
+class RenderCommandList;
+class RenderState;
+class ViewState;
+class ProgramBindings;
+class BufferSet;
+class Buffer;
+
+class CommandStream
+{
+    friend class RenderCommandList;
+
+public:
+    using ObjectHandle = uint32_t;
+
+    enum class Command : uint8_t
+    {
+        SetRenderState,
+        SetViewState,
+        SetProgramBindings,
+        SetVertexBuffers,
+        SetIndexBuffer,
+        Draw,
+        DrawIndexed
+    };
+
+    // Command arguments are plain data structures written to the stream as is,
+    // objects are referenced by handles in the stream objects table.
+    // Arguments are recorded after validation by render command list, so they are encoded without checks.
+    struct SetRenderStateArgs
+    {
+        static constexpr Command command = Command::SetRenderState;
+        ObjectHandle render_state;
+        uint32_t     apply_state_groups; // changed state groups applied to the native command list
+        uint32_t     state_groups;
+    };
+
+    struct SetViewStateArgs
+    {
+        static constexpr Command command = Command::SetViewState;
+        ObjectHandle view_state;
+    };
+
+    struct SetProgramBindingsArgs
+    {
+        static constexpr Command command = Command::SetProgramBindings;
+        ObjectHandle program_bindings;
+        uint32_t     apply_behavior;
+    };
+
+    struct SetVertexBuffersArgs
+    {
+        static constexpr Command command = Command::SetVertexBuffers;
+        ObjectHandle vertex_buffers;
+        uint32_t     set_resource_barriers;
+    };
+
+    struct SetIndexBufferArgs
+    {
+        static constexpr Command command = Command::SetIndexBuffer;
+        ObjectHandle index_buffer;
+        uint32_t     set_resource_barriers;
+    };
+
+    struct DrawArgs
+    {
+        static constexpr Command command = Command::Draw;
+        uint32_t primitive_type;
+        uint32_t vertex_count;
+        uint32_t start_vertex;
+        uint32_t instance_count;
+        uint32_t start_instance;
+    };
+
+    struct DrawIndexedArgs
+    {
+        static constexpr Command command = Command::DrawIndexed;
+        uint32_t primitive_type;
+        uint32_t index_count;
+        uint32_t start_index;
+        uint32_t start_vertex;
+        uint32_t instance_count;
+        uint32_t start_instance;
+    };
+
+    struct CommandHeader
+    {
+        Command  command;
+        uint8_t  reserved;
+        uint16_t args_size;
+    };
+
+    // Executes streams in the parallel render command lists of the same count in parallel threads
+    static void Translate(const std::vector<const CommandStream*>& command_streams,
+                          Rhi::IParallelRenderCommandList& parallel_command_list);
+
+    void Clear();
+
+    [[nodiscard]] bool     IsEmpty() const noexcept           { return m_commands_count == 0U; }
+    [[nodiscard]] uint32_t GetCommandsCount() const noexcept  { return m_commands_count; }
+    [[nodiscard]] size_t   GetDataSize() const noexcept       { return m_data.size(); }
+    [[nodiscard]] uint32_t GetObjectsCount() const noexcept   { return static_cast<uint32_t>(m_objects.size()); }
+
+    // Objects retained by command lists executing the stream until their execution is completed
+    [[nodiscard]] const Ptrs<Object>& GetRetainedObjects() const noexcept { return m_retained_objects; }
+
+    // Visits recorded commands in order starting from data offset with pointer to their arguments data,
+    // which can be read with GetArgs
+    template<typename FunctionType>
+    void ForEachCommand(const FunctionType& command_function, size_t begin_data_offset = 0U) const
+    {
+        for (size_t data_offset = begin_data_offset; data_offset < m_data.size();)
+        {
+            CommandHeader header{};
+            std::memcpy(&header, m_data.data() + data_offset, sizeof(CommandHeader));
+            command_function(header.command, m_data.data() + data_offset + sizeof(CommandHeader));
+            data_offset += sizeof(CommandHeader) + header.args_size;
+        }
+    }
+
+    template<typename ArgsType>
+    [[nodiscard]] static ArgsType GetArgs(const std::byte* args_data) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<ArgsType>);
+        ArgsType args{};
+        std::memcpy(&args, args_data, sizeof(ArgsType));
+        return args;
+    }
+
+    // Stream objects are Base implementation objects: RenderState, ViewState, ProgramBindings, BufferSet and Buffer
+    template<typename ObjectType>
+    [[nodiscard]] ObjectType& GetStreamObject(ObjectHandle object_handle) const
+    {
+        return *static_cast<ObjectType*>(GetStreamObjectPtr(object_handle));
+    }
+
+private:
+    // Recording of validated render commands is done by render command list in command stream mode
+    void SetRenderState(RenderState& render_state, Rhi::RenderStateGroupMask apply_state_groups, Rhi::RenderStateGroupMask state_groups);
+    void SetViewState(ViewState& view_state);
+    void SetProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior);
+    void SetVertexBuffers(BufferSet& vertex_buffers, bool set_resource_barriers);
+    void SetIndexBuffer(Buffer& index_buffer, bool set_resource_barriers);
+    void Draw(Rhi::RenderPrimitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
+              uint32_t instance_count, uint32_t start_instance);
+    void DrawIndexed(Rhi::RenderPrimitive primitive_type, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                     uint32_t instance_count, uint32_t start_instance);
+
+    template<typename ArgsType>
+    void Write(const ArgsType& args)
+    {
+        static_assert(std::is_trivially_copyable_v<ArgsType> && sizeof(ArgsType) % sizeof(uint32_t) == 0U);
+        const CommandHeader header{ ArgsType::command, 0U, static_cast<uint16_t>(sizeof(ArgsType)) };
+        const size_t data_offset = m_data.size();
+        m_data.resize(data_offset + sizeof(CommandHeader) + sizeof(ArgsType));
+        std::memcpy(m_data.data() + data_offset, &header, sizeof(CommandHeader));
+        std::memcpy(m_data.data() + data_offset + sizeof(CommandHeader), &args, sizeof(ArgsType));
+        m_commands_count++;
+    }
+
+    template<typename ObjectType>
+    ObjectHandle AddObject(ObjectType& object)
+    {
+        void* object_ptr = static_cast<void*>(std::addressof(object));
+        if (const auto object_handle_it = m_object_handles.find(object_ptr);
+            object_handle_it != m_object_handles.end())
+            return object_handle_it->second;
+
+        return AddObjectEntry(object_ptr, object);
+    }
+
+    ObjectHandle AddObjectEntry(void* object_ptr, Object& object);
+    ObjectHandle AddObjectEntry(void* object_ptr, ViewState& view_state);
+    void*        GetStreamObjectPtr(ObjectHandle object_handle) const;
+
+    std::vector<std::byte>                  m_data;
+    std::vector<void*>                      m_objects;
+    std::unordered_map<void*, ObjectHandle> m_object_handles;
+    Ptrs<Object>                            m_retained_objects;     // retains objects alive while they are referenced by stream
+    Ptrs<Rhi::IViewState>                   m_retained_view_states; // view states are not retained by command lists
+    uint32_t                                m_commands_count = 0U;
+};
+
+} // namespace Methane::Graphics::Base
@@ -82,6 +82,7 @@ public:
     Rhi::ICommandKit&           GetDefaultCommandKit(Rhi::CommandListType type) const final;
     Rhi::ICommandKit&           GetDefaultCommandKit(Rhi::ICommandQueue& cmd_queue) const final;
     const Rhi::IDevice&         GetDevice() const final;
+    Rhi::IDescriptorManager&    GetDescriptorManager() const final;
     bool                        UploadResources() const override;
 
     // Context interface
@@ -95,7 +96,6 @@ public:
     Ptr<Device>              GetBaseDevicePtr() const noexcept   { return m_device_ptr; }
     Device&                  GetBaseDevice();
     const Device&            GetBaseDevice() const;
-    Rhi::IDescriptorManager& GetDescriptorManager() const;
 
 protected:
     void PerformRequestedAction();
@@ -27,6 +27,8 @@ Base descriptor manager implementation.
 #include <Methane/Memory.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <array>
+#include <atomic>
 #include <mutex>
 
 namespace Methane::Graphics::Rhi
@@ -45,13 +47,23 @@ class DescriptorManager
     : public Rhi::IDescriptorManager
 {
 public:
+    // Program bindings registry is split into shards selected by the creator thread,
+    // so that parallel bindings creation does not serialize on the single mutex
+    static constexpr size_t g_program_bindings_shards_count = 16U;
+
     explicit DescriptorManager(Context& context, bool is_parallel_bindings_processing_enabled = true);
 
     // IDescriptorManager interface
-    void AddProgramBindings(Rhi::IProgramBindings& program_bindings) override;
-    void RemoveProgramBindings(Rhi::IProgramBindings&) override { /* intentionally unimplemented */}
-    void CompleteInitialization() override;
-    void Release() override;
+    void     AddProgramBindings(Rhi::IProgramBindings& program_bindings) override;
+    void     RemoveProgramBindings(Rhi::IProgramBindings&) override { /* intentionally unimplemented */}
+    void     CompleteInitialization() override;
+    void     Release() override;
+    bool     IsBindlessEnabled() const override { return false; }
+    uint32_t AcquireBindlessDescriptor(const Rhi::ResourceView& resource_view) override;
+    void     ReleaseBindlessDescriptor(const Rhi::ResourceView&) override { /* bindless descriptors are not supported */ }
+
+    [[nodiscard]] size_t   GetProgramBindingsCount() const;
+    [[nodiscard]] uint32_t GetCompactionEpoch() const noexcept { return m_compaction_epoch.load(std::memory_order_acquire); }
 
 protected:
     Context&       GetContext()       { return m_context; }
@@ -63,20 +75,38 @@ protected:
     template<typename BindingsFuncType>
     void ForEachProgramBinding(const BindingsFuncType& bindings_functor)
     {
-        std::scoped_lock lock_guard(m_program_bindings_mutex);
-        for (const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr : m_program_bindings)
+        for (ProgramBindingsShard& shard : m_program_bindings_shards)
         {
-            const Ptr<Rhi::IProgramBindings> program_bindings_ptr = program_bindings_wptr.lock();
-            if (program_bindings_ptr)
-                bindings_functor(*program_bindings_ptr);
+            std::scoped_lock lock_guard(shard.mutex);
+            for (const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr : shard.program_bindings)
+            {
+                const Ptr<Rhi::IProgramBindings> program_bindings_ptr = program_bindings_wptr.lock();
+                if (program_bindings_ptr)
+                    bindings_functor(*program_bindings_ptr);
+            }
         }
     }
 
 private:
-    Context&                        m_context;
-    const bool                      m_is_parallel_bindings_processing_enabled;
-    WeakPtrs<Rhi::IProgramBindings> m_program_bindings;
-    TracyLockable(std::mutex,       m_program_bindings_mutex);
+    // Aligned to cache line size to prevent false sharing between threads appending to neighbour shards
+    struct alignas(64) ProgramBindingsShard
+    {
+        WeakPtrs<Rhi::IProgramBindings> program_bindings;
+        mutable TracyLockable(std::mutex, mutex);
+    };
+
+    using ProgramBindingsShards = std::array<ProgramBindingsShard, g_program_bindings_shards_count>;
+
+    size_t GetCurrentThreadShardIndex() noexcept;
+
+    Ptrs<Rhi::IProgramBindings> AcquireProgramBindingsSnapshot();
+
+    Context&                 m_context;
+    const bool               m_is_parallel_bindings_processing_enabled;
+    const uint64_t           m_instance_id;
+    ProgramBindingsShards    m_program_bindings_shards;
+    std::atomic<size_t>      m_next_shard_index{ 0U };
+    std::atomic<uint32_t>    m_compaction_epoch{ 0U }; // number of expired bindings compaction passes
 };
 
 } // namespace Methane::Graphics::Base
@@ -26,8 +26,10 @@ Base implementation of the named object interface.
 #include <Methane/Graphics/RHI/IObject.h>
 #include <Methane/Memory.hpp>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Data/InternedString.h>
 
-#include <map>
+#include <atomic>
+#include <unordered_map>
 
 namespace Methane::Graphics::Base
 {
@@ -47,7 +49,7 @@ private:
     void OnObjectNameChanged(Rhi::IObject& object, const std::string& old_name) override;
     void OnObjectDestroyed(Rhi::IObject& object) override;
 
-    std::map<std::string, WeakPtr<Rhi::IObject>, std::less<>> m_object_by_name;
+    std::unordered_map<Data::InternedString, WeakPtr<Rhi::IObject>> m_object_by_name;
 };
 
 class Object // NOSONAR - destructor is required
@@ -62,25 +64,35 @@ public:
     explicit Object(std::string_view name);
     ~Object() override;
 
-    Object(const Object&) = default;
-    Object(Object&&) noexcept = default;
+    Object(const Object& other);
+    Object(Object&& other) noexcept;
 
-    Object& operator=(const Object&) = default;
-    Object& operator=(Object&&) noexcept = default;
+    Object& operator=(const Object& other);
+    Object& operator=(Object&& other) noexcept;
 
     // IObject interface
     bool                             SetName(std::string_view name) override;
-    [[nodiscard]] std::string_view   GetName() const noexcept override { return m_name; }
+    bool                             SetLazyName(NameFormatter name_formatter) override;
+    [[nodiscard]] std::string_view   GetName() const noexcept override { return GetInternedName(); }
     [[nodiscard]] Ptr<Rhi::IObject>  GetPtr() override;
 
     [[nodiscard]] Ptr<Object>        GetBasePtr()                { return shared_from_this(); }
-    [[nodiscard]] const std::string& GetNameRef() const noexcept { return m_name; }
+    [[nodiscard]] const std::string& GetNameRef() const noexcept { return GetInternedName().GetString(); }
+    [[nodiscard]] const Data::InternedString& GetInternedName() const noexcept;
 
     template<typename T> requires std::is_base_of_v<Object, T>
     [[nodiscard]] Ptr<T> GetPtr() { return std::static_pointer_cast<T>(GetBasePtr()); }
 
+protected:
+    // Objects applying names to native graphics API objects in SetName overrides do not support lazy names
+    [[nodiscard]] virtual bool IsLazyNameSupported() const noexcept { return false; }
+
 private:
-    std::string m_name;
+    void FormatName() const noexcept;
+
+    mutable Data::InternedString m_name;
+    mutable NameFormatter        m_name_formatter;
+    mutable std::atomic<bool>    m_is_name_format_pending{ false };
 };
 
 } // namespace Methane::Graphics::Base
@@ -69,11 +69,16 @@ public:
     // CommandList interface
     void Execute(const ICommandList::CompletedCallback& completed_callback = {}) override;
     void Complete() override;
+    void CompleteGpuTimings(const Opt<Data::Index>& frame_index) override;
     void Commit() override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
 
+    // Command stream mode of per-thread render command lists, which are encoded in parallel on commit
+    [[nodiscard]] bool IsCommandStreamEnabled() const noexcept { return m_is_command_stream_enabled; }
+    void SetCommandStreamEnabled(bool is_command_stream_enabled);
+
     [[nodiscard]] RenderPass& GetBaseRenderPass() const;
     [[nodiscard]] const Ptr<RenderPass>& GetBaseRenderPassPtr() const noexcept { return m_render_pass_ptr;}
 
@@ -93,6 +98,7 @@ private:
     Ptrs<RenderCommandList>       m_parallel_command_lists;
     Refs<Rhi::IRenderCommandList> m_parallel_command_lists_refs;
     bool                          m_is_validation_enabled = true;
+    bool                          m_is_command_stream_enabled = false;
 };
 
 } // namespace Methane::Graphics::Base
@@ -79,14 +79,21 @@ public:
                                          Rhi::ProgramArgumentAccessMask apply_access = Rhi::ProgramArgumentAccessMask{ ~0U },
                                          const Rhi::ICommandQueue* owner_queue_ptr = nullptr) const
     {
-        if (ApplyResourceStates(apply_access, owner_queue_ptr) &&
-            m_resource_state_transition_barriers_ptr && !m_resource_state_transition_barriers_ptr->IsEmpty())
-        {
-            command_list.SetResourceBarriers(*m_resource_state_transition_barriers_ptr);
-        }
+        if (!ApplyResourceStates(apply_access, owner_queue_ptr) ||
+            !m_resource_state_transition_barriers_ptr || m_resource_state_transition_barriers_ptr->IsEmpty())
+            return;
+
+        // Transition barriers are batched in command list and set before the next draw or dispatch
+        if constexpr (std::is_base_of_v<CommandList, CommandListType>)
+            command_list.AddResourceBarriers(*m_resource_state_transition_barriers_ptr);
+        else
+            command_list.GetBaseCommandList().AddResourceBarriers(*m_resource_state_transition_barriers_ptr);
     }
 
 protected:
+    // Object overrides: program bindings do not have native debug names, so their names can be formatted lazily
+    bool IsLazyNameSupported() const noexcept override { return true; }
+
     // IProgramBindings::IProgramArgumentBindingCallback overrides...
     void OnProgramArgumentBindingResourceViewsChanged(const IArgumentBinding&   argument_binding,
                                                       const Rhi::ResourceViews& old_resource_views,
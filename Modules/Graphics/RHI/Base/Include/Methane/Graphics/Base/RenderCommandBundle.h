@@ -0,0 +1,82 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/RenderCommandBundle.h
+Base implementation of the render command bundle interface:
+render commands are recorded once to the command stream and replayed without validation.
+
+******************************************************************************/
+
+#pragma once
+
+#include "CommandStream.h"
+
+#include <Methane/Graphics/RHI/IRenderCommandBundle.h>
+#include <Methane/Graphics/RHI/IProgramBindings.h>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Base
+{
+
+class RenderCommandList;
+
+class RenderCommandBundle
+    : public Rhi::IRenderCommandBundle
+    , private Data::Receiver<Rhi::IProgramArgumentBindingCallback> //NOSONAR
+{
+public:
+    explicit RenderCommandBundle(RecordFunction record_function);
+    ~RenderCommandBundle() override;
+
+    RenderCommandBundle(const RenderCommandBundle&) = delete;
+    RenderCommandBundle(RenderCommandBundle&&) = delete;
+    RenderCommandBundle& operator=(const RenderCommandBundle&) = delete;
+    RenderCommandBundle& operator=(RenderCommandBundle&&) = delete;
+
+    // IRenderCommandBundle interface
+    [[nodiscard]] bool     IsValid() const noexcept final            { return m_is_valid; }
+    [[nodiscard]] uint32_t GetRecordingsCount() const noexcept final { return m_recordings_count; }
+    void Invalidate() noexcept final                                 { m_is_valid = false; }
+
+    // Returns command stream of the bundle, which is recorded first with the given command list when bundle is invalid.
+    // Stream is returned by shared pointer, so that it stays alive while executed, even if bundle is re-recorded in other thread.
+    [[nodiscard]] Ptr<const CommandStream> GetCommandStream(RenderCommandList& recording_command_list);
+    [[nodiscard]] Ptr<const CommandStream> GetCommandStreamPtr() const;
+
+private:
+    // IProgramArgumentBindingCallback
+    void OnProgramArgumentBindingResourceViewsChanged(const Rhi::IProgramArgumentBinding&, const Rhi::ResourceViews&, const Rhi::ResourceViews&) override;
+    void OnProgramArgumentBindingRootConstantChanged(const Rhi::IProgramArgumentBinding&, const Rhi::RootConstant&) override { /* root constants are applied on execution */ }
+
+    void ConnectArgumentBindings();
+    void DisconnectArgumentBindings();
+
+    const RecordFunction                       m_record_function;
+    Ptr<const CommandStream>                   m_command_stream_ptr;
+    std::vector<Rhi::IProgramArgumentBinding*> m_argument_binding_ptrs;
+    std::atomic<bool>                          m_is_valid{ false };
+    std::atomic<uint32_t>                      m_recordings_count{ 0U };
+    mutable TracyLockable(std::mutex,          m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
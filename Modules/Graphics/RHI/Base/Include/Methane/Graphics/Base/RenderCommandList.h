@@ -24,8 +24,10 @@ Base implementation of the render command list interface.
 #pragma once
 
 #include "CommandList.h"
+#include "CommandStream.h"
 
 #include <Methane/Graphics/RHI/IRenderCommandList.h>
+#include <Methane/Graphics/RHI/IRenderCommandBundle.h>
 
 #include <Methane/Data/EnumMask.hpp>
 
@@ -91,14 +93,31 @@ public:
     void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
     void ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) override;
     void ResetWithStateOnce(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) final;
-    void SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups = Rhi::RenderStateGroupMask(~0U)) override;
-    void SetViewState(Rhi::IViewState& view_state) override;
-    bool SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers) override;
-    bool SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers) override;
+    void SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups = Rhi::RenderStateGroupMask(~0U)) final;
+    void SetViewState(Rhi::IViewState& view_state) final;
+    bool SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers) final;
+    bool SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers) final;
     void DrawIndexed(Primitive primitive_type, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
-                     uint32_t instance_count, uint32_t start_instance) override;
+                     uint32_t instance_count, uint32_t start_instance) final;
     void Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
-              uint32_t instance_count, uint32_t start_instance) override;
+              uint32_t instance_count, uint32_t start_instance) final;
+    void ExecuteBundle(Rhi::IRenderCommandBundle& render_command_bundle) override;
+
+    // Command stream mode: validated render commands are recorded to the command stream
+    // and encoded to the native command list on commit, so that per-thread command lists
+    // of the parallel render command list are encoded in parallel. Recorded stream is kept until reset
+    // and can be copied to be executed in other frames without validation of every command.
+    [[nodiscard]] bool IsCommandStreamEnabled() const noexcept    { return m_is_command_stream_enabled; }
+    void SetCommandStreamEnabled(bool is_command_stream_enabled);
+    const CommandStream& GetCommandStream() const noexcept        { return m_command_stream; }
+
+    // Encodes commands of the stream recorded from the same drawing state as current state of this command list,
+    // i.e. stream recorded right after reset can be executed right after reset in any frame
+    void ExecuteCommandStream(const CommandStream& command_stream);
+
+    // Records validated commands of the record function to the separate command stream starting from the empty drawing state,
+    // so that recorded stream can be executed in any drawing state; drawing state of this command list is restored after recording
+    [[nodiscard]] CommandStream RecordCommandStream(const Rhi::IRenderCommandBundle::RecordFunction& record_function);
 
     RenderPass&         GetPass();
     RenderPass*         GetPassPtr() const noexcept      { return m_render_pass_ptr.get(); }
@@ -108,18 +127,51 @@ public:
 protected:
     // CommandList overrides
     void ResetCommandState() override;
+    void EncodeProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) override;
+    void EncodePendingCommands() override;
+
+    // Native encoding of validated commands implemented by graphics API specific command lists
+    virtual void EncodeVertexBuffers(BufferSet&, bool /*set_resource_barriers*/) { /* nothing to encode by default */ }
+    virtual void EncodeIndexBuffer(Buffer&, bool /*set_resource_barriers*/)      { /* nothing to encode by default */ }
+    virtual void EncodeDrawIndexed(Primitive, uint32_t /*index_count*/, uint32_t /*start_index*/, uint32_t /*start_vertex*/,
+                                   uint32_t /*instance_count*/, uint32_t /*start_instance*/) { /* nothing to encode by default */ }
+    virtual void EncodeDraw(Primitive, uint32_t /*vertex_count*/, uint32_t /*start_vertex*/,
+                            uint32_t /*instance_count*/, uint32_t /*start_instance*/)   { /* nothing to encode by default */ }
 
     DrawingState& GetDrawingState() noexcept  { return m_drawing_state; }
     bool          IsParallel() const noexcept { return m_is_parallel; }
 
-    inline void UpdateDrawingState(Primitive primitive_type);
+    inline void UpdateDrawingState(Primitive primitive_type, bool encode_native);
     inline void ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count = 0) const;
 
 private:
+    // Drawing state changes with optional native encoding, shared by commands API and command streams replay
+    void ApplyRenderState(RenderState& render_state, Rhi::RenderStateGroupMask apply_state_groups,
+                          Rhi::RenderStateGroupMask state_groups, bool encode_native);
+    void ApplyViewState(ViewState& view_state, bool encode_native);
+    void ApplyVertexBuffers(BufferSet& vertex_buffers, bool set_resource_barriers, bool encode_native);
+    void ApplyIndexBuffer(Buffer& index_buffer, bool set_resource_barriers, bool encode_native);
+    void ApplyDrawIndexed(Primitive primitive_type, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                          uint32_t instance_count, uint32_t start_instance, bool encode_native);
+    void ApplyDraw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
+                   uint32_t instance_count, uint32_t start_instance, bool encode_native);
+
+    void ReplayCommandStream(const CommandStream& command_stream, size_t begin_data_offset = 0U);
+    void SwapEncodedState();
+
     const bool            m_is_parallel = false;
     const Ptr<RenderPass> m_render_pass_ptr;
     DrawingState          m_drawing_state;
     bool                  m_is_validation_enabled = true;
+
+    // Command stream mode state: drawing state is tracked separately for the commands recorded to stream
+    // and for the commands encoded from stream, which lags behind until pending commands are encoded
+    bool                   m_is_command_stream_enabled = false;
+    bool                   m_is_command_stream_recording = false;
+    CommandStream          m_command_stream;
+    size_t                 m_command_stream_encoded_size = 0U;
+    DrawingState           m_encoded_drawing_state;
+    const ProgramBindings* m_encoded_program_bindings_ptr = nullptr;
 };
 
 } // namespace Methane::Graphics::Base
@@ -0,0 +1,71 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ResourceBarriersBatch.h
+Command list accumulator of resource barriers, which merges consecutive
+transitions of the same resource and drops redundant ones before flush.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Memory.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+class ResourceBarriersBatch
+{
+public:
+    using Barrier  = Rhi::ResourceBarrier;
+    using Barriers = Rhi::IResourceBarriers;
+
+    struct Statistics
+    {
+        uint32_t added_count      = 0U; // barriers added to the batch
+        uint32_t merged_count     = 0U; // barriers merged with pending transition of the same resource
+        uint32_t eliminated_count = 0U; // barriers dropped as no-op or merged transitions
+        uint32_t flushed_count    = 0U; // barriers set to command list
+        uint32_t flushes_count    = 0U; // batched barrier sets set to command list
+    };
+
+    void Add(const Barriers& barriers);
+    void Add(const Barrier& barrier);
+
+    // Returns batched barriers to be set to command list or nullptr when there are no pending barriers.
+    // Transitions are deduplicated only within pending batch, because resource states may be changed
+    // by barriers set directly to command list (render pass, transfer and application barriers).
+    // Transitions between unordered access states synchronize shader writes, so they are never eliminated
+    [[nodiscard]] const Barriers* Flush();
+    void Reset();
+
+    [[nodiscard]] bool                 HasPendingBarriers() const noexcept { return !m_pending_barriers.empty(); }
+    [[nodiscard]] const Barriers::Map& GetPendingBarriers() const noexcept { return m_pending_barriers; }
+    [[nodiscard]] const Statistics&    GetStatistics() const noexcept      { return m_statistics; }
+
+private:
+    void AddStateTransition(const Barrier& barrier);
+    void AddOwnerTransition(const Barrier& barrier);
+
+    Barriers::Map  m_pending_barriers;
+    Ptr<Barriers>  m_batch_barriers_ptr;
+    Statistics     m_statistics;
+};
+
+} // namespace Methane::Graphics::Base
@@ -36,6 +36,7 @@ bound to Program using ProgramArgumentBinging as RootConstant.
 
 #include <mutex>
 #include <atomic>
+#include <vector>
 
 namespace Methane::Graphics::Rhi
 {
@@ -91,6 +92,14 @@ public:
     Data::Bytes& GetData();
 
 protected:
+    using RangeSet = Data::RangeSet<Data::Index>;
+    using Ranges   = std::vector<Accessor::Range>;
+
+    // Returns minimal set of buffer copy ranges covering all data changed since previous call,
+    // adjacent ranges and ranges separated by small gaps are coalesced to reduce copy regions count
+    [[nodiscard]] Ranges TakeDirtyRanges(Data::Size max_merged_gap_size);
+    void ClearDirtyRanges();
+
 #ifdef TRACY_ENABLE
     using Mutex = tracy::Lockable<std::mutex>;
 #else
@@ -101,12 +110,11 @@ protected:
     bool IsDataResizeRequired() const noexcept { return m_data_resize_required.load(); }
 
 private:
-    using RangeSet = Data::RangeSet<Data::Index>;
-
     Data::Size        m_deferred_size = 0U;
     Data::Bytes       m_buffer_data;
     std::atomic<bool> m_data_resize_required{ false };
     RangeSet          m_free_ranges;
+    RangeSet          m_dirty_ranges;
 
     TracyLockable(std::mutex, m_mutex);
 };
@@ -130,6 +138,13 @@ class RootConstantBuffer final
 public:
     using ICallback = IRootConstantBufferCallback;
 
+    struct UploadCounters
+    {
+        Data::Size uploaded_data_size  = 0U; // bytes uploaded to GPU buffer in the last upload (frame)
+        uint32_t   copy_regions_count  = 0U; // number of buffer copy regions in the last upload (frame)
+        Data::Size total_uploaded_size = 0U; // bytes uploaded to GPU buffer since its creation
+    };
+
     explicit RootConstantBuffer(Context& context, std::string_view buffer_name);
 
     // RootConstantStorage overrides
@@ -143,10 +158,9 @@ public:
 
     void SetBufferName(std::string_view buffer_name);
     std::string_view GetBufferName() const { return m_buffer_name; }
+    const UploadCounters& GetUploadCounters() const noexcept { return m_upload_counters; }
 
 private:
-    using RangeSet = Data::RangeSet<Data::Index>;
-
     void UpdateGpuBuffer(Rhi::ICommandQueue& target_cmd_queue);
 
     // Rhi::IContextCallback overrides
@@ -158,7 +172,9 @@ private:
     std::string       m_buffer_name;
     std::atomic<bool> m_buffer_resize_required{ false };
     std::atomic<bool> m_buffer_data_changed{ false };
+    std::atomic<bool> m_buffer_full_upload_required{ false };
     Ptr<Rhi::IBuffer> m_buffer_ptr;
+    UploadCounters    m_upload_counters;
 };
 
 } // namespace Methane::Graphics::Base
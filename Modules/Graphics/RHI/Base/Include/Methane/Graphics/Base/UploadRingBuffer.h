@@ -0,0 +1,125 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/UploadRingBuffer.h
+Linear ring-buffer allocator of transient per-frame upload data ranges,
+which are retired when the frame buffer index is reused.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Graphics/RHI/ResourceView.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <deque>
+#include <mutex>
+#include <span>
+#include <string_view>
+
+namespace Methane::Graphics::Base
+{
+
+class Context;
+
+class UploadRingBuffer final
+    : private Data::Receiver<Rhi::IContextCallback> //NOSONAR
+{
+public:
+    struct Settings
+    {
+        Data::Size       capacity;
+        Data::Size       alignment = 256U;
+        std::string_view name      = "Upload Ring Buffer";
+    };
+
+    struct Allocation
+    {
+        Data::Size             offset = 0U;
+        Data::Size             size   = 0U;
+        std::span<Data::Byte>  data; // CPU-writable range of the transient data
+
+        [[nodiscard]] bool IsEmpty() const noexcept { return size == 0U; }
+    };
+
+    struct Statistics
+    {
+        Data::Size capacity                  = 0U;
+        Data::Size frame_allocated_size      = 0U; // size allocated in the current frame
+        Data::Size frame_high_water_mark     = 0U; // maximum size allocated in a single frame
+        Data::Size in_flight_size            = 0U; // size allocated by all frames not yet retired
+        Data::Size in_flight_high_water_mark = 0U; // maximum size allocated by all frames in flight
+        Data::Size uploaded_size             = 0U; // total size uploaded to GPU buffer
+        uint32_t   frame_allocations_count   = 0U;
+    };
+
+    UploadRingBuffer(Context& context, const Settings& settings);
+
+    // Retires ranges allocated in the previous frame with the same index, which is safe to do
+    // after the frame buffer fence was waited on CPU (i.e. in the beginning of frame rendering)
+    void BeginFrame(Data::Index frame_index);
+
+    [[nodiscard]] Allocation        Allocate(Data::Size size);
+    [[nodiscard]] Allocation        AllocateData(const Data::Chunk& data);
+    [[nodiscard]] Rhi::ResourceView GetResourceView(const Allocation& allocation) const;
+    [[nodiscard]] Rhi::IBuffer&     GetBuffer() const noexcept       { return *m_buffer_ptr; }
+    [[nodiscard]] const Settings&   GetSettings() const noexcept     { return m_settings; }
+    [[nodiscard]] Statistics        GetStatistics() const;
+
+    // Uploads data ranges allocated since previous flush to GPU buffer,
+    // it is called automatically when context is uploading resources
+    void Flush(Rhi::ICommandQueue& target_cmd_queue);
+
+private:
+    // Virtual offsets grow monotonically and are wrapped by capacity to get buffer offsets
+    using VirtualOffset = uint64_t;
+
+    struct FrameRegion
+    {
+        Data::Index   frame_index;
+        VirtualOffset start;
+        VirtualOffset end;
+    };
+
+    // Rhi::IContextCallback overrides
+    void OnContextUploadingResources(Rhi::IContext& context) override;
+    void OnContextReleased(Rhi::IContext&) override    { /* event not handled */ }
+    void OnContextInitialized(Rhi::IContext&) override { /* event not handled */ }
+
+    void UploadRange(Rhi::ICommandQueue& target_cmd_queue, Data::Size start, Data::Size end);
+
+    Context&                m_context;
+    const Settings          m_settings;
+    Ptr<Rhi::IBuffer>       m_buffer_ptr;
+    Data::Bytes             m_data;
+    std::deque<FrameRegion> m_frame_regions;
+    Data::Index             m_frame_index = 0U;
+    VirtualOffset           m_frame_start = 0U;
+    VirtualOffset           m_head = 0U;
+    VirtualOffset           m_tail = 0U;
+    VirtualOffset           m_flushed_head = 0U;
+    Statistics              m_statistics;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
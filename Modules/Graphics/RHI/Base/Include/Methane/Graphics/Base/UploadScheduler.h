@@ -0,0 +1,151 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/UploadScheduler.h
+Asynchronous scheduler of resource data uploads batched in shared staging memory
+and executed on the upload command queue with per-batch readiness futures.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Graphics/RHI/ITexture.h>
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Graphics/RHI/ResourceView.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <deque>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Base
+{
+
+class Context;
+
+class UploadScheduler final
+    : private Data::Receiver<Rhi::IContextCallback>     //NOSONAR
+    , private Data::Receiver<Rhi::ICommandListCallback> //NOSONAR
+{
+public:
+    struct Settings
+    {
+        Data::Size batch_size_limit   = 64U * 1024U * 1024U; // batch is closed for encoding when its data size exceeds the limit
+        Data::Size staging_page_size  = 4U * 1024U * 1024U;  // non-owned data is copied to staging pages shared by many requests
+        Data::Size staging_alignment  = 16U;
+    };
+
+    using Readiness = std::shared_future<void>;
+    using Timeline  = uint64_t;
+
+    struct Statistics
+    {
+        uint32_t   requests_count          = 0U;
+        Data::Size staged_size             = 0U; // size of non-owned data copied to staging memory
+        Data::Size shared_size             = 0U; // size of owned data referenced by requests without copying
+        uint32_t   staging_pages_count     = 0U;
+        Timeline   closed_batches_count    = 0U;
+        Timeline   encoded_batches_count   = 0U;
+        Timeline   completed_batches_count = 0U;
+    };
+
+    explicit UploadScheduler(Context& context);
+    UploadScheduler(Context& context, const Settings& settings);
+    ~UploadScheduler() override;
+
+    UploadScheduler(const UploadScheduler&) = delete;
+    UploadScheduler(UploadScheduler&&) = delete;
+
+    UploadScheduler& operator=(const UploadScheduler&) = delete;
+    UploadScheduler& operator=(UploadScheduler&&) = delete;
+
+    // Schedules are thread-safe: non-owned sub-resource data is copied to staging memory in the calling thread,
+    // stored and shared data is referenced without copying; returned future is ready when the batch upload is completed
+    [[nodiscard]] Readiness Schedule(Rhi::IBuffer& buffer, Rhi::SubResource sub_resource, Rhi::ICommandQueue& target_cmd_queue);
+    [[nodiscard]] Readiness Schedule(Rhi::ITexture& texture, Rhi::SubResources sub_resources, Rhi::ICommandQueue& target_cmd_queue);
+
+    // Encodes scheduled batches to the upload command list and executes it on the upload command queue
+    // without waiting for completion, it should be called from the thread executing context uploads.
+    // Scheduled batches are also encoded automatically when context is uploading resources.
+    // NOTE: batches are encoded one thread at a time, because resources encode their copy commands
+    //       to the single upload command list of the context; scheduling is done in parallel threads.
+    void Submit();
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept { return m_settings; }
+    [[nodiscard]] Statistics      GetStatistics() const;
+
+private:
+    struct Request
+    {
+        Ptr<Rhi::IResource>     resource_ptr;
+        Ptr<Rhi::ICommandQueue> target_cmd_queue_ptr;
+        Rhi::SubResources       sub_resources;
+    };
+
+    struct Batch
+    {
+        Timeline             timeline = 0U;
+        bool                 is_encoding = false; // batch is registered as encoded while its requests are encoded
+        std::vector<Request> requests;
+        Data::Size           data_size = 0U;
+        std::promise<void>   promise;
+        Readiness            readiness;
+
+        Batch();
+    };
+
+    struct StagingPage
+    {
+        Ptr<Data::Bytes> data_ptr;
+        Data::Size       offset = 0U;
+    };
+
+    // Rhi::IContextCallback overrides
+    void OnContextUploadingResources(Rhi::IContext& context) override;
+    void OnContextReleased(Rhi::IContext&) override;
+    void OnContextInitialized(Rhi::IContext&) override { /* event not handled */ }
+
+    // Rhi::ICommandListCallback overrides
+    void OnCommandListStateChanged(Rhi::ICommandList& command_list) override;
+    void OnCommandListExecutionCompleted(Rhi::ICommandList& command_list) override;
+
+    Rhi::SubResource StageSubResource(Rhi::SubResource&& sub_resource);
+    Readiness        AddRequest(Request&& request);
+    void             CloseCurrentBatchNoLock();
+    void             EncodeClosedBatches();
+
+    Context&                     m_context;
+    const Settings               m_settings;
+    Batch                        m_current_batch;
+    std::deque<Batch>            m_closed_batches;
+    std::deque<Batch>            m_encoded_batches;
+    std::deque<Batch>            m_executing_batches;
+    StagingPage                  m_staging_page;
+    Rhi::ICommandList*           m_upload_cmd_list_ptr = nullptr;
+    Statistics                   m_statistics;
+    mutable TracyLockable(std::mutex, m_mutex);
+    TracyLockable(std::mutex, m_encoding_mutex);
+};
+
+} // namespace Methane::Graphics::Base
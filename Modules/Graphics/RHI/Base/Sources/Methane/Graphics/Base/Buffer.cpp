@@ -27,6 +27,8 @@ Base implementation of the buffer interface.
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
@@ -63,10 +65,13 @@ void Buffer::SetData(Rhi::ICommandQueue&, const SubResource& sub_resource)
     META_CHECK_NAME_DESCR("sub_resource", !sub_resource.IsEmptyOrNull(), "can not set empty subresource data to buffer");
     META_CHECK_EQUAL(sub_resource.GetIndex(), SubResource::Index());
 
+    // Optional sub-resource data range defines the target range of buffer data to be updated
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    const Data::Size data_end    = data_offset + sub_resource.GetDataSize();
     const Data::Size reserved_data_size = GetDataSize(Data::MemoryState::Reserved);
     META_UNUSED(reserved_data_size);
-    META_CHECK_LESS_OR_EQUAL_DESCR(sub_resource.GetDataSize(), reserved_data_size, "can not set more data than allocated buffer size");
-    SetInitializedDataSize(sub_resource.GetDataSize());
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_end, reserved_data_size, "can not set more data than allocated buffer size");
+    SetInitializedDataSize(sub_resource.HasDataRange() ? std::max(data_end, GetInitializedDataSize()) : data_end);
 }
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
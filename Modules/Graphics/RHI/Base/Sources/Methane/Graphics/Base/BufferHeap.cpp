@@ -0,0 +1,264 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/BufferHeap.cpp
+Buffer heap used for sub-allocation of small buffers in aligned ranges
+of large backing buffers of the same type.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/BufferHeap.h>
+
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+#include <algorithm>
+#include <cassert>
+
+namespace Methane::Graphics::Base
+{
+
+//////////////////// BufferHeapAllocation ////////////////////
+
+BufferHeapAllocation::BufferHeapAllocation(BufferHeap& heap, Data::Index block_index, const Range& buffer_range, Data::Size data_size)
+    : m_heap_ptr(heap.shared_from_this())
+    , m_block_index(block_index)
+    , m_buffer_range(buffer_range)
+    , m_data_size(data_size)
+{
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_size, buffer_range.GetLength(),
+                                   "buffer heap allocation data size is greater than reserved buffer range size");
+}
+
+BufferHeapAllocation::~BufferHeapAllocation()
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        m_heap_ptr->ReleaseAllocation(*this);
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during release of buffer heap allocation: {}", e.what());
+        assert(false);
+    }
+}
+
+Rhi::IBuffer& BufferHeapAllocation::GetBuffer() const
+{
+    META_FUNCTION_TASK();
+    return m_heap_ptr->GetBlockBuffer(m_block_index);
+}
+
+Rhi::ResourceView BufferHeapAllocation::GetResourceView() const
+{
+    META_FUNCTION_TASK();
+    return GetBuffer().GetBufferView(m_buffer_range.GetStart(), m_data_size);
+}
+
+void BufferHeapAllocation::SetData(Rhi::ICommandQueue& target_cmd_queue, const Data::Chunk& data) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_FALSE_DESCR(data.IsEmptyOrNull(), "can not set empty data to buffer heap allocation");
+    META_CHECK_LESS_OR_EQUAL_DESCR(data.GetDataSize(), m_data_size,
+                                   "can not set more data than allocated in buffer heap");
+    const Rhi::BytesRange target_range(m_buffer_range.GetStart(), m_buffer_range.GetStart() + data.GetDataSize());
+    GetBuffer().SetData(target_cmd_queue, Rhi::SubResource(data.GetDataPtr(), data.GetDataSize(), {}, target_range));
+}
+
+//////////////////// BufferHeap::Statistics ////////////////////
+
+float BufferHeap::Statistics::GetFragmentation() const noexcept
+{
+    META_FUNCTION_TASK();
+    return free_size
+         ? 1.F - static_cast<float>(largest_free_range_size) / static_cast<float>(free_size)
+         : 0.F;
+}
+
+//////////////////// BufferHeap ////////////////////
+
+Ptr<BufferHeap> BufferHeap::Create(const Rhi::IContext& context, const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    // BufferHeap constructor is protected to enforce creation with shared pointer required by allocations
+    struct MakeSharedEnabler : BufferHeap
+    {
+        MakeSharedEnabler(const Rhi::IContext& context, const Settings& settings) : BufferHeap(context, settings) { }
+    };
+    return std::make_shared<MakeSharedEnabler>(context, settings);
+}
+
+BufferHeap::BufferHeap(const Rhi::IContext& context, const Settings& settings)
+    : m_context(context)
+    , m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(settings.block_settings.size, "buffer heap block size can not be zero");
+    META_CHECK_NOT_ZERO_DESCR(settings.alignment, "buffer heap alignment can not be zero");
+    META_CHECK_EQUAL_DESCR(settings.block_settings.size % settings.alignment, 0U,
+                           "buffer heap block size should be a multiple of alignment");
+}
+
+UniquePtr<BufferHeap::Allocation> BufferHeap::Allocate(Data::Size data_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(data_size, "can not allocate zero size range in buffer heap");
+    std::scoped_lock lock(m_mutex);
+
+    const Data::Size aligned_size = Data::AlignUp(data_size, m_settings.alignment);
+    for (Data::Index block_index = 0U; block_index < m_blocks.size(); ++block_index)
+    {
+        Block& block = m_blocks[block_index];
+        if (!block.buffer_ptr)
+            continue;
+
+        if (const Range buffer_range = ReserveBestFitRange(block.free_ranges, aligned_size);
+            !buffer_range.IsEmpty())
+        {
+            block.allocations_count++;
+            return std::make_unique<Allocation>(*this, block_index, buffer_range, data_size);
+        }
+    }
+
+    // Allocations larger than block size get a dedicated block of the exact aligned size
+    const Data::Index block_index = AddBlock(std::max(aligned_size, m_settings.block_settings.size));
+    Block& block = m_blocks[block_index];
+    const Range buffer_range = ReserveBestFitRange(block.free_ranges, aligned_size);
+    META_CHECK_FALSE_DESCR(buffer_range.IsEmpty(), "failed to reserve range in the new buffer heap block");
+    block.allocations_count++;
+    return std::make_unique<Allocation>(*this, block_index, buffer_range, data_size);
+}
+
+BufferHeap::Statistics BufferHeap::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+
+    Statistics statistics;
+    for (const Block& block : m_blocks)
+    {
+        if (!block.buffer_ptr)
+            continue;
+
+        Data::Size block_free_size = 0U;
+        for (const Range& free_range : block.free_ranges)
+        {
+            block_free_size += free_range.GetLength();
+            statistics.largest_free_range_size = std::max(statistics.largest_free_range_size, free_range.GetLength());
+        }
+
+        statistics.blocks_count++;
+        statistics.allocations_count += block.allocations_count;
+        statistics.reserved_size     += block.size;
+        statistics.free_size         += block_free_size;
+        statistics.allocated_size    += block.size - block_free_size;
+        statistics.free_ranges_count += static_cast<uint32_t>(block.free_ranges.Size());
+    }
+    return statistics;
+}
+
+Rhi::IBuffer& BufferHeap::GetBlockBuffer(Data::Index block_index) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    META_CHECK_LESS(block_index, m_blocks.size());
+    const Ptr<Rhi::IBuffer>& buffer_ptr = m_blocks[block_index].buffer_ptr;
+    META_CHECK_NOT_NULL_DESCR(buffer_ptr, "buffer heap block was released");
+    return *buffer_ptr;
+}
+
+uint32_t BufferHeap::ReleaseEmptyBlocks()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+
+    // Blocks are not erased from vector to keep block indices of existing allocations valid,
+    // released block slots are reused for new blocks instead
+    uint32_t released_blocks_count = 0U;
+    for (Data::Index block_index = 1U; block_index < m_blocks.size(); ++block_index)
+    {
+        Block& block = m_blocks[block_index];
+        if (!block.buffer_ptr || block.allocations_count)
+            continue;
+
+        block = Block{};
+        released_blocks_count++;
+    }
+    return released_blocks_count;
+}
+
+void BufferHeap::ReleaseAllocation(const Allocation& allocation)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    Block& block = m_blocks.at(allocation.GetBlockIndex());
+    META_CHECK_NOT_ZERO_DESCR(block.allocations_count, "buffer heap block has no allocations to release");
+    block.free_ranges.Add(allocation.GetBufferRange());
+    block.allocations_count--;
+}
+
+Data::Index BufferHeap::AddBlock(Data::Size block_size)
+{
+    META_FUNCTION_TASK();
+    auto block_it = std::ranges::find_if(m_blocks, [](const Block& block) { return !block.buffer_ptr; });
+    if (block_it == m_blocks.end())
+        block_it = m_blocks.emplace(m_blocks.end());
+
+    Rhi::BufferSettings block_settings = m_settings.block_settings;
+    block_settings.size = block_size;
+
+    const auto block_index = static_cast<Data::Index>(std::distance(m_blocks.begin(), block_it));
+    block_it->buffer_ptr = m_context.CreateBuffer(block_settings);
+    block_it->buffer_ptr->SetName(fmt::format("Buffer Heap Block {}", block_index));
+    block_it->size = block_size;
+    block_it->free_ranges = RangeSet({ { 0U, block_size } });
+    block_it->allocations_count = 0U;
+    return block_index;
+}
+
+BufferHeap::Range BufferHeap::ReserveBestFitRange(RangeSet& free_ranges, Data::Size aligned_size)
+{
+    META_FUNCTION_TASK();
+    // Best-fit search of the smallest free range, which can hold the requested size,
+    // helps to keep large free ranges available and reduces fragmentation
+    const Range* best_range_ptr = nullptr;
+    for (const Range& free_range : free_ranges)
+    {
+        if (free_range.GetLength() < aligned_size ||
+            (best_range_ptr && best_range_ptr->GetLength() <= free_range.GetLength()))
+            continue;
+
+        best_range_ptr = &free_range;
+        if (free_range.GetLength() == aligned_size)
+            break;
+    }
+
+    if (!best_range_ptr)
+        return Range();
+
+    const Range reserved_range(best_range_ptr->GetStart(), best_range_ptr->GetStart() + aligned_size);
+    free_ranges.Remove(reserved_range);
+    return reserved_range;
+}
+
+} // namespace Methane::Graphics::Base
@@ -45,6 +45,9 @@ static Data::TimeRange GetNormalTimeRange(Timestamp start, Timestamp end)
 {
     return Data::TimeRange(std::min(start, end), std::max(start, end));
 }
+
+// Limits timestamp queries count taken by debug groups of one command list from the shared query pool of the command queue
+constexpr size_t g_max_debug_group_timestamp_queries_count = 64U;
 #endif
 
 CommandList::CommandList(CommandQueue& command_queue, Type type)
@@ -68,6 +71,7 @@ void CommandList::PushDebugGroup(IDebugGroup& debug_group)
 {
     META_FUNCTION_TASK();
     VerifyEncodingState();
+    EncodePendingCommands();
 
 #ifdef METHANE_DEBUG_GROUP_FRAMES_ENABLED
     META_CPU_FRAME_START(debug_group.GetName().data());
@@ -75,18 +79,21 @@ void CommandList::PushDebugGroup(IDebugGroup& debug_group)
     META_LOG("{} Command list '{}' PUSH debug group '{}'", magic_enum::enum_name(m_type), GetName(), debug_group.GetName());
 
     PushOpenDebugGroup(debug_group);
+    BeginDebugGroupGpuZone(debug_group);
 }
 
 void CommandList::PopDebugGroup()
 {
     META_FUNCTION_TASK();
     META_CHECK_NOT_EMPTY_DESCR(m_open_debug_groups, "Can not pop debug group, since no debug groups were pushed");
+    EncodePendingCommands();
 
     META_LOG("{} Command list '{}' POP debug group '{}'", magic_enum::enum_name(m_type), GetName(), GetTopOpenDebugGroup()->GetName());
 #ifdef METHANE_DEBUG_GROUP_FRAMES_ENABLED
     META_CPU_FRAME_END(GetTopOpenDebugGroup()->GetName().data());
 #endif
 
+    EndDebugGroupGpuZone();
     m_open_debug_groups.pop();
 }
 
@@ -103,6 +110,12 @@ void CommandList::Reset(IDebugGroup* debug_group_ptr)
     ResetCommandState();
     SetCommandListStateNoLock(State::Encoding);
 
+#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
+    // Debug groups left open from the previous encoding are not timed anymore
+    m_debug_group_timestamp_queries_count = 0U;
+    m_open_debug_group_timestamp_indices = {};
+#endif
+
     const bool debug_group_changed = GetTopOpenDebugGroup() != debug_group_ptr;
     if (!m_open_debug_groups.empty() && debug_group_changed)
     {
@@ -140,16 +153,7 @@ void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rh
              static_cast<std::string>(program_bindings));
 
     auto& program_bindings_base = static_cast<ProgramBindings&>(program_bindings);
-    ApplyProgramBindings(program_bindings_base, apply_behavior);
-
-    if (constexpr Rhi::ProgramBindingsApplyBehaviorMask constant_once_and_changes_only({
-            Rhi::ProgramBindingsApplyBehavior::ConstantOnce,
-            Rhi::ProgramBindingsApplyBehavior::ChangesOnly
-        });
-        apply_behavior.HasAnyBits(constant_once_and_changes_only))
-    {
-        m_command_state.program_bindings_ptr = std::addressof(program_bindings_base);
-    }
+    EncodeProgramBindings(program_bindings_base, apply_behavior);
 
     if (apply_behavior.HasAnyBit(Rhi::ProgramBindingsApplyBehavior::RetainResources))
     {
@@ -166,6 +170,8 @@ void CommandList::Commit()
                            "{} command list '{}' in {} state can not be committed; only command lists in 'Encoding' state can be committed",
                            magic_enum::enum_name(m_type), GetName(), magic_enum::enum_name(m_state));
 
+    FlushResourceBarriers();
+
     TRACY_GPU_SCOPE_END(m_tracy_gpu_scope);
     META_LOG("{} Command list '{}' COMMIT", magic_enum::enum_name(m_type), GetName());
 
@@ -258,6 +264,41 @@ void CommandList::ClearOpenDebugGroups()
     {
         m_open_debug_groups.pop();
     }
+#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
+    m_open_debug_group_timestamp_indices = {};
+#endif
+}
+
+void CommandList::CompleteGpuTimings(const Opt<Data::Index>& frame_index) // NOSONAR - function is not const when instrumentation enabled
+{
+#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
+    META_FUNCTION_TASK();
+    Rhi::GpuTimingReport::Timings gpu_timings;
+    if (m_begin_timestamp_query_ptr && m_end_timestamp_query_ptr)
+    {
+        const Data::TimeRange time_range = GetNormalTimeRange(m_begin_timestamp_query_ptr->GetCpuNanoseconds(),
+                                                              m_end_timestamp_query_ptr->GetCpuNanoseconds());
+        gpu_timings.push_back({ GetName(), 0U, time_range.GetStart(), time_range.GetLength() });
+    }
+
+    for (size_t query_index = 0U; query_index < m_debug_group_timestamp_queries_count; ++query_index)
+    {
+        const DebugGroupTimestampQueries& debug_group_queries = m_debug_group_timestamp_queries[query_index];
+        if (!debug_group_queries.is_resolved)
+            continue;
+
+        const Data::TimeRange time_range = GetNormalTimeRange(debug_group_queries.begin_timestamp_query_ptr->GetCpuNanoseconds(),
+                                                              debug_group_queries.end_timestamp_query_ptr->GetCpuNanoseconds());
+        gpu_timings.push_back({ debug_group_queries.name, debug_group_queries.depth, time_range.GetStart(), time_range.GetLength() });
+    }
+
+    if (!gpu_timings.empty())
+    {
+        GetBaseCommandQueue().AddGpuTimings(frame_index, std::move(gpu_timings));
+    }
+#else
+    META_UNUSED(frame_index);
+#endif
 }
 
 void CommandList::SetCommandListState(State state)
@@ -335,6 +376,54 @@ void CommandList::EndGpuZone() // NOSONAR - function is not const when instrumen
 #endif
 }
 
+void CommandList::BeginDebugGroupGpuZone(const IDebugGroup& debug_group) // NOSONAR - function is not const when instrumentation enabled
+{
+#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
+    META_FUNCTION_TASK();
+    Rhi::ITimestampQueryPool* query_pool_ptr = GetCommandQueue().GetTimestampQueryPoolPtr().get();
+    if (!query_pool_ptr || m_debug_group_timestamp_queries_count >= g_max_debug_group_timestamp_queries_count)
+        return;
+
+    const size_t query_index = m_debug_group_timestamp_queries_count++;
+    if (query_index == m_debug_group_timestamp_queries.size())
+    {
+        DebugGroupTimestampQueries& new_queries = m_debug_group_timestamp_queries.emplace_back();
+        new_queries.begin_timestamp_query_ptr = query_pool_ptr->CreateTimestampQuery(*this);
+        new_queries.end_timestamp_query_ptr   = query_pool_ptr->CreateTimestampQuery(*this);
+    }
+
+    DebugGroupTimestampQueries& debug_group_queries = m_debug_group_timestamp_queries[query_index];
+    debug_group_queries.name        = debug_group.GetName();
+    debug_group_queries.depth       = static_cast<uint32_t>(m_open_debug_group_timestamp_indices.size() + 1U);
+    debug_group_queries.is_resolved = false;
+    m_open_debug_group_timestamp_indices.push(query_index);
+
+    if (debug_group_queries.begin_timestamp_query_ptr)
+        debug_group_queries.begin_timestamp_query_ptr->InsertTimestamp();
+#else
+    META_UNUSED(debug_group);
+#endif
+}
+
+void CommandList::EndDebugGroupGpuZone() // NOSONAR - function is not const when instrumentation enabled
+{
+#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
+    META_FUNCTION_TASK();
+    if (m_open_debug_group_timestamp_indices.empty())
+        return;
+
+    DebugGroupTimestampQueries& debug_group_queries = m_debug_group_timestamp_queries[m_open_debug_group_timestamp_indices.top()];
+    m_open_debug_group_timestamp_indices.pop();
+    if (!debug_group_queries.begin_timestamp_query_ptr || !debug_group_queries.end_timestamp_query_ptr)
+        return;
+
+    debug_group_queries.end_timestamp_query_ptr->InsertTimestamp();
+    debug_group_queries.end_timestamp_query_ptr->ResolveTimestamp();
+    debug_group_queries.begin_timestamp_query_ptr->ResolveTimestamp();
+    debug_group_queries.is_resolved = true;
+#endif
+}
+
 Data::TimeRange CommandList::GetGpuTimeRange(bool in_cpu_nanoseconds) const
 {
     META_FUNCTION_TASK();
@@ -363,6 +452,25 @@ void CommandList::ResetCommandState()
 {
     META_FUNCTION_TASK();
     m_command_state.program_bindings_ptr = nullptr;
+    m_resource_barriers_batch.Reset();
+}
+
+void CommandList::FlushResourceBarriers()
+{
+    META_FUNCTION_TASK();
+    EncodePendingCommands();
+    if (const Rhi::IResourceBarriers* batch_barriers_ptr = m_resource_barriers_batch.Flush();
+        batch_barriers_ptr)
+    {
+        SetResourceBarriers(*batch_barriers_ptr);
+    }
+}
+
+void CommandList::AddResourceBarriers(const Rhi::IResourceBarriers& resource_barriers)
+{
+    META_FUNCTION_TASK();
+    EncodePendingCommands();
+    m_resource_barriers_batch.Add(resource_barriers);
 }
 
 void CommandList::ApplyProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
@@ -370,6 +478,25 @@ void CommandList::ApplyProgramBindings(ProgramBindings& program_bindings, Rhi::P
     program_bindings.Apply(*this, apply_behavior);
 }
 
+void CommandList::EncodeProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
+{
+    META_FUNCTION_TASK();
+    ApplyProgramBindings(program_bindings, apply_behavior);
+    UpdateProgramBindingsState(program_bindings, apply_behavior);
+}
+
+void CommandList::UpdateProgramBindingsState(const ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
+{
+    if (constexpr Rhi::ProgramBindingsApplyBehaviorMask constant_once_and_changes_only({
+            Rhi::ProgramBindingsApplyBehavior::ConstantOnce,
+            Rhi::ProgramBindingsApplyBehavior::ChangesOnly
+        });
+        apply_behavior.HasAnyBits(constant_once_and_changes_only))
+    {
+        m_command_state.program_bindings_ptr = std::addressof(program_bindings);
+    }
+}
+
 CommandQueue& CommandList::GetBaseCommandQueue()
 {
     META_FUNCTION_TASK();
@@ -89,6 +89,7 @@ void CommandListSet::Complete() const
         if (command_list.GetState() != CommandList::State::Executing)
             continue;
 
+        command_list.CompleteGpuTimings(m_frame_index_opt);
         command_list.Complete();
     }
 
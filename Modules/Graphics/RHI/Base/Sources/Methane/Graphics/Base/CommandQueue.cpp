@@ -25,7 +25,9 @@ Base implementation of the command queue interface.
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/CommandListSet.h>
 #include <Methane/Graphics/Base/CommandKit.h>
+#include <Methane/Graphics/Base/RenderCommandBundle.h>
 #include <Methane/Graphics/Base/RenderContext.h>
+#include <Methane/Graphics/RHI/IQueryPool.h>
 
 #include <Methane/Instrumentation.h>
 
@@ -56,6 +58,7 @@ bool CommandQueue::SetName(std::string_view name)
     {
         m_tracy_gpu_context_ptr->SetName(name);
     }
+    m_gpu_timing_report.SetQueueName(name);
     return true;
 }
 
@@ -65,6 +68,14 @@ Ptr<Rhi::ICommandKit> CommandQueue::CreateCommandKit()
     return std::make_shared<CommandKit>(*this);
 }
 
+Ptr<Rhi::IRenderCommandBundle> CommandQueue::CreateRenderCommandBundle(Rhi::IRenderCommandBundle::RecordFunction record_function)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL_DESCR(m_command_lists_type, Rhi::CommandListType::Render,
+                           "render command bundle can be created only with render command queue");
+    return std::make_shared<RenderCommandBundle>(std::move(record_function));
+}
+
 const Rhi::IContext& CommandQueue::GetContext() const noexcept
 {
     META_FUNCTION_TASK();
@@ -85,6 +96,18 @@ Tracy::GpuContext& CommandQueue::GetTracyContext() const
     return *m_tracy_gpu_context_ptr;
 }
 
+void CommandQueue::AddGpuTimings(const Opt<Data::Index>& frame_index, Rhi::GpuTimingReport::Timings&& gpu_timings)
+{
+    META_FUNCTION_TASK();
+    if (const Ptr<Rhi::ITimestampQueryPool>& timestamp_query_pool_ptr = GetTimestampQueryPoolPtr();
+        timestamp_query_pool_ptr)
+    {
+        m_gpu_timing_report.SetCalibratedTimestamps(timestamp_query_pool_ptr->GetCalibratedTimestamps(),
+                                                    timestamp_query_pool_ptr->GetGpuFrequency());
+    }
+    m_gpu_timing_report.AddTimings(frame_index, std::move(gpu_timings));
+}
+
 void CommandQueue::InitializeTracyGpuContext(const Tracy::GpuContext::Settings& tracy_settings)
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,147 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/CommandStream.cpp
+Backend agnostic stream of validated render commands recorded in compact linear memory
+by render command list and encoded to the native command lists at commit or on execution.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/CommandStream.h>
+#include <Methane/Graphics/Base/RenderCommandList.h>
+#include <Methane/Graphics/Base/RenderState.h>
+#include <Methane/Graphics/Base/ViewState.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
+#include <Methane/Graphics/Base/BufferSet.h>
+#include <Methane/Graphics/Base/Buffer.h>
+
+#include <Methane/Graphics/RHI/IParallelRenderCommandList.h>
+#include <Methane/Graphics/RHI/ICommandQueue.h>
+#include <Methane/Graphics/RHI/IContext.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+void CommandStream::Translate(const std::vector<const CommandStream*>& command_streams,
+                              Rhi::IParallelRenderCommandList& parallel_command_list)
+{
+    META_FUNCTION_TASK();
+    const Refs<Rhi::IRenderCommandList>& render_command_lists = parallel_command_list.GetParallelCommandLists();
+    META_CHECK_EQUAL_DESCR(command_streams.size(), render_command_lists.size(),
+                           "count of command streams should be equal to the count of parallel render command lists");
+
+    tf::Taskflow translate_task_flow;
+    translate_task_flow.for_each_index(size_t(0), command_streams.size(), size_t(1),
+        [&command_streams, &render_command_lists](const size_t stream_index)
+        {
+            META_FUNCTION_TASK();
+            META_CHECK_NOT_NULL(command_streams[stream_index]);
+            static_cast<RenderCommandList&>(render_command_lists[stream_index].get()).ExecuteCommandStream(*command_streams[stream_index]);
+        });
+    parallel_command_list.GetCommandQueue().GetContext().GetParallelExecutor().run(translate_task_flow).get();
+}
+
+void CommandStream::SetRenderState(RenderState& render_state, Rhi::RenderStateGroupMask apply_state_groups, Rhi::RenderStateGroupMask state_groups)
+{
+    META_FUNCTION_TASK();
+    Write(SetRenderStateArgs{ AddObject(render_state), apply_state_groups.GetValue(), state_groups.GetValue() });
+}
+
+void CommandStream::SetViewState(ViewState& view_state)
+{
+    META_FUNCTION_TASK();
+    Write(SetViewStateArgs{ AddObject(view_state) });
+}
+
+void CommandStream::SetProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
+{
+    META_FUNCTION_TASK();
+    Write(SetProgramBindingsArgs{ AddObject(program_bindings), apply_behavior.GetValue() });
+}
+
+void CommandStream::SetVertexBuffers(BufferSet& vertex_buffers, bool set_resource_barriers)
+{
+    META_FUNCTION_TASK();
+    Write(SetVertexBuffersArgs{ AddObject(vertex_buffers), set_resource_barriers ? 1U : 0U });
+}
+
+void CommandStream::SetIndexBuffer(Buffer& index_buffer, bool set_resource_barriers)
+{
+    META_FUNCTION_TASK();
+    Write(SetIndexBufferArgs{ AddObject(index_buffer), set_resource_barriers ? 1U : 0U });
+}
+
+void CommandStream::Draw(Rhi::RenderPrimitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
+                         uint32_t instance_count, uint32_t start_instance)
+{
+    META_FUNCTION_TASK();
+    Write(DrawArgs{ static_cast<uint32_t>(primitive_type), vertex_count, start_vertex, instance_count, start_instance });
+}
+
+void CommandStream::DrawIndexed(Rhi::RenderPrimitive primitive_type, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                                uint32_t instance_count, uint32_t start_instance)
+{
+    META_FUNCTION_TASK();
+    Write(DrawIndexedArgs{ static_cast<uint32_t>(primitive_type), index_count, start_index, start_vertex, instance_count, start_instance });
+}
+
+void CommandStream::Clear()
+{
+    META_FUNCTION_TASK();
+    m_data.clear();
+    m_objects.clear();
+    m_object_handles.clear();
+    m_retained_objects.clear();
+    m_retained_view_states.clear();
+    m_commands_count = 0U;
+}
+
+CommandStream::ObjectHandle CommandStream::AddObjectEntry(void* object_ptr, Object& object)
+{
+    META_FUNCTION_TASK();
+    const auto object_handle = static_cast<ObjectHandle>(m_objects.size());
+    m_objects.push_back(object_ptr);
+    m_object_handles.try_emplace(object_ptr, object_handle);
+    m_retained_objects.emplace_back(object.GetBasePtr());
+    return object_handle;
+}
+
+CommandStream::ObjectHandle CommandStream::AddObjectEntry(void* object_ptr, ViewState& view_state)
+{
+    META_FUNCTION_TASK();
+    const auto object_handle = static_cast<ObjectHandle>(m_objects.size());
+    m_objects.push_back(object_ptr);
+    m_object_handles.try_emplace(object_ptr, object_handle);
+    m_retained_view_states.emplace_back(view_state.GetPtr());
+    return object_handle;
+}
+
+void* CommandStream::GetStreamObjectPtr(ObjectHandle object_handle) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(object_handle, m_objects.size());
+    return m_objects[object_handle];
+}
+
+} // namespace Methane::Graphics::Base
@@ -86,6 +86,8 @@ void ComputeCommandList::Dispatch([[maybe_unused]] const Rhi::ThreadGroupsCount&
     META_FUNCTION_TASK();
     META_LOG("{} Command list '{}' DISPATCH {} thread groups count.",
              magic_enum::enum_name(GetType()), GetName(), thread_groups_count);
+
+    FlushResourceBarriers();
 }
 
 } // namespace Methane::Graphics::Base
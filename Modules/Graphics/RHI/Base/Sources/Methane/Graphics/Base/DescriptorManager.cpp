@@ -28,14 +28,18 @@ Base descriptor manager implementation.
 #include <Methane/Instrumentation.h>
 
 #include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
 #include <ranges>
 
 namespace Methane::Graphics::Base
 {
 
+static std::atomic<uint64_t> g_next_descriptor_manager_id{ 1U };
+
 DescriptorManager::DescriptorManager(Context& context, bool is_parallel_bindings_processing_enabled)
     : m_context(context)
     , m_is_parallel_bindings_processing_enabled(is_parallel_bindings_processing_enabled)
+    , m_instance_id(g_next_descriptor_manager_id.fetch_add(1U, std::memory_order_relaxed))
 { }
 
 void DescriptorManager::CompleteInitialization()
@@ -48,67 +52,153 @@ void DescriptorManager::CompleteInitialization()
 void DescriptorManager::Release()
 {
     META_FUNCTION_TASK();
-    m_program_bindings.clear();
+    for (ProgramBindingsShard& shard : m_program_bindings_shards)
+    {
+        std::scoped_lock lock_guard(shard.mutex);
+        shard.program_bindings.clear();
+    }
 }
 
-void DescriptorManager::ReleaseExpiredProgramBindings()
+uint32_t DescriptorManager::AcquireBindlessDescriptor(const Rhi::ResourceView&)
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_program_bindings_mutex);
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(0U, "bindless descriptors are not supported by graphics API");
+}
 
-    const auto remove_range = std::ranges::remove_if(m_program_bindings,
-        [](const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr)
-        { return program_bindings_wptr.expired(); }
-    );
+size_t DescriptorManager::GetProgramBindingsCount() const
+{
+    META_FUNCTION_TASK();
+    size_t program_bindings_count = 0U;
+    for (const ProgramBindingsShard& shard : m_program_bindings_shards)
+    {
+        std::scoped_lock lock_guard(shard.mutex);
+        program_bindings_count += shard.program_bindings.size();
+    }
+    return program_bindings_count;
+}
 
-    m_program_bindings.erase(remove_range.begin(), remove_range.end());
+size_t DescriptorManager::GetCurrentThreadShardIndex() noexcept
+{
+    // Threads are assigned to shards in round-robin order on first registration in this descriptor manager,
+    // so that each thread appends to its own shard until threads count exceeds shards count.
+    // Thread keeps the shard of the last used descriptor manager, which is identified by unique instance id
+    // instead of address to prevent reusing shard assignment of the released manager
+    struct ThreadShard
+    {
+        uint64_t manager_id  = 0U;
+        size_t   shard_index = 0U;
+    };
+
+    thread_local ThreadShard s_thread_shard;
+    if (s_thread_shard.manager_id != m_instance_id)
+    {
+        s_thread_shard.manager_id  = m_instance_id;
+        s_thread_shard.shard_index = m_next_shard_index.fetch_add(1U, std::memory_order_relaxed) % g_program_bindings_shards_count;
+    }
+    return s_thread_shard.shard_index;
 }
 
-void DescriptorManager::CompleteProgramBindingsInitialization()
+void DescriptorManager::ReleaseExpiredProgramBindings()
 {
     META_FUNCTION_TASK();
-    constexpr auto binding_initialization_completer = [](const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr)
+    m_compaction_epoch.fetch_add(1U, std::memory_order_acq_rel);
+    const auto shard_compactor = [](ProgramBindingsShard& shard)
     {
         META_FUNCTION_TASK();
-        // Some binding pointers may become expired here due to command list retained resources cleanup on execution completion
-        Ptr<Rhi::IProgramBindings> program_bindings_ptr = program_bindings_wptr.lock();
-        if (!program_bindings_ptr)
-            return;
+        std::scoped_lock lock_guard(shard.mutex);
+        const auto remove_range = std::ranges::remove_if(shard.program_bindings,
+            [](const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr)
+            { return program_bindings_wptr.expired(); }
+        );
 
-        static_cast<ProgramBindings&>(*program_bindings_ptr).CompleteInitialization();
+        shard.program_bindings.erase(remove_range.begin(), remove_range.end());
     };
 
-    std::scoped_lock lock_guard(m_program_bindings_mutex);
     if (m_is_parallel_bindings_processing_enabled)
     {
         tf::Taskflow task_flow;
-        task_flow.for_each(m_program_bindings.begin(), m_program_bindings.end(), binding_initialization_completer);
+        task_flow.for_each(m_program_bindings_shards.begin(), m_program_bindings_shards.end(), shard_compactor);
         m_context.GetParallelExecutor().run(task_flow).get();
     }
     else
     {
-        for (const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr : m_program_bindings)
-            binding_initialization_completer(program_bindings_wptr);
+        std::ranges::for_each(m_program_bindings_shards, shard_compactor);
     }
 }
 
-void DescriptorManager::AddProgramBindings(Rhi::IProgramBindings& program_bindings)
+Ptrs<Rhi::IProgramBindings> DescriptorManager::AcquireProgramBindingsSnapshot()
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_program_bindings_mutex);
+    Ptrs<Rhi::IProgramBindings> program_bindings_snapshot;
+    program_bindings_snapshot.reserve(GetProgramBindingsCount());
+
+    // Shard locks are held only while strong pointers are collected, so that bindings creation
+    // from other threads is not blocked by the long running bindings initialization
+    for (ProgramBindingsShard& shard : m_program_bindings_shards)
+    {
+        std::scoped_lock lock_guard(shard.mutex);
+        for (const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr : shard.program_bindings)
+        {
+            // Some binding pointers may become expired here due to command list retained resources cleanup on execution completion
+            if (Ptr<Rhi::IProgramBindings> program_bindings_ptr = program_bindings_wptr.lock();
+                program_bindings_ptr)
+                program_bindings_snapshot.emplace_back(std::move(program_bindings_ptr));
+        }
+    }
+    return program_bindings_snapshot;
+}
 
+void DescriptorManager::CompleteProgramBindingsInitialization()
+{
+    META_FUNCTION_TASK();
+    const Ptrs<Rhi::IProgramBindings> program_bindings_snapshot = AcquireProgramBindingsSnapshot();
+    const auto program_bindings_count = static_cast<uint32_t>(program_bindings_snapshot.size());
+    const auto binding_initialization_completer = [&program_bindings_snapshot](uint32_t program_bindings_index)
+    {
+        META_FUNCTION_TASK();
+        static_cast<ProgramBindings&>(*program_bindings_snapshot[program_bindings_index]).CompleteInitialization();
+    };
+
+    if (m_is_parallel_bindings_processing_enabled && program_bindings_count > 1U)
+    {
+        // Bindings are processed in chunks to amortize task scheduling overhead on massive bindings count
+        const tf::Executor& parallel_executor = m_context.GetParallelExecutor();
+        const size_t workers_count = std::max<size_t>(1U, parallel_executor.num_workers());
+        const size_t chunk_size    = std::max<size_t>(1U, program_bindings_count / (workers_count * 4U));
+
+        tf::Taskflow task_flow;
+        task_flow.for_each_index(0U, program_bindings_count, 1U, binding_initialization_completer,
+                                 tf::GuidedPartitioner(chunk_size));
+        m_context.GetParallelExecutor().run(task_flow).get();
+    }
+    else
+    {
+        for (uint32_t program_bindings_index = 0U; program_bindings_index < program_bindings_count; ++program_bindings_index)
+            binding_initialization_completer(program_bindings_index);
+    }
+}
+
+void DescriptorManager::AddProgramBindings(Rhi::IProgramBindings& program_bindings)
+{
+    META_FUNCTION_TASK();
 #ifdef _DEBUG
     // This may cause performance drop on adding massive amount of program bindings,
     // so we assume that only different program bindings are added and check it in Debug builds only
-    const auto program_bindings_it = std::ranges::find_if(m_program_bindings,
-        [&program_bindings](const WeakPtr<Rhi::IProgramBindings>& program_bindings_ptr)
-        { return !program_bindings_ptr.expired() && program_bindings_ptr.lock().get() == std::addressof(program_bindings); }
-    );
-    META_CHECK_DESCR("program_bindings", program_bindings_it == m_program_bindings.end(),
-                     "program bindings instance was already added to resource manager");
+    for (ProgramBindingsShard& shard : m_program_bindings_shards)
+    {
+        std::scoped_lock lock_guard(shard.mutex);
+        const auto program_bindings_it = std::ranges::find_if(shard.program_bindings,
+            [&program_bindings](const WeakPtr<Rhi::IProgramBindings>& program_bindings_ptr)
+            { return !program_bindings_ptr.expired() && program_bindings_ptr.lock().get() == std::addressof(program_bindings); }
+        );
+        META_CHECK_DESCR("program_bindings", program_bindings_it == shard.program_bindings.end(),
+                         "program bindings instance was already added to resource manager");
+    }
 #endif
 
-    m_program_bindings.push_back(static_cast<ProgramBindings&>(program_bindings).GetPtr<ProgramBindings>());
+    ProgramBindingsShard& shard = m_program_bindings_shards[GetCurrentThreadShardIndex()];
+    std::scoped_lock lock_guard(shard.mutex);
+    shard.program_bindings.push_back(static_cast<ProgramBindings&>(program_bindings).GetPtr<ProgramBindings>());
 }
 
 } // namespace Methane::Graphics::Base
@@ -28,6 +28,7 @@ Base implementation of the named object interface.
 
 #include <stdexcept>
 #include <cassert>
+#include <mutex>
 
 namespace Methane::Graphics::Base
 {
@@ -38,7 +39,7 @@ void ObjectRegistry::AddGraphicsObject(Rhi::IObject& object)
     META_CHECK_NOT_EMPTY_DESCR(object.GetName(), "Can not add graphics object without name to the objects registry.");
 
     const auto& obj = dynamic_cast<Object&>(object);
-    const auto [name_and_object_it, object_added] = m_object_by_name.try_emplace(obj.GetNameRef(), object.GetPtr());
+    const auto [name_and_object_it, object_added] = m_object_by_name.try_emplace(obj.GetInternedName(), object.GetPtr());
     if (!object_added &&
         !name_and_object_it->second.expired() &&
          name_and_object_it->second.lock().get() != std::addressof(object))
@@ -53,8 +54,8 @@ void ObjectRegistry::RemoveGraphicsObject(Rhi::IObject& object)
     META_FUNCTION_TASK();
 
     const auto& obj = dynamic_cast<Object&>(object);
-    const std::string& object_name = obj.GetNameRef();
-    META_CHECK_NOT_EMPTY_DESCR(object_name, "Can not remove graphics object without name to the objects registry.");
+    const Data::InternedString& object_name = obj.GetInternedName();
+    META_CHECK_NOT_EMPTY_DESCR(object_name.GetView(), "Can not remove graphics object without name to the objects registry.");
 
     if (m_object_by_name.erase(object_name))
     {
@@ -65,30 +66,38 @@ void ObjectRegistry::RemoveGraphicsObject(Rhi::IObject& object)
 Ptr<Rhi::IObject> ObjectRegistry::GetGraphicsObject(const std::string& object_name) const noexcept
 {
     META_FUNCTION_TASK();
-    const auto object_by_name_it = m_object_by_name.find(object_name);
+    const Opt<Data::InternedString> interned_name_opt = Data::InternedString::Find(object_name);
+    if (!interned_name_opt)
+        return nullptr;
+
+    const auto object_by_name_it = m_object_by_name.find(*interned_name_opt);
     return object_by_name_it == m_object_by_name.end() ? nullptr : object_by_name_it->second.lock();
 }
 
 bool ObjectRegistry::HasGraphicsObject(const std::string& object_name) const noexcept
 {
     META_FUNCTION_TASK();
-    const auto object_by_name_it = m_object_by_name.find(object_name);
+    const Opt<Data::InternedString> interned_name_opt = Data::InternedString::Find(object_name);
+    if (!interned_name_opt)
+        return false;
+
+    const auto object_by_name_it = m_object_by_name.find(*interned_name_opt);
     return object_by_name_it != m_object_by_name.end() && !object_by_name_it->second.expired();
 }
 
 void ObjectRegistry::OnObjectNameChanged(Rhi::IObject& object, const std::string& old_name)
 {
     META_FUNCTION_TASK();
-    const auto object_by_name_it = m_object_by_name.find(old_name);
+    const auto object_by_name_it = m_object_by_name.find(Data::InternedString(old_name));
     META_CHECK_TRUE_DESCR(object_by_name_it != m_object_by_name.end(),
                           "renamed object was not found in the objects registry by its old name '{}'", old_name);
-    META_CHECK_TRUE_DESCR(object_by_name_it->second.expired(),
+    META_CHECK_FALSE_DESCR(object_by_name_it->second.expired(),
                           "object pointer stored in registry by old name '{}' has expired", old_name);
     META_CHECK_TRUE_DESCR(std::addressof(*object_by_name_it->second.lock()) == std::addressof(object),
                           "object stored in the registry by old name '{}' differs from the renamed object", old_name);
 
-    const std::string_view new_name = object.GetName();
-    if (new_name.empty())
+    const Data::InternedString& new_name = dynamic_cast<Object&>(object).GetInternedName();
+    if (new_name.IsEmpty())
     {
         m_object_by_name.erase(object_by_name_it);
         object.Disconnect(*this);
@@ -106,10 +115,54 @@ void ObjectRegistry::OnObjectDestroyed(Rhi::IObject& object)
     RemoveGraphicsObject(object);
 }
 
+static std::mutex& GetNameFormatMutex()
+{
+    static std::mutex s_name_format_mutex;
+    return s_name_format_mutex;
+}
+
 Object::Object(std::string_view name)
     : m_name(name)
 { }
 
+Object::Object(const Object& other)
+    : std::enable_shared_from_this<Object>(other)
+    , Data::Emitter<Rhi::IObjectCallback>(other)
+    , m_name(other.GetInternedName())
+{ }
+
+Object::Object(Object&& other) noexcept
+    : std::enable_shared_from_this<Object>(std::move(other))
+    , Data::Emitter<Rhi::IObjectCallback>(std::move(other))
+    , m_name(other.GetInternedName())
+{ }
+
+Object& Object::operator=(const Object& other)
+{
+    META_FUNCTION_TASK();
+    if (this == std::addressof(other))
+        return *this;
+
+    Data::Emitter<Rhi::IObjectCallback>::operator=(other);
+    m_name = other.GetInternedName();
+    m_name_formatter = {};
+    m_is_name_format_pending = false;
+    return *this;
+}
+
+Object& Object::operator=(Object&& other) noexcept
+{
+    META_FUNCTION_TASK();
+    if (this == std::addressof(other))
+        return *this;
+
+    Data::Emitter<Rhi::IObjectCallback>::operator=(std::move(other));
+    m_name = other.GetInternedName();
+    m_name_formatter = {};
+    m_is_name_format_pending = false;
+    return *this;
+}
+
 Object::~Object()
 {
     META_FUNCTION_TASK();
@@ -134,14 +187,60 @@ Ptr<Rhi::IObject> Object::GetPtr()
 bool Object::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
-    if (m_name == name)
+    const Data::InternedString old_name = GetInternedName();
+    if (old_name == name)
         return false;
 
-    const std::string old_name = m_name;
-    m_name = name;
+    // Interned name strings are never released, so the old name is passed to callbacks without copying
+    m_name = Data::InternedString(name);
 
-    Emit(&Rhi::IObjectCallback::OnObjectNameChanged, *this, old_name);
+    Emit(&Rhi::IObjectCallback::OnObjectNameChanged, *this, old_name.GetString());
     return true;
 }
 
+bool Object::SetLazyName(NameFormatter name_formatter)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(static_cast<bool>(name_formatter), "object name formatter is not initialized");
+
+    // Connected receivers are notified about name change immediately, so the name is formatted eagerly
+    if (!IsLazyNameSupported() || GetConnectedReceiversCount())
+        return SetName(name_formatter());
+
+    m_name_formatter = std::move(name_formatter);
+    m_is_name_format_pending.store(true, std::memory_order_release);
+    return true;
+}
+
+const Data::InternedString& Object::GetInternedName() const noexcept
+{
+    if (m_is_name_format_pending.load(std::memory_order_acquire))
+    {
+        FormatName();
+    }
+    return m_name;
+}
+
+void Object::FormatName() const noexcept
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(GetNameFormatMutex());
+    if (!m_is_name_format_pending.load(std::memory_order_relaxed))
+        return;
+
+    try
+    {
+        m_name = Data::InternedString(m_name_formatter());
+    }
+    catch (const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during object name formatting: {}", e.what());
+        assert(false);
+    }
+
+    m_name_formatter = {};
+    m_is_name_format_pending.store(false, std::memory_order_release);
+}
+
 } // namespace Methane::Graphics::Base
\ No newline at end of file
@@ -58,6 +58,17 @@ void ParallelRenderCommandList::SetValidationEnabled(bool is_validation_enabled)
     }
 }
 
+void ParallelRenderCommandList::SetCommandStreamEnabled(bool is_command_stream_enabled)
+{
+    META_FUNCTION_TASK();
+    m_is_command_stream_enabled = is_command_stream_enabled;
+    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_parallel_command_lists)
+    {
+        META_CHECK_NOT_NULL(render_command_list_ptr);
+        render_command_list_ptr->SetCommandStreamEnabled(m_is_command_stream_enabled);
+    }
+}
+
 Rhi::IRenderPass& ParallelRenderCommandList::GetRenderPass() const
 {
     META_FUNCTION_TASK();
@@ -159,6 +170,7 @@ void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count)
         m_parallel_command_lists.emplace_back(std::static_pointer_cast<RenderCommandList>(CreateCommandList(false)));
         RenderCommandList& render_command_list = *m_parallel_command_lists.back();
         render_command_list.SetValidationEnabled(m_is_validation_enabled);
+        render_command_list.SetCommandStreamEnabled(m_is_command_stream_enabled);
         m_parallel_command_lists_refs.emplace_back(render_command_list);
         if (!name.empty())
         {
@@ -211,6 +223,18 @@ void ParallelRenderCommandList::Complete()
     CommandList::Complete();
 }
 
+void ParallelRenderCommandList::CompleteGpuTimings(const Opt<Data::Index>& frame_index)
+{
+    META_FUNCTION_TASK();
+    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_parallel_command_lists)
+    {
+        META_CHECK_NOT_NULL(render_command_list_ptr);
+        render_command_list_ptr->CompleteGpuTimings(frame_index);
+    }
+
+    CommandList::CompleteGpuTimings(frame_index);
+}
+
 bool ParallelRenderCommandList::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
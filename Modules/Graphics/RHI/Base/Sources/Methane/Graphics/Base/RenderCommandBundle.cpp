@@ -0,0 +1,125 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/RenderCommandBundle.cpp
+Base implementation of the render command bundle interface:
+render commands are recorded once to the command stream and replayed without validation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/RenderCommandBundle.h>
+#include <Methane/Graphics/Base/RenderCommandList.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+
+namespace Methane::Graphics::Base
+{
+
+RenderCommandBundle::RenderCommandBundle(RecordFunction record_function)
+    : m_record_function(std::move(record_function))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(static_cast<bool>(m_record_function), "render command bundle record function must be set");
+}
+
+RenderCommandBundle::~RenderCommandBundle()
+{
+    META_FUNCTION_TASK();
+    DisconnectArgumentBindings();
+}
+
+Ptr<const CommandStream> RenderCommandBundle::GetCommandStream(RenderCommandList& recording_command_list)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    if (m_is_valid && m_command_stream_ptr)
+        return m_command_stream_ptr;
+
+    // Argument bindings are disconnected before releasing the stream, which may hold the last references to them
+    DisconnectArgumentBindings();
+    m_command_stream_ptr.reset();
+
+    // Bundle is marked valid before recording, so that invalidation during recording is not lost
+    m_is_valid = true;
+    try
+    {
+        m_command_stream_ptr = std::make_shared<const CommandStream>(recording_command_list.RecordCommandStream(m_record_function));
+    }
+    catch (...)
+    {
+        m_is_valid = false;
+        throw;
+    }
+
+    m_recordings_count++;
+    ConnectArgumentBindings();
+    return m_command_stream_ptr;
+}
+
+Ptr<const CommandStream> RenderCommandBundle::GetCommandStreamPtr() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    return m_command_stream_ptr;
+}
+
+void RenderCommandBundle::OnProgramArgumentBindingResourceViewsChanged(const Rhi::IProgramArgumentBinding&,
+                                                                       const Rhi::ResourceViews&, const Rhi::ResourceViews&)
+{
+    META_FUNCTION_TASK();
+    Invalidate();
+}
+
+void RenderCommandBundle::ConnectArgumentBindings()
+{
+    META_FUNCTION_TASK();
+    const CommandStream& command_stream = *m_command_stream_ptr;
+    command_stream.ForEachCommand([this, &command_stream](CommandStream::Command command, const std::byte* args_data)
+    {
+        if (command != CommandStream::Command::SetProgramBindings)
+            return;
+
+        const auto args = CommandStream::GetArgs<CommandStream::SetProgramBindingsArgs>(args_data);
+        const ProgramBindings& program_bindings = command_stream.GetStreamObject<ProgramBindings>(args.program_bindings);
+        for (const Rhi::ProgramArgument& program_argument : program_bindings.GetArguments())
+        {
+            Rhi::IProgramArgumentBinding& argument_binding = program_bindings.Get(program_argument);
+            if (std::ranges::find(m_argument_binding_ptrs, &argument_binding) != m_argument_binding_ptrs.end())
+                continue;
+
+            static_cast<Data::IEmitter<Rhi::IProgramArgumentBindingCallback>&>(argument_binding).Connect(*this);
+            m_argument_binding_ptrs.push_back(&argument_binding);
+        }
+    });
+}
+
+void RenderCommandBundle::DisconnectArgumentBindings()
+{
+    META_FUNCTION_TASK();
+    for (Rhi::IProgramArgumentBinding* argument_binding_ptr : m_argument_binding_ptrs)
+    {
+        static_cast<Data::IEmitter<Rhi::IProgramArgumentBindingCallback>&>(*argument_binding_ptr).Disconnect(*this);
+    }
+    m_argument_binding_ptrs.clear();
+}
+
+} // namespace Methane::Graphics::Base
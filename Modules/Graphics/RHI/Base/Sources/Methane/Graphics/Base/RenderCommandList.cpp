@@ -22,6 +22,7 @@ Base implementation of the render command list interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/Base/RenderCommandList.h>
+#include <Methane/Graphics/Base/RenderCommandBundle.h>
 #include <Methane/Graphics/Base/ParallelRenderCommandList.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/RenderPass.h>
@@ -30,6 +31,7 @@ Base implementation of the render command list interface.
 #include <Methane/Graphics/Base/Buffer.h>
 #include <Methane/Graphics/Base/BufferSet.h>
 #include <Methane/Graphics/Base/Program.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Texture.h>
 
 #include <Methane/Instrumentation.h>
@@ -69,6 +71,10 @@ void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
     {
         META_LOG("{}", static_cast<std::string>(m_render_pass_ptr->GetPattern().GetSettings()));
         m_drawing_state.render_pass_attachment_ptrs = m_render_pass_ptr->GetNonFrameBufferAttachmentTextures();
+        if (m_is_command_stream_enabled)
+        {
+            m_encoded_drawing_state.render_pass_attachment_ptrs = m_drawing_state.render_pass_attachment_ptrs;
+        }
     }
 }
 
@@ -109,18 +115,16 @@ void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::Ren
     }
 
     auto& render_state_base = static_cast<RenderState&>(render_state);
-    if (!render_state_base.IsDeferred())
+    if (m_is_command_stream_enabled)
     {
-        render_state_base.Apply(*this, changed_states & state_groups);
+        m_command_stream.SetRenderState(render_state_base, changed_states & state_groups, state_groups);
     }
+    ApplyRenderState(render_state_base, changed_states & state_groups, state_groups, !m_is_command_stream_enabled);
 
-    Ptr<Object> render_state_object_ptr = render_state_base.GetBasePtr();
-    m_drawing_state.render_state_ptr = std::static_pointer_cast<RenderState>(render_state_object_ptr);
-    m_drawing_state.render_state_groups |= state_groups;
-
-    if (render_state_changed && !render_state_base.IsDeferred())
+    if (render_state_changed)
     {
-        RetainResource(render_state_object_ptr);
+        // Deferred render state is retained on change too, though it is applied later before the draw call
+        RetainResource(render_state_base);
     }
 }
 
@@ -129,7 +133,7 @@ void RenderCommandList::SetViewState(Rhi::IViewState& view_state)
     META_FUNCTION_TASK();
     VerifyEncodingState();
 
-    DrawingState& drawing_state = GetDrawingState();
+    const DrawingState& drawing_state = GetDrawingState();
     if (drawing_state.view_state_ptr && drawing_state.view_state_ptr->GetSettings() == view_state.GetSettings())
     {
         META_LOG("{} Command list '{}' view state is already set up", magic_enum::enum_name(GetType()), GetName());
@@ -138,16 +142,18 @@ void RenderCommandList::SetViewState(Rhi::IViewState& view_state)
 
     META_LOG("{} Command list '{}' SET VIEW STATE:\n{}",
              magic_enum::enum_name(GetType()), GetName(), static_cast<std::string>(view_state.GetSettings()));
-    drawing_state.view_state_ptr = static_cast<ViewState*>(&view_state);
-    drawing_state.view_state_ptr->Apply(*this);
-    drawing_state.changes |= DrawingState::Change::ViewState;
+
+    auto& view_state_base = static_cast<ViewState&>(view_state);
+    if (m_is_command_stream_enabled)
+    {
+        m_command_stream.SetViewState(view_state_base);
+    }
+    ApplyViewState(view_state_base, !m_is_command_stream_enabled);
 }
 
 bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
 {
     META_FUNCTION_TASK();
-    META_UNUSED(set_resource_barriers);
-
     VerifyEncodingState();
 
     if (m_is_validation_enabled)
@@ -157,7 +163,7 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
                               magic_enum::enum_name(vertex_buffers.GetType()));
     }
 
-    DrawingState&  drawing_state = GetDrawingState();
+    const DrawingState& drawing_state = GetDrawingState();
     if (drawing_state.vertex_buffer_set_ptr.get() == std::addressof(vertex_buffers))
     {
         META_LOG("{} Command list '{}' vertex buffers {} are already set up",
@@ -168,17 +174,19 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
     META_LOG("{} Command list '{}' SET VERTEX BUFFERS {}",
              magic_enum::enum_name(GetType()), GetName(), vertex_buffers.GetNames());
 
-    Ptr<Object> vertex_buffer_set_object_ptr = static_cast<BufferSet&>(vertex_buffers).GetBasePtr();
-    drawing_state.vertex_buffer_set_ptr = std::static_pointer_cast<BufferSet>(vertex_buffer_set_object_ptr);
-    RetainResource(vertex_buffer_set_object_ptr);
+    auto& vertex_buffer_set_base = static_cast<BufferSet&>(vertex_buffers);
+    if (m_is_command_stream_enabled)
+    {
+        m_command_stream.SetVertexBuffers(vertex_buffer_set_base, set_resource_barriers);
+    }
+    ApplyVertexBuffers(vertex_buffer_set_base, set_resource_barriers, !m_is_command_stream_enabled);
+    RetainResource(vertex_buffer_set_base);
     return true;
 }
 
 bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
 {
     META_FUNCTION_TASK();
-    META_UNUSED(set_resource_barriers);
-
     VerifyEncodingState();
 
     if (m_is_validation_enabled)
@@ -188,7 +196,7 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
                               magic_enum::enum_name(index_buffer.GetSettings().type));
     }
 
-    DrawingState& drawing_state = GetDrawingState();
+    const DrawingState& drawing_state = GetDrawingState();
     if (drawing_state.index_buffer_ptr.get() == std::addressof(index_buffer))
     {
         META_LOG("{} Command list '{}' index buffer {} is already set up",
@@ -196,9 +204,13 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
         return false;
     }
 
-    Ptr<Object> index_buffer_object_ptr = static_cast<Buffer&>(index_buffer).GetBasePtr();
-    drawing_state.index_buffer_ptr = std::static_pointer_cast<Buffer>(index_buffer_object_ptr);
-    RetainResource(index_buffer_object_ptr);
+    auto& index_buffer_base = static_cast<Buffer&>(index_buffer);
+    if (m_is_command_stream_enabled)
+    {
+        m_command_stream.SetIndexBuffer(index_buffer_base, set_resource_barriers);
+    }
+    ApplyIndexBuffer(index_buffer_base, set_resource_barriers, !m_is_command_stream_enabled);
+    RetainResource(index_buffer_base);
     return true;
 }
 
@@ -208,6 +220,12 @@ void RenderCommandList::DrawIndexed(Primitive primitive_type, uint32_t index_cou
     META_FUNCTION_TASK();
     VerifyEncodingState();
 
+    if (const DrawingState& drawing_state = GetDrawingState();
+        index_count == 0 && drawing_state.index_buffer_ptr)
+    {
+        index_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
+    }
+
     if (m_is_validation_enabled)
     {
         const DrawingState& drawing_state = GetDrawingState();
@@ -229,9 +247,12 @@ void RenderCommandList::DrawIndexed(Primitive primitive_type, uint32_t index_cou
     META_LOG("{} Command list '{}' DRAW INDEXED with vertex buffers {} and index buffer '{}' using {} primive type, {} indices from {} index and {} vertex with {} instances count from {} instance",
              magic_enum::enum_name(GetType()), GetName(), GetDrawingState().vertex_buffer_set_ptr->GetNames(), GetDrawingState().index_buffer_ptr->GetName(),
              magic_enum::enum_name(primitive_type), index_count, start_index, start_vertex, instance_count, start_instance);
-    META_UNUSED(start_instance);
 
-    UpdateDrawingState(primitive_type);
+    if (m_is_command_stream_enabled)
+    {
+        m_command_stream.DrawIndexed(primitive_type, index_count, start_index, start_vertex, instance_count, start_instance);
+    }
+    ApplyDrawIndexed(primitive_type, index_count, start_index, start_vertex, instance_count, start_instance, !m_is_command_stream_enabled);
 }
 
 void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
@@ -260,9 +281,108 @@ void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, ui
              magic_enum::enum_name(GetType()), GetName(),
              GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
              magic_enum::enum_name(primitive_type), vertex_count, start_vertex, instance_count, start_instance);
-    META_UNUSED(start_instance);
 
-    UpdateDrawingState(primitive_type);
+    if (m_is_command_stream_enabled)
+    {
+        m_command_stream.Draw(primitive_type, vertex_count, start_vertex, instance_count, start_instance);
+    }
+    ApplyDraw(primitive_type, vertex_count, start_vertex, instance_count, start_instance, !m_is_command_stream_enabled);
+}
+
+void RenderCommandList::ExecuteBundle(Rhi::IRenderCommandBundle& render_command_bundle)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    // Invalid bundle is re-recorded with this command list, then its command stream is replayed without validation
+    const Ptr<const CommandStream> command_stream_ptr = static_cast<RenderCommandBundle&>(render_command_bundle).GetCommandStream(*this);
+    ExecuteCommandStream(*command_stream_ptr);
+}
+
+void RenderCommandList::SetCommandStreamEnabled(bool is_command_stream_enabled)
+{
+    META_FUNCTION_TASK();
+    if (m_is_command_stream_enabled == is_command_stream_enabled)
+        return;
+
+    if (m_is_command_stream_enabled)
+    {
+        // Recorded commands are encoded before switching to immediate encoding,
+        // which continues from the encoded drawing state
+        EncodePendingCommands();
+        m_drawing_state = m_encoded_drawing_state;
+        GetCommandState().program_bindings_ptr = m_encoded_program_bindings_ptr;
+    }
+    else
+    {
+        // Encoding of recorded commands starts from the current drawing state
+        m_command_stream_encoded_size  = m_command_stream.GetDataSize();
+        m_encoded_drawing_state        = m_drawing_state;
+        m_encoded_program_bindings_ptr = GetCommandState().program_bindings_ptr;
+    }
+
+    META_LOG("{} Command list '{}' command stream mode is {}",
+             magic_enum::enum_name(GetType()), GetName(), is_command_stream_enabled ? "ENABLED" : "DISABLED");
+    m_is_command_stream_enabled = is_command_stream_enabled;
+}
+
+void RenderCommandList::ExecuteCommandStream(const CommandStream& command_stream)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+    META_LOG("{} Command list '{}' EXECUTE COMMAND STREAM with {} commands",
+             magic_enum::enum_name(GetType()), GetName(), command_stream.GetCommandsCount());
+
+    // Stream objects are retained once instead of retaining resources of every command
+    RetainResources(command_stream.GetRetainedObjects());
+
+    // Executed stream is encoded immediately after pending commands recorded in command stream mode
+    const bool is_command_stream_enabled = m_is_command_stream_enabled;
+    SetCommandStreamEnabled(false);
+    ReplayCommandStream(command_stream);
+    SetCommandStreamEnabled(is_command_stream_enabled);
+}
+
+CommandStream RenderCommandList::RecordCommandStream(const Rhi::IRenderCommandBundle::RecordFunction& record_function)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+    META_CHECK_FALSE_DESCR(m_is_command_stream_recording, "command stream recording can not be nested");
+    META_LOG("{} Command list '{}' RECORD COMMAND STREAM", magic_enum::enum_name(GetType()), GetName());
+
+    // Pending commands recorded in command stream mode are encoded first to keep the commands order
+    const bool is_command_stream_enabled = m_is_command_stream_enabled;
+    SetCommandStreamEnabled(false);
+
+    DrawingState drawing_state = std::exchange(m_drawing_state, DrawingState{});
+    m_drawing_state.render_pass_attachment_ptrs = drawing_state.render_pass_attachment_ptrs;
+    const ProgramBindings* program_bindings_ptr = std::exchange(GetCommandState().program_bindings_ptr, nullptr);
+    CommandStream command_stream = std::exchange(m_command_stream, CommandStream{});
+    m_is_command_stream_enabled   = true;
+    m_is_command_stream_recording = true;
+
+    const auto restore_state = [&]()
+    {
+        std::swap(m_command_stream, command_stream);
+        m_drawing_state = std::move(drawing_state);
+        GetCommandState().program_bindings_ptr = program_bindings_ptr;
+        m_is_command_stream_enabled   = false;
+        m_is_command_stream_recording = false;
+        SetCommandStreamEnabled(is_command_stream_enabled);
+    };
+
+    try
+    {
+        record_function(*this);
+    }
+    catch (...)
+    {
+        restore_state();
+        throw;
+    }
+
+    restore_state();
+    return command_stream;
 }
 
 void RenderCommandList::ResetCommandState()
@@ -280,9 +400,53 @@ void RenderCommandList::ResetCommandState()
     m_drawing_state.view_state_ptr = nullptr;
     m_drawing_state.render_state_groups = {};
     m_drawing_state.changes = DrawingState::ChangeMask{};
+
+    m_command_stream.Clear();
+    m_command_stream_encoded_size = 0U;
+    m_encoded_drawing_state = DrawingState{};
+    m_encoded_program_bindings_ptr = nullptr;
+}
+
+void RenderCommandList::EncodeProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
+{
+    META_FUNCTION_TASK();
+    if (!m_is_command_stream_enabled)
+    {
+        CommandList::EncodeProgramBindings(program_bindings, apply_behavior);
+        return;
+    }
+
+    m_command_stream.SetProgramBindings(program_bindings, apply_behavior);
+    UpdateProgramBindingsState(program_bindings, apply_behavior);
 }
 
-void RenderCommandList::UpdateDrawingState(Primitive primitive_type)
+void RenderCommandList::EncodePendingCommands()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_FALSE_DESCR(m_is_command_stream_recording,
+                           "only render state, view state, program bindings, buffers and draw commands can be recorded to the command stream");
+    if (!m_is_command_stream_enabled || m_command_stream_encoded_size == m_command_stream.GetDataSize())
+        return;
+
+    // Encoded size is updated first, so that pending commands are not encoded again
+    // on resource barriers flush from within the encoded commands
+    const size_t begin_data_offset = m_command_stream_encoded_size;
+    m_command_stream_encoded_size = m_command_stream.GetDataSize();
+
+    SwapEncodedState();
+    try
+    {
+        ReplayCommandStream(m_command_stream, begin_data_offset);
+    }
+    catch (...)
+    {
+        SwapEncodedState();
+        throw;
+    }
+    SwapEncodedState();
+}
+
+void RenderCommandList::UpdateDrawingState(Primitive primitive_type, bool encode_native)
 {
     META_FUNCTION_TASK();
     using enum RenderDrawingState::Change;
@@ -301,8 +465,10 @@ void RenderCommandList::UpdateDrawingState(Primitive primitive_type)
     {
         // Apply render state in deferred mode right before the Draw call,
         // only in case when any render state groups or view state or primitive type has changed
-        m_drawing_state.render_state_ptr->Apply(*this, m_drawing_state.render_state_groups);
-        RetainResource(m_drawing_state.render_state_ptr);
+        if (encode_native)
+        {
+            m_drawing_state.render_state_ptr->Apply(*this, m_drawing_state.render_state_groups);
+        }
 
         m_drawing_state.render_state_groups = {};
         drawing_state.changes.SetBitOff(PrimitiveType);
@@ -333,6 +499,151 @@ void RenderCommandList::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, ui
     }
 }
 
+void RenderCommandList::ApplyRenderState(RenderState& render_state, Rhi::RenderStateGroupMask apply_state_groups,
+                                         Rhi::RenderStateGroupMask state_groups, bool encode_native)
+{
+    META_FUNCTION_TASK();
+    if (encode_native && !render_state.IsDeferred())
+    {
+        render_state.Apply(*this, apply_state_groups);
+    }
+
+    m_drawing_state.render_state_ptr = render_state.GetPtr<RenderState>();
+    m_drawing_state.render_state_groups |= state_groups;
+}
+
+void RenderCommandList::ApplyViewState(ViewState& view_state, bool encode_native)
+{
+    META_FUNCTION_TASK();
+    m_drawing_state.view_state_ptr = &view_state;
+    if (encode_native)
+    {
+        view_state.Apply(*this);
+    }
+    m_drawing_state.changes |= DrawingState::Change::ViewState;
+}
+
+void RenderCommandList::ApplyVertexBuffers(BufferSet& vertex_buffers, bool set_resource_barriers, bool encode_native)
+{
+    META_FUNCTION_TASK();
+    m_drawing_state.vertex_buffer_set_ptr = vertex_buffers.GetPtr<BufferSet>();
+    if (encode_native)
+    {
+        EncodeVertexBuffers(vertex_buffers, set_resource_barriers);
+    }
+}
+
+void RenderCommandList::ApplyIndexBuffer(Buffer& index_buffer, bool set_resource_barriers, bool encode_native)
+{
+    META_FUNCTION_TASK();
+    m_drawing_state.index_buffer_ptr = index_buffer.GetPtr<Buffer>();
+    if (encode_native)
+    {
+        EncodeIndexBuffer(index_buffer, set_resource_barriers);
+    }
+}
+
+void RenderCommandList::ApplyDrawIndexed(Primitive primitive_type, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                                         uint32_t instance_count, uint32_t start_instance, bool encode_native)
+{
+    META_FUNCTION_TASK();
+    if (encode_native)
+    {
+        FlushResourceBarriers();
+    }
+
+    UpdateDrawingState(primitive_type, encode_native);
+
+    if (encode_native)
+    {
+        EncodeDrawIndexed(primitive_type, index_count, start_index, start_vertex, instance_count, start_instance);
+    }
+}
+
+void RenderCommandList::ApplyDraw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
+                                  uint32_t instance_count, uint32_t start_instance, bool encode_native)
+{
+    META_FUNCTION_TASK();
+    if (encode_native)
+    {
+        FlushResourceBarriers();
+    }
+
+    UpdateDrawingState(primitive_type, encode_native);
+
+    if (encode_native)
+    {
+        EncodeDraw(primitive_type, vertex_count, start_vertex, instance_count, start_instance);
+    }
+}
+
+void RenderCommandList::ReplayCommandStream(const CommandStream& command_stream, size_t begin_data_offset)
+{
+    META_FUNCTION_TASK();
+    using Command = CommandStream::Command;
+    command_stream.ForEachCommand([this, &command_stream](Command command, const std::byte* args_data)
+    {
+        switch (command)
+        {
+        case Command::SetRenderState:
+        {
+            const auto args = CommandStream::GetArgs<CommandStream::SetRenderStateArgs>(args_data);
+            ApplyRenderState(command_stream.GetStreamObject<RenderState>(args.render_state),
+                             Rhi::RenderStateGroupMask(args.apply_state_groups), Rhi::RenderStateGroupMask(args.state_groups), true);
+            break;
+        }
+        case Command::SetViewState:
+        {
+            const auto args = CommandStream::GetArgs<CommandStream::SetViewStateArgs>(args_data);
+            ApplyViewState(command_stream.GetStreamObject<ViewState>(args.view_state), true);
+            break;
+        }
+        case Command::SetProgramBindings:
+        {
+            const auto args = CommandStream::GetArgs<CommandStream::SetProgramBindingsArgs>(args_data);
+            CommandList::EncodeProgramBindings(command_stream.GetStreamObject<ProgramBindings>(args.program_bindings),
+                                               Rhi::ProgramBindingsApplyBehaviorMask(args.apply_behavior));
+            break;
+        }
+        case Command::SetVertexBuffers:
+        {
+            const auto args = CommandStream::GetArgs<CommandStream::SetVertexBuffersArgs>(args_data);
+            ApplyVertexBuffers(command_stream.GetStreamObject<BufferSet>(args.vertex_buffers), args.set_resource_barriers != 0U, true);
+            break;
+        }
+        case Command::SetIndexBuffer:
+        {
+            const auto args = CommandStream::GetArgs<CommandStream::SetIndexBufferArgs>(args_data);
+            ApplyIndexBuffer(command_stream.GetStreamObject<Buffer>(args.index_buffer), args.set_resource_barriers != 0U, true);
+            break;
+        }
+        case Command::Draw:
+        {
+            const auto args = CommandStream::GetArgs<CommandStream::DrawArgs>(args_data);
+            ApplyDraw(static_cast<Primitive>(args.primitive_type), args.vertex_count, args.start_vertex,
+                      args.instance_count, args.start_instance, true);
+            break;
+        }
+        case Command::DrawIndexed:
+        {
+            const auto args = CommandStream::GetArgs<CommandStream::DrawIndexedArgs>(args_data);
+            ApplyDrawIndexed(static_cast<Primitive>(args.primitive_type), args.index_count, args.start_index,
+                             args.start_vertex, args.instance_count, args.start_instance, true);
+            break;
+        }
+        default:
+            META_UNEXPECTED(command);
+        }
+    }, begin_data_offset);
+}
+
+void RenderCommandList::SwapEncodedState()
+{
+    META_FUNCTION_TASK();
+    std::swap(m_drawing_state, m_encoded_drawing_state);
+    std::swap(GetCommandState().program_bindings_ptr, m_encoded_program_bindings_ptr);
+}
+
 RenderPass& RenderCommandList::GetPass()
 {
     META_FUNCTION_TASK();
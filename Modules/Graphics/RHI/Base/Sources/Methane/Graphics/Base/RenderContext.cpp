@@ -106,6 +106,7 @@ void RenderContext::OnCpuPresentComplete(bool signal_frame_fence)
     }
 
     META_CPU_FRAME_DELIMITER(m_frame_buffer_index, m_frame_index);
+    META_SCOPE_TIMERS_FRAME_COMPLETE();
     META_LOG("Render context '{}' PRESENT COMPLETE frame {}", GetName(), m_frame_buffer_index);
 
     m_fps_counter.OnCpuFramePresented();
@@ -0,0 +1,154 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ResourceBarriersBatch.cpp
+Command list accumulator of resource barriers, which merges consecutive
+transitions of the same resource and drops redundant ones before flush.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/ResourceBarriersBatch.h>
+#include <Methane/Graphics/Base/ResourceBarriers.h>
+
+#include <Methane/Instrumentation.h>
+
+namespace Methane::Graphics::Base
+{
+
+void ResourceBarriersBatch::Add(const Barriers& barriers)
+{
+    META_FUNCTION_TASK();
+    const auto lock_guard = static_cast<const ResourceBarriers&>(barriers).Lock();
+    for (const auto& [barrier_id, barrier] : barriers.GetMap())
+    {
+        Add(barrier);
+    }
+}
+
+void ResourceBarriersBatch::Add(const Barrier& barrier)
+{
+    META_FUNCTION_TASK();
+    m_statistics.added_count++;
+    switch (barrier.GetId().GetType())
+    {
+    case Barrier::Type::StateTransition: AddStateTransition(barrier); break;
+    case Barrier::Type::OwnerTransition: AddOwnerTransition(barrier); break;
+    }
+}
+
+const ResourceBarriersBatch::Barriers* ResourceBarriersBatch::Flush()
+{
+    META_FUNCTION_TASK();
+    if (m_pending_barriers.empty())
+        return nullptr;
+
+    if (m_batch_barriers_ptr)
+    {
+        // Batch barriers object is reused between flushes to avoid allocation of the native barriers data
+        while (!m_batch_barriers_ptr->IsEmpty())
+        {
+            const Barrier::Id barrier_id = m_batch_barriers_ptr->GetMap().begin()->first;
+            m_batch_barriers_ptr->Remove(barrier_id);
+        }
+    }
+    else
+    {
+        m_batch_barriers_ptr = Rhi::IResourceBarriers::Create();
+    }
+
+    for (const auto& [barrier_id, barrier] : m_pending_barriers)
+    {
+        m_batch_barriers_ptr->Add(barrier);
+    }
+
+    m_statistics.flushed_count += static_cast<uint32_t>(m_pending_barriers.size());
+    m_statistics.flushes_count++;
+    m_pending_barriers.clear();
+    return m_batch_barriers_ptr.get();
+}
+
+void ResourceBarriersBatch::Reset()
+{
+    META_FUNCTION_TASK();
+    m_pending_barriers.clear();
+    m_statistics = {};
+}
+
+void ResourceBarriersBatch::AddStateTransition(const Barrier& barrier)
+{
+    META_FUNCTION_TASK();
+    const Barrier::StateChange& state_change = barrier.GetStateChange();
+    if (state_change.GetStateBefore() == state_change.GetStateAfter() &&
+        state_change.GetStateAfter() != Rhi::ResourceState::UnorderedAccess)
+    {
+        m_statistics.eliminated_count++;
+        return;
+    }
+
+    const Barrier::Id& barrier_id = barrier.GetId();
+    const auto pending_barrier_it = m_pending_barriers.find(barrier_id);
+    if (pending_barrier_it == m_pending_barriers.end())
+    {
+        m_pending_barriers.try_emplace(barrier_id, barrier);
+        return;
+    }
+
+    // Consecutive transitions A -> B -> C are merged in a single transition A -> C
+    const Rhi::ResourceState state_before = pending_barrier_it->second.GetStateChange().GetStateBefore();
+    m_statistics.merged_count++;
+    m_statistics.eliminated_count++;
+    if (state_before == state_change.GetStateAfter() && state_before != Rhi::ResourceState::UnorderedAccess)
+    {
+        m_statistics.eliminated_count++;
+        m_pending_barriers.erase(pending_barrier_it);
+        return;
+    }
+    pending_barrier_it->second = Barrier(barrier_id.GetResource(), state_before, state_change.GetStateAfter());
+}
+
+void ResourceBarriersBatch::AddOwnerTransition(const Barrier& barrier)
+{
+    META_FUNCTION_TASK();
+    const Barrier::OwnerChange& owner_change = barrier.GetOwnerChange();
+    if (owner_change.GetQueueFamilyBefore() == owner_change.GetQueueFamilyAfter())
+    {
+        m_statistics.eliminated_count++;
+        return;
+    }
+
+    const Barrier::Id& barrier_id = barrier.GetId();
+    const auto pending_barrier_it = m_pending_barriers.find(barrier_id);
+    if (pending_barrier_it == m_pending_barriers.end())
+    {
+        m_pending_barriers.try_emplace(barrier_id, barrier);
+        return;
+    }
+
+    const uint32_t queue_family_before = pending_barrier_it->second.GetOwnerChange().GetQueueFamilyBefore();
+    m_statistics.merged_count++;
+    m_statistics.eliminated_count++;
+    if (queue_family_before == owner_change.GetQueueFamilyAfter())
+    {
+        m_statistics.eliminated_count++;
+        m_pending_barriers.erase(pending_barrier_it);
+        return;
+    }
+    pending_barrier_it->second = Barrier(barrier_id.GetResource(), queue_family_before, owner_change.GetQueueFamilyAfter());
+}
+
+} // namespace Methane::Graphics::Base
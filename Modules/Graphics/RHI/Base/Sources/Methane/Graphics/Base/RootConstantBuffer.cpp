@@ -37,6 +37,9 @@ namespace Methane::Graphics::Base
 // Root constants memory alignment should match D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT
 static constexpr Data::Size g_root_constant_alignment = 256;
 
+// Dirty ranges separated by a gap not larger than this size are uploaded with a single copy region
+static constexpr Data::Size g_dirty_ranges_max_merged_gap_size = 4 * g_root_constant_alignment;
+
 //////////////////// RootConstantAccessor ////////////////////
 
 RootConstantAccessor::RootConstantAccessor(RootConstantStorage& storage, const Range& buffer_range, Data::Size data_size)
@@ -157,6 +160,32 @@ void RootConstantStorage::SetRootConstant(const Accessor& accessor, const Rhi::R
     META_CHECK_LESS_OR_EQUAL_DESCR(root_constant.GetDataSize(), data_range.GetLength(),
                                    "root constant size should be less or equal to reserved memory range size");
     std::copy(root_constant.GetDataPtr(), root_constant.GetDataEndPtr(), data.data() + data_range.GetStart());
+
+    std::lock_guard lock(m_mutex);
+    m_dirty_ranges.Add(Accessor::Range(data_range.GetStart(), data_range.GetStart() + root_constant.GetDataSize()));
+}
+
+RootConstantStorage::Ranges RootConstantStorage::TakeDirtyRanges(Data::Size max_merged_gap_size)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    Ranges dirty_ranges;
+    for (const Accessor::Range& dirty_range : m_dirty_ranges)
+    {
+        if (!dirty_ranges.empty() && dirty_range.GetStart() - dirty_ranges.back().GetEnd() <= max_merged_gap_size)
+            dirty_ranges.back() = Accessor::Range(dirty_ranges.back().GetStart(), dirty_range.GetEnd());
+        else
+            dirty_ranges.emplace_back(dirty_range);
+    }
+    m_dirty_ranges.Clear();
+    return dirty_ranges;
+}
+
+void RootConstantStorage::ClearDirtyRanges()
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    m_dirty_ranges.Clear();
 }
 
 std::scoped_lock<RootConstantStorage::Mutex> RootConstantStorage::GetLockGuard()
@@ -228,6 +257,7 @@ Rhi::IBuffer& RootConstantBuffer::GetBuffer()
     // After recreating the buffer it has to be filled with previous arguments data in UpdateGpuBuffer
     m_buffer_resize_required = false;
     m_buffer_data_changed = true;
+    m_buffer_full_upload_required = true;
 
     // NOTE: request deferred initialization complete to update program binding descriptors on GPU with updated buffer views
     m_context.RequestDeferredAction(Rhi::IContext::DeferredAction::CompleteInitialization);
@@ -258,6 +288,9 @@ void RootConstantBuffer::SetBufferName(std::string_view buffer_name)
 void RootConstantBuffer::UpdateGpuBuffer(Rhi::ICommandQueue& target_cmd_queue)
 {
     META_FUNCTION_TASK();
+    m_upload_counters.uploaded_data_size = 0U;
+    m_upload_counters.copy_regions_count = 0U;
+
     if (!m_buffer_data_changed)
         return;
 
@@ -265,8 +298,29 @@ void RootConstantBuffer::UpdateGpuBuffer(Rhi::ICommandQueue& target_cmd_queue)
     META_CHECK_NOT_EMPTY(buffer_data);
 
     Rhi::IBuffer& buffer = GetBuffer();
-    buffer.SetData(target_cmd_queue, Rhi::SubResource(buffer_data));
 
+    if (m_buffer_full_upload_required)
+    {
+        // Newly created buffer is filled with all root constants data at once
+        ClearDirtyRanges();
+        buffer.SetData(target_cmd_queue, Rhi::SubResource(buffer_data));
+        m_upload_counters.uploaded_data_size = static_cast<Data::Size>(buffer_data.size());
+        m_upload_counters.copy_regions_count = 1U;
+        m_buffer_full_upload_required = false;
+    }
+    else
+    {
+        // Only changed root constant ranges are uploaded to the existing buffer
+        for (const Accessor::Range& dirty_range : TakeDirtyRanges(g_dirty_ranges_max_merged_gap_size))
+        {
+            buffer.SetData(target_cmd_queue, Rhi::SubResource(buffer_data.data() + dirty_range.GetStart(),
+                                                              dirty_range.GetLength(), {}, dirty_range));
+            m_upload_counters.uploaded_data_size += dirty_range.GetLength();
+            m_upload_counters.copy_regions_count++;
+        }
+    }
+
+    m_upload_counters.total_uploaded_size += m_upload_counters.uploaded_data_size;
     m_buffer_data_changed = false;
 }
 
@@ -0,0 +1,190 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/UploadRingBuffer.cpp
+Linear ring-buffer allocator of transient per-frame upload data ranges,
+which are retired when the frame buffer index is reused.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/UploadRingBuffer.h>
+#include <Methane/Graphics/Base/Context.h>
+
+#include <Methane/Graphics/RHI/ICommandKit.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Methane::Graphics::Base
+{
+
+UploadRingBuffer::UploadRingBuffer(Context& context, const Settings& settings)
+    : m_context(context)
+    , m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(m_settings.capacity, "upload ring buffer capacity can not be zero");
+    META_CHECK_NOT_ZERO_DESCR(m_settings.alignment, "upload ring buffer alignment can not be zero");
+    META_CHECK_EQUAL_DESCR(m_settings.capacity % m_settings.alignment, 0U,
+                           "upload ring buffer capacity should be a multiple of alignment");
+
+    m_buffer_ptr = m_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(m_settings.capacity, true, true));
+    m_buffer_ptr->SetName(m_settings.name);
+    m_data.resize(m_settings.capacity, Data::Byte{});
+    m_statistics.capacity = m_settings.capacity;
+
+    dynamic_cast<Data::IEmitter<IContextCallback>&>(context).Connect(*this);
+}
+
+void UploadRingBuffer::BeginFrame(Data::Index frame_index)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+
+    if (m_head > m_frame_start)
+    {
+        m_frame_regions.push_back({ m_frame_index, m_frame_start, m_head });
+    }
+
+    // Frame buffer with the same index was completed on GPU, so its ranges can be reused
+    std::erase_if(m_frame_regions, [frame_index](const FrameRegion& region)
+    {
+        return region.frame_index == frame_index;
+    });
+    m_tail = m_frame_regions.empty() ? m_head : m_frame_regions.front().start;
+
+    m_frame_index = frame_index;
+    m_frame_start = m_head;
+    m_statistics.frame_allocated_size    = 0U;
+    m_statistics.frame_allocations_count = 0U;
+    m_statistics.in_flight_size          = static_cast<Data::Size>(m_head - m_tail);
+}
+
+UploadRingBuffer::Allocation UploadRingBuffer::Allocate(Data::Size size)
+{
+    META_FUNCTION_TASK();
+    if (!size)
+        return {};
+
+    const Data::Size aligned_size = Data::AlignUp(size, m_settings.alignment);
+    META_CHECK_LESS_OR_EQUAL_DESCR(aligned_size, m_settings.capacity,
+                                   "upload ring buffer allocation size is greater than ring buffer capacity");
+
+    std::scoped_lock lock(m_mutex);
+
+    // Allocated range can not wrap around the end of buffer, so the tail space is skipped instead
+    VirtualOffset allocation_head = m_head;
+    auto offset = static_cast<Data::Size>(allocation_head % m_settings.capacity);
+    if (offset + aligned_size > m_settings.capacity)
+    {
+        allocation_head += m_settings.capacity - offset;
+        offset = 0U;
+    }
+
+    // Head is committed only after overflow check, so the failed allocation leaves ring buffer state intact
+    META_CHECK_LESS_OR_EQUAL_DESCR(allocation_head + aligned_size - m_tail, static_cast<VirtualOffset>(m_settings.capacity),
+                                   "upload ring buffer overflow: increase capacity to fit all frames in flight");
+    m_head = allocation_head + aligned_size;
+
+    m_statistics.frame_allocated_size      = static_cast<Data::Size>(m_head - m_frame_start);
+    m_statistics.frame_high_water_mark     = std::max(m_statistics.frame_high_water_mark, m_statistics.frame_allocated_size);
+    m_statistics.in_flight_size            = static_cast<Data::Size>(m_head - m_tail);
+    m_statistics.in_flight_high_water_mark = std::max(m_statistics.in_flight_high_water_mark, m_statistics.in_flight_size);
+    m_statistics.frame_allocations_count++;
+
+    // Allocated data is uploaded to GPU buffer in OnContextUploadingResources
+    m_context.RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
+
+    return Allocation{ offset, size, std::span<Data::Byte>(m_data.data() + offset, size) };
+}
+
+UploadRingBuffer::Allocation UploadRingBuffer::AllocateData(const Data::Chunk& data)
+{
+    META_FUNCTION_TASK();
+    Allocation allocation = Allocate(data.GetDataSize());
+    if (!allocation.IsEmpty())
+    {
+        std::memcpy(allocation.data.data(), data.GetDataPtr(), data.GetDataSize());
+    }
+    return allocation;
+}
+
+Rhi::ResourceView UploadRingBuffer::GetResourceView(const Allocation& allocation) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_FALSE_DESCR(allocation.IsEmpty(), "can not get resource view of empty upload ring buffer allocation");
+    return m_buffer_ptr->GetBufferView(allocation.offset, allocation.size);
+}
+
+UploadRingBuffer::Statistics UploadRingBuffer::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    return m_statistics;
+}
+
+void UploadRingBuffer::Flush(Rhi::ICommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    if (m_flushed_head == m_head)
+        return;
+
+    if (m_head - m_flushed_head >= m_settings.capacity)
+    {
+        UploadRange(target_cmd_queue, 0U, m_settings.capacity);
+    }
+    else
+    {
+        // Ranges allocated since previous flush are uploaded with one or two copy regions, when wrapped
+        const auto start_offset = static_cast<Data::Size>(m_flushed_head % m_settings.capacity);
+        const auto end_offset   = static_cast<Data::Size>((m_head - 1U) % m_settings.capacity) + 1U;
+        if (start_offset < end_offset)
+        {
+            UploadRange(target_cmd_queue, start_offset, end_offset);
+        }
+        else
+        {
+            UploadRange(target_cmd_queue, start_offset, m_settings.capacity);
+            UploadRange(target_cmd_queue, 0U, end_offset);
+        }
+    }
+    m_flushed_head = m_head;
+}
+
+void UploadRingBuffer::UploadRange(Rhi::ICommandQueue& target_cmd_queue, Data::Size start, Data::Size end)
+{
+    META_FUNCTION_TASK();
+    if (start == end)
+        return;
+
+    m_buffer_ptr->SetData(target_cmd_queue, Rhi::SubResource(m_data.data() + start, end - start, {},
+                                                             Rhi::BytesRange(start, end)));
+    m_statistics.uploaded_size += end - start;
+}
+
+void UploadRingBuffer::OnContextUploadingResources(Rhi::IContext& context)
+{
+    META_FUNCTION_TASK();
+    Flush(context.GetDefaultCommandKit(Rhi::CommandListType::Transfer).GetQueue());
+}
+
+} // namespace Methane::Graphics::Base
@@ -0,0 +1,341 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/UploadScheduler.cpp
+Asynchronous scheduler of resource data uploads batched in shared staging memory
+and executed on the upload command queue with per-batch readiness futures.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/UploadScheduler.h>
+#include <Methane/Graphics/Base/Context.h>
+
+#include <Methane/Graphics/RHI/ICommandKit.h>
+#include <Methane/Graphics/RHI/ICommandQueue.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+namespace Methane::Graphics::Base
+{
+
+UploadScheduler::Batch::Batch()
+    : readiness(promise.get_future().share())
+{ }
+
+UploadScheduler::UploadScheduler(Context& context)
+    : UploadScheduler(context, Settings{})
+{ }
+
+UploadScheduler::UploadScheduler(Context& context, const Settings& settings)
+    : m_context(context)
+    , m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(m_settings.batch_size_limit, "upload batch size limit can not be zero");
+    META_CHECK_NOT_ZERO_DESCR(m_settings.staging_page_size, "upload staging page size can not be zero");
+    META_CHECK_NOT_ZERO_DESCR(m_settings.staging_alignment, "upload staging alignment can not be zero");
+
+    dynamic_cast<Data::IEmitter<Rhi::IContextCallback>&>(context).Connect(*this);
+}
+
+UploadScheduler::~UploadScheduler()
+{
+    META_FUNCTION_TASK();
+    // Batches which were not completed are dropped, so their readiness futures get broken promise errors
+    std::scoped_lock lock(m_mutex);
+    m_closed_batches.clear();
+    m_encoded_batches.clear();
+    m_executing_batches.clear();
+}
+
+UploadScheduler::Readiness UploadScheduler::Schedule(Rhi::IBuffer& buffer, Rhi::SubResource sub_resource, Rhi::ICommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_FALSE_DESCR(sub_resource.IsEmptyOrNull(), "can not schedule upload of empty buffer sub-resource data");
+
+    Rhi::SubResources sub_resources;
+    sub_resources.emplace_back(StageSubResource(std::move(sub_resource)));
+    return AddRequest(Request{
+        buffer.GetDerivedPtr<Rhi::IResource>(),
+        target_cmd_queue.GetDerivedPtr<Rhi::ICommandQueue>(),
+        std::move(sub_resources)
+    });
+}
+
+UploadScheduler::Readiness UploadScheduler::Schedule(Rhi::ITexture& texture, Rhi::SubResources sub_resources, Rhi::ICommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_EMPTY_DESCR(sub_resources, "can not schedule upload of empty texture sub-resources");
+
+    Rhi::SubResources staged_sub_resources;
+    staged_sub_resources.reserve(sub_resources.size());
+    for (Rhi::SubResource& sub_resource : sub_resources)
+    {
+        staged_sub_resources.emplace_back(StageSubResource(std::move(sub_resource)));
+    }
+    return AddRequest(Request{
+        texture.GetDerivedPtr<Rhi::IResource>(),
+        target_cmd_queue.GetDerivedPtr<Rhi::ICommandQueue>(),
+        std::move(staged_sub_resources)
+    });
+}
+
+void UploadScheduler::Submit()
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock(m_mutex);
+        CloseCurrentBatchNoLock();
+        if (m_closed_batches.empty())
+            return;
+    }
+
+    EncodeClosedBatches();
+
+    META_LOG("Upload scheduler SUBMIT batches to upload command queue");
+    m_context.UploadResources();
+}
+
+UploadScheduler::Statistics UploadScheduler::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    return m_statistics;
+}
+
+void UploadScheduler::OnContextUploadingResources(Rhi::IContext&)
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock(m_mutex);
+        CloseCurrentBatchNoLock();
+    }
+    EncodeClosedBatches();
+}
+
+void UploadScheduler::OnContextReleased(Rhi::IContext&)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+
+    // Context waits for GPU completion before release, so encoded batches are completed,
+    // while closed batches reference resources of the released context and are dropped
+    for (std::deque<Batch>* batches_ptr : { &m_executing_batches, &m_encoded_batches })
+    {
+        for (Batch& batch : *batches_ptr)
+        {
+            batch.promise.set_value();
+            m_statistics.completed_batches_count++;
+        }
+        batches_ptr->clear();
+    }
+    m_closed_batches.clear();
+    m_upload_cmd_list_ptr = nullptr;
+}
+
+void UploadScheduler::OnCommandListStateChanged(Rhi::ICommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    if (command_list.GetState() != Rhi::CommandListState::Executing)
+        return;
+
+    // Batches encoded before execution of the upload command list are completed with it,
+    // while batches still encoding in other thread are completed with the next upload command list execution,
+    // which includes the rest of their commands; batches are encoded in order, so they are always the last ones
+    std::scoped_lock lock(m_mutex);
+    const auto encoding_batch_it = std::ranges::find_if(m_encoded_batches, &Batch::is_encoding);
+    std::move(m_encoded_batches.begin(), encoding_batch_it, std::back_inserter(m_executing_batches));
+    m_encoded_batches.erase(m_encoded_batches.begin(), encoding_batch_it);
+}
+
+void UploadScheduler::OnCommandListExecutionCompleted(Rhi::ICommandList&)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    for (Batch& batch : m_executing_batches)
+    {
+        META_LOG("Upload scheduler batch {} is COMPLETED", batch.timeline);
+        batch.promise.set_value();
+        m_statistics.completed_batches_count++;
+    }
+    m_executing_batches.clear();
+}
+
+Rhi::SubResource UploadScheduler::StageSubResource(Rhi::SubResource&& sub_resource)
+{
+    META_FUNCTION_TASK();
+    const Rhi::SubResource::Index  index      = sub_resource.GetIndex();
+    const Rhi::BytesRangeOpt       data_range = sub_resource.HasDataRange() ? Rhi::BytesRangeOpt(sub_resource.GetDataRange()) : Rhi::BytesRangeOpt();
+    const Data::Size               data_size  = sub_resource.GetDataSize();
+
+    if (sub_resource.IsDataStored() || sub_resource.IsDataShared())
+    {
+        // Owned data is referenced by the upload request without copying
+        std::scoped_lock lock(m_mutex);
+        m_statistics.shared_size += data_size;
+        return Rhi::SubResource(std::move(sub_resource).Share(), index, data_range);
+    }
+
+    // Non-owned data may be released by caller after scheduling, so it is copied to staging memory,
+    // which is shared by many small requests to reduce allocations count
+    if (data_size > m_settings.staging_page_size)
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_statistics.staged_size += data_size;
+        }
+        return Rhi::SubResource(Data::SharedChunk::CopyFrom(sub_resource.GetDataPtr(), data_size), index, data_range);
+    }
+
+    Ptr<Data::Bytes> page_data_ptr;
+    Data::Size       page_offset = 0U;
+    {
+        std::scoped_lock lock(m_mutex);
+        const Data::Size aligned_offset = Data::AlignUp(m_staging_page.offset, m_settings.staging_alignment);
+        if (!m_staging_page.data_ptr || aligned_offset + data_size > m_settings.staging_page_size)
+        {
+            m_staging_page = StagingPage{ std::make_shared<Data::Bytes>(m_settings.staging_page_size) };
+            m_statistics.staging_pages_count++;
+        }
+        else
+        {
+            m_staging_page.offset = aligned_offset;
+        }
+        page_data_ptr          = m_staging_page.data_ptr;
+        page_offset            = m_staging_page.offset;
+        m_staging_page.offset += data_size;
+        m_statistics.staged_size += data_size;
+    }
+
+    // Data is copied to the reserved staging range outside of lock to let multiple threads stage data in parallel
+    Data::RawPtr staging_data_ptr = page_data_ptr->data() + page_offset;
+    std::memcpy(staging_data_ptr, sub_resource.GetDataPtr(), data_size);
+    Data::ChunkCopyCounter::AddCopiedBytes(data_size);
+
+    return Rhi::SubResource(Data::SharedChunk(staging_data_ptr, data_size, std::move(page_data_ptr)), index, data_range);
+}
+
+UploadScheduler::Readiness UploadScheduler::AddRequest(Request&& request)
+{
+    META_FUNCTION_TASK();
+    Data::Size request_data_size = 0U;
+    for (const Rhi::SubResource& sub_resource : request.sub_resources)
+    {
+        request_data_size += sub_resource.GetDataSize();
+    }
+
+    std::scoped_lock lock(m_mutex);
+    m_current_batch.requests.emplace_back(std::move(request));
+    m_current_batch.data_size += request_data_size;
+    m_statistics.requests_count++;
+
+    Readiness readiness = m_current_batch.readiness;
+    if (m_current_batch.data_size >= m_settings.batch_size_limit)
+    {
+        CloseCurrentBatchNoLock();
+    }
+
+    // Closed batches are encoded when context is uploading resources, unless submitted explicitly
+    m_context.RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
+    return readiness;
+}
+
+void UploadScheduler::CloseCurrentBatchNoLock()
+{
+    META_FUNCTION_TASK();
+    if (m_current_batch.requests.empty())
+        return;
+
+    m_current_batch.timeline = ++m_statistics.closed_batches_count;
+    META_LOG("Upload scheduler batch {} is CLOSED with {} requests of {} bytes",
+             m_current_batch.timeline, m_current_batch.requests.size(), m_current_batch.data_size);
+
+    m_closed_batches.emplace_back(std::move(m_current_batch));
+    m_current_batch = Batch();
+}
+
+void UploadScheduler::EncodeClosedBatches()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock encoding_lock(m_encoding_mutex);
+
+    // Closed batches are registered as encoded before encoding under the same lock with upload command list
+    // execution transition, so that execution started from other thread in the middle of encoding does not miss them
+    std::vector<std::pair<Timeline, std::vector<Request>>> encoding_batches;
+    {
+        std::scoped_lock lock(m_mutex);
+        for (Batch& batch : m_closed_batches)
+        {
+            batch.is_encoding = true;
+            encoding_batches.emplace_back(batch.timeline, std::move(batch.requests));
+            m_encoded_batches.emplace_back(std::move(batch));
+        }
+        m_closed_batches.clear();
+    }
+    if (encoding_batches.empty())
+        return;
+
+    // Upload command list is encoded even when resources do not encode any commands,
+    // so that its execution completion marks scheduled batches as completed
+    const Rhi::ICommandKit& upload_cmd_kit = m_context.GetUploadCommandKit();
+    Rhi::ICommandList& upload_cmd_list = upload_cmd_kit.GetListForEncoding();
+    if (m_upload_cmd_list_ptr != &upload_cmd_list)
+    {
+        static_cast<Data::IEmitter<Rhi::ICommandListCallback>&>(upload_cmd_list).Connect(*this);
+        m_upload_cmd_list_ptr = &upload_cmd_list;
+    }
+
+    for (auto& [batch_timeline, batch_requests] : encoding_batches)
+    {
+        META_LOG("Upload scheduler batch {} is ENCODED with {} requests", batch_timeline, batch_requests.size());
+        for (const Request& request : batch_requests)
+        {
+            if (request.resource_ptr->GetResourceType() == Rhi::ResourceType::Buffer)
+            {
+                auto& buffer = dynamic_cast<Rhi::IBuffer&>(*request.resource_ptr);
+                for (const Rhi::SubResource& sub_resource : request.sub_resources)
+                {
+                    buffer.SetData(*request.target_cmd_queue_ptr, sub_resource);
+                }
+            }
+            else
+            {
+                dynamic_cast<Rhi::ITexture&>(*request.resource_ptr).SetData(*request.target_cmd_queue_ptr, request.sub_resources);
+            }
+        }
+
+        // Staging memory is released after data was encoded to the upload command list
+        batch_requests.clear();
+
+        std::scoped_lock lock(m_mutex);
+        if (const auto batch_it = std::ranges::find(m_encoded_batches, batch_timeline, &Batch::timeline);
+            batch_it != m_encoded_batches.end())
+        {
+            batch_it->is_encoding = false;
+        }
+        m_statistics.encoded_batches_count++;
+    }
+}
+
+} // namespace Methane::Graphics::Base
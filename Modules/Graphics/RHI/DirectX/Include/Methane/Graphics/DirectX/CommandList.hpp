@@ -109,7 +109,10 @@ public:
     {
         META_FUNCTION_TASK();
         CommandListBaseT::VerifyEncodingState();
-        
+
+        // Pending batched barriers are set first to preserve the order of resource state transitions
+        CommandListBaseT::FlushResourceBarriers();
+
         const auto lock_guard = static_cast<const Base::ResourceBarriers&>(resource_barriers).Lock();
         if (resource_barriers.IsEmpty())
             return;
@@ -166,6 +169,7 @@ public:
 
     CommandQueue&              GetDirectCommandQueue() final      { return static_cast<CommandQueue&>(CommandListBaseT::GetBaseCommandQueue()); }
     Rhi::CommandListType       GetCommandListType() const final   { return Base::CommandList::GetType(); }
+    Base::CommandList&         GetBaseCommandList() noexcept final { return *this; }
     ID3D12GraphicsCommandList& GetNativeCommandList() const final
     {
         META_CHECK_NOT_NULL(m_command_list_cptr);
@@ -28,6 +28,11 @@ DirectX 12 command list interface and debug group implementation.
 
 #include <directx/d3d12.h>
 
+namespace Methane::Graphics::Base
+{
+class CommandList;
+}
+
 namespace Methane::Graphics::DirectX
 {
 
@@ -43,6 +48,7 @@ struct ICommandList
     virtual ID3D12GraphicsCommandList& GetNativeCommandList() const = 0;
     virtual ID3D12GraphicsCommandList4* GetNativeCommandList4() const = 0;
     virtual void SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) = 0;
+    virtual Base::CommandList& GetBaseCommandList() noexcept = 0;
 
     virtual ~ICommandList() = default;
 };
@@ -47,15 +47,18 @@ public:
     // IRenderCommandList interface
     void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
     void ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) override;
-    bool SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers) override;
-    bool SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers) override;
-    void DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
-                     uint32_t instance_count, uint32_t start_instance) override;
-    void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
-              uint32_t instance_count, uint32_t start_instance) override;
 
     void ResetNative(const Ptr<RenderState>& render_state_ptr = nullptr);
 
+protected:
+    // Base::RenderCommandList overrides
+    void EncodeVertexBuffers(Base::BufferSet& vertex_buffers, bool set_resource_barriers) override;
+    void EncodeIndexBuffer(Base::Buffer& index_buffer, bool set_resource_barriers) override;
+    void EncodeDrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                           uint32_t instance_count, uint32_t start_instance) override;
+    void EncodeDraw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+                    uint32_t instance_count, uint32_t start_instance) override;
+
 private:
     void ResetRenderPass();
 
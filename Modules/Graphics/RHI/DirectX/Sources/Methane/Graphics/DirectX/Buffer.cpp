@@ -135,8 +135,9 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
     );
 
     META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::span target_data_span(sub_resource_data_ptr, sub_resource.GetDataSize());
-    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), target_data_span.begin());
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    std::span target_data_span(sub_resource_data_ptr, data_offset + sub_resource.GetDataSize());
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), target_data_span.begin() + data_offset);
 
     if (sub_resource.HasDataRange())
     {
@@ -153,7 +154,10 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
 
     // In case of private GPU storage, copy buffer data from intermediate upload resource to the private GPU resource
     const TransferCommandList& upload_cmd_list = PrepareResourceTransfer(TransferOperation::Upload, target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), 0U, m_upload_resource_cptr.Get(), 0U, settings.size);
+    if (sub_resource.HasDataRange())
+        upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), data_offset, m_upload_resource_cptr.Get(), data_offset, sub_resource.GetDataSize());
+    else
+        upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), 0U, m_upload_resource_cptr.Get(), 0U, settings.size);
     GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
 }
 
@@ -144,12 +144,9 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
     }
 }
 
-bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
+void RenderCommandList::EncodeVertexBuffers(Base::BufferSet& vertex_buffers, bool set_resource_barriers)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetVertexBuffers(vertex_buffers, set_resource_barriers))
-        return false;
-
     auto& dx_vertex_buffer_set = static_cast<BufferSet&>(vertex_buffers);
     if (const Ptr<Rhi::IResourceBarriers>& buffer_set_setup_barriers_ptr = dx_vertex_buffer_set.GetSetupTransitionBarriers();
         set_resource_barriers && dx_vertex_buffer_set.SetState(Rhi::ResourceState::VertexBuffer) && buffer_set_setup_barriers_ptr)
@@ -159,15 +156,11 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
 
     const std::vector<D3D12_VERTEX_BUFFER_VIEW>& vertex_buffer_views = dx_vertex_buffer_set.GetNativeVertexBufferViews();
     GetNativeCommandListRef().IASetVertexBuffers(0, static_cast<UINT>(vertex_buffer_views.size()), vertex_buffer_views.data());
-    return true;
 }
 
-bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
+void RenderCommandList::EncodeIndexBuffer(Base::Buffer& index_buffer, bool set_resource_barriers)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetIndexBuffer(index_buffer, set_resource_barriers))
-        return false;
-
     auto& dx_index_buffer = static_cast<Buffer&>(index_buffer);
     if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = dx_index_buffer.GetSetupTransitionBarriers();
         set_resource_barriers && dx_index_buffer.SetState(Rhi::ResourceState::IndexBuffer, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
@@ -177,24 +170,15 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
 
     const D3D12_INDEX_BUFFER_VIEW dx_index_buffer_view = dx_index_buffer.GetNativeIndexBufferView();
     GetNativeCommandListRef().IASetIndexBuffer(&dx_index_buffer_view);
-    return true;
 }
 
-void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
-                                    uint32_t instance_count, uint32_t start_instance)
+void RenderCommandList::EncodeDrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                                          uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
-
-    DrawingState& drawing_state = GetDrawingState();
-    if (index_count == 0 && drawing_state.index_buffer_ptr)
-    {
-        index_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
-    }
-
-    Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
-
     ID3D12GraphicsCommandList& dx_command_list = GetNativeCommandListRef();
-    if (drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
+    if (DrawingState& drawing_state = GetDrawingState();
+        drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
     {
         const D3D12_PRIMITIVE_TOPOLOGY primitive_topology = PrimitiveToDXTopology(primitive);
         dx_command_list.IASetPrimitiveTopology(primitive_topology);
@@ -204,12 +188,10 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     dx_command_list.DrawIndexedInstanced(index_count, instance_count, start_index, start_vertex, start_instance);
 }
 
-void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
-                             uint32_t instance_count, uint32_t start_instance)
+void RenderCommandList::EncodeDraw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+                                   uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
-    Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
-
     ID3D12GraphicsCommandList& dx_command_list = GetNativeCommandListRef();
     if (DrawingState& drawing_state = GetDrawingState();
         drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
@@ -224,6 +206,9 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
 void RenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
+    // Commands recorded in command stream are encoded before render pass is ended
+    EncodePendingCommands();
+
     if (IsParallel())
     {
         CommandList<Base::RenderCommandList>::Commit();
@@ -45,44 +45,38 @@ namespace Methane::Graphics::DirectX
 {
 
 [[nodiscard]]
-static D3D12_RESOURCE_BARRIER_TYPE GetNativeBarrierType(Rhi::ResourceBarrier::Type barrier_type)
+static bool IsUnorderedAccessBarrier(const Rhi::ResourceBarrier::StateChange& state_change)
+{
+    // Transition between unordered access states is a UAV barrier, which waits for shader writes before subsequent accesses
+    return state_change.GetStateBefore() == Rhi::ResourceState::UnorderedAccess &&
+           state_change.GetStateAfter()  == Rhi::ResourceState::UnorderedAccess;
+}
+
+[[nodiscard]]
+static const ID3D12Resource* GetNativeBarrierResource(const D3D12_RESOURCE_BARRIER& native_resource_barrier)
 {
     META_FUNCTION_TASK();
-    switch (barrier_type) // NOSONAR
+    switch (native_resource_barrier.Type)
     {
-    case Rhi::ResourceBarrier::Type::StateTransition: return D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    default: META_UNEXPECTED_RETURN(barrier_type, D3D12_RESOURCE_BARRIER_TYPE_TRANSITION);
+    case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION: return native_resource_barrier.Transition.pResource;
+    case D3D12_RESOURCE_BARRIER_TYPE_UAV:        return native_resource_barrier.UAV.pResource;
+    case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:   return native_resource_barrier.Aliasing.pResourceBefore;
+    default: META_UNEXPECTED_RETURN(native_resource_barrier.Type, nullptr);
     }
 }
 
 [[nodiscard]]
-static std::function<bool(const D3D12_RESOURCE_BARRIER&)> GetNativeResourceBarrierPredicate(D3D12_RESOURCE_BARRIER_TYPE native_barrier_type,
-                                                                                            const ID3D12Resource* native_resource_ptr)
+static std::vector<D3D12_RESOURCE_BARRIER>::iterator FindNativeResourceBarrier(std::vector<D3D12_RESOURCE_BARRIER>& native_resource_barriers,
+                                                                                const Rhi::ResourceBarrier::Id& id)
 {
     META_FUNCTION_TASK();
-    switch (native_barrier_type)
-    {
-    case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
-        return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
-            {
-                return native_resource_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
-                       native_resource_barrier.Transition.pResource == native_resource_ptr;
-            };
-    case D3D12_RESOURCE_BARRIER_TYPE_UAV:
-        return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
-            {
-                return native_resource_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_UAV &&
-                       native_resource_barrier.UAV.pResource == native_resource_ptr;
-            };
-    case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:
-        return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
-            {
-                return native_resource_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING &&
-                       native_resource_barrier.Aliasing.pResourceBefore == native_resource_ptr;
-            };
-    default:
-        META_UNEXPECTED_RETURN(native_barrier_type, nullptr);
-    }
+    // Only state transition barriers are encoded natively, so there is at most one native barrier per resource
+    const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource();
+    const auto native_resource_barrier_it = std::ranges::find_if(native_resource_barriers,
+        [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
+        { return GetNativeBarrierResource(native_resource_barrier) == native_resource_ptr; });
+    META_CHECK_TRUE_DESCR(native_resource_barrier_it != native_resource_barriers.end(), "can not find DX resource barrier");
+    return native_resource_barrier_it;
 }
 
 D3D12_RESOURCE_BARRIER ResourceBarriers::GetNativeResourceBarrier(const Barrier::Id& id, const Barrier::StateChange& state_change)
@@ -91,6 +85,9 @@ D3D12_RESOURCE_BARRIER ResourceBarriers::GetNativeResourceBarrier(const Barrier:
     switch (id.GetType()) // NOSONAR
     {
     case Barrier::Type::StateTransition:
+        if (IsUnorderedAccessBarrier(state_change))
+            return CD3DX12_RESOURCE_BARRIER::UAV(dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource());
+
         return CD3DX12_RESOURCE_BARRIER::Transition(
             dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource(),
             IResource::GetNativeResourceState(state_change.GetStateBefore()),
@@ -141,12 +138,7 @@ bool ResourceBarriers::Remove(const Barrier::Id& id)
     if (id.GetType() != Barrier::Type::StateTransition)
         return true;
 
-    const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
-    const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource();
-    const auto native_resource_barrier_it = std::ranges::find_if(m_native_resource_barriers,
-                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
-    META_CHECK_TRUE_DESCR(native_resource_barrier_it != m_native_resource_barriers.end(), "can not find DX resource barrier to update");
-    m_native_resource_barriers.erase(native_resource_barrier_it);
+    m_native_resource_barriers.erase(FindNativeResourceBarrier(m_native_resource_barriers, id));
 
     static_cast<Data::IEmitter<IResourceCallback>&>(id.GetResource()).Disconnect(*this);
     return true;
@@ -168,22 +160,8 @@ void ResourceBarriers::AddNativeResourceBarrier(const Barrier::Id& id, const Bar
 void ResourceBarriers::UpdateNativeResourceBarrier(const Barrier::Id& id, const Barrier::StateChange& state_change)
 {
     META_FUNCTION_TASK();
-    const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
-    const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource();
-    const auto native_resource_barrier_it = std::ranges::find_if(m_native_resource_barriers,
-                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
-    META_CHECK_TRUE_DESCR(native_resource_barrier_it != m_native_resource_barriers.end(), "can not find DX resource barrier to update");
-
-    switch (native_barrier_type) // NOSONAR - do not replace switch with if
-    {
-    case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
-        native_resource_barrier_it->Transition.StateBefore = IResource::GetNativeResourceState(state_change.GetStateBefore());
-        native_resource_barrier_it->Transition.StateAfter  = IResource::GetNativeResourceState(state_change.GetStateAfter());
-        break;
-
-    default:
-        META_UNEXPECTED(native_barrier_type);
-    }
+    // Native barrier is replaced, since its type changes between transition and UAV barrier depending on states
+    *FindNativeResourceBarrier(m_native_resource_barriers, id) = GetNativeResourceBarrier(id, state_change);
 }
 
 } // namespace Methane::Graphics
\ No newline at end of file
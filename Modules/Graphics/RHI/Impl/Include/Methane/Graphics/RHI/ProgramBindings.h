@@ -63,6 +63,7 @@ public:
 
     // IObject interface methods
     META_PIMPL_API bool SetName(std::string_view name) const;
+    META_PIMPL_API bool SetLazyName(IObject::NameFormatter name_formatter) const;
     META_PIMPL_API std::string_view GetName() const META_PIMPL_NOEXCEPT;
 
     // Data::IEmitter<IObjectCallback> interface methods
@@ -106,6 +106,7 @@ public:
                                     uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
     META_PIMPL_API void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0U,
                              uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+    META_PIMPL_API void ExecuteBundle(IRenderCommandBundle& render_command_bundle) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::RenderCommandList;
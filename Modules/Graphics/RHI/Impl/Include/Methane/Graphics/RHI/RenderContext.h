@@ -115,6 +115,7 @@ public:
     [[nodiscard]] META_PIMPL_API Device GetDevice() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetDefaultCommandKit(CommandListType type) const;
     [[nodiscard]] META_PIMPL_API CommandKit GetDefaultCommandKit(const CommandQueue& cmd_queue) const;
+    [[nodiscard]] META_PIMPL_API IDescriptorManager& GetDescriptorManager() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetRenderCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetComputeCommandKit() const;
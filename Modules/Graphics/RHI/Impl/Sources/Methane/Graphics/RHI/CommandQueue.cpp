@@ -151,6 +151,11 @@ ParallelRenderCommandList CommandQueue::CreateParallelRenderCommandList(const Re
     return GetImpl(m_impl_ptr).GetTimestampQueryPoolPtr();
 }
 
+[[nodiscard]] const GpuTimingReport& CommandQueue::GetGpuTimingReport() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetGpuTimingReport();
+}
+
 void CommandQueue::Execute(const CommandListSet& command_lists, const ICommandList::CompletedCallback& completed_callback) const
 {
     return GetImpl(m_impl_ptr).Execute(command_lists.GetInterface(), completed_callback);
@@ -201,6 +201,11 @@ CommandKit ComputeContext::GetDefaultCommandKit(const CommandQueue& cmd_queue) c
     return CommandKit(GetImpl(m_impl_ptr).GetDefaultCommandKit(cmd_queue.GetInterface()));
 }
 
+IDescriptorManager& ComputeContext::GetDescriptorManager() const
+{
+    return GetImpl(m_impl_ptr).GetDescriptorManager();
+}
+
 CommandKit ComputeContext::GetUploadCommandKit() const
 {
     return CommandKit(GetImpl(m_impl_ptr).GetUploadCommandKit());
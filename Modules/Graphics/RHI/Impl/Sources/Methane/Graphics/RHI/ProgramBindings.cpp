@@ -78,6 +78,11 @@ bool ProgramBindings::SetName(std::string_view name) const
     return GetImpl(m_impl_ptr).SetName(name);
 }
 
+bool ProgramBindings::SetLazyName(IObject::NameFormatter name_formatter) const
+{
+    return GetImpl(m_impl_ptr).SetLazyName(std::move(name_formatter));
+}
+
 std::string_view ProgramBindings::GetName() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetName();
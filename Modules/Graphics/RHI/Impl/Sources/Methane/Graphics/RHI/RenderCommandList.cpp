@@ -219,4 +219,9 @@ void RenderCommandList::Draw(Primitive primitive,
     GetImpl(m_impl_ptr).Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 }
 
+void RenderCommandList::ExecuteBundle(IRenderCommandBundle& render_command_bundle) const
+{
+    GetImpl(m_impl_ptr).ExecuteBundle(render_command_bundle);
+}
+
 } // namespace Methane::Graphics::Rhi
@@ -213,6 +213,11 @@ CommandKit RenderContext::GetDefaultCommandKit(const CommandQueue& cmd_queue) co
     return CommandKit(GetImpl(m_impl_ptr).GetDefaultCommandKit(cmd_queue.GetInterface()));
 }
 
+IDescriptorManager& RenderContext::GetDescriptorManager() const
+{
+    return GetImpl(m_impl_ptr).GetDescriptorManager();
+}
+
 CommandKit RenderContext::GetUploadCommandKit() const
 {
     return CommandKit(GetImpl(m_impl_ptr).GetUploadCommandKit());
@@ -0,0 +1,111 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/GpuTimingReport.h
+Per-frame report of GPU execution timings of command lists and their debug groups
+resolved from timestamp queries of the command queue.
+
+******************************************************************************/
+
+#pragma once
+
+#include "IQueryPool.h"
+
+#include <Methane/Data/Types.h>
+#include <Methane/Memory.hpp>
+
+#include <deque>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Methane::Graphics::Rhi
+{
+
+class GpuTimingReport
+{
+public:
+    struct Timing
+    {
+        std::string     name;
+        uint32_t        depth;       // 0 - command list, 1 and more - nested debug groups
+        Data::Timestamp start_ns;    // CPU time correlated with GPU timestamp using calibrated timestamps
+        Data::Timestamp duration_ns;
+
+        [[nodiscard]] Data::Timestamp GetEndNs() const noexcept { return start_ns + duration_ns; }
+    };
+
+    using Timings = std::vector<Timing>;
+
+    struct Frame
+    {
+        Opt<Data::Index> frame_index;
+        uint64_t         frame_number = 0U;
+        std::string      queue_name;
+        Data::Frequency  gpu_frequency = 0U;
+        ITimestampQueryPool::CalibratedTimestamps calibrated_timestamps{ 0U, 0U };
+        Timings          timings;
+
+        // Time range of all command lists executed in frame, including gaps between them
+        [[nodiscard]] Data::Timestamp GetStartNs() const noexcept;
+        [[nodiscard]] Data::Timestamp GetEndNs() const noexcept;
+        [[nodiscard]] Data::Timestamp GetDurationNs() const noexcept { return GetEndNs() - GetStartNs(); }
+        [[nodiscard]] double          GetDurationMs() const noexcept;
+
+        // Multi-line text with indented timings of command lists and debug groups for HUD display
+        [[nodiscard]] explicit operator std::string() const;
+    };
+
+    using Frames = std::vector<Frame>;
+
+    // Frame is completed on overflow to limit memory of queues executing command lists without frame index
+    static constexpr size_t max_frame_timings_count = 4096U;
+
+    explicit GpuTimingReport(uint32_t max_frames_count = 8U);
+
+    void SetQueueName(std::string_view queue_name);
+    void SetCalibratedTimestamps(const ITimestampQueryPool::CalibratedTimestamps& calibrated_timestamps, Data::Frequency gpu_frequency);
+
+    // Timings of the frame are collected until timings of another frame index are added or frame is completed explicitly,
+    // timings without frame index are added to the currently collected frame
+    void AddTimings(const Opt<Data::Index>& frame_index, Timings&& timings);
+    void CompleteFrame();
+    void Clear();
+
+    [[nodiscard]] uint32_t   GetMaxFramesCount() const noexcept { return m_max_frames_count; }
+    [[nodiscard]] Opt<Frame> GetLastCompletedFrame() const;
+    [[nodiscard]] Frames     GetCompletedFrames() const;
+
+    void WriteJson(std::ostream& output_stream) const;
+
+private:
+    void CompleteFrameNoLock();
+
+    const uint32_t     m_max_frames_count;
+    mutable std::mutex m_mutex;
+    std::string        m_queue_name;
+    Data::Frequency    m_gpu_frequency = 0U;
+    ITimestampQueryPool::CalibratedTimestamps m_calibrated_timestamps{ 0U, 0U };
+    Opt<Frame>         m_collected_frame_opt;
+    std::deque<Frame>  m_completed_frames;
+    uint64_t           m_frames_count = 0U;
+};
+
+} // namespace Methane::Graphics::Rhi
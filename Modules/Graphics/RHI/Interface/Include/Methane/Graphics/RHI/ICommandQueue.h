@@ -25,6 +25,7 @@ Methane command queue interface: queues are used to execute command lists.
 
 #include "IObject.h"
 #include "ICommandList.h"
+#include "IRenderCommandBundle.h"
 
 #include <Methane/Memory.hpp>
 
@@ -41,6 +42,7 @@ struct IComputeCommandList;
 struct IRenderCommandList;
 struct IParallelRenderCommandList;
 struct ITimestampQueryPool;
+class GpuTimingReport;
 
 struct ICommandQueue
     : virtual IObject // NOSONAR
@@ -55,11 +57,13 @@ struct ICommandQueue
     [[nodiscard]] virtual Ptr<IComputeCommandList>        CreateComputeCommandList() = 0;
     [[nodiscard]] virtual Ptr<IRenderCommandList>         CreateRenderCommandList(IRenderPass& render_pass) = 0;
     [[nodiscard]] virtual Ptr<IParallelRenderCommandList> CreateParallelRenderCommandList(IRenderPass& render_pass) = 0;
+    [[nodiscard]] virtual Ptr<IRenderCommandBundle>       CreateRenderCommandBundle(IRenderCommandBundle::RecordFunction record_function) = 0;
     [[nodiscard]] virtual Ptr<ITimestampQueryPool>        CreateTimestampQueryPool(uint32_t max_timestamps_per_frame) = 0;
     [[nodiscard]] virtual const IContext&                 GetContext() const noexcept = 0;
     [[nodiscard]] virtual CommandListType                 GetCommandListType() const noexcept = 0;
     [[nodiscard]] virtual uint32_t                        GetFamilyIndex() const noexcept = 0;
     [[nodiscard]] virtual const Ptr<ITimestampQueryPool>& GetTimestampQueryPoolPtr() = 0;
+    [[nodiscard]] virtual const GpuTimingReport&          GetGpuTimingReport() const noexcept = 0;
     virtual void Execute(ICommandListSet& command_lists, const ICommandList::CompletedCallback& completed_callback = {}) = 0;
 };
 
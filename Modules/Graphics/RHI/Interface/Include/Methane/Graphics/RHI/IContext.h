@@ -98,6 +98,7 @@ struct IComputeState;
 struct IBuffer;
 struct ITexture;
 struct ISampler;
+struct IDescriptorManager;
 
 struct ShaderSettings;
 struct ProgramSettings;
@@ -144,6 +145,7 @@ struct IContext
     [[nodiscard]] virtual const IDevice& GetDevice() const = 0;
     [[nodiscard]] virtual ICommandKit& GetDefaultCommandKit(CommandListType type) const = 0;
     [[nodiscard]] virtual ICommandKit& GetDefaultCommandKit(ICommandQueue& cmd_queue) const = 0;
+    [[nodiscard]] virtual IDescriptorManager& GetDescriptorManager() const = 0;
 
     [[nodiscard]] ICommandKit& GetUploadCommandKit() const;
 };
@@ -52,6 +52,7 @@ namespace Methane::Graphics::Rhi
 {
 
 struct IProgramBindings;
+class ResourceView;
 
 struct IDescriptorManager
 {
@@ -60,6 +61,14 @@ struct IDescriptorManager
     virtual void CompleteInitialization() = 0;
     virtual void Release() = 0;
 
+    // Bindless descriptors are available with BindlessDescriptors device feature enabled:
+    // acquired index of the resource view in the global descriptors array is passed to shaders with root constants.
+    // Acquired texture and buffer resources are transitioned to ShaderResource state,
+    // resources used later in other states (like render targets) have to be transitioned back to it before drawing.
+    [[nodiscard]] virtual bool     IsBindlessEnabled() const = 0;
+    [[nodiscard]] virtual uint32_t AcquireBindlessDescriptor(const ResourceView& resource_view) = 0;
+    virtual void                   ReleaseBindlessDescriptor(const ResourceView& resource_view) = 0;
+
     virtual ~IDescriptorManager() = default;
 };
 
@@ -49,7 +49,8 @@ enum class DeviceFeature : uint32_t
 {
     PresentToWindow,
     AnisotropicFiltering,
-    ImageCubeArray
+    ImageCubeArray,
+    BindlessDescriptors // global descriptor arrays indexed in shaders, supported by Vulkan with descriptor indexing
 };
 
 using DeviceFeatureMask = Data::EnumMask<DeviceFeature>;
@@ -28,6 +28,7 @@ Methane object interface: represents any named object.
 
 #include <string>
 #include <stdexcept>
+#include <functional>
 
 namespace Methane::Graphics::Rhi
 {
@@ -63,9 +64,14 @@ struct IObjectCallback
 struct IObject
     : virtual Data::IEmitter<IObjectCallback> // NOSONAR
 {
-    using IRegistry = IObjectRegistry;
+    using IRegistry     = IObjectRegistry;
+    using NameFormatter = std::function<std::string()>;
 
     virtual bool SetName(std::string_view name) = 0;
+
+    // Name formatter may be evaluated only when object name is requested by registry, logs or debug tools,
+    // objects which apply names to the native graphics API objects evaluate it immediately
+    virtual bool SetLazyName(NameFormatter name_formatter) = 0;
     [[nodiscard]] virtual std::string_view GetName() const noexcept = 0;
     [[nodiscard]] virtual Ptr<IObject>     GetPtr() = 0;
 
@@ -0,0 +1,55 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/IRenderCommandBundle.h
+Methane render command bundle interface: render commands recorded once
+and executed in render command lists of any frame with a single call.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+
+#include <functional>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct ICommandQueue;
+struct IRenderCommandList;
+
+struct IRenderCommandBundle
+{
+    using RecordFunction = std::function<void(IRenderCommandList&)>;
+
+    // Create IRenderCommandBundle instance
+    [[nodiscard]] static Ptr<IRenderCommandBundle> Create(ICommandQueue& command_queue, RecordFunction record_function);
+
+    // IRenderCommandBundle interface
+    [[nodiscard]] virtual bool     IsValid() const noexcept = 0;
+    [[nodiscard]] virtual uint32_t GetRecordingsCount() const noexcept = 0;
+
+    // Bundle is re-recorded on next execution after invalidation, which is done automatically
+    // on resource view changes of the recorded program bindings, or manually when recorded commands depend on other state
+    virtual void Invalidate() noexcept = 0;
+
+    virtual ~IRenderCommandBundle() = default;
+};
+
+} // namespace Methane::Graphics::Rhi
@@ -36,6 +36,7 @@ struct IParallelRenderCommandList;
 struct IBuffer;
 struct IBufferSet;
 struct IViewState;
+struct IRenderCommandBundle;
 
 enum class RenderPrimitive
 {
@@ -68,6 +69,7 @@ struct IRenderCommandList
     virtual bool SetIndexBuffer(IBuffer& index_buffer, bool set_resource_barriers = true) = 0;
     virtual void DrawIndexed(Primitive primitive, uint32_t index_count = 0, uint32_t start_index = 0, uint32_t start_vertex = 0,
                              uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+    virtual void ExecuteBundle(IRenderCommandBundle& render_command_bundle) = 0;
     virtual void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0,
                       uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
     
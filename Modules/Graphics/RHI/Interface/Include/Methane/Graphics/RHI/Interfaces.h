@@ -47,3 +47,4 @@ Methane graphics RHI interfaces: all headers under one umbrella.
 #include "IComputeCommandList.h"
 #include "IRenderCommandList.h"
 #include "IParallelRenderCommandList.h"
+#include "IRenderCommandBundle.h"
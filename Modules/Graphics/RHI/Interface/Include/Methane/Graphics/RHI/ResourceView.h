@@ -118,6 +118,7 @@ public:
     explicit SubResource(Data::Bytes&& data, const Index& index = {}, BytesRangeOpt data_range = {}) noexcept;
     explicit SubResource(const Data::Bytes& data, const Index& index = {}, BytesRangeOpt data_range = {}) noexcept;
     SubResource(Data::ConstRawPtr data_ptr, Data::Size size, const Index& index = {}, BytesRangeOpt data_range = {}) noexcept;
+    explicit SubResource(const Data::SharedChunk& data, const Index& index = {}, BytesRangeOpt data_range = {}) noexcept;
     ~SubResource() = default;
 
     [[nodiscard]] const Index& GetIndex() const noexcept
@@ -0,0 +1,240 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/GpuTimingReport.cpp
+Per-frame report of GPU execution timings of command lists and their debug groups
+resolved from timestamp queries of the command queue.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/GpuTimingReport.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <ostream>
+
+namespace Methane::Graphics::Rhi
+{
+
+static void WriteJsonString(std::ostream& output_stream, std::string_view text)
+{
+    output_stream << '"';
+    for (const char character : text)
+    {
+        switch (character)
+        {
+        case '"':  output_stream << "\\\""; break;
+        case '\\': output_stream << "\\\\"; break;
+        case '\n': output_stream << "\\n";  break;
+        case '\t': output_stream << "\\t";  break;
+        default:   output_stream << character;
+        }
+    }
+    output_stream << '"';
+}
+
+Data::Timestamp GpuTimingReport::Frame::GetStartNs() const noexcept
+{
+    META_FUNCTION_TASK();
+    Data::Timestamp start_ns = std::numeric_limits<Data::Timestamp>::max();
+    for (const Timing& timing : timings)
+    {
+        if (!timing.depth)
+            start_ns = std::min(start_ns, timing.start_ns);
+    }
+    return start_ns == std::numeric_limits<Data::Timestamp>::max() ? 0U : start_ns;
+}
+
+Data::Timestamp GpuTimingReport::Frame::GetEndNs() const noexcept
+{
+    META_FUNCTION_TASK();
+    Data::Timestamp end_ns = 0U;
+    for (const Timing& timing : timings)
+    {
+        if (!timing.depth)
+            end_ns = std::max(end_ns, timing.GetEndNs());
+    }
+    return end_ns;
+}
+
+double GpuTimingReport::Frame::GetDurationMs() const noexcept
+{
+    META_FUNCTION_TASK();
+    return static_cast<double>(GetDurationNs()) / 1000000.0;
+}
+
+GpuTimingReport::Frame::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    std::string report_str = fmt::format("{} GPU frame {}: {:.3f} ms", queue_name, frame_number, GetDurationMs());
+    for (const Timing& timing : timings)
+    {
+        report_str += fmt::format("\n{:>{}}{}: {:.3f} ms", "", (timing.depth + 1U) * 2U, timing.name,
+                                  static_cast<double>(timing.duration_ns) / 1000000.0);
+    }
+    return report_str;
+}
+
+GpuTimingReport::GpuTimingReport(uint32_t max_frames_count)
+    : m_max_frames_count(max_frames_count)
+{
+    META_CHECK_NOT_ZERO_DESCR(max_frames_count, "GPU timing report should keep at least one completed frame");
+}
+
+void GpuTimingReport::SetQueueName(std::string_view queue_name)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    m_queue_name = queue_name;
+}
+
+void GpuTimingReport::SetCalibratedTimestamps(const ITimestampQueryPool::CalibratedTimestamps& calibrated_timestamps, Data::Frequency gpu_frequency)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    m_calibrated_timestamps = calibrated_timestamps;
+    m_gpu_frequency         = gpu_frequency;
+}
+
+void GpuTimingReport::AddTimings(const Opt<Data::Index>& frame_index, Timings&& timings)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    if (m_collected_frame_opt && frame_index && m_collected_frame_opt->frame_index && *m_collected_frame_opt->frame_index != *frame_index)
+    {
+        CompleteFrameNoLock();
+    }
+
+    if (!m_collected_frame_opt)
+    {
+        m_collected_frame_opt = Frame{ frame_index };
+    }
+    else if (!m_collected_frame_opt->frame_index)
+    {
+        m_collected_frame_opt->frame_index = frame_index;
+    }
+
+    Timings& frame_timings = m_collected_frame_opt->timings;
+    frame_timings.insert(frame_timings.end(), std::make_move_iterator(timings.begin()), std::make_move_iterator(timings.end()));
+    if (frame_timings.size() >= max_frame_timings_count)
+    {
+        CompleteFrameNoLock();
+    }
+}
+
+void GpuTimingReport::CompleteFrame()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    CompleteFrameNoLock();
+}
+
+void GpuTimingReport::Clear()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    m_collected_frame_opt.reset();
+    m_completed_frames.clear();
+    m_frames_count = 0U;
+}
+
+Opt<GpuTimingReport::Frame> GpuTimingReport::GetLastCompletedFrame() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    return m_completed_frames.empty() ? Opt<Frame>() : m_completed_frames.back();
+}
+
+GpuTimingReport::Frames GpuTimingReport::GetCompletedFrames() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    return Frames(m_completed_frames.begin(), m_completed_frames.end());
+}
+
+void GpuTimingReport::WriteJson(std::ostream& output_stream) const
+{
+    META_FUNCTION_TASK();
+    const Frames frames = GetCompletedFrames();
+    output_stream << "{\"frames\":[";
+    for (size_t frame_index = 0U; frame_index < frames.size(); ++frame_index)
+    {
+        const Frame& frame = frames[frame_index];
+        output_stream << (frame_index ? "," : "") << "{\"frame\":" << frame.frame_number
+                      << ",\"frame_index\":";
+        if (frame.frame_index)
+            output_stream << *frame.frame_index;
+        else
+            output_stream << "null";
+
+        output_stream << ",\"queue\":";
+        WriteJsonString(output_stream, frame.queue_name);
+        output_stream << ",\"gpu_frequency\":" << frame.gpu_frequency
+                      << ",\"calibration\":{\"gpu_ts\":" << frame.calibrated_timestamps.gpu_ts
+                      << ",\"cpu_ts\":" << frame.calibrated_timestamps.cpu_ts << "}"
+                      << ",\"start_ns\":" << frame.GetStartNs()
+                      << ",\"duration_ns\":" << frame.GetDurationNs()
+                      << ",\"timings\":[";
+
+        for (size_t timing_index = 0U; timing_index < frame.timings.size(); ++timing_index)
+        {
+            const Timing& timing = frame.timings[timing_index];
+            output_stream << (timing_index ? "," : "") << "{\"name\":";
+            WriteJsonString(output_stream, timing.name);
+            output_stream << ",\"depth\":" << timing.depth
+                          << ",\"start_ns\":" << timing.start_ns
+                          << ",\"duration_ns\":" << timing.duration_ns << "}";
+        }
+        output_stream << "]}";
+    }
+    output_stream << "]}";
+}
+
+void GpuTimingReport::CompleteFrameNoLock()
+{
+    META_FUNCTION_TASK();
+    if (!m_collected_frame_opt)
+        return;
+
+    Frame& frame = *m_collected_frame_opt;
+    frame.frame_number          = m_frames_count++;
+    frame.queue_name            = m_queue_name;
+    frame.gpu_frequency         = m_gpu_frequency;
+    frame.calibrated_timestamps = m_calibrated_timestamps;
+
+    // Timings are added in order of command lists completion, which may differ from order of their execution
+    std::ranges::stable_sort(frame.timings, [](const Timing& left, const Timing& right)
+    {
+        return left.start_ns < right.start_ns;
+    });
+
+    m_completed_frames.emplace_back(std::move(frame));
+    m_collected_frame_opt.reset();
+    while (m_completed_frames.size() > m_max_frames_count)
+    {
+        m_completed_frames.pop_front();
+    }
+}
+
+} // namespace Methane::Graphics::Rhi
@@ -60,6 +60,12 @@ SubResource::SubResource(Data::ConstRawPtr data_ptr, Data::Size size, const Inde
     , m_data_range(std::move(data_range))
 { }
 
+SubResource::SubResource(const Data::SharedChunk& data, const Index& index, BytesRangeOpt data_range) noexcept
+    : Data::Chunk(data)
+    , m_index(index)
+    , m_data_range(std::move(data_range))
+{ }
+
 SubResourceCount::SubResourceCount(Data::Size depth, Data::Size array_size, Data::Size mip_levels_count)
     : m_depth(depth)
     , m_array_size(array_size)
@@ -121,12 +121,9 @@ void RenderCommandList::ResetCommandEncoder()
     }
 }
 
-bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
+void RenderCommandList::EncodeVertexBuffers(Base::BufferSet& vertex_buffers, bool)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetVertexBuffers(vertex_buffers, set_resource_barriers))
-        return false;
-
     const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
     META_CHECK_NOT_NULL(mtl_cmd_encoder);
 
@@ -135,23 +132,13 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
     const std::vector<NSUInteger>&    mtl_offsets = metal_vertex_buffers.GetNativeOffsets();
     const NSRange                     mtl_range{ m_start_vertex_buffer_index, metal_vertex_buffers.GetCount() };
     [mtl_cmd_encoder setVertexBuffers:mtl_buffers.data() offsets:mtl_offsets.data() withRange:mtl_range];
-
-    return true;
 }
 
-void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
-                                    uint32_t instance_count, uint32_t start_instance)
+void RenderCommandList::EncodeDrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                                          uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
-
-    DrawingState& drawing_state = GetDrawingState();
-    if (index_count == 0 && drawing_state.index_buffer_ptr)
-    {
-        index_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
-    }
-
-    Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
-
+    const DrawingState& drawing_state = GetDrawingState();
     const Buffer& metal_index_buffer = static_cast<const Buffer&>(*drawing_state.index_buffer_ptr);
     const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
     const MTLIndexType     mtl_index_type     = metal_index_buffer.GetNativeIndexType();
@@ -188,12 +175,10 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     }
 }
 
-void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
-                             uint32_t instance_count, uint32_t start_instance)
+void RenderCommandList::EncodeDraw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+                                   uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
-    Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
-
     const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
 
     const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
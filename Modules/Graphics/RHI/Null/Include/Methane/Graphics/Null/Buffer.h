@@ -36,7 +36,16 @@ class Buffer final // NOSONAR - inheritance hierarchy is greater than 5
 public:
     Buffer(const Base::Context& context, const Settings& settings);
 
-    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt&) override;
+    // IBuffer interface
+    void        SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource) override;
+    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range) override;
+
+    // CPU memory of the buffer data, which is allocated on first use when compute dispatch is recorded,
+    // and is never reallocated after that, so it can be accessed from compute kernels in parallel
+    [[nodiscard]] Data::Bytes& GetCpuData();
+
+private:
+    Data::Bytes m_cpu_data;
 };
 
 } // namespace Methane::Graphics::Null
@@ -24,6 +24,7 @@ Null base template implementation of the command list interface.
 #pragma once
 
 #include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
 
 namespace Methane::Graphics::Null
 {
@@ -35,10 +36,20 @@ class CommandList
 public:
     using CommandListBaseT::CommandListBaseT;
 
-    void SetResourceBarriers(const Rhi::IResourceBarriers&) final
+    void SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) final
     {
         CommandListBaseT::VerifyEncodingState();
+        CommandListBaseT::FlushResourceBarriers();
+        m_set_resource_barriers_count++;
+        m_last_resource_barriers = resource_barriers.GetSet();
     }
+
+    uint32_t                           GetSetResourceBarriersCount() const noexcept { return m_set_resource_barriers_count; }
+    const Rhi::IResourceBarriers::Set& GetLastResourceBarriers() const noexcept     { return m_last_resource_barriers; }
+
+private:
+    uint32_t                    m_set_resource_barriers_count = 0U;
+    Rhi::IResourceBarriers::Set m_last_resource_barriers;
 };
 
 } // namespace Methane::Graphics::Null
@@ -24,9 +24,12 @@ Null implementation of the compute command list interface.
 #pragma once
 
 #include "CommandList.hpp"
+#include "ComputeKernel.h"
 
 #include <Methane/Graphics/Base/ComputeCommandList.h>
 
+#include <vector>
+
 namespace Methane::Graphics::Null
 {
 
@@ -38,10 +41,32 @@ class ComputeCommandList final // NOSONAR - inheritance hierarchy depth is highe
 public:
     explicit ComputeCommandList(CommandQueue& command_queue);
 
+    // IComputeCommandList interface
     void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
 
+    // Base::CommandList interface
+    void Execute(const CompletedCallback& completed_callback = {}) override;
+
+    [[nodiscard]] size_t GetKernelDispatchesCount() const noexcept { return m_kernel_dispatches.size(); }
+
+protected:
+    // Base::CommandList overrides
+    void ResetCommandState() override;
+
 private:
-    Rhi::ThreadGroupsCount m_dispatched_thread_groups_count;
+    // Dispatch of the compute shader with registered C++ kernel, which is executed on CPU
+    struct KernelDispatch
+    {
+        ComputeKernel          kernel;
+        ComputeKernelBindings  bindings;
+        Rhi::ThreadGroupSize   thread_group_size;
+        Rhi::ThreadGroupsCount thread_groups_count;
+    };
+
+    void ExecuteKernelDispatch(const KernelDispatch& kernel_dispatch) const;
+
+    Rhi::ThreadGroupsCount      m_dispatched_thread_groups_count;
+    std::vector<KernelDispatch> m_kernel_dispatches;
 };
 
 } // namespace Methane::Graphics::Null
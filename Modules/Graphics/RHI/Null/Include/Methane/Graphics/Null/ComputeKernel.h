@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/ComputeKernel.h
+Null implementation of compute shaders with C++ kernels registered for shader entry points,
+which are executed on CPU by the Null compute command list.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IShader.h>
+#include <Methane/Graphics/RHI/IComputeState.h>
+#include <Methane/Graphics/RHI/IComputeCommandList.h>
+#include <Methane/Graphics/RHI/ResourceView.h>
+#include <Methane/Graphics/RHI/RootConstant.h>
+#include <Methane/Graphics/Point.hpp>
+#include <Methane/Graphics/Volume.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Checks.hpp>
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Methane::Graphics::Base
+{
+class ProgramBindings;
+}
+
+namespace Methane::Graphics::Null
+{
+
+struct ComputeKernelTexture
+{
+    std::span<std::byte> data;
+    Dimensions           dimensions;
+    Data::Size           pixel_size = 0U;
+
+    // Pixels are stored row by row and slice by slice without padding: index = (z * height + y) * width + x
+    template<typename PixelType>
+    [[nodiscard]] std::span<PixelType> GetPixels() const
+    {
+        META_CHECK_EQUAL_DESCR(sizeof(PixelType), pixel_size, "pixel type size does not match texture pixel size");
+        return std::span<PixelType>(reinterpret_cast<PixelType*>(data.data()), data.size() / sizeof(PixelType)); // NOSONAR
+    }
+};
+
+class ComputeKernelBindings
+{
+public:
+    // Root constants are copied, resource views are retained and their CPU data is allocated on dispatch recording,
+    // so that kernels executed in parallel thread groups only access prepared data without allocations
+    explicit ComputeKernelBindings(const Base::ProgramBindings& program_bindings);
+
+    [[nodiscard]] const Rhi::RootConstant& GetRootConstant(std::string_view argument_name) const;
+    [[nodiscard]] std::span<std::byte>     GetBufferData(std::string_view argument_name) const;
+    [[nodiscard]] ComputeKernelTexture     GetTexture(std::string_view argument_name) const;
+
+    template<typename T>
+    [[nodiscard]] const T& GetRootConstantValue(std::string_view argument_name) const
+    { return GetRootConstant(argument_name).GetValue<T>(); }
+
+    template<typename T>
+    [[nodiscard]] std::span<T> GetBufferItems(std::string_view argument_name) const
+    {
+        const std::span<std::byte> buffer_data = GetBufferData(argument_name);
+        return std::span<T>(reinterpret_cast<T*>(buffer_data.data()), buffer_data.size() / sizeof(T)); // NOSONAR
+    }
+
+private:
+    using RootConstantByName = std::map<std::string, Rhi::RootConstant, std::less<>>;
+    using ResourceViewByName = std::map<std::string, Rhi::ResourceView, std::less<>>;
+    using BufferDataByName   = std::map<std::string, std::span<std::byte>, std::less<>>;
+    using TextureByName      = std::map<std::string, ComputeKernelTexture, std::less<>>;
+
+    void AddResourceView(const std::string& argument_name, const Rhi::ResourceView& resource_view);
+
+    RootConstantByName m_root_constant_by_name;
+    ResourceViewByName m_resource_view_by_name;
+    BufferDataByName   m_buffer_data_by_name;
+    TextureByName      m_texture_by_name;
+};
+
+struct ComputeThreadGroup
+{
+    Point3U              group_id;          // SV_GroupID
+    Rhi::ThreadGroupSize thread_group_size; // [numthreads(x, y, z)]
+
+    // Calls thread function for each thread in group with its SV_DispatchThreadID
+    template<typename ThreadFuncType>
+    void ForEachThread(ThreadFuncType&& thread_func) const
+    {
+        const uint32_t origin_x = group_id.GetX() * thread_group_size.GetWidth();
+        const uint32_t origin_y = group_id.GetY() * thread_group_size.GetHeight();
+        const uint32_t origin_z = group_id.GetZ() * thread_group_size.GetDepth();
+        for(uint32_t z = 0U; z < thread_group_size.GetDepth(); ++z)
+            for(uint32_t y = 0U; y < thread_group_size.GetHeight(); ++y)
+                for(uint32_t x = 0U; x < thread_group_size.GetWidth(); ++x)
+                    thread_func(Point3U(origin_x + x, origin_y + y, origin_z + z));
+    }
+};
+
+// Kernel is called once per thread group, thread groups are executed in parallel
+using ComputeKernel = std::function<void(const ComputeKernelBindings& bindings, const ComputeThreadGroup& thread_group)>;
+
+class ComputeKernelRegistry
+{
+public:
+    [[nodiscard]] static ComputeKernelRegistry& Get();
+
+    // Kernels are registered by compute shader entry function, named as "<file_name>::<function_name>"
+    void Register(const Rhi::ShaderEntryFunction& entry_function, const ComputeKernel& kernel);
+    void Unregister(const Rhi::ShaderEntryFunction& entry_function);
+
+    // Returns empty kernel when it is not registered for the entry function
+    [[nodiscard]] ComputeKernel Find(const Rhi::ShaderEntryFunction& entry_function) const;
+
+private:
+    ComputeKernelRegistry() = default;
+
+    [[nodiscard]] static std::string GetKernelName(const Rhi::ShaderEntryFunction& entry_function);
+
+    using KernelByName = std::map<std::string, ComputeKernel, std::less<>>;
+
+    mutable std::mutex m_mutex;
+    KernelByName       m_kernel_by_name;
+};
+
+} // namespace Methane::Graphics::Null
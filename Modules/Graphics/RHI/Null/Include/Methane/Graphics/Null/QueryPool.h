@@ -51,11 +51,14 @@ class TimestampQuery final
 public:
     TimestampQuery(Base::QueryPool& buffer, Base::CommandList& command_list, Index index, Range data_range);
 
-    // TimestampQuery overrides
-    void InsertTimestamp() override                 { /* Null implementation */ }
+    // TimestampQuery overrides, GPU timestamps are synthesized from CPU clock in nanoseconds for testing
+    void InsertTimestamp() override;
     void ResolveTimestamp() override                { /* Null implementation */ }
-    Timestamp GetGpuTimestamp() const override      { return 0U; }
-    Timestamp GetCpuNanoseconds() const override    { return 0U; }
+    Timestamp GetGpuTimestamp() const override      { return m_timestamp; }
+    Timestamp GetCpuNanoseconds() const override    { return m_timestamp; }
+
+private:
+    Timestamp m_timestamp = 0U;
 };
 
 class TimestampQueryPool final
@@ -66,8 +69,8 @@ public:
     TimestampQueryPool(CommandQueue& command_queue, uint32_t max_timestamps_per_frame);
 
     // ITimestampQueryPool interface
-    Ptr<Rhi::ITimestampQuery> CreateTimestampQuery(Rhi::ICommandList&) override { return nullptr; }
-    CalibratedTimestamps Calibrate() override { return {}; }
+    Ptr<Rhi::ITimestampQuery> CreateTimestampQuery(Rhi::ICommandList& command_list) override;
+    CalibratedTimestamps Calibrate() override;
 };
 
 } // namespace Methane::Graphics::Null
@@ -27,6 +27,8 @@ Null implementation of the texture interface.
 
 #include <Methane/Graphics/Base/Texture.h>
 
+#include <vector>
+
 namespace Methane::Graphics::Null
 {
 
@@ -39,7 +41,16 @@ public:
     Texture(const Base::Context& context, const Settings& settings);
     Texture(const RenderContext& render_context, const Settings& settings, Data::Index frame_index);
 
-    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&) override;
+    // ITexture interface
+    void        SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources) override;
+    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range) override;
+
+    // CPU memory of the sub-resource data, which is allocated on first use when compute dispatch is recorded,
+    // and is never reallocated after that, so it can be accessed from compute kernels in parallel
+    [[nodiscard]] Data::Bytes& GetCpuData(const SubResource::Index& sub_resource_index);
+
+private:
+    std::vector<Data::Bytes> m_cpu_sub_resources;
 };
 
 } // namespace Methane::Graphics::Null
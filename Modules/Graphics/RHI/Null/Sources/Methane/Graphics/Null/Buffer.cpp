@@ -23,6 +23,10 @@ Null implementation of the buffer interface.
 
 #include <Methane/Graphics/Null/Buffer.h>
 
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
 #include <iterator>
 
 namespace Methane::Graphics::Null
@@ -33,9 +37,36 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
 {
 }
 
-Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt&)
+void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource)
+{
+    META_FUNCTION_TASK();
+    Base::Buffer::SetData(target_cmd_queue, sub_resource);
+
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), GetCpuData().begin() + data_offset);
+}
+
+Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    if (m_cpu_data.empty())
+        return {};
+
+    const Data::Index data_start = data_range ? data_range->GetStart() : 0U;
+    const Data::Index data_end   = data_range ? data_range->GetEnd()   : static_cast<Data::Index>(m_cpu_data.size());
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_end, m_cpu_data.size(), "buffer data range is out of bounds");
+    return Rhi::SubResource(Data::Bytes(m_cpu_data.begin() + data_start, m_cpu_data.begin() + data_end),
+                            Rhi::SubResourceIndex(), data_range);
+}
+
+Data::Bytes& Buffer::GetCpuData()
 {
-    return {};
+    META_FUNCTION_TASK();
+    if (m_cpu_data.empty())
+    {
+        m_cpu_data.resize(GetDataSize(Data::MemoryState::Reserved));
+    }
+    return m_cpu_data;
 }
 
 } // namespace Methane::Graphics::Null
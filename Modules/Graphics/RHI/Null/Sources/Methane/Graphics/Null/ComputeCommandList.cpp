@@ -25,6 +25,15 @@ Null implementation of the compute command list interface.
 #include <Methane/Graphics/Null/ComputeCommandList.h>
 #include <Methane/Graphics/Null/CommandQueue.h>
 
+#include <Methane/Graphics/Base/ComputeState.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/RHI/IProgram.h>
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+
 namespace Methane::Graphics::Null
 {
 
@@ -34,8 +43,76 @@ ComputeCommandList::ComputeCommandList(CommandQueue& command_queue)
 
 void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
 {
+    META_FUNCTION_TASK();
     m_dispatched_thread_groups_count = thread_groups_count;
     Base::ComputeCommandList::Dispatch(thread_groups_count);
+
+    // Compute shader is executed on CPU only when C++ kernel is registered for its entry function
+    const Base::ComputeState&    compute_state = GetComputeState();
+    const Ptr<Rhi::IProgram>&    program_ptr   = compute_state.GetSettings().program_ptr;
+    const Base::ProgramBindings* bindings_ptr  = GetProgramBindingsPtr();
+    if (!program_ptr || !bindings_ptr)
+        return;
+
+    const Ptr<Rhi::IShader>& shader_ptr = program_ptr->GetShader(Rhi::ShaderType::Compute);
+    if (!shader_ptr)
+        return;
+
+    ComputeKernel kernel = ComputeKernelRegistry::Get().Find(shader_ptr->GetSettings().entry_function);
+    if (!kernel)
+        return;
+
+    m_kernel_dispatches.push_back(KernelDispatch{
+        std::move(kernel),
+        ComputeKernelBindings(*bindings_ptr),
+        compute_state.GetSettings().thread_group_size,
+        thread_groups_count
+    });
+}
+
+void ComputeCommandList::Execute(const CompletedCallback& completed_callback)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::Execute(completed_callback);
+
+    for(const KernelDispatch& kernel_dispatch : m_kernel_dispatches)
+    {
+        ExecuteKernelDispatch(kernel_dispatch);
+    }
+}
+
+void ComputeCommandList::ResetCommandState()
+{
+    META_FUNCTION_TASK();
+    m_kernel_dispatches.clear();
+    Base::ComputeCommandList::ResetCommandState();
+}
+
+void ComputeCommandList::ExecuteKernelDispatch(const KernelDispatch& kernel_dispatch) const
+{
+    META_FUNCTION_TASK();
+    const Rhi::ThreadGroupsCount& groups_count = kernel_dispatch.thread_groups_count;
+    const uint32_t groups_count_xy = groups_count.GetWidth() * groups_count.GetHeight();
+    const uint32_t groups_count_total = groups_count_xy * groups_count.GetDepth();
+    if (!groups_count_total)
+        return;
+
+    // Thread groups are executed in parallel, each group is processed by one task
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(0U, groups_count_total, 1U,
+        [&kernel_dispatch, &groups_count, groups_count_xy](const uint32_t group_index)
+        {
+            META_FUNCTION_TASK();
+            const ComputeThreadGroup thread_group{
+                Point3U(group_index % groups_count.GetWidth(),
+                        (group_index % groups_count_xy) / groups_count.GetWidth(),
+                        group_index / groups_count_xy),
+                kernel_dispatch.thread_group_size
+            };
+            kernel_dispatch.kernel(kernel_dispatch.bindings, thread_group);
+        }
+    );
+    GetBaseCommandQueue().GetBaseContext().GetParallelExecutor().run(task_flow).get();
 }
 
 } // namespace Methane::Graphics::Null
@@ -0,0 +1,155 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/ComputeKernel.cpp
+Null implementation of compute shaders with C++ kernels registered for shader entry points,
+which are executed on CPU by the Null compute command list.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Null/ComputeKernel.h>
+#include <Methane/Graphics/Null/Buffer.h>
+#include <Methane/Graphics/Null/Texture.h>
+
+#include <Methane/Graphics/Base/ProgramBindings.h>
+#include <Methane/Graphics/Types.h>
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+
+namespace Methane::Graphics::Null
+{
+
+ComputeKernelBindings::ComputeKernelBindings(const Base::ProgramBindings& program_bindings)
+{
+    META_FUNCTION_TASK();
+    for(const Rhi::ProgramArgument& program_argument : program_bindings.GetArguments())
+    {
+        const Rhi::IProgramArgumentBinding& argument_binding = program_bindings.Get(program_argument);
+        const std::string argument_name(program_argument.GetName());
+        if (argument_binding.GetSettings().argument.IsRootConstant())
+        {
+            m_root_constant_by_name.try_emplace(argument_name, Rhi::RootConstant::StoreFrom(argument_binding.GetRootConstant()));
+            continue;
+        }
+
+        const Rhi::ResourceViews& resource_views = argument_binding.GetResourceViews();
+        if (!resource_views.empty())
+        {
+            AddResourceView(argument_name, resource_views.front());
+        }
+    }
+}
+
+const Rhi::RootConstant& ComputeKernelBindings::GetRootConstant(std::string_view argument_name) const
+{
+    META_FUNCTION_TASK();
+    const auto root_constant_it = m_root_constant_by_name.find(argument_name);
+    META_CHECK_TRUE_DESCR(root_constant_it != m_root_constant_by_name.end(),
+                          "compute kernel argument '{}' is not bound to root constant", argument_name);
+    return root_constant_it->second;
+}
+
+std::span<std::byte> ComputeKernelBindings::GetBufferData(std::string_view argument_name) const
+{
+    META_FUNCTION_TASK();
+    const auto buffer_data_it = m_buffer_data_by_name.find(argument_name);
+    META_CHECK_TRUE_DESCR(buffer_data_it != m_buffer_data_by_name.end(),
+                          "compute kernel argument '{}' is not bound to buffer", argument_name);
+    return buffer_data_it->second;
+}
+
+ComputeKernelTexture ComputeKernelBindings::GetTexture(std::string_view argument_name) const
+{
+    META_FUNCTION_TASK();
+    const auto texture_it = m_texture_by_name.find(argument_name);
+    META_CHECK_TRUE_DESCR(texture_it != m_texture_by_name.end(),
+                          "compute kernel argument '{}' is not bound to texture", argument_name);
+    return texture_it->second;
+}
+
+void ComputeKernelBindings::AddResourceView(const std::string& argument_name, const Rhi::ResourceView& resource_view)
+{
+    META_FUNCTION_TASK();
+    // Resource view is retained to keep CPU data of the resource alive until dispatch execution
+    m_resource_view_by_name.try_emplace(argument_name, resource_view);
+
+    if (auto* buffer_ptr = dynamic_cast<Buffer*>(&resource_view.GetResource()))
+    {
+        Data::Bytes& buffer_data = buffer_ptr->GetCpuData();
+        const Data::Size data_offset = std::min(resource_view.GetOffset(), static_cast<Data::Size>(buffer_data.size()));
+        const Data::Size data_size   = resource_view.GetSize()
+                                     ? std::min(resource_view.GetSize(), static_cast<Data::Size>(buffer_data.size()) - data_offset)
+                                     : static_cast<Data::Size>(buffer_data.size()) - data_offset;
+        m_buffer_data_by_name.try_emplace(argument_name, std::span<std::byte>(buffer_data).subspan(data_offset, data_size));
+        return;
+    }
+
+    auto* texture_ptr = dynamic_cast<Texture*>(&resource_view.GetResource());
+    if (!texture_ptr)
+        return;
+
+    const Rhi::TextureSettings& texture_settings = texture_ptr->GetSettings();
+    const uint32_t mip_level = resource_view.GetSubresourceIndex().GetMipLevel();
+    const Dimensions mip_dimensions(
+        std::max(1U, texture_settings.dimensions.GetWidth()  >> mip_level),
+        std::max(1U, texture_settings.dimensions.GetHeight() >> mip_level),
+        std::max(1U, texture_settings.dimensions.GetDepth()  >> mip_level)
+    );
+    m_texture_by_name.try_emplace(argument_name, ComputeKernelTexture{
+        std::span<std::byte>(texture_ptr->GetCpuData(resource_view.GetSubresourceIndex())),
+        mip_dimensions,
+        GetPixelSize(texture_settings.pixel_format)
+    });
+}
+
+ComputeKernelRegistry& ComputeKernelRegistry::Get()
+{
+    static ComputeKernelRegistry s_kernel_registry;
+    return s_kernel_registry;
+}
+
+void ComputeKernelRegistry::Register(const Rhi::ShaderEntryFunction& entry_function, const ComputeKernel& kernel)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(static_cast<bool>(kernel), "can not register empty compute kernel");
+    std::scoped_lock lock(m_mutex);
+    m_kernel_by_name.insert_or_assign(GetKernelName(entry_function), kernel);
+}
+
+void ComputeKernelRegistry::Unregister(const Rhi::ShaderEntryFunction& entry_function)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    m_kernel_by_name.erase(GetKernelName(entry_function));
+}
+
+ComputeKernel ComputeKernelRegistry::Find(const Rhi::ShaderEntryFunction& entry_function) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    const auto kernel_it = m_kernel_by_name.find(GetKernelName(entry_function));
+    return kernel_it == m_kernel_by_name.end() ? ComputeKernel() : kernel_it->second;
+}
+
+std::string ComputeKernelRegistry::GetKernelName(const Rhi::ShaderEntryFunction& entry_function)
+{
+    return entry_function.file_name + "::" + entry_function.function_name;
+}
+
+} // namespace Methane::Graphics::Null
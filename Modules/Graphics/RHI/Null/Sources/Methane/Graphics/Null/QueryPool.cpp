@@ -23,10 +23,21 @@ Null GPU query pool implementation.
 
 #include <Methane/Graphics/Null/QueryPool.h>
 #include <Methane/Graphics/Null/CommandQueue.h>
+#include <Methane/Graphics/Base/CommandList.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <chrono>
 
 namespace Methane::Graphics::Null
 {
 
+static Timestamp GetCurrentNanoseconds()
+{
+    return static_cast<Timestamp>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 Query::Query(Base::QueryPool& buffer, Base::CommandList& command_list, Index index, Range data_range)
     : Base::Query(buffer, command_list, index, data_range)
 { }
@@ -35,8 +46,33 @@ TimestampQuery::TimestampQuery(Base::QueryPool& buffer, Base::CommandList& comma
     : Query(buffer, command_list, index, data_range)
 { }
 
+void TimestampQuery::InsertTimestamp()
+{
+    META_FUNCTION_TASK();
+    m_timestamp = GetCurrentNanoseconds();
+}
+
 TimestampQueryPool::TimestampQueryPool(CommandQueue& command_queue, uint32_t max_timestamps_per_frame)
     : Base::QueryPool(command_queue, Type::Timestamp, 1U << 15U, 1U, max_timestamps_per_frame * sizeof(Timestamp), sizeof(Timestamp))
-{ }
+{
+    META_FUNCTION_TASK();
+    // Synthesized GPU timestamps are measured in nanoseconds of CPU clock
+    SetGpuFrequency(1000000000U);
+    Calibrate();
+}
+
+Ptr<Rhi::ITimestampQuery> TimestampQueryPool::CreateTimestampQuery(Rhi::ICommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    return Base::QueryPool::CreateQuery<TimestampQuery>(dynamic_cast<Base::CommandList&>(command_list));
+}
+
+Rhi::ITimestampQueryPool::CalibratedTimestamps TimestampQueryPool::Calibrate()
+{
+    META_FUNCTION_TASK();
+    const Timestamp timestamp = GetCurrentNanoseconds();
+    SetCalibratedTimestamps({ timestamp, timestamp });
+    return GetCalibratedTimestamps();
+}
 
 } // namespace Methane::Graphics::Null
@@ -70,42 +70,16 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
     CommandList::SetRenderState(render_state);
 }
 
-bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
+void RenderCommandList::EncodeDrawIndexed(Primitive, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetVertexBuffers(vertex_buffers, set_resource_barriers))
-        return false;
-
-    return true;
-}
-
-bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
-{
-    META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetIndexBuffer(index_buffer, set_resource_barriers))
-        return false;
-
-    return true;
-}
-
-void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
-                                    uint32_t instance_count, uint32_t start_instance)
-{
-    META_FUNCTION_TASK();
-    if (const DrawingState& drawing_state = GetDrawingState();
-        index_count == 0 && drawing_state.index_buffer_ptr)
-    {
-        index_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
-    }
-
-    Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    m_encoded_draws_count++;
 }
 
-void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
-                             uint32_t instance_count, uint32_t start_instance)
+void RenderCommandList::EncodeDraw(Primitive, uint32_t, uint32_t, uint32_t, uint32_t)
 {
     META_FUNCTION_TASK();
-    Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    m_encoded_draws_count++;
 }
 
 } // namespace Methane::Graphics::Null
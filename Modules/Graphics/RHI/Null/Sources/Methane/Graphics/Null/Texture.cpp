@@ -24,8 +24,11 @@ Null implementation of the texture interface.
 #include <Methane/Graphics/Null/Texture.h>
 #include <Methane/Graphics/Null/RenderContext.h>
 
+#include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Null
 {
 
@@ -41,9 +44,51 @@ Texture::Texture(const RenderContext& render_context, const Settings& settings,
     META_CHECK_EQUAL(frame_index, settings.frame_index_opt.value());
 }
 
-Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&)
+void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources)
+{
+    META_FUNCTION_TASK();
+    Base::Texture::SetData(target_cmd_queue, sub_resources);
+
+    for(const Rhi::SubResource& sub_resource : sub_resources)
+    {
+        ValidateSubResource(sub_resource);
+        const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), GetCpuData(sub_resource.GetIndex()).begin() + data_offset);
+    }
+}
+
+Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range)
 {
-    return {};
+    META_FUNCTION_TASK();
+    ValidateSubResource(sub_resource_index, data_range);
+
+    const Data::Index raw_index = sub_resource_index.GetRawIndex(GetSubresourceCount());
+    if (raw_index >= m_cpu_sub_resources.size() || m_cpu_sub_resources[raw_index].empty())
+        return {};
+
+    const Data::Bytes& sub_resource_data = m_cpu_sub_resources[raw_index];
+    const Data::Index  data_start = data_range ? data_range->GetStart() : 0U;
+    const Data::Index  data_end   = data_range ? data_range->GetEnd()   : static_cast<Data::Index>(sub_resource_data.size());
+    return Rhi::SubResource(Data::Bytes(sub_resource_data.begin() + data_start, sub_resource_data.begin() + data_end),
+                            sub_resource_index, data_range);
+}
+
+Data::Bytes& Texture::GetCpuData(const SubResource::Index& sub_resource_index)
+{
+    META_FUNCTION_TASK();
+    const SubResource::Count& sub_resource_count = GetSubresourceCount();
+    META_CHECK_LESS(sub_resource_index, sub_resource_count);
+    if (m_cpu_sub_resources.empty())
+    {
+        m_cpu_sub_resources.resize(sub_resource_count.GetRawCount());
+    }
+
+    Data::Bytes& sub_resource_data = m_cpu_sub_resources[sub_resource_index.GetRawIndex(sub_resource_count)];
+    if (sub_resource_data.empty())
+    {
+        sub_resource_data.resize(GetSubResourceDataSize(sub_resource_index));
+    }
+    return sub_resource_data;
 }
 
 } // namespace Methane::Graphics::Null
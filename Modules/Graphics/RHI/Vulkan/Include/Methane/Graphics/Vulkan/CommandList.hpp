@@ -175,6 +175,9 @@ public:
         META_FUNCTION_TASK();
         CommandListBaseT::VerifyEncodingState();
 
+        // Pending batched barriers are set first to preserve the order of resource state transitions
+        CommandListBaseT::FlushResourceBarriers();
+
         const auto lock_guard = static_cast<const Base::ResourceBarriers&>(resource_barriers).Lock();
         if (resource_barriers.IsEmpty())
             return;
@@ -248,6 +251,7 @@ public:
     CommandQueue&            GetVulkanCommandQueue() final               { return static_cast<CommandQueue&>(CommandListBaseT::GetBaseCommandQueue()); }
     const CommandQueue&      GetVulkanCommandQueue() const final         { return static_cast<const CommandQueue&>(CommandListBaseT::GetBaseCommandQueue()); }
     vk::PipelineBindPoint    GetNativePipelineBindPoint() const final    { return pipeline_bind_point; }
+    Base::CommandList&       GetBaseCommandList() noexcept final         { return *this; }
     const vk::CommandBuffer& GetNativeCommandBufferDefault() const final { return GetNativeCommandBuffer(default_command_buffer_type); }
     const vk::CommandBuffer& GetNativeCommandBuffer(CommandBufferType cmd_buffer_type) const final
     {
@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.h
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with descriptor sets allocator
+and global bindless descriptor arrays.
 
 ******************************************************************************/
 
@@ -27,6 +28,7 @@ Vulkan descriptor manager with descriptor sets allocator.
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
+#include <array>
 #include <map>
 #include <optional>
 #include <mutex>
@@ -35,6 +37,7 @@ namespace Methane::Graphics::Rhi
 {
 
 struct IProgramBindings;
+struct IResource;
 
 } // namespace Methane::Graphics::Rhi
 
@@ -49,6 +52,7 @@ namespace Methane::Graphics::Vulkan
 {
 
 struct IContext;
+class ResourceView;
 
 class DescriptorManager final
     : public Base::DescriptorManager
@@ -56,6 +60,18 @@ class DescriptorManager final
 public:
     using PoolSizeRatioByDescType = std::map<vk::DescriptorType, float>;
 
+    // Shader resources declared in META_ARG_BINDLESS register space are bound to the global bindless descriptor set
+    static constexpr uint32_t bindless_register_space = 3U;
+
+    struct BindlessSettings
+    {
+        uint32_t textures_count = 16384U; // sampled images at binding 0
+        uint32_t samplers_count = 256U;   // samplers at binding 1
+        uint32_t buffers_count  = 16384U; // storage buffers at binding 2
+    };
+
+    [[nodiscard]] static uint32_t GetBindlessBinding(vk::DescriptorType descriptor_type);
+
     DescriptorManager(Base::Context& context, uint32_t pool_sets_count = 1000U,
                       const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type = {
         { vk::DescriptorType::eSampler,              0.5f },
@@ -72,17 +88,56 @@ public:
     });
 
     // IDescriptorManager overrides
-    void Release() override;
+    void     Release() override;
+    bool     IsBindlessEnabled() const override;
+    uint32_t AcquireBindlessDescriptor(const Rhi::ResourceView& resource_view) override;
+    void     ReleaseBindlessDescriptor(const Rhi::ResourceView& resource_view) override;
 
     void SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio);
     vk::DescriptorSet AllocDescriptorSet(vk::DescriptorSetLayout layout);
 
+    // Bindless descriptors are available when BindlessDescriptors device feature is enabled:
+    // resource views are written once to the global descriptor arrays and get stable indices,
+    // which are passed to shaders with root constants instead of allocating descriptor sets per program bindings
+    void                                         SetBindlessSettings(const BindlessSettings& bindless_settings);
+    [[nodiscard]] const BindlessSettings&        GetBindlessSettings() const noexcept { return m_bindless_settings; }
+    [[nodiscard]] const vk::DescriptorSetLayout& GetBindlessDescriptorSetLayout();
+    [[nodiscard]] const vk::DescriptorSet&       GetBindlessDescriptorSet();
+    [[nodiscard]] uint32_t                       GetBindlessDescriptorsCount(vk::DescriptorType descriptor_type) const;
+
 private:
+    struct BindlessDescriptorKey
+    {
+        vk::ImageView  vk_image_view;
+        vk::Sampler    vk_sampler;
+        vk::Buffer     vk_buffer;
+        vk::DeviceSize buffer_offset = 0U;
+        vk::DeviceSize buffer_range  = 0U;
+
+        bool operator<(const BindlessDescriptorKey& other) const;
+    };
+
+    struct BindlessDescriptorTable
+    {
+        vk::DescriptorType                        vk_descriptor_type;
+        uint32_t                                  capacity = 0U;
+        std::map<BindlessDescriptorKey, uint32_t> index_by_key;
+        std::vector<uint32_t>                     ref_counts; // reference counts of descriptors by index
+        std::vector<uint32_t>                     free_indices;
+    };
+
+    using BindlessDescriptorTables = std::array<BindlessDescriptorTable, 3>;
+
     vk::DescriptorPool CreateDescriptorPool();
     vk::DescriptorPool AcquireDescriptorPool();
-    const IContext&    GetContextVk();
+    const IContext&    GetContextVk() const;
+
+    void                     InitializeBindlessDescriptorSet();
+    uint32_t                 AcquireBindlessDescriptorIndex(const ResourceView& resource_view);
+    void                     TransitionBindlessResource(Rhi::IResource& resource);
+    BindlessDescriptorTable& GetBindlessDescriptorTable(const ResourceView& resource_view, BindlessDescriptorKey& descriptor_key);
 
-    const IContext*                       m_vk_context_ptr = nullptr;
+    mutable const IContext*               m_vk_context_ptr = nullptr;
     uint32_t                              m_pool_sets_count;
     PoolSizeRatioByDescType               m_pool_size_ratio_by_desc_type;
     std::vector<vk::UniqueDescriptorPool> m_vk_descriptor_pools;
@@ -90,6 +145,12 @@ private:
     std::vector<vk::DescriptorPool>       m_vk_free_pools;
     vk::DescriptorPool                    m_vk_current_pool;
     TracyLockable(std::mutex,             m_descriptor_pool_mutex);
+    BindlessSettings                      m_bindless_settings;
+    BindlessDescriptorTables              m_bindless_descriptor_tables;
+    vk::UniqueDescriptorSetLayout         m_vk_bindless_descriptor_set_layout;
+    vk::UniqueDescriptorPool              m_vk_bindless_descriptor_pool;
+    vk::DescriptorSet                     m_vk_bindless_descriptor_set;
+    mutable TracyLockable(std::mutex,     m_bindless_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
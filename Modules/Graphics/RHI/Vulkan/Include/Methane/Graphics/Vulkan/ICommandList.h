@@ -27,6 +27,11 @@ Vulkan command list interface implementation.
 
 #include <vulkan/vulkan.hpp>
 
+namespace Methane::Graphics::Base
+{
+class CommandList;
+}
+
 namespace Methane::Graphics::Vulkan
 {
 
@@ -49,6 +54,7 @@ struct ICommandList
     virtual const vk::CommandBuffer& GetNativeCommandBuffer(CommandBufferType cmd_buffer_type = CommandBufferType::Primary) const = 0;
     virtual vk::PipelineBindPoint GetNativePipelineBindPoint() const = 0;
     virtual void SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) = 0;
+    virtual Base::CommandList& GetBaseCommandList() noexcept = 0;
 
     virtual ~ICommandList() = default;
 };
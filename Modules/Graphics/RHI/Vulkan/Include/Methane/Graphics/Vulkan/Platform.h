@@ -39,6 +39,7 @@ public:
 
     static const std::vector<std::string_view>& GetVulkanInstanceRequiredExtensions();
     static vk::UniqueSurfaceKHR CreateVulkanSurfaceForWindow(const vk::Instance& instance, const Methane::Platform::AppEnvironment& app_env);
+    static bool HasWindow(const Methane::Platform::AppEnvironment& app_env) noexcept;
 
 private:
     static std::vector<std::string_view> GetPlatformInstanceExtensions(const std::vector<std::string_view>& platform_instance_extensions);
@@ -44,6 +44,7 @@ namespace Methane::Graphics::Vulkan
 {
 
 class RenderContext;
+class CommandQueue;
 
 struct IRenderContextCallback
 {
@@ -82,6 +83,8 @@ public:
     // Base::Object overrides
     bool SetName(std::string_view name) override;
 
+    // Render context without window renders to offscreen textures and has no surface and swap-chain
+    bool                    IsOffscreen() const noexcept          { return !m_vk_unique_surface; }
     const vk::SurfaceKHR&   GetNativeSurface() const noexcept     { return m_vk_unique_surface.get(); }
     const vk::SwapchainKHR& GetNativeSwapchain() const noexcept   { return m_vk_unique_swapchain.get(); }
     const vk::Extent2D&     GetNativeFrameExtent() const noexcept { return m_vk_frame_extent; }
@@ -102,6 +105,8 @@ private:
     vk::PresentModeKHR ChooseSwapPresentMode(const std::vector<vk::PresentModeKHR>& available_present_modes) const;
     vk::Extent2D ChooseSwapExtent(const vk::SurfaceCapabilitiesKHR& surface_caps) const;
     void InitializeNativeSwapchain();
+    void InitializeOffscreenFrames();
+    void PresentOffscreen(CommandQueue& render_command_queue, uint32_t frame_buffer_index);
     void ReleaseNativeSwapchainResources();
     void ResetNativeSwapchain();
     void ResetNativeObjectNames() const;
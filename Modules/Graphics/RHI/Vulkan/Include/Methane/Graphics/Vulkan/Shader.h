@@ -32,6 +32,7 @@ Vulkan implementation of the shader interface.
 
 #include <string>
 #include <mutex>
+#include <vector>
 
 namespace spirv_cross // NOSONAR
 {
@@ -53,12 +54,24 @@ class Shader final
     : public Base::Shader
 {
 public:
+    // Locations of descriptor set and binding decorations in SPIRV byte code of bindless descriptor arrays
+    struct BindlessByteCodeMap
+    {
+        vk::DescriptorType descriptor_type;
+        uint32_t           descriptor_set_offset = 0U;
+        uint32_t           binding_offset = 0U;
+    };
+
+    using BindlessByteCodeMaps = std::vector<BindlessByteCodeMap>;
+
     Shader(Type shader_type, const Base::Context& context, const Settings& settings);
     ~Shader() override;
 
     // Base::Shader interface
     Ptrs<Base::ProgramArgumentBinding> GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors) const override;
 
+    BindlessByteCodeMaps GetBindlessByteCodeMaps() const;
+
     const Data::Chunk&                     GetNativeByteCode() const noexcept { return m_byte_code_chunk.AsConstChunk(); }
     const vk::ShaderModule&                GetNativeModule() const;
     const spirv_cross::Compiler&           GetNativeCompiler() const;
@@ -65,4 +65,10 @@ vk::UniqueSurfaceKHR Platform::CreateVulkanSurfaceForWindow(const vk::Instance&
     );
 }
 
+bool Platform::HasWindow(const Methane::Platform::AppEnvironment&) noexcept
+{
+    // Render context on MacOS always presents to Metal application view via MoltenVK
+    return true;
+}
+
 } // namespace Methane::Graphics::Vulkan
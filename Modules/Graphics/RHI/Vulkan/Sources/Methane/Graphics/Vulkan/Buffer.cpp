@@ -113,7 +113,7 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResourc
     const bool is_private_storage = buffer_settings.storage_mode == Rhi::IBuffer::StorageMode::Private;
     const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
 
-    const vk::DeviceSize sub_resource_offset = 0U;
+    const vk::DeviceSize sub_resource_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
     Data::RawPtr sub_resource_data_ptr = nullptr;
     const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
                                                                  reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
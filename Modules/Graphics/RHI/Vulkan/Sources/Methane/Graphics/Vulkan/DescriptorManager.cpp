@@ -17,27 +17,60 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.cpp
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with descriptor sets allocator
+and global bindless descriptor arrays.
 
 ******************************************************************************/
 
 #include <Methane/Graphics/Vulkan/DescriptorManager.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
 #include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/ResourceView.h>
+#include <Methane/Graphics/Vulkan/Utils.hpp>
 
 #include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Graphics/RHI/IResource.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+#include <tuple>
+
 namespace Methane::Graphics::Vulkan
 {
 
+uint32_t DescriptorManager::GetBindlessBinding(vk::DescriptorType descriptor_type)
+{
+    META_FUNCTION_TASK();
+    switch(descriptor_type)
+    {
+    using enum vk::DescriptorType;
+    case eSampledImage:  return 0U;
+    case eSampler:       return 1U;
+    case eStorageBuffer: return 2U;
+    default: META_UNEXPECTED_RETURN_DESCR(descriptor_type, 0U,
+                                          "bindless descriptors support only sampled images, samplers and storage buffers");
+    }
+}
+
+bool DescriptorManager::BindlessDescriptorKey::operator<(const BindlessDescriptorKey& other) const
+{
+    return std::tie(vk_image_view, vk_sampler, vk_buffer, buffer_offset, buffer_range) <
+           std::tie(other.vk_image_view, other.vk_sampler, other.vk_buffer, other.buffer_offset, other.buffer_range);
+}
+
 DescriptorManager::DescriptorManager(Base::Context& context, uint32_t pool_sets_count, const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type)
     : Base::DescriptorManager(context, false)
     , m_pool_sets_count(pool_sets_count)
     , m_pool_size_ratio_by_desc_type(pool_size_ratio_by_desc_type)
+    , m_bindless_descriptor_tables{{
+        { vk::DescriptorType::eSampledImage },
+        { vk::DescriptorType::eSampler },
+        { vk::DescriptorType::eStorageBuffer }
+    }}
 { }
 
 void DescriptorManager::Release()
@@ -54,6 +87,17 @@ void DescriptorManager::Release()
     }
     m_vk_used_pools.clear();
     m_vk_current_pool = nullptr;
+
+    std::scoped_lock bindless_lock_guard(m_bindless_mutex);
+    for(BindlessDescriptorTable& descriptor_table : m_bindless_descriptor_tables)
+    {
+        descriptor_table.index_by_key.clear();
+        descriptor_table.ref_counts.clear();
+        descriptor_table.free_indices.clear();
+    }
+    m_vk_bindless_descriptor_set = nullptr;
+    m_vk_bindless_descriptor_pool.reset();
+    m_vk_bindless_descriptor_set_layout.reset();
 }
 
 void DescriptorManager::SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio)
@@ -95,6 +139,122 @@ vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout
     return descriptor_sets.back();
 }
 
+bool DescriptorManager::IsBindlessEnabled() const
+{
+    META_FUNCTION_TASK();
+    return GetContextVk().GetVulkanDevice().IsBindlessDescriptorsEnabled();
+}
+
+void DescriptorManager::SetBindlessSettings(const BindlessSettings& bindless_settings)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_bindless_mutex);
+    META_CHECK_FALSE_DESCR(static_cast<bool>(m_vk_bindless_descriptor_set), "bindless settings can not be changed after bindless descriptor set initialization");
+    m_bindless_settings = bindless_settings;
+}
+
+const vk::DescriptorSetLayout& DescriptorManager::GetBindlessDescriptorSetLayout()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_bindless_mutex);
+    InitializeBindlessDescriptorSet();
+    return m_vk_bindless_descriptor_set_layout.get();
+}
+
+const vk::DescriptorSet& DescriptorManager::GetBindlessDescriptorSet()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_bindless_mutex);
+    InitializeBindlessDescriptorSet();
+    return m_vk_bindless_descriptor_set;
+}
+
+uint32_t DescriptorManager::AcquireBindlessDescriptor(const Rhi::ResourceView& resource_view)
+{
+    META_FUNCTION_TASK();
+    const ResourceView resource_view_vk(resource_view, Rhi::ResourceUsageMask(Rhi::ResourceUsage::ShaderRead));
+    const uint32_t descriptor_index = AcquireBindlessDescriptorIndex(resource_view_vk);
+
+    // Image descriptors are written with shader-read-only layout, which has to match the resource state in shaders
+    TransitionBindlessResource(resource_view.GetResource());
+    return descriptor_index;
+}
+
+void DescriptorManager::ReleaseBindlessDescriptor(const Rhi::ResourceView& resource_view)
+{
+    META_FUNCTION_TASK();
+    const ResourceView resource_view_vk(resource_view, Rhi::ResourceUsageMask(Rhi::ResourceUsage::ShaderRead));
+    std::scoped_lock lock_guard(m_bindless_mutex);
+
+    BindlessDescriptorKey descriptor_key;
+    BindlessDescriptorTable& descriptor_table = GetBindlessDescriptorTable(resource_view_vk, descriptor_key);
+    const auto index_it = descriptor_table.index_by_key.find(descriptor_key);
+    if (index_it == descriptor_table.index_by_key.end())
+        return;
+
+    const uint32_t descriptor_index = index_it->second;
+    META_CHECK_NOT_ZERO(descriptor_table.ref_counts[descriptor_index]);
+    if (--descriptor_table.ref_counts[descriptor_index])
+        return;
+
+    // Partially bound descriptor is left as is until its index is reused by another resource view
+    descriptor_table.index_by_key.erase(index_it);
+    descriptor_table.free_indices.emplace_back(descriptor_index);
+}
+
+uint32_t DescriptorManager::AcquireBindlessDescriptorIndex(const ResourceView& resource_view)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_bindless_mutex);
+    InitializeBindlessDescriptorSet();
+
+    BindlessDescriptorKey descriptor_key;
+    BindlessDescriptorTable& descriptor_table = GetBindlessDescriptorTable(resource_view, descriptor_key);
+    if (const auto index_it = descriptor_table.index_by_key.find(descriptor_key);
+        index_it != descriptor_table.index_by_key.end())
+    {
+        // Resource view was already written to the bindless descriptors array, so its index is reused without update
+        descriptor_table.ref_counts[index_it->second]++;
+        return index_it->second;
+    }
+
+    uint32_t descriptor_index = 0U;
+    if (descriptor_table.free_indices.empty())
+    {
+        META_CHECK_LESS_DESCR(descriptor_table.ref_counts.size(), descriptor_table.capacity,
+                              "bindless {} descriptors array is full", vk::to_string(descriptor_table.vk_descriptor_type));
+        descriptor_index = static_cast<uint32_t>(descriptor_table.ref_counts.size());
+        descriptor_table.ref_counts.emplace_back(1U);
+    }
+    else
+    {
+        descriptor_index = descriptor_table.free_indices.back();
+        descriptor_table.free_indices.pop_back();
+        descriptor_table.ref_counts[descriptor_index] = 1U;
+    }
+    descriptor_table.index_by_key.try_emplace(descriptor_key, descriptor_index);
+
+    // Descriptor set is created with update-after-bind flag, so it is updated even while bound in executing command lists
+    const vk::WriteDescriptorSet vk_write_descriptor_set(
+        m_vk_bindless_descriptor_set,
+        GetBindlessBinding(descriptor_table.vk_descriptor_type),
+        descriptor_index, 1U,
+        descriptor_table.vk_descriptor_type,
+        resource_view.GetNativeDescriptorImageInfoPtr(),
+        resource_view.GetNativeDescriptorBufferInfoPtr()
+    );
+    GetContextVk().GetVulkanDevice().GetNativeDevice().updateDescriptorSets(vk_write_descriptor_set, {});
+    return descriptor_index;
+}
+
+uint32_t DescriptorManager::GetBindlessDescriptorsCount(vk::DescriptorType descriptor_type) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_bindless_mutex);
+    const BindlessDescriptorTable& descriptor_table = m_bindless_descriptor_tables.at(GetBindlessBinding(descriptor_type));
+    return static_cast<uint32_t>(descriptor_table.index_by_key.size());
+}
+
 vk::DescriptorPool DescriptorManager::CreateDescriptorPool()
 {
     META_FUNCTION_TASK();
@@ -124,7 +284,111 @@ vk::DescriptorPool DescriptorManager::AcquireDescriptorPool()
     return free_pool;
 }
 
-const IContext& DescriptorManager::GetContextVk()
+void DescriptorManager::InitializeBindlessDescriptorSet()
+{
+    META_FUNCTION_TASK();
+    if (m_vk_bindless_descriptor_set)
+        return;
+
+    const Device& device = GetContextVk().GetVulkanDevice();
+    META_CHECK_TRUE_DESCR(device.IsBindlessDescriptorsEnabled(), "bindless descriptors device feature is not enabled");
+
+    // Bindless arrays capacity is limited by the device limits of update-after-bind descriptors
+    const vk::PhysicalDeviceDescriptorIndexingProperties vk_indexing_props = device.GetNativeDescriptorIndexingProperties();
+    m_bindless_descriptor_tables[0].capacity = std::min({ m_bindless_settings.textures_count,
+                                                          vk_indexing_props.maxDescriptorSetUpdateAfterBindSampledImages,
+                                                          vk_indexing_props.maxPerStageDescriptorUpdateAfterBindSampledImages });
+    m_bindless_descriptor_tables[1].capacity = std::min({ m_bindless_settings.samplers_count,
+                                                          vk_indexing_props.maxDescriptorSetUpdateAfterBindSamplers,
+                                                          vk_indexing_props.maxPerStageDescriptorUpdateAfterBindSamplers });
+    m_bindless_descriptor_tables[2].capacity = std::min({ m_bindless_settings.buffers_count,
+                                                          vk_indexing_props.maxDescriptorSetUpdateAfterBindStorageBuffers,
+                                                          vk_indexing_props.maxPerStageDescriptorUpdateAfterBindStorageBuffers });
+
+    std::vector<vk::DescriptorSetLayoutBinding> vk_layout_bindings;
+    std::vector<vk::DescriptorBindingFlags>     vk_binding_flags;
+    std::vector<vk::DescriptorPoolSize>         vk_pool_sizes;
+    for (const BindlessDescriptorTable& descriptor_table : m_bindless_descriptor_tables)
+    {
+        META_CHECK_NOT_ZERO_DESCR(descriptor_table.capacity, "bindless {} descriptors capacity can not be zero",
+                                  vk::to_string(descriptor_table.vk_descriptor_type));
+        vk_layout_bindings.emplace_back(GetBindlessBinding(descriptor_table.vk_descriptor_type), descriptor_table.vk_descriptor_type,
+                                        descriptor_table.capacity, vk::ShaderStageFlagBits::eAll);
+        vk_binding_flags.emplace_back(vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateAfterBind);
+        vk_pool_sizes.emplace_back(descriptor_table.vk_descriptor_type, descriptor_table.capacity);
+    }
+
+    const vk::Device& vk_device = device.GetNativeDevice();
+    const vk::DescriptorSetLayoutBindingFlagsCreateInfo vk_binding_flags_info(vk_binding_flags);
+    vk::DescriptorSetLayoutCreateInfo vk_layout_info(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool, vk_layout_bindings);
+    vk_layout_info.setPNext(&vk_binding_flags_info);
+
+    m_vk_bindless_descriptor_set_layout = vk_device.createDescriptorSetLayoutUnique(vk_layout_info);
+    m_vk_bindless_descriptor_pool       = vk_device.createDescriptorPoolUnique(
+        vk::DescriptorPoolCreateInfo(vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind, 1U, vk_pool_sizes));
+
+    const vk::DescriptorSetLayout vk_layout = m_vk_bindless_descriptor_set_layout.get();
+    const auto vk_descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_bindless_descriptor_pool.get(), 1, &vk_layout));
+    META_CHECK_NOT_EMPTY(vk_descriptor_sets);
+    m_vk_bindless_descriptor_set = vk_descriptor_sets.front();
+
+    SetVulkanObjectName(vk_device, m_vk_bindless_descriptor_set_layout.get(), "Bindless Descriptors Layout");
+    SetVulkanObjectName(vk_device, m_vk_bindless_descriptor_set, "Bindless Descriptors");
+
+    META_LOG("Bindless descriptor set was created with {} textures, {} samplers and {} buffers",
+             m_bindless_descriptor_tables[0].capacity, m_bindless_descriptor_tables[1].capacity, m_bindless_descriptor_tables[2].capacity);
+}
+
+void DescriptorManager::TransitionBindlessResource(Rhi::IResource& resource)
+{
+    META_FUNCTION_TASK();
+    if (resource.GetResourceType() == Rhi::ResourceType::Sampler)
+        return;
+
+    Ptr<Rhi::IResourceBarriers> transition_barriers_ptr;
+    if (!resource.SetState(Rhi::ResourceState::ShaderResource, transition_barriers_ptr) ||
+        !transition_barriers_ptr || transition_barriers_ptr->IsEmpty())
+        return;
+
+    // Resource state is not tracked by bindless descriptor: resources used later in other states
+    // have to be transitioned back to ShaderResource state by the caller before drawing with bindless index
+    const Base::Context& context = GetContext();
+    context.GetUploadCommandKit().GetListForEncoding().SetResourceBarriers(*transition_barriers_ptr);
+    context.RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
+}
+
+DescriptorManager::BindlessDescriptorTable& DescriptorManager::GetBindlessDescriptorTable(const ResourceView& resource_view,
+                                                                                          BindlessDescriptorKey& descriptor_key)
+{
+    META_FUNCTION_TASK();
+    const Rhi::ResourceType resource_type = resource_view.GetResource().GetResourceType();
+    switch(resource_type)
+    {
+    using enum Rhi::ResourceType;
+    case Texture:
+        descriptor_key.vk_image_view = resource_view.GetNativeImageView();
+        return m_bindless_descriptor_tables[GetBindlessBinding(vk::DescriptorType::eSampledImage)];
+
+    case Sampler:
+        descriptor_key.vk_sampler = resource_view.GetNativeDescriptorImageInfoPtr()->sampler;
+        return m_bindless_descriptor_tables[GetBindlessBinding(vk::DescriptorType::eSampler)];
+
+    case Buffer:
+    {
+        const vk::DescriptorBufferInfo* vk_buffer_info_ptr = resource_view.GetNativeDescriptorBufferInfoPtr();
+        META_CHECK_NOT_NULL(vk_buffer_info_ptr);
+        descriptor_key.vk_buffer     = vk_buffer_info_ptr->buffer;
+        descriptor_key.buffer_offset = vk_buffer_info_ptr->offset;
+        descriptor_key.buffer_range  = vk_buffer_info_ptr->range;
+        return m_bindless_descriptor_tables[GetBindlessBinding(vk::DescriptorType::eStorageBuffer)];
+    }
+
+    default:
+        META_UNEXPECTED_RETURN_DESCR(resource_type, m_bindless_descriptor_tables.back(), "resource type is not supported by bindless descriptors");
+    }
+}
+
+const IContext& DescriptorManager::GetContextVk() const
 {
     META_FUNCTION_TASK();
     if (m_vk_context_ptr)
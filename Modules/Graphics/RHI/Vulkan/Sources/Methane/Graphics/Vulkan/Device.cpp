@@ -126,6 +126,24 @@ static bool IsSoftwarePhysicalDevice(const vk::PhysicalDevice& vk_physical_devic
            vk_device_type == vk::PhysicalDeviceType::eCpu;
 }
 
+static bool IsDescriptorIndexingSupported(const vk::PhysicalDevice& vk_physical_device, bool is_extension_supported)
+{
+    META_FUNCTION_TASK();
+    if (!is_extension_supported)
+        return false;
+
+    // Bindless descriptors require runtime-sized descriptor arrays, which are partially bound,
+    // updated after binding to command buffers and indexed non-uniformly in shaders
+    const auto vk_features_chain = vk_physical_device.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeatures>();
+    const auto& vk_indexing_features = vk_features_chain.get<vk::PhysicalDeviceDescriptorIndexingFeatures>();
+    return vk_indexing_features.runtimeDescriptorArray &&
+           vk_indexing_features.descriptorBindingPartiallyBound &&
+           vk_indexing_features.descriptorBindingSampledImageUpdateAfterBind &&
+           vk_indexing_features.descriptorBindingStorageBufferUpdateAfterBind &&
+           vk_indexing_features.shaderSampledImageArrayNonUniformIndexing &&
+           vk_indexing_features.shaderStorageBufferArrayNonUniformIndexing;
+}
+
 static vk::QueueFlags GetQueueFlagsByType(Rhi::CommandListType cmd_list_type)
 {
     META_FUNCTION_TASK();
@@ -213,6 +231,7 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     , m_supported_extension_names_storage(GetDeviceSupportedExtensionNames(vk_physical_device))
     , m_supported_extension_names_set(m_supported_extension_names_storage.begin(), m_supported_extension_names_storage.end())
     , m_is_dynamic_state_supported(IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+    , m_is_descriptor_indexing_supported(IsDescriptorIndexingSupported(vk_physical_device, IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME)))
     , m_vk_queue_family_properties(vk_physical_device.getQueueFamilyProperties())
 {
     META_FUNCTION_TASK();
@@ -256,6 +275,14 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
         enabled_extension_names.emplace_back(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME);
     }
 
+    const bool is_bindless_descriptors_enabled = capabilities.features.HasBit(Rhi::DeviceFeature::BindlessDescriptors);
+    if (is_bindless_descriptors_enabled)
+    {
+        enabled_extension_names.emplace_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+        if (IsExtensionSupported(VK_KHR_MAINTENANCE3_EXTENSION_NAME))
+            enabled_extension_names.emplace_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME);
+    }
+
     std::vector<const char*> raw_enabled_extension_names;
     std::ranges::transform(enabled_extension_names, std::back_inserter(raw_enabled_extension_names),
                    [](const std::string_view& extension_name) { return extension_name.data(); });
@@ -269,6 +296,7 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT vk_device_dynamic_state_feature(m_is_dynamic_state_supported);
     vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR    vk_device_timeline_semaphores_feature(true);
     vk::PhysicalDeviceHostQueryResetFeatures          vk_device_host_query_reset_feature(true);
+    vk::PhysicalDeviceDescriptorIndexingFeatures      vk_device_descriptor_indexing_feature;
     vk::DeviceCreateInfo vk_device_info(
         vk::DeviceCreateFlags{},
         vk_queue_create_infos,
@@ -280,6 +308,18 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     vk_device_dynamic_state_feature.setPNext(&vk_device_timeline_semaphores_feature);
     vk_device_timeline_semaphores_feature.setPNext(&vk_device_host_query_reset_feature);
 
+    if (is_bindless_descriptors_enabled)
+    {
+        vk_device_descriptor_indexing_feature
+            .setRuntimeDescriptorArray(true)
+            .setDescriptorBindingPartiallyBound(true)
+            .setDescriptorBindingSampledImageUpdateAfterBind(true)
+            .setDescriptorBindingStorageBufferUpdateAfterBind(true)
+            .setShaderSampledImageArrayNonUniformIndexing(true)
+            .setShaderStorageBufferArrayNonUniformIndexing(true);
+        vk_device_host_query_reset_feature.setPNext(&vk_device_descriptor_indexing_feature);
+    }
+
     m_vk_unique_device = vk_physical_device.createDeviceUnique(vk_device_info);
     VULKAN_HPP_DEFAULT_DISPATCHER.init(m_vk_unique_device.get());
 }
@@ -316,6 +356,18 @@ bool Device::IsExtensionSupported(std::string_view required_extension) const
     return m_supported_extension_names_set.contains(required_extension);
 }
 
+bool Device::IsBindlessDescriptorsEnabled() const noexcept
+{
+    return GetCapabilities().features.HasBit(Rhi::DeviceFeature::BindlessDescriptors);
+}
+
+vk::PhysicalDeviceDescriptorIndexingProperties Device::GetNativeDescriptorIndexingProperties() const
+{
+    META_FUNCTION_TASK();
+    const auto vk_properties_chain = m_vk_physical_device.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceDescriptorIndexingProperties>();
+    return vk_properties_chain.get<vk::PhysicalDeviceDescriptorIndexingProperties>();
+}
+
 const QueueFamilyReservation* Device::GetQueueFamilyReservationPtr(Rhi::CommandListType cmd_list_type) const noexcept
 {
     META_FUNCTION_TASK();
@@ -411,6 +463,7 @@ Rhi::DeviceFeatureMask Device::GetSupportedFeatures() const
         device_features.SetBit(PresentToWindow,      IsExtensionSupported(VK_KHR_SWAPCHAIN_EXTENSION_NAME));
         device_features.SetBit(AnisotropicFiltering, vk_device_features.samplerAnisotropy);
         device_features.SetBit(ImageCubeArray,       vk_device_features.imageCubeArray);
+        device_features.SetBit(BindlessDescriptors,  m_is_descriptor_indexing_supported);
     }
     return device_features;
 }
@@ -44,4 +44,9 @@ vk::UniqueSurfaceKHR Platform::CreateVulkanSurfaceForWindow(const vk::Instance&
     return instance.createXcbSurfaceKHRUnique(vk::XcbSurfaceCreateInfoKHR({}, env.connection, env.window));
 }
 
+bool Platform::HasWindow(const Methane::Platform::AppEnvironment& env) noexcept
+{
+    return env.connection != nullptr;
+}
+
 } // namespace Methane::Graphics::Vulkan
@@ -280,9 +280,47 @@ void Program::InitializeDescriptorSetLayouts()
 
     m_vk_descriptor_set_layouts = vk::uniqueToRaw(m_vk_unique_descriptor_set_layouts);
 
+    InitializeBindlessDescriptorSetLayout();
     UpdateDescriptorSetLayoutNames();
 }
 
+void Program::InitializeBindlessDescriptorSetLayout()
+{
+    META_FUNCTION_TASK();
+    m_bindless_descriptor_set_index_opt.reset();
+    m_vk_bindless_descriptor_set = nullptr;
+
+    DescriptorManager& descriptor_manager = GetVulkanContext().GetVulkanDescriptorManager();
+    for(Rhi::ShaderType shader_type : GetShaderTypes())
+    {
+        Shader& shader = GetVulkanShader(shader_type);
+        const Shader::BindlessByteCodeMaps bindless_byte_code_maps = shader.GetBindlessByteCodeMaps();
+        if (bindless_byte_code_maps.empty())
+            continue;
+
+        // Global bindless descriptor set is added to pipeline layout after descriptor sets of program arguments
+        if (!m_bindless_descriptor_set_index_opt)
+        {
+            META_CHECK_TRUE_DESCR(descriptor_manager.IsBindlessEnabled(),
+                                  "program shaders use bindless descriptors, but BindlessDescriptors device feature is not enabled");
+            m_bindless_descriptor_set_index_opt = static_cast<uint32_t>(m_vk_descriptor_set_layouts.size());
+            m_vk_descriptor_set_layouts.emplace_back(descriptor_manager.GetBindlessDescriptorSetLayout());
+            m_vk_bindless_descriptor_set = descriptor_manager.GetBindlessDescriptorSet();
+        }
+
+        // Patch shader SPIRV byte code with bindless descriptor set index and descriptor array bindings
+        Data::MutableChunk& spirv_shader_bytecode = shader.GetMutableByteCode();
+        for(const Shader::BindlessByteCodeMap& byte_code_map : bindless_byte_code_maps)
+        {
+            spirv_shader_bytecode.PatchData(byte_code_map.descriptor_set_offset, *m_bindless_descriptor_set_index_opt);
+            spirv_shader_bytecode.PatchData(byte_code_map.binding_offset, DescriptorManager::GetBindlessBinding(byte_code_map.descriptor_type));
+        }
+
+        META_LOG("Program '{}' {} shader uses {} bindless descriptor arrays in descriptor set {}",
+                 GetName(), magic_enum::enum_name(shader_type), bindless_byte_code_maps.size(), *m_bindless_descriptor_set_index_opt);
+    }
+}
+
 void Program::UpdatePipelineName()
 {
     if (!m_vk_unique_pipeline_layout)
@@ -304,10 +342,10 @@ void Program::UpdateDescriptorSetLayoutNames() const
         return;
 
     size_t layout_index = 0u;
-    for (const vk::DescriptorSetLayout& descriptor_set_layout : m_vk_descriptor_set_layouts)
+    for (const vk::UniqueDescriptorSetLayout& descriptor_set_layout : m_vk_unique_descriptor_set_layouts)
     {
         Rhi::ProgramArgumentAccessType access_type = magic_enum::enum_value<Rhi::ProgramArgumentAccessType>(layout_index);
-        SetVulkanObjectName(GetVulkanContext().GetVulkanDevice().GetNativeDevice(), descriptor_set_layout,
+        SetVulkanObjectName(GetVulkanContext().GetVulkanDevice().GetNativeDevice(), descriptor_set_layout.get(),
                             fmt::format("{} {} Arguments Layout", program_name, magic_enum::enum_name(access_type)));
         layout_index++;
     }
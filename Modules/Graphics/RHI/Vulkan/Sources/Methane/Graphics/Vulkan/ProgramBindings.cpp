@@ -238,6 +238,15 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
                                         root_constant_accessor.GetDataPtr());
     }
 
+    // Bind global bindless descriptor set, which descriptors are indexed in shaders with push constants...
+    if (const Opt<uint32_t>& bindless_descriptor_set_index_opt = program.GetBindlessDescriptorSetIndex();
+        bindless_descriptor_set_index_opt && !is_constant_binding_applied)
+    {
+        vk_command_buffer.bindDescriptorSets(vk_pipeline_bind_point, vk_pipeline_layout,
+                                             *bindless_descriptor_set_index_opt,
+                                             program.GetNativeBindlessDescriptorSet(), {});
+    }
+
     // Bind descriptor sets...
     if (m_descriptor_sets.empty())
         return;
@@ -106,13 +106,9 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
     CommandList::SetRenderState(render_state);
 }
 
-bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
+void RenderCommandList::EncodeVertexBuffers(Base::BufferSet& vertex_buffers, bool set_resource_barriers)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetVertexBuffers(vertex_buffers, set_resource_barriers))
-        return false;
-
-    const auto& vk_vertex_buffers = static_cast<const BufferSet&>(vertex_buffers);
     auto& vk_vertex_buffer_set = static_cast<BufferSet&>(vertex_buffers);
     if (const Ptr<Rhi::IResourceBarriers>& buffer_set_setup_barriers_ptr = vk_vertex_buffer_set.GetSetupTransitionBarriers();
         set_resource_barriers && vk_vertex_buffer_set.SetState(Rhi::ResourceState::VertexBuffer) && buffer_set_setup_barriers_ptr)
@@ -120,16 +116,12 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
         SetResourceBarriers(*buffer_set_setup_barriers_ptr);
     }
 
-    GetNativeCommandBufferDefault().bindVertexBuffers(0U, vk_vertex_buffers.GetNativeBuffers(), vk_vertex_buffers.GetNativeOffsets());
-    return true;
+    GetNativeCommandBufferDefault().bindVertexBuffers(0U, vk_vertex_buffer_set.GetNativeBuffers(), vk_vertex_buffer_set.GetNativeOffsets());
 }
 
-bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
+void RenderCommandList::EncodeIndexBuffer(Base::Buffer& index_buffer, bool set_resource_barriers)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetIndexBuffer(index_buffer, set_resource_barriers))
-        return false;
-
     auto& vk_index_buffer = static_cast<Buffer&>(index_buffer);
     if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = vk_index_buffer.GetSetupTransitionBarriers();
         set_resource_barriers && vk_index_buffer.SetState(Rhi::ResourceState::IndexBuffer, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
@@ -139,31 +131,20 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
 
     const vk::IndexType vk_index_type = GetVulkanIndexTypeByStride(index_buffer.GetSettings().item_stride_size);
     GetNativeCommandBufferDefault().bindIndexBuffer(vk_index_buffer.GetNativeResource(), 0U, vk_index_type);
-    return true;
 }
 
-void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
-                                    uint32_t instance_count, uint32_t start_instance)
+void RenderCommandList::EncodeDrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                                          uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
-    if (const DrawingState& drawing_state = GetDrawingState();
-        index_count == 0 && drawing_state.index_buffer_ptr)
-    {
-        index_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
-    }
-
-    Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
-
     UpdatePrimitiveTopology(primitive);
     GetNativeCommandBufferDefault().drawIndexed(index_count, instance_count, start_index, start_vertex, start_instance);
 }
 
-void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
-                             uint32_t instance_count, uint32_t start_instance)
+void RenderCommandList::EncodeDraw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+                                   uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
-    Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
-
     UpdatePrimitiveTopology(primitive);
     GetNativeCommandBufferDefault().draw(vertex_count, instance_count, start_vertex, start_instance);
 }
@@ -173,6 +154,9 @@ void RenderCommandList::Commit()
     META_FUNCTION_TASK();
     META_CHECK_FALSE(IsCommitted());
 
+    // Commands recorded in command stream are encoded before render pass is ended
+    EncodePendingCommands();
+
     if (!IsParallel())
     {
         using enum CommandBufferType;
@@ -55,7 +55,9 @@ RenderContext::RenderContext(const Methane::Platform::AppEnvironment& app_env, D
     : Context<Base::RenderContext>(device, parallel_executor, settings)
     , m_app_env(app_env)
     , m_vk_device(device.GetNativeDevice())
-    , m_vk_unique_surface(Platform::CreateVulkanSurfaceForWindow(static_cast<System&>(Rhi::ISystem::Get()).GetNativeInstance(), app_env))
+    , m_vk_unique_surface(Platform::HasWindow(app_env)
+                          ? Platform::CreateVulkanSurfaceForWindow(static_cast<System&>(Rhi::ISystem::Get()).GetNativeInstance(), app_env)
+                          : vk::UniqueSurfaceKHR())
 { }
 
 #endif // #ifndef __APPLE__
@@ -79,7 +81,11 @@ RenderContext::~RenderContext()
 {
     META_FUNCTION_TASK();
     if (settings.type == Rhi::TextureType::FrameBuffer)
-         return std::make_shared<Texture>(*this, settings, settings.frame_index_opt.value());
+    {
+        META_CHECK_FALSE_DESCR(IsOffscreen(), "frame buffer textures are not available in render context without window, "
+                                              "offscreen render target textures should be used instead");
+        return std::make_shared<Texture>(*this, settings, settings.frame_index_opt.value());
+    }
 
     return Context::CreateTexture(settings);
 }
@@ -166,9 +172,14 @@ void RenderContext::Present()
     Context<Base::RenderContext>::Present();
 
     auto& render_command_queue = static_cast<CommandQueue&>(GetRenderCommandKit().GetQueue());
+    const uint32_t image_index = GetFrameBufferIndex();
+    if (IsOffscreen())
+    {
+        PresentOffscreen(render_command_queue, image_index);
+        return;
+    }
 
     // Present frame to screen
-    const uint32_t image_index = GetFrameBufferIndex();
     const vk::PresentInfoKHR present_info(
         render_command_queue.GetWaitForFrameExecutionCompleted(image_index).semaphores,
         GetNativeSwapchain(), image_index
@@ -249,6 +260,12 @@ const vk::Semaphore& RenderContext::GetNativeFrameImageAvailableSemaphore(Opt<ui
 uint32_t RenderContext::GetNextFrameBufferIndex()
 {
     META_FUNCTION_TASK();
+    if (IsOffscreen())
+    {
+        // Offscreen frame buffers are switched in round-robin order, since there is no swap-chain to acquire images from
+        return (GetFrameBufferIndex() + 1U) % GetSettings().frame_buffers_count;
+    }
+
     const uint32_t frame_sync_index = Base::RenderContext::GetFrameIndex() % m_frame_sync_pool.size();
     const uint32_t await_sync_index = (frame_sync_index + 1U) % m_frame_sync_pool.size();
 
@@ -360,6 +377,11 @@ vk::Extent2D RenderContext::ChooseSwapExtent(const vk::SurfaceCapabilitiesKHR& s
 void RenderContext::InitializeNativeSwapchain()
 {
     META_FUNCTION_TASK();
+    if (IsOffscreen())
+    {
+        InitializeOffscreenFrames();
+        return;
+    }
 
     if (const uint32_t present_queue_family_index = GetVulkanDevice().GetQueueFamilyReservation(Rhi::CommandListType::Render).GetFamilyIndex();
         !GetVulkanDevice().GetNativePhysicalDevice().getSurfaceSupportKHR(present_queue_family_index, GetNativeSurface()))
@@ -433,6 +455,39 @@ void RenderContext::InitializeNativeSwapchain()
     Data::Emitter<IRenderContextCallback>::Emit(&IRenderContextCallback::OnRenderContextSwapchainChanged, std::ref(*this));
 }
 
+void RenderContext::InitializeOffscreenFrames()
+{
+    META_FUNCTION_TASK();
+    const Rhi::RenderContextSettings& settings = GetSettings();
+    m_vk_frame_format = TypeConverter::PixelFormatToVulkan(settings.color_format);
+    m_vk_frame_extent = vk::Extent2D(settings.frame_size.GetWidth(), settings.frame_size.GetHeight());
+
+    // Frame images are not acquired from swap-chain, so command lists do not wait for image available semaphores
+    m_vk_frame_image_available_semaphores.resize(settings.frame_buffers_count);
+    InvalidateFrameBufferIndex(0U);
+
+    Data::Emitter<IRenderContextCallback>::Emit(&IRenderContextCallback::OnRenderContextSwapchainChanged, std::ref(*this));
+}
+
+void RenderContext::PresentOffscreen(CommandQueue& render_command_queue, uint32_t frame_buffer_index)
+{
+    META_FUNCTION_TASK();
+    // Semaphores signalled on frame execution completion are waited by an empty submission instead of frame presentation,
+    // so that they are unsignalled before the next execution of the same command list sets
+    const CommandQueue::WaitInfo& frame_execution_wait_info = render_command_queue.GetWaitForFrameExecutionCompleted(frame_buffer_index);
+    if (!frame_execution_wait_info.semaphores.empty())
+    {
+        render_command_queue.GetNativeQueue().submit(
+            vk::SubmitInfo(frame_execution_wait_info.semaphores, frame_execution_wait_info.stages, {}, {})
+        );
+    }
+
+    render_command_queue.ResetWaitForFrameExecution(frame_buffer_index);
+
+    Context<Base::RenderContext>::OnCpuPresentComplete();
+    UpdateFrameBufferIndex();
+}
+
 void RenderContext::ReleaseNativeSwapchainResources()
 {
     META_FUNCTION_TASK();
@@ -466,7 +521,8 @@ void RenderContext::ResetNativeObjectNames() const
 
     // NOTE: Do not set name of the m_vk_unique_surface because it was not created with m_vk_device,
     // and attempt to set name of the unrelated object may cause crash on some platforms (SIGSEGV on Linux).
-    SetVulkanObjectName(m_vk_device, m_vk_unique_swapchain.get(), context_name);
+    if (m_vk_unique_swapchain)
+        SetVulkanObjectName(m_vk_device, m_vk_unique_swapchain.get(), context_name);
 
     uint32_t frame_index = 0u;
     for (const FrameSync& frame_sync : m_frame_sync_pool)
@@ -26,6 +26,7 @@ Vulkan implementation of the shader interface.
 #include <Methane/Graphics/Vulkan/IContext.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/ProgramBindings.h>
+#include <Methane/Graphics/Vulkan/DescriptorManager.h>
 
 #include <Methane/Data/IProvider.h>
 #include <Methane/Graphics/Base/Context.h>
@@ -34,6 +35,8 @@ Vulkan implementation of the shader interface.
 #include <spirv_cross.hpp>
 #include <spirv_hlsl.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Vulkan
 {
 
@@ -155,6 +158,12 @@ static vk::DescriptorType UpdateDescriptorType(vk::DescriptorType vk_shader_desc
     }
 }
 
+static bool IsBindlessSpirvResource(const spirv_cross::Compiler& spirv_compiler, const spirv_cross::Resource& spirv_resource)
+{
+    META_FUNCTION_TASK();
+    return spirv_compiler.get_decoration(spirv_resource.id, spv::DecorationDescriptorSet) == DescriptorManager::bindless_register_space;
+}
+
 static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spirv_compiler,
                                                 const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
                                                 const vk::DescriptorType vk_descriptor_type,
@@ -171,6 +180,11 @@ static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spi
 
     for (const spirv_cross::Resource& resource : spirv_resources)
     {
+        // Bindless descriptor arrays are not program arguments, they are bound with the global bindless descriptor set
+        if (vk_descriptor_type != vk::DescriptorType::eInlineUniformBlock &&
+            IsBindlessSpirvResource(spirv_compiler, resource))
+            continue;
+
         const spirv_cross::SPIRType& spirv_type = spirv_compiler.get_type(resource.type_id);
         const uint32_t array_size = GetArraySize(spirv_type);
         const uint32_t buffer_size = spirv_type.basetype == spirv_cross::SPIRType::BaseType::Struct
@@ -267,6 +281,43 @@ Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::Progra
     return argument_bindings;
 }
 
+Shader::BindlessByteCodeMaps Shader::GetBindlessByteCodeMaps() const
+{
+    META_FUNCTION_TASK();
+    BindlessByteCodeMaps bindless_byte_code_maps;
+    const spirv_cross::Compiler& spirv_compiler = GetNativeCompiler();
+    const auto add_bindless_byte_code_maps = [&spirv_compiler, &bindless_byte_code_maps]
+                                             (const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
+                                              const vk::DescriptorType vk_descriptor_type)
+    {
+        for (const spirv_cross::Resource& resource : spirv_resources)
+        {
+            if (!IsBindlessSpirvResource(spirv_compiler, resource))
+                continue;
+
+            BindlessByteCodeMap& byte_code_map = bindless_byte_code_maps.emplace_back(BindlessByteCodeMap{ vk_descriptor_type });
+            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationDescriptorSet, byte_code_map.descriptor_set_offset));
+            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationBinding, byte_code_map.binding_offset));
+        }
+    };
+
+    const spirv_cross::ShaderResources spirv_resources = spirv_compiler.get_shader_resources(spirv_compiler.get_active_interface_variables());
+    add_bindless_byte_code_maps(spirv_resources.separate_images,   vk::DescriptorType::eSampledImage);
+    add_bindless_byte_code_maps(spirv_resources.separate_samplers, vk::DescriptorType::eSampler);
+    add_bindless_byte_code_maps(spirv_resources.storage_buffers,   vk::DescriptorType::eStorageBuffer);
+
+    for (const spirv_cross::SmallVector<spirv_cross::Resource>* unsupported_resources_ptr : { &spirv_resources.uniform_buffers,
+                                                                                              &spirv_resources.storage_images,
+                                                                                              &spirv_resources.sampled_images })
+    {
+        META_CHECK_TRUE_DESCR(std::ranges::none_of(*unsupported_resources_ptr,
+                                                   [&spirv_compiler](const spirv_cross::Resource& resource)
+                                                   { return IsBindlessSpirvResource(spirv_compiler, resource); }),
+                              "bindless descriptors support only textures, samplers and structured buffers");
+    }
+    return bindless_byte_code_maps;
+}
+
 const vk::ShaderModule& Shader::GetNativeModule() const
 {
     META_FUNCTION_TASK();
@@ -44,4 +44,9 @@ vk::UniqueSurfaceKHR Platform::CreateVulkanSurfaceForWindow(const vk::Instance&
     return vk_instance.createWin32SurfaceKHRUnique(vk::Win32SurfaceCreateInfoKHR(vk::Win32SurfaceCreateFlagsKHR(), GetModuleHandle(NULL), app_env.window_handle));
 }
 
+bool Platform::HasWindow(const Methane::Platform::AppEnvironment& app_env) noexcept
+{
+    return app_env.window_handle != nullptr;
+}
+
 } // namespace Methane::Graphics::Vulkan
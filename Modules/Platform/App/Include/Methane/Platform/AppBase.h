@@ -27,13 +27,18 @@ Base application interface and platform-independent implementation.
 
 #include <Methane/Platform/AppView.h>
 #include <Methane/Platform/Input/State.h>
+#include <Methane/Platform/Input/ActionsRecorder.h>
+#include <Methane/Platform/Input/ActionsQueue.h>
+#include <Methane/Clock.hpp>
 #include <Methane/Memory.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <CLI/App.hpp>
 
 #include <fmt/format.h>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace tf // NOSONAR
 {
@@ -80,7 +85,7 @@ public:
 
     template<typename FuncType, typename... ArgTypes>
     void ProcessInputWithErrorHandling(FuncType&& func_ptr, ArgTypes&&... args)
-    { ExecuteWithErrorHandling("Application Input", false, m_input_state, std::forward<FuncType>(func_ptr), std::forward<ArgTypes>(args)...); }
+    { ExecuteWithErrorHandling("Application Input", false, GetInputActionController(), std::forward<FuncType>(func_ptr), std::forward<ArgTypes>(args)...); }
 
     tf::Executor&           GetParallelExecutor() const;
     const Settings&         GetPlatformAppSettings() const noexcept { return m_settings; }
@@ -90,11 +95,23 @@ public:
     bool                    IsResizing() const noexcept             { return m_is_resizing; }
     bool                    HasKeyboardFocus() const noexcept       { return m_has_keyboard_focus; }
     bool                    HasError() const noexcept;
+    bool                    IsHeadless() const noexcept             { return m_is_headless; }
+    const std::string&      GetHeadlessDumpDir() const noexcept     { return m_headless_dump_dir; }
+    const IClock&           GetFrameClock() const noexcept          { return m_frame_clock_ptr ? *m_frame_clock_ptr : static_cast<const IClock&>(RealClock::Get()); }
+    uint32_t                GetUpdatedFramesCount() const noexcept  { return m_updated_frames_count; }
+    bool                    IsInputReplaying() const noexcept       { return m_actions_recorder_ptr && m_actions_recorder_ptr->IsReplaying(); }
+    bool                    IsInputQueued() const noexcept          { return m_is_input_queued; }
 
 protected:
     // AppBase interface
     virtual AppView GetView() const = 0;
     virtual void ShowAlert(const Message& msg);
+    virtual void OnHeadlessFrameRendered(uint32_t /*frame_index*/) { /* no frame processing is needed by default */ }
+    virtual void WaitForFrameStart() { /* frames are started without delay by default */ }
+    virtual void OnHeadlessRunCompleted() { /* no frame statistics are written by default */ }
+
+    // Renders fixed number of frames without window and event loop, writes frame timings to the dump directory
+    int RunHeadless(const AppEnvironment& env);
 
     std::string GetControlsHelp() const;
     std::string GetCommandLineHelp() const { return CLI::App::help(); }
@@ -115,6 +132,11 @@ protected:
 
 private:
     bool UpdateAndRender();
+    void WriteHeadlessFrameTimings(const std::vector<double>& frame_times_ms) const;
+    void InitFrameClockAndInputRecording();
+    void SaveInputRecording() const noexcept;
+    Input::IActionController& GetInputActionController() noexcept;
+    Input::IActionController& GetInputTargetController() noexcept;
 
     template<typename ObjectType, typename FuncType, typename... ArgTypes>
     bool ExecuteWithErrorHandling(std::string_view stage_name, bool is_error_deferred, ObjectType& obj, FuncType&& func_ptr, ArgTypes&&... args)
@@ -157,6 +179,17 @@ private:
     bool            m_is_resize_required_to_render = false;
     bool            m_has_keyboard_focus = false;
     Input::State    m_input_state;
+    bool            m_is_headless = false;
+    uint32_t        m_headless_frames_count = 100U;
+    std::string     m_headless_dump_dir;
+    double          m_fixed_time_step_ms = 0.0;
+    std::string     m_record_input_file_path;
+    std::string     m_replay_input_file_path;
+    bool            m_is_input_queued = false;
+    UniquePtr<IClock>                 m_frame_clock_ptr;
+    UniquePtr<Input::ActionsRecorder> m_actions_recorder_ptr;
+    Input::ActionsQueue               m_input_actions_queue;
+    uint32_t                          m_updated_frames_count = 0U;
 
     mutable UniquePtr<tf::Executor> m_parallel_executor_ptr;
 };
@@ -26,6 +26,7 @@ Base application interface and platform-independent implementation.
 #include <Methane/Platform/Logger.h>
 #include <Methane/Platform/Input/Controller.h>
 #include <Methane/ScopeTimer.h>
+#include <Methane/Timer.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 #include <Methane/Version.h>
@@ -35,6 +36,10 @@ Base application interface and platform-independent implementation.
 #include <taskflow/core/executor.hpp>
 
 #include <sstream>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include <numeric>
 #include <vector>
 #include <string_view>
 #include <cstdlib>
@@ -42,6 +47,8 @@ Base application interface and platform-independent implementation.
 namespace Methane::Platform
 {
 
+static const Data::FrameSize g_headless_reference_frame_size{ 1920U, 1080U };
+
 static bool WriteControllerHeaderToHelpStream(std::stringstream& help_stream, const Input::Controller& controller, bool is_first_controller)
 {
     if (!is_first_controller)
@@ -159,6 +166,17 @@ AppBase::AppBase(const AppBase::Settings& settings)
 
     AddRectSizeOption(*this, "-w,--wnd-size", m_settings.size, "Window size in pixels or as ratio of desktop size", true);
     add_option("-f,--full-screen", m_settings.is_full_screen, "Full-screen mode");
+    add_flag("--headless", m_is_headless, "Render offscreen without window for a fixed number of frames (Vulkan on Linux and Windows)");
+    add_option("--frames", m_headless_frames_count, "Number of frames rendered in headless mode");
+    add_option("--dump-dir", m_headless_dump_dir, "Directory for frame timings CSV and frame images written in headless mode");
+    add_option("--fixed-time-step", m_fixed_time_step_ms, "Advance animations by fixed time step in milliseconds per frame instead of real time");
+    add_option("--record-input", m_record_input_file_path, "Record input actions and frame time steps to file for deterministic replay");
+    add_option("--replay-input", m_replay_input_file_path, "Replay input actions and frame time steps from file recorded with --record-input");
+    add_flag("--queued-input", m_is_input_queued, "Queue input actions without blocking and process them in one batch per frame");
+#ifdef METHANE_TRACE_EVENTS_ENABLED
+    add_option_function<std::string>("--trace-events", [](const std::string& file_path) { META_TRACE_EVENTS_OUTPUT_FILE(file_path); },
+                                     "Write trace events of instrumented functions in Chrome JSON format to file on exit");
+#endif
 
 #ifdef __APPLE__
     // When application is opened on MacOS with its Bundle,
@@ -172,6 +190,8 @@ AppBase::~AppBase()
     META_FUNCTION_TASK();
     if (m_parallel_executor_ptr)
         m_parallel_executor_ptr->wait_for_all();
+
+    SaveInputRecording();
 }
 
 int AppBase::Run(const RunArgs& args)
@@ -191,9 +211,64 @@ int AppBase::Run(const RunArgs& args)
         std::cerr << "Failed to parse command line:" << std::endl; // NOSONAR
         return exit(e);
     }
+
+    ExecuteWithErrorHandling("Input Recording Initialization", true, *this, &AppBase::InitFrameClockAndInputRecording);
     return 0;
 }
 
+int AppBase::RunHeadless(const AppEnvironment& env)
+{
+    META_FUNCTION_TASK();
+    META_LOG("\n========================== HEADLESS RUN ==========================");
+
+    // Window size ratios are applied to the reference full HD frame size, since there is no desktop
+    const Data::FrameSize frame_size(
+        GetScaledSize(m_settings.size.GetWidth(),  g_headless_reference_frame_size.GetWidth()),
+        GetScaledSize(m_settings.size.GetHeight(), g_headless_reference_frame_size.GetHeight())
+    );
+    Resize(frame_size, false);
+
+    std::vector<double> frame_times_ms;
+    frame_times_ms.reserve(m_headless_frames_count);
+
+    if (InitContextWithErrorHandling(env, frame_size) && InitWithErrorHandling())
+    {
+        Timer frame_timer;
+        for (uint32_t frame_index = 0U; frame_index < m_headless_frames_count && !HasError(); ++frame_index)
+        {
+            frame_timer.Reset();
+            if (!UpdateAndRenderWithErrorHandling())
+                break;
+
+            frame_times_ms.push_back(frame_timer.GetElapsedSecondsD() * 1000.0);
+            ExecuteWithErrorHandling("Frame Dump", true, *this, &AppBase::OnHeadlessFrameRendered, frame_index);
+        }
+        ExecuteWithErrorHandling("Frame Statistics", true, *this, &AppBase::OnHeadlessRunCompleted);
+    }
+
+    // Frame timings are written even after rendering error, so that partial results could be analyzed
+    ExecuteWithErrorHandling("Frame Timings", true, *this, &AppBase::WriteHeadlessFrameTimings, frame_times_ms);
+
+    if (HasDeferredMessage())
+    {
+        const Message& message = GetDeferredMessage();
+        (message.type == Message::Type::Error ? std::cerr : std::cout) // NOSONAR
+            << message.title << ": " << message.information << std::endl;
+    }
+
+    if (!frame_times_ms.empty())
+    {
+        const double total_time_ms = std::accumulate(frame_times_ms.begin(), frame_times_ms.end(), 0.0);
+        const double average_frame_time_ms = total_time_ms / static_cast<double>(frame_times_ms.size());
+        std::cout << fmt::format("Rendered {} frames of {} x {} in {:.3f} sec: {:.3f} ms per frame, {:.1f} FPS", // NOSONAR
+                                 frame_times_ms.size(), frame_size.GetWidth(), frame_size.GetHeight(), total_time_ms / 1000.0,
+                                 average_frame_time_ms, average_frame_time_ms > 0.0 ? 1000.0 / average_frame_time_ms : 0.0)
+                  << std::endl;
+    }
+
+    return HasError() ? 1 : 0;
+}
+
 void AppBase::Init()
 {
     META_FUNCTION_TASK();
@@ -242,7 +317,8 @@ bool AppBase::Resize(const Data::FrameSize& frame_size, bool is_minimized)
 void AppBase::Alert(const Message& msg, bool deferred)
 {
     META_FUNCTION_TASK();
-    if (!deferred)
+    // There is no message loop in headless mode, so all messages are deferred to be printed on exit
+    if (!deferred && !m_is_headless)
         return;
 
     m_deferred_message_ptr.reset(new Message(msg));
@@ -367,7 +443,21 @@ bool AppBase::UpdateAndRender()
     if (HasError() || m_is_resize_required_to_render)
         return false;
 
+    if (m_frame_clock_ptr)
+        m_frame_clock_ptr->Tick();
+
+    if (m_actions_recorder_ptr)
+        m_actions_recorder_ptr->StartFrame(m_updated_frames_count);
+
+    // Frame start may be delayed by the derived application to sample the latest input
+    WaitForFrameStart();
+
+    // Input actions queued since previous frame are processed in one batch, so that they are recorded with current frame index
+    if (m_is_input_queued)
+        m_input_actions_queue.Dispatch(GetInputTargetController());
+
     Update();
+    ++m_updated_frames_count;
 
     try
     {
@@ -383,4 +473,92 @@ bool AppBase::UpdateAndRender()
     return true;
 }
 
+void AppBase::InitFrameClockAndInputRecording()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_FALSE_DESCR(!m_record_input_file_path.empty() && !m_replay_input_file_path.empty(),
+                           "input can not be recorded and replayed at the same time");
+    META_CHECK_GREATER_OR_EQUAL_DESCR(m_fixed_time_step_ms, 0.0, "fixed time step can not be negative");
+
+    const auto fixed_time_step = std::chrono::duration_cast<IClock::TimeDuration>(std::chrono::duration<double, std::milli>(m_fixed_time_step_ms));
+    if (!m_replay_input_file_path.empty())
+    {
+        Input::ActionsRecording recording = Input::ActionsRecording::LoadFromFile(m_replay_input_file_path);
+        m_actions_recorder_ptr = std::make_unique<Input::ActionsRecorder>(m_input_state, std::move(recording.actions));
+        if (!recording.frame_time_steps.empty())
+            m_frame_clock_ptr = std::make_unique<RecordedClock>(std::move(recording.frame_time_steps));
+        else if (m_fixed_time_step_ms > 0.0)
+            m_frame_clock_ptr = std::make_unique<FixedStepClock>(fixed_time_step);
+        return;
+    }
+
+    // Real frame time steps are recorded to reproduce the same animation timing on replay
+    if (m_fixed_time_step_ms > 0.0)
+        m_frame_clock_ptr = std::make_unique<FixedStepClock>(fixed_time_step);
+    else if (!m_record_input_file_path.empty())
+        m_frame_clock_ptr = std::make_unique<RecordedClock>();
+
+    if (!m_record_input_file_path.empty())
+        m_actions_recorder_ptr = std::make_unique<Input::ActionsRecorder>(m_input_state);
+}
+
+void AppBase::SaveInputRecording() const noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_record_input_file_path.empty() || !m_actions_recorder_ptr || m_actions_recorder_ptr->IsReplaying())
+        return;
+
+    try
+    {
+        Input::ActionsRecording recording{ m_actions_recorder_ptr->GetActions(), {} };
+        if (const auto* recorded_clock_ptr = dynamic_cast<const RecordedClock*>(m_frame_clock_ptr.get()))
+            recording.frame_time_steps = recorded_clock_ptr->GetTimeSteps();
+        else if (const auto* fixed_step_clock_ptr = dynamic_cast<const FixedStepClock*>(m_frame_clock_ptr.get()))
+            recording.frame_time_steps.assign(m_updated_frames_count, fixed_step_clock_ptr->GetTimeStep());
+
+        recording.SaveToFile(m_record_input_file_path);
+    }
+    catch (const std::exception& e) // NOSONAR - general exception type is caught intentionally here
+    {
+        std::cerr << "Failed to save input recording: " << e.what() << std::endl; // NOSONAR
+    }
+}
+
+Input::IActionController& AppBase::GetInputActionController() noexcept
+{
+    // Live input is ignored while recorded input is replayed
+    if (m_is_input_queued && !(m_actions_recorder_ptr && m_actions_recorder_ptr->IsReplaying() && !m_actions_recorder_ptr->IsReplayCompleted()))
+        return m_input_actions_queue;
+
+    return GetInputTargetController();
+}
+
+Input::IActionController& AppBase::GetInputTargetController() noexcept
+{
+    if (m_actions_recorder_ptr && !m_actions_recorder_ptr->IsReplayCompleted())
+        return *m_actions_recorder_ptr;
+
+    return m_input_state;
+}
+
+void AppBase::WriteHeadlessFrameTimings(const std::vector<double>& frame_times_ms) const
+{
+    META_FUNCTION_TASK();
+    if (m_headless_dump_dir.empty())
+        return;
+
+    const std::filesystem::path dump_dir_path(m_headless_dump_dir);
+    std::filesystem::create_directories(dump_dir_path);
+
+    const std::filesystem::path timings_file_path = dump_dir_path / "frame_timings.csv";
+    std::ofstream timings_file(timings_file_path);
+    META_CHECK_TRUE_DESCR(timings_file.is_open(), "failed to open frame timings file '{}'", timings_file_path.string());
+
+    timings_file << "frame,frame_time_ms" << std::endl;
+    for (size_t frame_index = 0U; frame_index < frame_times_ms.size(); ++frame_index)
+    {
+        timings_file << frame_index << "," << fmt::format("{:.4f}", frame_times_ms[frame_index]) << std::endl;
+    }
+}
+
 } // namespace Methane::Platform
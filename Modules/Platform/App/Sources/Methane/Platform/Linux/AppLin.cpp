@@ -52,28 +52,7 @@ namespace Methane::Platform
 
 AppLin::AppLin(const AppBase::Settings& settings)
     : AppBase(settings)
-{
-    META_FUNCTION_TASK();
-
-    m_env.display = XOpenDisplay(nullptr);
-    META_CHECK_NOT_NULL_DESCR(m_env.display, "failed to open X11 display");
-    XSetEventQueueOwner(m_env.display, XCBOwnsEventQueue);
-
-    // Establish connection to X-server
-    m_env.connection = XGetXCBConnection(m_env.display);
-    const int connection_error = xcb_connection_has_error(m_env.connection);
-    META_CHECK_EQUAL_DESCR(connection_error, 0, "XCB connection to display has failed");
-
-    // Find default screen_id setup
-    const xcb_setup_t*    setup = xcb_get_setup(m_env.connection);
-    xcb_screen_iterator_t screen_iter = xcb_setup_roots_iterator(setup);
-    m_env.screen = screen_iter.data;
-    m_env.primary_screen_rect = Linux::GetPrimaryMonitorRect(m_env.connection, m_env.screen->root);
-
-    // Check X11 event synchronization support
-    const xcb_query_extension_reply_t* reply = xcb_get_extension_data(m_env.connection, &xcb_sync_id);
-    m_is_sync_supported = reply && reply->present;
-}
+{ }
 
 AppLin::~AppLin()
 {
@@ -82,7 +61,10 @@ AppLin::~AppLin()
     {
         xcb_destroy_window(m_env.connection, m_env.window);
     }
-    xcb_disconnect(m_env.connection);
+    if (m_env.connection)
+    {
+        xcb_disconnect(m_env.connection);
+    }
 }
 
 int AppLin::Run(const RunArgs& args)
@@ -92,7 +74,12 @@ int AppLin::Run(const RunArgs& args)
         base_return_code)
         return base_return_code;
 
-    // Init window and show on screen
+    // Headless mode does not require X11 display connection
+    if (IsHeadless())
+        return RunHeadless(m_env);
+
+    // Connect to display, init window and show on screen
+    ConnectToDisplay();
     const Data::FrameSize init_frame_size = InitWindow();
 
     // Application Initialization
@@ -142,7 +129,7 @@ void AppLin::Alert(const Message& msg, bool deferred)
 {
     META_FUNCTION_TASK();
     AppBase::Alert(msg, deferred);
-    if (!deferred)
+    if (!deferred && !IsHeadless())
     {
         ShowAlert(msg);
     }
@@ -205,6 +192,9 @@ float AppLin::GetContentScalingFactor() const
 uint32_t AppLin::GetFontResolutionDpi() const
 {
     META_FUNCTION_TASK();
+    if (!m_env.display)
+        return 96U;
+
     if (const char* display_res_str = XResourceManagerString(m_env.display);
         display_res_str)
     {
@@ -240,6 +230,29 @@ void AppLin::ShowAlert(const Message& message)
     }
 }
 
+void AppLin::ConnectToDisplay()
+{
+    META_FUNCTION_TASK();
+    m_env.display = XOpenDisplay(nullptr);
+    META_CHECK_NOT_NULL_DESCR(m_env.display, "failed to open X11 display");
+    XSetEventQueueOwner(m_env.display, XCBOwnsEventQueue);
+
+    // Establish connection to X-server
+    m_env.connection = XGetXCBConnection(m_env.display);
+    const int connection_error = xcb_connection_has_error(m_env.connection);
+    META_CHECK_EQUAL_DESCR(connection_error, 0, "XCB connection to display has failed");
+
+    // Find default screen_id setup
+    const xcb_setup_t*    setup = xcb_get_setup(m_env.connection);
+    xcb_screen_iterator_t screen_iter = xcb_setup_roots_iterator(setup);
+    m_env.screen = screen_iter.data;
+    m_env.primary_screen_rect = Linux::GetPrimaryMonitorRect(m_env.connection, m_env.screen->root);
+
+    // Check X11 event synchronization support
+    const xcb_query_extension_reply_t* reply = xcb_get_extension_data(m_env.connection, &xcb_sync_id);
+    m_is_sync_supported = reply && reply->present;
+}
+
 Data::FrameSize AppLin::InitWindow()
 {
     META_FUNCTION_TASK();
@@ -75,6 +75,9 @@ int AppMac::Run(const RunArgs& args)
     if (base_return_code)
         return base_return_code;
 
+    if (IsHeadless())
+        return RunHeadless(AppEnvironment{});
+
     m_ns_app_delegate = [[AppDelegate alloc] initWithApp:this andSettings: &GetPlatformAppSettings()];
     [m_ns_app setDelegate: m_ns_app_delegate];
     [m_ns_app_delegate run];
@@ -85,6 +88,12 @@ int AppMac::Run(const RunArgs& args)
 void AppMac::Alert(const Message& msg, bool deferred)
 {
     META_FUNCTION_TASK();
+    if (IsHeadless())
+    {
+        AppBase::Alert(msg, deferred);
+        return;
+    }
+
     if (deferred)
     {
         dispatch_async(dispatch_get_main_queue(), ^{
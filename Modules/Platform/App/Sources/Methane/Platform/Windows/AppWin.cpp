@@ -98,6 +98,9 @@ int AppWin::Run(const RunArgs& args)
         base_return_code)
         return base_return_code;
 
+    if (IsHeadless())
+        return RunHeadless(m_env);
+
     // Initialize the window class.
     WNDCLASSEX window_class{};
     window_class.cbSize         = sizeof(WNDCLASSEX);
@@ -182,6 +185,8 @@ void AppWin::Alert(const Message& msg, bool deferred)
 {
     META_FUNCTION_TASK();
     AppBase::Alert(msg, deferred);
+    if (IsHeadless())
+        return;
 
     if (deferred)
     {
@@ -0,0 +1,100 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/Input/ActionsQueue.h
+Lock-free single-producer single-consumer queue of input actions: platform thread pushes actions
+without blocking and application thread dispatches them to the target controller once per frame.
+Actions pushed to the full queue are coalesced to the latest key, button and mouse states, so they are never lost.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ActionsRecorder.h"
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+namespace Methane::Platform::Input
+{
+
+class ActionsQueue final
+    : public IActionController
+{
+public:
+    static constexpr uint32_t default_capacity = 1024U;
+
+    // Capacity is rounded up to the power of two
+    explicit ActionsQueue(uint32_t capacity = default_capacity);
+
+    [[nodiscard]] uint32_t GetCapacity() const noexcept      { return static_cast<uint32_t>(m_actions.size()); }
+    [[nodiscard]] uint32_t GetCoalescedCount() const noexcept { return m_coalesced_count.load(std::memory_order_relaxed); }
+    [[nodiscard]] bool     IsEmpty() const noexcept;
+
+    // Producer thread: returns false when queue is full and action is coalesced with the previously overflowed actions:
+    // key, button, modifiers and mouse states are overwritten with the latest values and scroll deltas are accumulated
+    bool Push(const RecordedAction& action) noexcept;
+
+    // Consumer thread: dispatches all queued actions to the target controller in one batch followed by the coalesced actions,
+    // consecutive mouse position changes are collapsed to the last position; returns number of dispatched actions
+    uint32_t Dispatch(IActionController& target_controller);
+
+    // IActionController producer interface
+    void OnMouseButtonChanged(Mouse::Button button, Mouse::ButtonState button_state) override;
+    void OnMousePositionChanged(const Mouse::Position& mouse_position) override;
+    void OnMouseScrollChanged(const Mouse::Scroll& mouse_scroll_delta) override;
+    void OnMouseInWindowChanged(bool is_mouse_in_window) override;
+    void OnKeyboardChanged(Keyboard::Key key, Keyboard::KeyState key_state) override;
+    void OnModifiersChanged(Keyboard::ModifierMask modifiers) override;
+
+private:
+    // Latest states of overflowed actions: zero value means no state, otherwise state value is incremented by one
+    using CoalescedState = std::atomic<uint32_t>;
+
+    struct CoalescedActions
+    {
+        std::array<CoalescedState, static_cast<size_t>(Keyboard::Key::Count)>  key_states{ };
+        std::array<CoalescedState, static_cast<size_t>(Mouse::Button::Unknown)> button_states{ };
+        CoalescedState       modifiers{ 0U };
+        CoalescedState       mouse_in_window{ 0U };
+        std::atomic<bool>    has_mouse_position{ false };
+        std::atomic<int32_t> mouse_position_x{ 0 };
+        std::atomic<int32_t> mouse_position_y{ 0 };
+        std::atomic<bool>    has_mouse_scroll{ false };
+        std::atomic<float>   mouse_scroll_x{ 0.F };
+        std::atomic<float>   mouse_scroll_y{ 0.F };
+
+        void     Add(const RecordedAction& action) noexcept;
+        uint32_t Dispatch(IActionController& target_controller);
+    };
+
+    // Producer and consumer positions are placed in separate cache lines to avoid false sharing
+    static constexpr size_t cache_line_size = 64U;
+
+    std::vector<RecordedAction> m_actions;
+    const uint32_t              m_index_mask;
+    alignas(cache_line_size) std::atomic<uint32_t> m_write_position{ 0U };
+    alignas(cache_line_size) std::atomic<uint32_t> m_read_position{ 0U };
+    alignas(cache_line_size) std::atomic<bool>     m_is_overflowed{ false };
+    std::atomic<uint32_t>                          m_coalesced_count{ 0U };
+    CoalescedActions                               m_coalesced_actions;
+};
+
+} // namespace Methane::Platform::Input
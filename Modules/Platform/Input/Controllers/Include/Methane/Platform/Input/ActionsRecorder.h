@@ -0,0 +1,110 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/Input/ActionsRecorder.h
+Recorder of input actions with frame indices for deterministic replay
+of application input through the target action controller.
+
+******************************************************************************/
+
+#pragma once
+
+#include "IActionController.h"
+
+#include <Methane/Clock.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace Methane::Platform::Input
+{
+
+struct RecordedAction
+{
+    enum class Type : uint32_t
+    {
+        MouseButton = 0U,
+        MousePosition,
+        MouseScroll,
+        MouseInWindow,
+        Keyboard,
+        Modifiers,
+    };
+
+    uint32_t frame_index = 0U;
+    Type     type        = Type::MouseButton;
+    uint32_t code        = 0U; // mouse button, keyboard key or modifiers mask
+    uint32_t state       = 0U; // button state, key state or mouse in window flag
+    float    x           = 0.F; // mouse position or scroll
+    float    y           = 0.F;
+
+    [[nodiscard]] bool operator==(const RecordedAction& other) const noexcept = default;
+
+    void Dispatch(IActionController& controller) const;
+};
+
+using RecordedActions = std::vector<RecordedAction>;
+
+struct ActionsRecording
+{
+    RecordedActions          actions;
+    RecordedClock::TimeSteps frame_time_steps;
+
+    // Text file with one line per frame time step and per action
+    void SaveToFile(const std::string& file_path) const;
+    [[nodiscard]] static ActionsRecording LoadFromFile(const std::string& file_path);
+};
+
+class ActionsRecorder final
+    : public IActionController
+{
+public:
+    // Recording mode: actions are forwarded to the target controller and recorded with current frame index
+    explicit ActionsRecorder(IActionController& target_controller);
+
+    // Replay mode: live actions are ignored, recorded actions are dispatched to the target controller on frame start
+    ActionsRecorder(IActionController& target_controller, RecordedActions recorded_actions);
+
+    [[nodiscard]] bool                   IsReplaying() const noexcept       { return m_is_replaying; }
+    [[nodiscard]] bool                   IsReplayCompleted() const noexcept { return m_is_replaying && m_replay_action_index >= m_actions.size(); }
+    [[nodiscard]] uint32_t               GetFrameIndex() const noexcept     { return m_frame_index; }
+    [[nodiscard]] const RecordedActions& GetActions() const noexcept        { return m_actions; }
+
+    // Called before each frame update: sets current frame index and dispatches actions recorded for this frame in replay mode
+    void StartFrame(uint32_t frame_index);
+
+    // IActionController
+    void OnMouseButtonChanged(Mouse::Button button, Mouse::ButtonState button_state) override;
+    void OnMousePositionChanged(const Mouse::Position& mouse_position) override;
+    void OnMouseScrollChanged(const Mouse::Scroll& mouse_scroll_delta) override;
+    void OnMouseInWindowChanged(bool is_mouse_in_window) override;
+    void OnKeyboardChanged(Keyboard::Key key, Keyboard::KeyState key_state) override;
+    void OnModifiersChanged(Keyboard::ModifierMask modifiers) override;
+
+private:
+    void Record(const RecordedAction& action);
+
+    IActionController& m_target_controller;
+    const bool         m_is_replaying;
+    RecordedActions    m_actions;
+    size_t             m_replay_action_index = 0U;
+    uint32_t           m_frame_index = 0U;
+};
+
+} // namespace Methane::Platform::Input
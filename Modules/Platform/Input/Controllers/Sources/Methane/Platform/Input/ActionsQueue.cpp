@@ -0,0 +1,241 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/Input/ActionsQueue.cpp
+Lock-free single-producer single-consumer queue of input actions: platform thread pushes actions
+without blocking and application thread dispatches them to the target controller once per frame.
+Actions pushed to the full queue are coalesced to the latest key, button and mouse states, so they are never lost.
+
+******************************************************************************/
+
+#include <Methane/Platform/Input/ActionsQueue.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace Methane::Platform::Input
+{
+
+static void AddAtomic(std::atomic<float>& value, float delta) noexcept
+{
+    float expected_value = value.load(std::memory_order_relaxed);
+    while (!value.compare_exchange_weak(expected_value, expected_value + delta, std::memory_order_relaxed)) { }
+}
+
+template<size_t states_count>
+static void StoreCoalescedState(std::array<std::atomic<uint32_t>, states_count>& states, uint32_t code, uint32_t state) noexcept
+{
+    if (code < states_count)
+        states[code].store(state + 1U, std::memory_order_release);
+}
+
+void ActionsQueue::CoalescedActions::Add(const RecordedAction& action) noexcept
+{
+    META_FUNCTION_TASK();
+    using Type = RecordedAction::Type;
+    switch (action.type)
+    {
+    case Type::MouseButton:
+        StoreCoalescedState(button_states, action.code, action.state);
+        break;
+
+    case Type::MousePosition:
+        mouse_position_x.store(static_cast<int32_t>(action.x), std::memory_order_relaxed);
+        mouse_position_y.store(static_cast<int32_t>(action.y), std::memory_order_relaxed);
+        has_mouse_position.store(true, std::memory_order_release);
+        break;
+
+    case Type::MouseScroll:
+        AddAtomic(mouse_scroll_x, action.x);
+        AddAtomic(mouse_scroll_y, action.y);
+        has_mouse_scroll.store(true, std::memory_order_release);
+        break;
+
+    case Type::MouseInWindow:
+        mouse_in_window.store(action.state + 1U, std::memory_order_release);
+        break;
+
+    case Type::Keyboard:
+        StoreCoalescedState(key_states, action.code, action.state);
+        break;
+
+    case Type::Modifiers:
+        modifiers.store(action.code + 1U, std::memory_order_release);
+        break;
+    }
+}
+
+uint32_t ActionsQueue::CoalescedActions::Dispatch(IActionController& target_controller)
+{
+    META_FUNCTION_TASK();
+    // Coalesced states are reset before dispatching, so that states updated by producer in parallel are dispatched next time
+    uint32_t dispatched_count = 0U;
+    if (const uint32_t in_window_state = mouse_in_window.exchange(0U, std::memory_order_acquire); in_window_state)
+    {
+        target_controller.OnMouseInWindowChanged(in_window_state - 1U != 0U);
+        ++dispatched_count;
+    }
+    if (has_mouse_position.exchange(false, std::memory_order_acquire))
+    {
+        target_controller.OnMousePositionChanged(Mouse::Position(mouse_position_x.load(std::memory_order_relaxed),
+                                                                 mouse_position_y.load(std::memory_order_relaxed)));
+        ++dispatched_count;
+    }
+    if (const uint32_t modifiers_state = modifiers.exchange(0U, std::memory_order_acquire); modifiers_state)
+    {
+        target_controller.OnModifiersChanged(Keyboard::ModifierMask(modifiers_state - 1U));
+        ++dispatched_count;
+    }
+    for (uint32_t button_index = 0U; button_index < button_states.size(); ++button_index)
+    {
+        if (const uint32_t button_state = button_states[button_index].exchange(0U, std::memory_order_acquire); button_state)
+        {
+            target_controller.OnMouseButtonChanged(static_cast<Mouse::Button>(button_index), static_cast<Mouse::ButtonState>(button_state - 1U));
+            ++dispatched_count;
+        }
+    }
+    for (uint32_t key_index = 0U; key_index < key_states.size(); ++key_index)
+    {
+        if (const uint32_t key_state = key_states[key_index].exchange(0U, std::memory_order_acquire); key_state)
+        {
+            target_controller.OnKeyboardChanged(static_cast<Keyboard::Key>(key_index), static_cast<Keyboard::KeyState>(key_state - 1U));
+            ++dispatched_count;
+        }
+    }
+    if (has_mouse_scroll.exchange(false, std::memory_order_acquire))
+    {
+        target_controller.OnMouseScrollChanged(Mouse::Scroll(mouse_scroll_x.exchange(0.F, std::memory_order_relaxed),
+                                                             mouse_scroll_y.exchange(0.F, std::memory_order_relaxed)));
+        ++dispatched_count;
+    }
+    return dispatched_count;
+}
+
+ActionsQueue::ActionsQueue(uint32_t capacity)
+    : m_actions(std::bit_ceil(std::max(capacity, 2U)))
+    , m_index_mask(static_cast<uint32_t>(m_actions.size()) - 1U)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_DESCR(capacity, 0U, "input actions queue capacity must be positive");
+}
+
+bool ActionsQueue::IsEmpty() const noexcept
+{
+    return m_read_position.load(std::memory_order_acquire) == m_write_position.load(std::memory_order_acquire) &&
+           !m_is_overflowed.load(std::memory_order_acquire);
+}
+
+bool ActionsQueue::Push(const RecordedAction& action) noexcept
+{
+    META_FUNCTION_TASK();
+    // Positions grow monotonically and wrap around on overflow, so their difference is the number of queued actions
+    const uint32_t write_position = m_write_position.load(std::memory_order_relaxed);
+    const uint32_t read_position  = m_read_position.load(std::memory_order_acquire);
+    // After overflow actions are coalesced until next dispatch, so that they are never reordered with actions queued later
+    if (m_is_overflowed.load(std::memory_order_relaxed) || write_position - read_position >= GetCapacity())
+    {
+        m_coalesced_actions.Add(action);
+        m_coalesced_count.fetch_add(1U, std::memory_order_relaxed);
+        // Overflow flag is set after coalesced state update to make it visible for consumer resetting the flag
+        m_is_overflowed.store(true, std::memory_order_release);
+        return false;
+    }
+
+    m_actions[write_position & m_index_mask] = action;
+    m_write_position.store(write_position + 1U, std::memory_order_release);
+    return true;
+}
+
+uint32_t ActionsQueue::Dispatch(IActionController& target_controller)
+{
+    META_FUNCTION_TASK();
+    // Overflow flag is reset before loading write position, so that all actions queued before coalesced actions are dispatched first.
+    // Only actions queued before dispatch start are processed, so that producer can not starve the consumer
+    const bool     is_overflowed  = m_is_overflowed.exchange(false, std::memory_order_acq_rel);
+    const uint32_t write_position = m_write_position.load(std::memory_order_acquire);
+    uint32_t       read_position  = m_read_position.load(std::memory_order_relaxed);
+    uint32_t       dispatched_count = 0U;
+
+    try
+    {
+        for (; read_position != write_position; ++read_position)
+        {
+            const RecordedAction action = m_actions[read_position & m_index_mask];
+            if (action.type == RecordedAction::Type::MousePosition && read_position + 1U != write_position &&
+                m_actions[(read_position + 1U) & m_index_mask].type == RecordedAction::Type::MousePosition)
+                continue;
+
+            // Read position is released before dispatching the copied action to free queue space for producer
+            // and to skip the action on next dispatch when target controller throws an exception
+            m_read_position.store(read_position + 1U, std::memory_order_release);
+            action.Dispatch(target_controller);
+            ++dispatched_count;
+        }
+    }
+    catch (...) // NOSONAR - overflow flag is restored for any exception to dispatch coalesced actions next time
+    {
+        if (is_overflowed)
+            m_is_overflowed.store(true, std::memory_order_release);
+        throw;
+    }
+
+    m_read_position.store(read_position, std::memory_order_release);
+    if (is_overflowed)
+        dispatched_count += m_coalesced_actions.Dispatch(target_controller);
+
+    return dispatched_count;
+}
+
+void ActionsQueue::OnMouseButtonChanged(Mouse::Button button, Mouse::ButtonState button_state)
+{
+    Push(RecordedAction{ 0U, RecordedAction::Type::MouseButton,
+                         static_cast<uint32_t>(button), static_cast<uint32_t>(button_state) });
+}
+
+void ActionsQueue::OnMousePositionChanged(const Mouse::Position& mouse_position)
+{
+    Push(RecordedAction{ 0U, RecordedAction::Type::MousePosition, 0U, 0U,
+                         static_cast<float>(mouse_position.GetX()), static_cast<float>(mouse_position.GetY()) });
+}
+
+void ActionsQueue::OnMouseScrollChanged(const Mouse::Scroll& mouse_scroll_delta)
+{
+    Push(RecordedAction{ 0U, RecordedAction::Type::MouseScroll, 0U, 0U,
+                         mouse_scroll_delta.GetX(), mouse_scroll_delta.GetY() });
+}
+
+void ActionsQueue::OnMouseInWindowChanged(bool is_mouse_in_window)
+{
+    Push(RecordedAction{ 0U, RecordedAction::Type::MouseInWindow, 0U, is_mouse_in_window ? 1U : 0U });
+}
+
+void ActionsQueue::OnKeyboardChanged(Keyboard::Key key, Keyboard::KeyState key_state)
+{
+    Push(RecordedAction{ 0U, RecordedAction::Type::Keyboard,
+                         static_cast<uint32_t>(key), static_cast<uint32_t>(key_state) });
+}
+
+void ActionsQueue::OnModifiersChanged(Keyboard::ModifierMask modifiers)
+{
+    Push(RecordedAction{ 0U, RecordedAction::Type::Modifiers, modifiers.GetValue() });
+}
+
+} // namespace Methane::Platform::Input
@@ -0,0 +1,202 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/Input/ActionsRecorder.cpp
+Recorder of input actions with frame indices for deterministic replay
+of application input through the target action controller.
+
+******************************************************************************/
+
+#include <Methane/Platform/Input/ActionsRecorder.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace Methane::Platform::Input
+{
+
+static constexpr char g_time_step_line_tag = 'T';
+static constexpr char g_action_line_tag    = 'A';
+
+void RecordedAction::Dispatch(IActionController& controller) const
+{
+    META_FUNCTION_TASK();
+    switch(type)
+    {
+    case Type::MouseButton:
+        controller.OnMouseButtonChanged(static_cast<Mouse::Button>(code), static_cast<Mouse::ButtonState>(state));
+        break;
+    case Type::MousePosition:
+        controller.OnMousePositionChanged(Mouse::Position(static_cast<int32_t>(x), static_cast<int32_t>(y)));
+        break;
+    case Type::MouseScroll:
+        controller.OnMouseScrollChanged(Mouse::Scroll(x, y));
+        break;
+    case Type::MouseInWindow:
+        controller.OnMouseInWindowChanged(state != 0U);
+        break;
+    case Type::Keyboard:
+        controller.OnKeyboardChanged(static_cast<Keyboard::Key>(code), static_cast<Keyboard::KeyState>(state));
+        break;
+    case Type::Modifiers:
+        controller.OnModifiersChanged(Keyboard::ModifierMask(code));
+        break;
+    default:
+        META_UNEXPECTED(type);
+    }
+}
+
+void ActionsRecording::SaveToFile(const std::string& file_path) const
+{
+    META_FUNCTION_TASK();
+    std::ofstream recording_file(file_path);
+    META_CHECK_TRUE_DESCR(recording_file.is_open(), "failed to open input recording file '{}' for writing", file_path);
+
+    recording_file << std::setprecision(std::numeric_limits<float>::max_digits10);
+    for(const RecordedClock::TimeDuration& time_step : frame_time_steps)
+    {
+        recording_file << g_time_step_line_tag << ' '
+                       << std::chrono::duration_cast<std::chrono::nanoseconds>(time_step).count() << '\n';
+    }
+    for(const RecordedAction& action : actions)
+    {
+        recording_file << g_action_line_tag << ' ' << action.frame_index << ' ' << static_cast<uint32_t>(action.type) << ' '
+                       << action.code << ' ' << action.state << ' ' << action.x << ' ' << action.y << '\n';
+    }
+}
+
+ActionsRecording ActionsRecording::LoadFromFile(const std::string& file_path)
+{
+    META_FUNCTION_TASK();
+    std::ifstream recording_file(file_path);
+    META_CHECK_TRUE_DESCR(recording_file.is_open(), "failed to open input recording file '{}' for reading", file_path);
+
+    ActionsRecording recording;
+    std::string line;
+    while(std::getline(recording_file, line))
+    {
+        if (line.empty())
+            continue;
+
+        std::istringstream line_stream(line);
+        char line_tag = 0;
+        line_stream >> line_tag;
+        if (line_tag == g_time_step_line_tag)
+        {
+            int64_t time_step_ns = 0;
+            line_stream >> time_step_ns;
+            recording.frame_time_steps.emplace_back(
+                std::chrono::duration_cast<RecordedClock::TimeDuration>(std::chrono::nanoseconds(time_step_ns)));
+        }
+        else if (line_tag == g_action_line_tag)
+        {
+            RecordedAction action;
+            uint32_t action_type = 0U;
+            line_stream >> action.frame_index >> action_type >> action.code >> action.state >> action.x >> action.y;
+            META_CHECK_LESS_OR_EQUAL_DESCR(action_type, static_cast<uint32_t>(RecordedAction::Type::Modifiers),
+                                           "invalid input action type in recording file '{}'", file_path);
+            action.type = static_cast<RecordedAction::Type>(action_type);
+            META_CHECK_TRUE_DESCR(recording.actions.empty() || recording.actions.back().frame_index <= action.frame_index,
+                                  "input actions in recording file '{}' are not ordered by frame index", file_path);
+            recording.actions.push_back(action);
+        }
+        META_CHECK_FALSE_DESCR(line_stream.fail(), "invalid line '{}' in input recording file '{}'", line, file_path);
+    }
+    return recording;
+}
+
+ActionsRecorder::ActionsRecorder(IActionController& target_controller)
+    : m_target_controller(target_controller)
+    , m_is_replaying(false)
+{ }
+
+ActionsRecorder::ActionsRecorder(IActionController& target_controller, RecordedActions recorded_actions)
+    : m_target_controller(target_controller)
+    , m_is_replaying(true)
+    , m_actions(std::move(recorded_actions))
+{ }
+
+void ActionsRecorder::StartFrame(uint32_t frame_index)
+{
+    META_FUNCTION_TASK();
+    m_frame_index = frame_index;
+    if (!m_is_replaying)
+        return;
+
+    for(; m_replay_action_index < m_actions.size() && m_actions[m_replay_action_index].frame_index <= frame_index; ++m_replay_action_index)
+    {
+        m_actions[m_replay_action_index].Dispatch(m_target_controller);
+    }
+}
+
+void ActionsRecorder::OnMouseButtonChanged(Mouse::Button button, Mouse::ButtonState button_state)
+{
+    META_FUNCTION_TASK();
+    Record(RecordedAction{ m_frame_index, RecordedAction::Type::MouseButton,
+                           static_cast<uint32_t>(button), static_cast<uint32_t>(button_state) });
+}
+
+void ActionsRecorder::OnMousePositionChanged(const Mouse::Position& mouse_position)
+{
+    META_FUNCTION_TASK();
+    Record(RecordedAction{ m_frame_index, RecordedAction::Type::MousePosition, 0U, 0U,
+                           static_cast<float>(mouse_position.GetX()), static_cast<float>(mouse_position.GetY()) });
+}
+
+void ActionsRecorder::OnMouseScrollChanged(const Mouse::Scroll& mouse_scroll_delta)
+{
+    META_FUNCTION_TASK();
+    Record(RecordedAction{ m_frame_index, RecordedAction::Type::MouseScroll, 0U, 0U,
+                           mouse_scroll_delta.GetX(), mouse_scroll_delta.GetY() });
+}
+
+void ActionsRecorder::OnMouseInWindowChanged(bool is_mouse_in_window)
+{
+    META_FUNCTION_TASK();
+    Record(RecordedAction{ m_frame_index, RecordedAction::Type::MouseInWindow, 0U, is_mouse_in_window ? 1U : 0U });
+}
+
+void ActionsRecorder::OnKeyboardChanged(Keyboard::Key key, Keyboard::KeyState key_state)
+{
+    META_FUNCTION_TASK();
+    Record(RecordedAction{ m_frame_index, RecordedAction::Type::Keyboard,
+                           static_cast<uint32_t>(key), static_cast<uint32_t>(key_state) });
+}
+
+void ActionsRecorder::OnModifiersChanged(Keyboard::ModifierMask modifiers)
+{
+    META_FUNCTION_TASK();
+    Record(RecordedAction{ m_frame_index, RecordedAction::Type::Modifiers, modifiers.GetValue() });
+}
+
+void ActionsRecorder::Record(const RecordedAction& action)
+{
+    META_FUNCTION_TASK();
+    if (m_is_replaying)
+        return;
+
+    m_actions.push_back(action);
+    action.Dispatch(m_target_controller);
+}
+
+} // namespace Methane::Platform::Input
@@ -43,6 +43,9 @@ Platform abstraction of keyboard events.
 
 #include <array>
 #include <set>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
 #include <string_view>
 #include <ostream>
@@ -164,7 +167,114 @@ enum class KeyState : uint8_t
     Pressed
 };
 
-using KeyStates = std::array<KeyState, static_cast<size_t>(Key::Count) - 1>;
+// Set of keys packed in bit mask words, so that key states are compared, diffed and counted with a few word operations
+class KeyMask
+{
+public:
+    using Word = uint64_t;
+
+    static constexpr size_t keys_count  = static_cast<size_t>(Key::Count) - 1;
+    static constexpr size_t word_bits   = sizeof(Word) * 8U;
+    static constexpr size_t words_count = (keys_count + word_bits - 1U) / word_bits;
+
+    using Words = std::array<Word, words_count>;
+
+    KeyMask() = default;
+    KeyMask(std::initializer_list<Key> keys) noexcept
+    {
+        for (Key key : keys)
+        {
+            Set(key, true);
+        }
+    }
+
+    [[nodiscard]] friend auto operator<=>(const KeyMask& left, const KeyMask& right) noexcept = default;
+
+    [[nodiscard]] friend KeyMask operator^(KeyMask left, const KeyMask& right) noexcept
+    {
+        for (size_t word_index = 0; word_index < words_count; ++word_index)
+            left.m_words[word_index] ^= right.m_words[word_index];
+        return left;
+    }
+
+    [[nodiscard]] friend KeyMask operator|(KeyMask left, const KeyMask& right) noexcept
+    {
+        for (size_t word_index = 0; word_index < words_count; ++word_index)
+            left.m_words[word_index] |= right.m_words[word_index];
+        return left;
+    }
+
+    [[nodiscard]] friend KeyMask operator&(KeyMask left, const KeyMask& right) noexcept
+    {
+        for (size_t word_index = 0; word_index < words_count; ++word_index)
+            left.m_words[word_index] &= right.m_words[word_index];
+        return left;
+    }
+
+    [[nodiscard]] bool IsSet(Key key) const noexcept
+    {
+        const auto key_index = static_cast<size_t>(key);
+        return key_index < keys_count && (m_words[key_index / word_bits] & GetKeyBit(key_index)) != 0U;
+    }
+
+    // Unknown key is not stored in mask
+    void Set(Key key, bool is_set) noexcept
+    {
+        const auto key_index = static_cast<size_t>(key);
+        if (key_index >= keys_count)
+            return;
+
+        if (Word& word = m_words[key_index / word_bits]; is_set)
+            word |= GetKeyBit(key_index);
+        else
+            word &= ~GetKeyBit(key_index);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        Word words_union = 0U;
+        for (Word word : m_words)
+            words_union |= word;
+        return words_union == 0U;
+    }
+
+    [[nodiscard]] size_t GetCount() const noexcept
+    {
+        size_t keys_set_count = 0U;
+        for (Word word : m_words)
+            keys_set_count += static_cast<size_t>(std::popcount(word));
+        return keys_set_count;
+    }
+
+    template<typename FuncType>
+    void ForEachKey(FuncType&& func) const
+    {
+        for (size_t word_index = 0; word_index < words_count; ++word_index)
+        {
+            for (Word word = m_words[word_index]; word != 0U; word &= word - 1U)
+            {
+                func(static_cast<Key>(word_index * word_bits + static_cast<size_t>(std::countr_zero(word))));
+            }
+        }
+    }
+
+    [[nodiscard]] Keys GetKeys() const
+    {
+        Keys keys;
+        ForEachKey([&keys](Key key) { keys.insert(keys.end(), key); });
+        return keys;
+    }
+
+    [[nodiscard]] const Words& GetWords() const noexcept { return m_words; }
+
+private:
+    [[nodiscard]] static constexpr Word GetKeyBit(size_t key_index) noexcept { return Word{ 1U } << (key_index % word_bits); }
+
+    Words m_words{};
+};
+
+// Pressed keys are set in mask, released keys are not
+using KeyStates = KeyMask;
 
 class State
 {
@@ -189,7 +299,7 @@ public:
         return os;
     }
 
-    [[nodiscard]] const  KeyState& operator[](Key key) const noexcept { return m_key_states[static_cast<size_t>(key)]; }
+    [[nodiscard]] KeyState operator[](Key key) const noexcept         { return m_key_states.IsSet(key) ? KeyState::Pressed : KeyState::Released; }
     [[nodiscard]] explicit operator std::string() const               { return ToString(); }
     [[nodiscard]] explicit operator bool() const noexcept;
 
@@ -199,10 +309,12 @@ public:
     void PressKey(Key key)                         { SetKey(key, KeyState::Pressed); }
     void ReleaseKey(Key key)                       { SetKey(key, KeyState::Released); }
 
-    [[nodiscard]] Keys             GetPressedKeys() const noexcept;
-    [[nodiscard]] const KeyStates& GetKeyStates() const noexcept     { return m_key_states; }
-    [[nodiscard]] ModifierMask     GetModifiersMask() const noexcept { return m_modifiers_mask; }
+    [[nodiscard]] Keys             GetPressedKeys() const;
+    [[nodiscard]] size_t           GetPressedKeysCount() const noexcept { return m_key_states.GetCount(); }
+    [[nodiscard]] const KeyStates& GetKeyStates() const noexcept        { return m_key_states; }
+    [[nodiscard]] ModifierMask     GetModifiersMask() const noexcept    { return m_modifiers_mask; }
     [[nodiscard]] PropertyMask     GetDiff(const State& other) const noexcept;
+    [[nodiscard]] KeyMask          GetChangedKeys(const State& other) const noexcept { return m_key_states ^ other.m_key_states; }
     [[nodiscard]] std::string      ToString() const;
 
 private:
@@ -223,13 +335,13 @@ public:
 
     KeyType SetKey(Key key, KeyState key_state) override;
 
-    [[nodiscard]] const Keys& GetPressedModifierKeys() const { return m_pressed_modifier_keys; }
-    [[nodiscard]] Keys        GetAllPressedKeys() const;
+    [[nodiscard]] const KeyMask& GetPressedModifierKeys() const noexcept { return m_pressed_modifier_keys; }
+    [[nodiscard]] Keys           GetAllPressedKeys() const;
 
 private:
-    void SetModifierKey(Key key, KeyState key_state);
+    void SetModifierKey(Key key, KeyState key_state) noexcept;
 
-    Keys m_pressed_modifier_keys;
+    KeyMask m_pressed_modifier_keys;
 };
 
 struct StateChange
@@ -250,8 +250,7 @@ State::State(std::initializer_list<Key> pressed_keys, ModifierMask modifiers_mas
 State::operator bool() const noexcept
 {
     META_FUNCTION_TASK();
-    static const State s_empty_state;
-    return *this != s_empty_state;
+    return m_modifiers_mask != ModifierMask{} || !m_key_states.IsEmpty();
 }
 
 State::PropertyMask State::GetDiff(const State& other) const noexcept
@@ -286,9 +285,8 @@ KeyType State::SetKeyImpl(Key key, KeyState key_state)
         return KeyType::Modifier;
     }
 
-    const auto key_index = static_cast<size_t>(key);
-    META_CHECK_LESS(key_index, m_key_states.size());
-    m_key_states[key_index] = key_state;
+    META_CHECK_LESS(static_cast<size_t>(key), KeyMask::keys_count);
+    m_key_states.Set(key, key_state == KeyState::Pressed);
     return KeyType::Common;
 }
 
@@ -301,19 +299,10 @@ void State::UpdateModifiersMask(ModifierMask modifier, bool add_modifier) noexce
         m_modifiers_mask &= ~modifier;
 }
 
-Keys State::GetPressedKeys() const noexcept
+Keys State::GetPressedKeys() const
 {
     META_FUNCTION_TASK();
-    Keys pressed_keys;
-    for (size_t key_index = 0; key_index < m_key_states.size(); ++key_index)
-    {
-        if (m_key_states[key_index] != KeyState::Pressed)
-            continue;
-
-        const auto key = static_cast<Key>(key_index);
-        pressed_keys.insert(key);
-    }
-    return pressed_keys;
+    return m_key_states.GetKeys();
 }
 
 StateExt::StateExt(std::initializer_list<Key> pressed_keys, ModifierMask modifiers_mask)
@@ -338,25 +327,16 @@ KeyType StateExt::SetKey(Key key, KeyState key_state)
     return KeyType::Modifier;
 }
 
-void StateExt::SetModifierKey(Key key, KeyState key_state)
+void StateExt::SetModifierKey(Key key, KeyState key_state) noexcept
 {
     META_FUNCTION_TASK();
-    if (key_state == KeyState::Pressed)
-    {
-        m_pressed_modifier_keys.insert(key);
-    }
-    else
-    {
-        m_pressed_modifier_keys.erase(key);
-    }
+    m_pressed_modifier_keys.Set(key, key_state == KeyState::Pressed);
 }
 
 Keys StateExt::GetAllPressedKeys() const
 {
     META_FUNCTION_TASK();
-    Keys all_pressed_keys = GetPressedKeys();
-    all_pressed_keys.insert(m_pressed_modifier_keys.begin(), m_pressed_modifier_keys.end());
-    return all_pressed_keys;
+    return (GetKeyStates() | m_pressed_modifier_keys).GetKeys();
 }
 
 std::string State::ToString() const
@@ -379,19 +359,15 @@ std::string State::ToString() const
     }
 
     // Serialize regular keys
-    for (size_t key_index = 0; key_index < m_key_states.size(); ++key_index)
+    m_key_states.ForEachKey([&ss, &is_first_key](Key key)
     {
-        if (m_key_states[key_index] != KeyState::Pressed)
-            continue;
-        
         if (!is_first_key)
             ss << g_keys_separator;
-        
-        const auto key = static_cast<Key>(key_index);
+
         ss << KeyConverter(key).ToString();
         is_first_key = false;
-    }
-    
+    });
+
     return ss.str();
 }
 
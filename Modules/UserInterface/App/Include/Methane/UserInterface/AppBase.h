@@ -27,6 +27,7 @@ Base implementation of the Methane user interface application.
 
 #include <Methane/UserInterface/FontLibrary.h>
 #include <Methane/UserInterface/HeadsUpDisplay.h>
+#include <Methane/UserInterface/BatchRenderer.h>
 #include <Methane/Checks.hpp>
 
 #include <string_view>
@@ -80,6 +81,7 @@ protected:
 
     [[nodiscard]] HeadsUpDisplay::Settings& GetHeadsUpDisplaySettings()        { return m_app_settings.hud_settings; }
     [[nodiscard]] HeadsUpDisplay*           GetHeadsUpDisplay() const noexcept { return m_hud_ptr.get(); }
+    [[nodiscard]] const BatchRenderer&      GetOverlayBatchRenderer() const noexcept { return m_batch_renderer; }
 
     [[nodiscard]] IApp::Settings& GetAppSettings() noexcept                    { return m_app_settings; }
     [[nodiscard]] const Context&  GetUIContext() const                         { META_CHECK_NOT_NULL(m_ui_context_ptr); return *m_ui_context_ptr; }
@@ -95,6 +97,7 @@ private:
 
         void Update(const FrameSize& frame_size) const;
         void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr) const;
+        void Draw(const BatchRenderer& batch_renderer) const;
         void Reset(bool forget_text_string);
     };
 
@@ -112,6 +115,7 @@ private:
     UnitPoint           m_window_padding;
     Ptr<Badge>          m_logo_badge_ptr;
     Ptr<HeadsUpDisplay> m_hud_ptr;
+    BatchRenderer       m_batch_renderer;
     Opt<Font>           m_main_font_opt;
     std::string         m_help_text_str;
     HelpTextPanels      m_help_columns;
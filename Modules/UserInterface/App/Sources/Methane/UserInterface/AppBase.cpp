@@ -92,6 +92,12 @@ void AppBase::InitUI(const Platform::IApp& app, const rhi::CommandQueue& render_
         );
     }
 
+    // Create batch renderer drawing all overlay widgets with a few draw calls
+    if (m_app_settings.batch_rendering_enabled)
+    {
+        m_batch_renderer = BatchRenderer(*m_ui_context_ptr);
+    }
+
     // Create heads-up-display (HUD)
     m_app_settings.hud_settings.position = m_app_settings.window_padding;
     if (m_app_settings.heads_up_display_mode == HeadsUpDisplayMode::UserInterface)
@@ -121,6 +127,7 @@ void AppBase::ReleaseUI()
     m_help_columns.first.Reset(false);
     m_help_columns.second.Reset(false);
     m_parameters.Reset(false);
+    m_batch_renderer = {};
     m_ui_context_ptr.reset();
 }
 
@@ -159,6 +166,25 @@ void AppBase::RenderOverlay(const rhi::RenderCommandList& cmd_list) const
     META_FUNCTION_TASK();
     META_DEBUG_GROUP_VAR(s_debug_group, "Overlay Rendering");
 
+    if (m_batch_renderer.IsInitialized())
+    {
+        // Overlay quads are batched by texture in the same order as widgets are drawn separately
+        m_batch_renderer.Begin();
+
+        if (m_hud_ptr && m_app_settings.heads_up_display_mode == HeadsUpDisplayMode::UserInterface)
+            m_hud_ptr->Draw(m_batch_renderer);
+
+        m_help_columns.first.Draw(m_batch_renderer);
+        m_help_columns.second.Draw(m_batch_renderer);
+        m_parameters.Draw(m_batch_renderer);
+
+        if (m_logo_badge_ptr)
+            m_logo_badge_ptr->Draw(m_batch_renderer);
+
+        m_batch_renderer.Draw(cmd_list, &s_debug_group);
+        return;
+    }
+
     if (m_hud_ptr && m_app_settings.heads_up_display_mode == HeadsUpDisplayMode::UserInterface)
         m_hud_ptr->Draw(cmd_list, &s_debug_group);
 
@@ -192,6 +218,19 @@ void AppBase::TextPanel::Draw(const rhi::RenderCommandList& cmd_list, const rhi:
     }
 }
 
+void AppBase::TextPanel::Draw(const BatchRenderer& batch_renderer) const
+{
+    META_FUNCTION_TASK();
+    if (panel_ptr)
+    {
+        panel_ptr->Draw(batch_renderer);
+    }
+    if (text_ptr)
+    {
+        text_ptr->Draw(batch_renderer);
+    }
+}
+
 void AppBase::TextPanel::Reset(bool forget_text_string)
 {
     META_FUNCTION_TASK();
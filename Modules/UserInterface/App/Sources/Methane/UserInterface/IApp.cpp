@@ -82,4 +82,11 @@ AppSettings& AppSettings::SetHudSettings(const HeadsUpDisplay::Settings& new_hud
     return *this;
 }
 
+AppSettings& AppSettings::SetBatchRenderingEnabled(bool new_batch_rendering_enabled) noexcept
+{
+    META_FUNCTION_TASK();
+    batch_rendering_enabled = new_batch_rendering_enabled;
+    return *this;
+}
+
 } // namespace Methane::UserInterface
@@ -0,0 +1,110 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/BatchRenderer.h
+User interface batch renderer merging textured and colored screen quads
+of multiple widgets into a single dynamic vertex stream drawn per material.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/UserInterface/Types.hpp>
+#include <Methane/Graphics/Color.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Pimpl.h>
+
+#include <span>
+
+namespace Methane::Graphics::Rhi
+{
+class Texture;
+class RenderPattern;
+class RenderCommandList;
+class CommandListDebugGroup;
+}
+
+namespace Methane::UserInterface
+{
+
+namespace rhi = Methane::Graphics::Rhi;
+
+class Context;
+
+enum class BatchQuadMode : uint32_t
+{
+    Color = 0U,           // quad is filled with color, texture is not sampled
+    RgbaTexture,          // texture color is modulated with quad color
+    AlphaTexture,         // texture red channel is used as an alpha of quad color (glyphs and R-float textures)
+    DistanceFieldTexture, // texture red channel is a signed distance to glyph edge converted to alpha of quad color
+};
+
+struct BatchQuad
+{
+    FloatRect     screen_rect;   // quad rectangle in pixels with origin in top-left corner of the frame
+    FloatRect     texcoord_rect  { 0.F, 0.F, 1.F, 1.F };
+    Color4F       color          { 1.F, 1.F, 1.F, 1.F };
+    BatchQuadMode mode           = BatchQuadMode::Color;
+};
+
+struct BatchStatistics
+{
+    uint32_t quads_count                = 0U;
+    uint32_t materials_count            = 0U; // unique textures of the drawn quads
+    uint32_t draw_calls_count           = 0U; // draw calls issued by batch renderer
+    uint32_t unbatched_draw_calls_count = 0U; // draw calls which would be issued by drawing widgets one by one
+};
+
+class BatchRenderer // NOSONAR - manual copy, move constructors and assignment operators
+{
+public:
+    using QuadMode   = BatchQuadMode;
+    using Quad       = BatchQuad;
+    using Statistics = BatchStatistics;
+
+    META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE_NO_INLINE(BatchRenderer);
+
+    BatchRenderer(Context& ui_context, const rhi::RenderPattern& render_pattern);
+    explicit BatchRenderer(Context& ui_context);
+
+    bool IsInitialized() const noexcept { return static_cast<bool>(m_impl_ptr); }
+
+    // Clears quads collected for the previous frame and begins collecting quads of the current frame
+    void Begin() const;
+
+    // Adds quads drawn by one widget with the same texture, which would otherwise require a separate draw call.
+    // Quads with Color mode may be added without texture, while textured modes require initialized texture.
+    // Optional clip rectangle in pixels replaces scissor rectangle of the widget drawn separately.
+    void AddQuads(std::span<const Quad> quads, const rhi::Texture* texture_ptr = nullptr, const FloatRect* clip_rect_ptr = nullptr) const;
+    void AddQuad(const Quad& quad, const rhi::Texture* texture_ptr = nullptr, const FloatRect* clip_rect_ptr = nullptr) const;
+
+    // Uploads collected quads to the current frame vertex and index buffers and draws them with one DrawIndexed call
+    // per batch of quads with the same material (texture). Widget quads are appended to the previous batch of the same
+    // material only when they do not overlap quads added after that batch, so the result is the same as drawing widgets
+    // one by one in order of addition.
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
+
+    [[nodiscard]] const Statistics& GetStatistics() const META_PIMPL_NOEXCEPT;
+
+private:
+    class Impl;
+
+    Ptr<Impl> m_impl_ptr;
+};
+
+} // namespace Methane::UserInterface
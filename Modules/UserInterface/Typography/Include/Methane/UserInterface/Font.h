@@ -51,11 +51,19 @@ struct FontDescription
     uint32_t    size_pt;
 };
 
+enum class FontRenderMode : uint32_t
+{
+    Bitmap = 0U,         // glyphs are rasterized to coverage bitmaps of the exact font size and resolution
+    SignedDistanceField, // glyphs are rendered to signed distance fields, which can be drawn with any text size
+};
+
 struct FontSettings
 {
     FontDescription description;
     uint32_t        resolution_dpi;
     std::u32string  characters;
+    FontRenderMode  render_mode        = FontRenderMode::Bitmap;
+    uint32_t        distance_spread_px = 4U; // distance range in pixels encoded around glyph edges in SDF render mode
 };
 
 class FreeTypeError
@@ -92,6 +100,7 @@ public:
     using Description = FontDescription;
     using Settings    = FontSettings;
     using Library     = FontLibrary;
+    using RenderMode  = FontRenderMode;
 
     [[nodiscard]] static std::u32string ConvertUtf8To32(std::string_view text);
     [[nodiscard]] static std::string    ConvertUtf32To8(std::u32string_view text);
@@ -106,6 +115,7 @@ public:
     Font(const Library& font_lib, const Data::IProvider& data_provider, const Settings& settings);
 
     [[nodiscard]] const Settings& GetSettings() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] bool IsDistanceField() const META_PIMPL_NOEXCEPT;
 
     void Connect(Data::Receiver<IFontCallback>& receiver) const;
     void Disconnect(Data::Receiver<IFontCallback>& receiver) const;
@@ -91,6 +91,10 @@ struct TextSettings // NOSONAR
     // NOTE: State name should be different in case of render state incompatibility between Text objects
     std::string state_name = "Screen Text Render State";
 
+    // Text font size in points, which may differ from the font atlas size only for signed distance field fonts,
+    // so that one distance field atlas is shared by texts of different sizes; zero value means font atlas size
+    uint32_t    font_size_pt = 0U;
+
     TextSettings& SetName(std::string_view new_name) noexcept                                         { name = new_name; return *this; }
     TextSettings& SetText(const StringType& new_text) noexcept                                        { text = new_text; return *this; }
     TextSettings& SetRect(const UnitRect& new_rect) noexcept                                          { rect = new_rect; return *this; }
@@ -100,6 +104,7 @@ struct TextSettings // NOSONAR
     TextSettings& SetAdjustVerticalContentOffset(bool new_adjust_offset) noexcept                     { adjust_vertical_content_offset = new_adjust_offset; return *this; }
     TextSettings& SetMeshBuffersReservationMultiplier(Data::Size new_reservation_multiplier) noexcept { mesh_buffers_reservation_multiplier = new_reservation_multiplier; return *this; }
     TextSettings& SetStateName(std::string_view new_state_name) noexcept                              { state_name = new_state_name; return *this; }
+    TextSettings& SetFontSize(uint32_t new_font_size_pt) noexcept                                     { font_size_pt = new_font_size_pt; return *this; }
 };
 
 struct ITextCallback
@@ -111,6 +116,7 @@ struct ITextCallback
 
 class Context;
 class Font;
+class BatchRenderer;
 
 namespace rhi = Methane::Graphics::Rhi;
 
@@ -159,6 +165,9 @@ public:
     void Update(const gfx::FrameSize& frame_size) const;
     void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
 
+    // Adds text glyph quads to the batch renderer instead of drawing them with a separate draw call
+    void Draw(const BatchRenderer& batch_renderer) const;
+
 private:
     class Impl;
 
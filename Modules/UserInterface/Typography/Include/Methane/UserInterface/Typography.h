@@ -24,4 +24,5 @@ Methane user interface typography headers.
 #pragma once
 
 #include "Font.h"
-#include "Text.h"
\ No newline at end of file
+#include "Text.h"
+#include "BatchRenderer.h"
\ No newline at end of file
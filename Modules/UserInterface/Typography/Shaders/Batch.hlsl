@@ -0,0 +1,73 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: MethaneKit/Modules/UserInterface/Typography/Shaders/Batch.hlsl
+Shaders for batched rendering of user interface quads with per-vertex color and quad mode
+
+******************************************************************************/
+
+// Quad modes encoded in texcoord.z component, must match BatchQuadMode enum values
+#define QUAD_MODE_COLOR                  0U
+#define QUAD_MODE_RGBA_TEXTURE           1U
+#define QUAD_MODE_ALPHA_TEXTURE          2U
+#define QUAD_MODE_DISTANCE_FIELD_TEXTURE 3U
+
+struct VSInput
+{
+    float2 position         : POSITION;
+    float3 texcoord         : TEXCOORD;
+    float4 color            : COLOR;
+};
+
+struct PSInput
+{
+    float4 position         : SV_POSITION;
+    float3 texcoord         : TEXCOORD;
+    float4 color            : COLOR;
+};
+
+Texture2D<float4> g_texture : register(t0, META_ARG_CONSTANT);
+SamplerState      g_sampler : register(s0, META_ARG_CONSTANT);
+
+PSInput BatchVS(VSInput input)
+{
+    PSInput output;
+    output.position = float4(input.position, 0.F, 1.F);
+    output.texcoord = input.texcoord;
+    output.color    = input.color;
+    return output;
+}
+
+float4 BatchPS(PSInput input) : SV_TARGET
+{
+    const float4 texel     = g_texture.Sample(g_sampler, input.texcoord.xy);
+    const uint   quad_mode = (uint)(input.texcoord.z + 0.5F);
+    if (quad_mode == QUAD_MODE_COLOR)
+        return input.color;
+
+    if (quad_mode == QUAD_MODE_ALPHA_TEXTURE)
+        return float4(input.color.rgb, input.color.a * texel.r);
+
+    if (quad_mode == QUAD_MODE_DISTANCE_FIELD_TEXTURE)
+    {
+        const float edge_width = max(fwidth(texel.r) * 0.5F, 0.0001F);
+        return float4(input.color.rgb, input.color.a * smoothstep(0.5F - edge_width, 0.5F + edge_width, texel.r));
+    }
+
+    return input.color * texel;
+}
@@ -53,3 +53,12 @@ float4 TextPS(PSInput input) : SV_TARGET
     const float glyph_alpha = g_texture.Sample(g_sampler, input.texcoord);
     return float4(g_constants.color.rgb, g_constants.color.a * glyph_alpha);
 }
+
+float4 TextSdfPS(PSInput input) : SV_TARGET
+{
+    // Glyph edge is at 0.5 distance, anti-aliasing width is adjusted to screen-space derivative of distance
+    const float distance    = g_texture.Sample(g_sampler, input.texcoord);
+    const float edge_width  = max(fwidth(distance) * 0.5F, 0.0001F);
+    const float glyph_alpha = smoothstep(0.5F - edge_width, 0.5F + edge_width, distance);
+    return float4(g_constants.color.rgb, g_constants.color.a * glyph_alpha);
+}
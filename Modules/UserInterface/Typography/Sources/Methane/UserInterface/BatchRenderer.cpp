@@ -0,0 +1,596 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/BatchRenderer.cpp
+User interface batch renderer merging textured and colored screen quads
+of multiple widgets into a single dynamic vertex stream drawn per material.
+
+******************************************************************************/
+
+#include <Methane/UserInterface/BatchRenderer.h>
+#include <Methane/UserInterface/Context.h>
+
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ObjectRegistry.h>
+#include <Methane/Graphics/Types.h>
+#include <Methane/Data/AppResourceProviders.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+#include <Methane/Pimpl.hpp>
+
+#include <vector>
+#include <array>
+#include <map>
+#include <algorithm>
+#include <iterator>
+
+namespace Methane::UserInterface
+{
+
+struct BatchVertex
+{
+    Data::RawVector2F position; // normalized device coordinates
+    Data::RawVector3F texcoord; // texture coordinates in xy and quad mode in z
+    Data::RawVector4F color;
+};
+
+using BatchIndex    = uint32_t;
+using BatchVertices = std::vector<BatchVertex>;
+using BatchIndices  = std::vector<BatchIndex>;
+
+static constexpr uint32_t g_quad_vertices_count = 4U;
+static constexpr uint32_t g_quad_indices_count  = 6U;
+
+[[nodiscard]] static bool AreRectsOverlapping(const FloatRect& left, const FloatRect& right) noexcept
+{
+    return left.GetLeft() < right.GetRight() && right.GetLeft() < left.GetRight() &&
+           left.GetTop() < right.GetBottom() && right.GetTop() < left.GetBottom();
+}
+
+[[nodiscard]] static FloatRect GetBoundingRect(const FloatRect& left, const FloatRect& right) noexcept
+{
+    const float min_x = std::min(left.GetLeft(),   right.GetLeft());
+    const float min_y = std::min(left.GetTop(),    right.GetTop());
+    const float max_x = std::max(left.GetRight(),  right.GetRight());
+    const float max_y = std::max(left.GetBottom(), right.GetBottom());
+    return FloatRect(min_x, min_y, max_x - min_x, max_y - min_y);
+}
+
+// Clips quad by rectangle with proportional adjustment of texture coordinates,
+// which gives the same result as drawing with scissor rectangle; returns false when quad is clipped entirely
+[[nodiscard]] static bool ClipQuad(BatchQuad& quad, const FloatRect& clip_rect)
+{
+    const FloatRect& screen_rect = quad.screen_rect;
+    const float left   = std::max(screen_rect.GetLeft(),   clip_rect.GetLeft());
+    const float top    = std::max(screen_rect.GetTop(),    clip_rect.GetTop());
+    const float right  = std::min(screen_rect.GetRight(),  clip_rect.GetRight());
+    const float bottom = std::min(screen_rect.GetBottom(), clip_rect.GetBottom());
+    if (left >= right || top >= bottom)
+        return false;
+
+    if (left == screen_rect.GetLeft() && top == screen_rect.GetTop() &&
+        right == screen_rect.GetRight() && bottom == screen_rect.GetBottom())
+        return true;
+
+    const FloatRect& tex_rect = quad.texcoord_rect;
+    const float u_scale = tex_rect.size.GetWidth()  / screen_rect.size.GetWidth();
+    const float v_scale = tex_rect.size.GetHeight() / screen_rect.size.GetHeight();
+    const float tex_left   = tex_rect.GetLeft() + (left   - screen_rect.GetLeft()) * u_scale;
+    const float tex_top    = tex_rect.GetTop()  + (top    - screen_rect.GetTop())  * v_scale;
+    const float tex_right  = tex_rect.GetLeft() + (right  - screen_rect.GetLeft()) * u_scale;
+    const float tex_bottom = tex_rect.GetTop()  + (bottom - screen_rect.GetTop())  * v_scale;
+
+    quad.screen_rect   = FloatRect(left, top, right - left, bottom - top);
+    quad.texcoord_rect = FloatRect(tex_left, tex_top, tex_right - tex_left, tex_bottom - tex_top);
+    return true;
+}
+
+class BatchFrameResources
+{
+public:
+    explicit BatchFrameResources(uint32_t frame_index)
+        : m_frame_index(frame_index)
+    { }
+
+    [[nodiscard]] const rhi::BufferSet& GetVertexBufferSet() const noexcept { return m_vertex_buffer_set; }
+    [[nodiscard]] const rhi::Buffer&    GetIndexBuffer() const noexcept     { return m_index_buffer; }
+
+    void UpdateBuffers(const rhi::RenderContext& render_context, const BatchVertices& vertices, const BatchIndices& indices,
+                       Data::Size reservation_multiplier)
+    {
+        META_FUNCTION_TASK();
+        const rhi::CommandQueue& render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+
+        const auto vertices_data_size = static_cast<Data::Size>(vertices.size() * sizeof(BatchVertex));
+        META_CHECK_NOT_ZERO(vertices_data_size);
+
+        if (!m_vertex_buffer_set.IsInitialized() || m_vertex_buffer_set[0].GetDataSize() < vertices_data_size)
+        {
+            rhi::Buffer vertex_buffer = render_context.CreateBuffer(
+                rhi::BufferSettings::ForVertexBuffer(vertices_data_size * reservation_multiplier, static_cast<Data::Size>(sizeof(BatchVertex)), true));
+            vertex_buffer.SetName(fmt::format("UI Batch Vertex Buffer {}", m_frame_index));
+            m_vertex_buffer_set = rhi::BufferSet(rhi::BufferType::Vertex, { vertex_buffer });
+        }
+        m_vertex_buffer_set[0].SetData(render_cmd_queue, {
+            rhi::SubResource(
+                reinterpret_cast<Data::ConstRawPtr>(vertices.data()), vertices_data_size, // NOSONAR
+                rhi::SubResource::Index(), rhi::BytesRange(0U, vertices_data_size)
+            )
+        });
+
+        const auto indices_data_size = static_cast<Data::Size>(indices.size() * sizeof(BatchIndex));
+        META_CHECK_NOT_ZERO(indices_data_size);
+
+        if (!m_index_buffer.IsInitialized() || m_index_buffer.GetDataSize() < indices_data_size)
+        {
+            m_index_buffer = render_context.CreateBuffer(
+                rhi::BufferSettings::ForIndexBuffer(indices_data_size * reservation_multiplier, gfx::PixelFormat::R32Uint, true));
+            m_index_buffer.SetName(fmt::format("UI Batch Index Buffer {}", m_frame_index));
+        }
+        m_index_buffer.SetData(render_cmd_queue, {
+            rhi::SubResource(
+                reinterpret_cast<Data::ConstRawPtr>(indices.data()), indices_data_size, // NOSONAR
+                rhi::SubResource::Index(), rhi::BytesRange(0U, indices_data_size)
+            )
+        });
+    }
+
+    const rhi::ProgramBindings& GetProgramBindings(const rhi::RenderState& render_state, const rhi::Sampler& sampler, const rhi::Texture& texture)
+    {
+        META_FUNCTION_TASK();
+        MaterialBindings& material_bindings = m_bindings_by_texture[std::addressof(texture.GetInterface())];
+        material_bindings.is_used = true;
+        if (material_bindings.program_bindings.IsInitialized())
+            return material_bindings.program_bindings;
+
+        using enum rhi::ShaderType;
+        material_bindings.texture = texture;
+        material_bindings.program_bindings = render_state.GetProgram().CreateBindings({
+            { { Pixel, "g_texture" }, texture.GetResourceView() },
+            { { Pixel, "g_sampler" }, sampler.GetResourceView() },
+        });
+        material_bindings.program_bindings.SetName(fmt::format("UI Batch '{}' Bindings {}", texture.GetName(), m_frame_index));
+        return material_bindings.program_bindings;
+    }
+
+    // Releases program bindings of textures which were not drawn in the last frame, like reset font atlas textures
+    void ReleaseUnusedProgramBindings()
+    {
+        META_FUNCTION_TASK();
+        for(auto bindings_it = m_bindings_by_texture.begin(); bindings_it != m_bindings_by_texture.end();)
+        {
+            if (!bindings_it->second.is_used)
+            {
+                bindings_it = m_bindings_by_texture.erase(bindings_it);
+                continue;
+            }
+            bindings_it->second.is_used = false;
+            ++bindings_it;
+        }
+    }
+
+private:
+    struct MaterialBindings
+    {
+        rhi::Texture         texture; // holds texture from destruction while it is referenced by program bindings
+        rhi::ProgramBindings program_bindings;
+        bool                 is_used = false;
+    };
+
+    uint32_t                                           m_frame_index;
+    rhi::BufferSet                                     m_vertex_buffer_set;
+    rhi::Buffer                                        m_index_buffer;
+    std::map<const rhi::ITexture*, MaterialBindings>   m_bindings_by_texture;
+};
+
+class BatchRenderer::Impl
+{
+private:
+    struct Material
+    {
+        rhi::Texture texture;
+    };
+
+    // Consecutive range of quads drawn with one draw call
+    struct DrawBatch
+    {
+        uint32_t  material_index;
+        uint32_t  quads_count = 0U;
+        FloatRect bounds;       // bounding rectangle of all batch quads
+    };
+
+    struct BatchedQuad
+    {
+        Quad     quad;
+        uint32_t batch_index;
+    };
+
+    using PerFrameResources = std::vector<BatchFrameResources>;
+
+    // Minimize number of vertex/index buffer re-allocations on growing quads count by reserving additional size
+    static constexpr Data::Size s_buffers_reservation_multiplier = 2U;
+
+    Context&                  m_ui_context;
+    rhi::RenderState          m_render_state;
+    rhi::ViewState            m_view_state;
+    FrameSize                 m_view_frame_size;
+    rhi::Sampler              m_sampler;
+    rhi::Texture              m_white_texture;
+    PerFrameResources         m_frame_resources;
+    std::vector<Material>     m_materials;
+    std::vector<DrawBatch>    m_batches;
+    std::vector<BatchedQuad>  m_quads;
+    std::vector<Quad>         m_clipped_quads;
+    BatchVertices             m_vertices;
+    BatchIndices              m_indices;
+    Statistics                m_statistics;
+
+public:
+    Impl(Context& ui_context, const rhi::RenderPattern& render_pattern)
+        : m_ui_context(ui_context)
+    {
+        META_FUNCTION_TASK();
+        const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+        rhi::ObjectRegistry gfx_objects_registry = render_context.GetObjectRegistry();
+
+        static const std::string s_state_name = "UI Batch Render State";
+        m_render_state = gfx_objects_registry.GetGraphicsObject<rhi::RenderState>(s_state_name);
+        if (m_render_state.IsInitialized())
+        {
+            META_CHECK_EQUAL_DESCR(m_render_state.GetSettings().render_pattern_ptr->GetSettings(), render_pattern.GetSettings(),
+                                   "UI batch render state '{}' from cache has incompatible render pattern settings", s_state_name);
+        }
+        else
+        {
+            rhi::RenderState::Settings state_settings
+            {
+                .program = rhi::Program(
+                    render_context,
+                    rhi::Program::Settings
+                    {
+                        .shader_set = rhi::Program::ShaderSet
+                        {
+                            { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Batch", "BatchVS" }, {} } },
+                            { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Batch", "BatchPS" }, {} } },
+                        },
+                        .input_buffer_layouts = rhi::ProgramInputBufferLayouts
+                        {
+                            rhi::Program::InputBufferLayout
+                            {
+                                rhi::Program::InputBufferLayout::ArgumentSemantics{ "POSITION", "TEXCOORD", "COLOR" }
+                            }
+                        },
+                        .argument_accessors = rhi::ProgramArgumentAccessors{ },
+                        .attachment_formats = render_pattern.GetAttachmentFormats()
+                    }),
+                .render_pattern = render_pattern,
+                .rasterizer = rhi::RasterizerSettings
+                {
+                    .cull_mode = rhi::RasterizerCullMode::None
+                },
+                .depth = rhi::DepthSettings
+                {
+                    .enabled       = false,
+                    .write_enabled = false
+                },
+                .blending = rhi::BlendingSettings
+                {
+                    .render_targets = rhi::BlendingSettings::RenderTargets
+                    {{
+                        rhi::RenderTargetSettings
+                        {
+                            .blend_enabled             = true,
+                            .source_rgb_blend_factor   = Graphics::Rhi::BlendingFactor::SourceAlpha,
+                            .source_alpha_blend_factor = Graphics::Rhi::BlendingFactor::Zero,
+                            .dest_rgb_blend_factor     = Graphics::Rhi::BlendingFactor::OneMinusSourceAlpha,
+                            .dest_alpha_blend_factor   = Graphics::Rhi::BlendingFactor::Zero
+                        }
+                    }}
+                }
+            };
+            state_settings.program.SetName("UI Batch Shading");
+
+            m_render_state = render_context.CreateRenderState(state_settings);
+            m_render_state.SetName(s_state_name);
+
+            gfx_objects_registry.AddGraphicsObject(m_render_state);
+        }
+
+        static const std::string s_sampler_name = "UI Batch Sampler";
+        m_sampler = gfx_objects_registry.GetGraphicsObject<rhi::Sampler>(s_sampler_name);
+        if (!m_sampler.IsInitialized())
+        {
+            m_sampler = render_context.CreateSampler({
+                rhi::ISampler::Filter(rhi::ISampler::Filter::MinMag::Linear),
+                rhi::ISampler::Address(rhi::ISampler::Address::Mode::ClampToEdge),
+            });
+            m_sampler.SetName(s_sampler_name);
+
+            gfx_objects_registry.AddGraphicsObject(m_sampler);
+        }
+
+        // Colored quads are drawn with white texture, so that they could be batched with each other regardless of texture mode
+        static const std::string s_white_texture_name = "UI Batch White Texture";
+        m_white_texture = gfx_objects_registry.GetGraphicsObject<rhi::Texture>(s_white_texture_name);
+        if (!m_white_texture.IsInitialized())
+        {
+            static constexpr std::array<uint8_t, 4> s_white_texel{ 255U, 255U, 255U, 255U };
+            m_white_texture = render_context.CreateTexture(
+                rhi::TextureSettings::ForImage(gfx::Dimensions(1U, 1U), std::nullopt, gfx::PixelFormat::RGBA8Unorm, false));
+            m_white_texture.SetName(s_white_texture_name);
+            m_white_texture.SetData(m_ui_context.GetRenderCommandQueue(), {
+                { reinterpret_cast<Data::ConstRawPtr>(s_white_texel.data()), static_cast<Data::Size>(s_white_texel.size()) } // NOSONAR
+            });
+
+            gfx_objects_registry.AddGraphicsObject(m_white_texture);
+        }
+
+        const uint32_t frame_buffers_count = render_context.GetSettings().frame_buffers_count;
+        m_frame_resources.reserve(frame_buffers_count);
+        for(uint32_t frame_buffer_index = 0U; frame_buffer_index < frame_buffers_count; ++frame_buffer_index)
+        {
+            m_frame_resources.emplace_back(frame_buffer_index);
+        }
+
+        UpdateViewState(m_ui_context.GetFrameSize());
+    }
+
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept
+    { return m_statistics; }
+
+    void Begin()
+    {
+        META_FUNCTION_TASK();
+        m_quads.clear();
+        m_batches.clear();
+        m_materials.clear();
+        m_statistics.quads_count = 0U;
+        m_statistics.unbatched_draw_calls_count = 0U;
+    }
+
+    void AddQuads(std::span<const Quad> quads, const rhi::Texture* texture_ptr, const FloatRect* clip_rect_ptr)
+    {
+        META_FUNCTION_TASK();
+        if (clip_rect_ptr)
+        {
+            m_clipped_quads.clear();
+            for(const Quad& quad : quads)
+            {
+                if (Quad clipped_quad = quad;
+                    ClipQuad(clipped_quad, *clip_rect_ptr))
+                    m_clipped_quads.push_back(clipped_quad);
+            }
+            quads = m_clipped_quads;
+        }
+        if (quads.empty())
+            return;
+
+        const rhi::Texture& texture = texture_ptr && texture_ptr->IsInitialized() ? *texture_ptr : m_white_texture;
+        const uint32_t material_index = GetMaterialIndex(texture);
+
+        FloatRect quads_bounds = quads.front().screen_rect;
+        for(const Quad& quad : quads)
+        {
+            META_CHECK_TRUE_DESCR(quad.mode == QuadMode::Color || std::addressof(texture) != std::addressof(m_white_texture),
+                                  "textured UI batch quad requires initialized texture");
+            quads_bounds = GetBoundingRect(quads_bounds, quad.screen_rect);
+        }
+
+        const uint32_t batch_index = GetDrawBatchIndex(material_index, quads_bounds);
+        for(const Quad& quad : quads)
+        {
+            m_quads.push_back({ quad, batch_index });
+        }
+
+        DrawBatch& batch = m_batches[batch_index];
+        batch.bounds = batch.quads_count ? GetBoundingRect(batch.bounds, quads_bounds) : quads_bounds;
+        batch.quads_count += static_cast<uint32_t>(quads.size());
+        m_statistics.quads_count += static_cast<uint32_t>(quads.size());
+        m_statistics.unbatched_draw_calls_count++;
+    }
+
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr)
+    {
+        META_FUNCTION_TASK();
+        m_statistics.materials_count  = static_cast<uint32_t>(m_materials.size());
+        m_statistics.draw_calls_count = 0U;
+        if (m_quads.empty())
+            return;
+
+        const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+        const FrameSize& frame_size = m_ui_context.GetFrameSize();
+        if (m_view_frame_size != frame_size)
+        {
+            UpdateViewState(frame_size);
+        }
+
+        FillSortedQuadBuffers(frame_size);
+
+        const uint32_t frame_index = render_context.GetFrameBufferIndex();
+        META_CHECK_LESS_DESCR(frame_index, m_frame_resources.size(), "no UI batch resources available for the current frame buffer index");
+        BatchFrameResources& frame_resources = m_frame_resources[frame_index];
+        frame_resources.UpdateBuffers(render_context, m_vertices, m_indices, s_buffers_reservation_multiplier);
+
+        cmd_list.ResetWithStateOnce(m_render_state, debug_group_ptr);
+        cmd_list.SetViewState(m_view_state);
+        cmd_list.SetVertexBuffers(frame_resources.GetVertexBufferSet());
+        cmd_list.SetIndexBuffer(frame_resources.GetIndexBuffer());
+
+        uint32_t start_quad_index = 0U;
+        for(const DrawBatch& batch : m_batches)
+        {
+            const Material& material = m_materials[batch.material_index];
+            cmd_list.SetProgramBindings(frame_resources.GetProgramBindings(m_render_state, m_sampler, material.texture));
+            cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle,
+                                 batch.quads_count * g_quad_indices_count,
+                                 start_quad_index * g_quad_indices_count);
+            start_quad_index += batch.quads_count;
+            m_statistics.draw_calls_count++;
+        }
+
+        frame_resources.ReleaseUnusedProgramBindings();
+    }
+
+private:
+    uint32_t GetMaterialIndex(const rhi::Texture& texture)
+    {
+        META_FUNCTION_TASK();
+        // Linear search is used since UI overlay has just a few materials: font atlases, white texture and badge images
+        for(uint32_t material_index = 0U; material_index < m_materials.size(); ++material_index)
+        {
+            if (m_materials[material_index].texture == texture)
+                return material_index;
+        }
+        m_materials.push_back({ texture });
+        return static_cast<uint32_t>(m_materials.size() - 1U);
+    }
+
+    uint32_t GetDrawBatchIndex(uint32_t material_index, const FloatRect& quads_bounds)
+    {
+        META_FUNCTION_TASK();
+        // Quads can be appended to the last batch of the same material only when they do not overlap
+        // quads of batches drawn after it, so that drawing order of overlapping widgets is preserved
+        for(auto batch_it = m_batches.rbegin(); batch_it != m_batches.rend(); ++batch_it)
+        {
+            if (batch_it->material_index == material_index)
+                return static_cast<uint32_t>(std::distance(batch_it, m_batches.rend()) - 1);
+
+            if (AreRectsOverlapping(batch_it->bounds, quads_bounds))
+                break;
+        }
+        m_batches.push_back({ material_index, 0U, quads_bounds });
+        return static_cast<uint32_t>(m_batches.size() - 1U);
+    }
+
+    void FillSortedQuadBuffers(const FrameSize& frame_size)
+    {
+        META_FUNCTION_TASK();
+        // Quads are sorted by draw batch with counting sort, which preserves order of quads within each batch
+        std::vector<uint32_t> batch_quad_offsets(m_batches.size(), 0U);
+        uint32_t quads_offset = 0U;
+        for(size_t batch_index = 0U; batch_index < m_batches.size(); ++batch_index)
+        {
+            batch_quad_offsets[batch_index] = quads_offset;
+            quads_offset += m_batches[batch_index].quads_count;
+        }
+
+        m_vertices.resize(m_quads.size() * g_quad_vertices_count);
+        m_indices.resize(m_quads.size() * g_quad_indices_count);
+
+        const float x_scale = 2.F / static_cast<float>(frame_size.GetWidth());
+        const float y_scale = 2.F / static_cast<float>(frame_size.GetHeight());
+
+        for(const BatchedQuad& batched_quad : m_quads)
+        {
+            const uint32_t quad_index = batch_quad_offsets[batched_quad.batch_index]++;
+            const Quad&    quad       = batched_quad.quad;
+
+            const float left   = quad.screen_rect.GetLeft()   * x_scale - 1.F;
+            const float right  = quad.screen_rect.GetRight()  * x_scale - 1.F;
+            const float top    = 1.F - quad.screen_rect.GetTop()    * y_scale;
+            const float bottom = 1.F - quad.screen_rect.GetBottom() * y_scale;
+            const auto  mode   = static_cast<float>(quad.mode);
+            const Data::RawVector4F color(quad.color.AsArray());
+
+            const FloatRect& tex_rect = quad.texcoord_rect;
+            BatchVertex* vertex_ptr = &m_vertices[quad_index * g_quad_vertices_count];
+            vertex_ptr[0] = BatchVertex{ { left,  top    }, { tex_rect.GetLeft(),  tex_rect.GetTop(),    mode }, color };
+            vertex_ptr[1] = BatchVertex{ { right, top    }, { tex_rect.GetRight(), tex_rect.GetTop(),    mode }, color };
+            vertex_ptr[2] = BatchVertex{ { right, bottom }, { tex_rect.GetRight(), tex_rect.GetBottom(), mode }, color };
+            vertex_ptr[3] = BatchVertex{ { left,  bottom }, { tex_rect.GetLeft(),  tex_rect.GetBottom(), mode }, color };
+
+            const BatchIndex start_vertex = quad_index * g_quad_vertices_count;
+            BatchIndex* index_ptr = &m_indices[quad_index * g_quad_indices_count];
+            index_ptr[0] = start_vertex;
+            index_ptr[1] = start_vertex + 1U;
+            index_ptr[2] = start_vertex + 2U;
+            index_ptr[3] = start_vertex + 2U;
+            index_ptr[4] = start_vertex + 3U;
+            index_ptr[5] = start_vertex;
+        }
+    }
+
+    void UpdateViewState(const FrameSize& frame_size)
+    {
+        META_FUNCTION_TASK();
+        if (m_view_state.IsInitialized())
+        {
+            m_view_state.SetViewports({ gfx::GetFrameViewport(frame_size) });
+            m_view_state.SetScissorRects({ gfx::GetFrameScissorRect(frame_size) });
+        }
+        else
+        {
+            m_view_state = rhi::ViewState({
+                { gfx::GetFrameViewport(frame_size) },
+                { gfx::GetFrameScissorRect(frame_size) }
+            });
+        }
+        m_view_frame_size = frame_size;
+    }
+};
+
+META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(BatchRenderer);
+
+BatchRenderer::BatchRenderer(Context& ui_context)
+    : BatchRenderer(ui_context, ui_context.GetRenderPattern())
+{
+}
+
+BatchRenderer::BatchRenderer(Context& ui_context, const rhi::RenderPattern& render_pattern)
+    : m_impl_ptr(std::make_shared<Impl>(ui_context, render_pattern))
+{
+}
+
+void BatchRenderer::Begin() const
+{
+    GetImpl(m_impl_ptr).Begin();
+}
+
+void BatchRenderer::AddQuads(std::span<const Quad> quads, const rhi::Texture* texture_ptr, const FloatRect* clip_rect_ptr) const
+{
+    GetImpl(m_impl_ptr).AddQuads(quads, texture_ptr, clip_rect_ptr);
+}
+
+void BatchRenderer::AddQuad(const Quad& quad, const rhi::Texture* texture_ptr, const FloatRect* clip_rect_ptr) const
+{
+    GetImpl(m_impl_ptr).AddQuads(std::span<const Quad>(&quad, 1U), texture_ptr, clip_rect_ptr);
+}
+
+void BatchRenderer::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr) const
+{
+    GetImpl(m_impl_ptr).Draw(cmd_list, debug_group_ptr);
+}
+
+const BatchRenderer::Statistics& BatchRenderer::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
+} // namespace Methane::UserInterface
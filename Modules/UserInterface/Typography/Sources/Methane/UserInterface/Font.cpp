@@ -114,6 +114,11 @@ const Font::Settings& Font::GetSettings() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetSettings();
 }
 
+bool Font::IsDistanceField() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetSettings().render_mode == RenderMode::SignedDistanceField;
+}
+
 void Font::Connect(Data::Receiver<IFontCallback>& receiver) const
 {
     GetImpl(m_impl_ptr).Connect(receiver);
@@ -27,8 +27,13 @@ Font char internal implementation.
 
 #include <ft2build.h>
 #include <freetype/ftglyph.h>
+#include <freetype/ftoutln.h>
 #include FT_FREETYPE_H
 
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
 namespace Methane::UserInterface
 {
 
@@ -86,17 +91,276 @@ FontChar::FontChar(Code code)
 { }
 
 FontChar::FontChar(Code code, gfx::FrameRect rect, gfx::Point2I offset, gfx::Point2I advance,
-                   FT_Glyph ft_glyph, uint32_t face_index)
+                   FT_Glyph ft_glyph, uint32_t face_index, uint32_t padding)
     : m_code(code)
     , m_type_mask(GetTypeMask(code))
-    , m_rect(std::move(rect))
+    , m_rect(rect.origin, rect.size ? gfx::FrameSize(rect.size.GetWidth() + 2U * padding, rect.size.GetHeight() + 2U * padding) : rect.size)
     , m_offset(std::move(offset))
     , m_advance(std::move(advance))
-    , m_visual_size(IsWhiteSpace() ? m_advance.GetX() : m_offset.GetX() + m_rect.size.GetWidth(),
-                    IsWhiteSpace() ? m_advance.GetY() : m_offset.GetY() + m_rect.size.GetHeight())
+    , m_visual_size(IsWhiteSpace() ? m_advance.GetX() : m_offset.GetX() + rect.size.GetWidth(),
+                    IsWhiteSpace() ? m_advance.GetY() : m_offset.GetY() + rect.size.GetHeight())
+    , m_padding(padding)
     , m_glyph_ptr(std::make_shared<Glyph>(ft_glyph, face_index))
 { }
 
+namespace
+{
+
+struct OutlineSegment
+{
+    float start_x;
+    float start_y;
+    float end_x;
+    float end_y;
+};
+
+// Flattens glyph outline curves to line segments in coordinates of the glyph atlas rect with Y axis pointing down
+class OutlineFlattener
+{
+public:
+    OutlineFlattener(float origin_x, float origin_y)
+        : m_origin_x(origin_x)
+        , m_origin_y(origin_y)
+    { }
+
+    std::vector<OutlineSegment> Flatten(const FT_Outline& outline)
+    {
+        META_FUNCTION_TASK();
+        static const FT_Outline_Funcs s_outline_funcs{
+            &OutlineFlattener::MoveTo,
+            &OutlineFlattener::LineTo,
+            &OutlineFlattener::ConicTo,
+            &OutlineFlattener::CubicTo,
+            0, 0
+        };
+        ThrowFreeTypeError(FT_Outline_Decompose(const_cast<FT_Outline*>(&outline), &s_outline_funcs, this)); // NOSONAR
+        return std::move(m_segments);
+    }
+
+private:
+    static constexpr uint32_t s_curve_subdivisions = 8U;
+
+    [[nodiscard]] float GetX(const FT_Vector& v) const noexcept { return static_cast<float>(v.x) / 64.F - m_origin_x; }
+    [[nodiscard]] float GetY(const FT_Vector& v) const noexcept { return m_origin_y - static_cast<float>(v.y) / 64.F; }
+
+    void AddLine(float x, float y)
+    {
+        m_segments.push_back({ m_last_x, m_last_y, x, y });
+        m_last_x = x;
+        m_last_y = y;
+    }
+
+    static int MoveTo(const FT_Vector* to, void* user)
+    {
+        auto& self = *static_cast<OutlineFlattener*>(user);
+        self.m_last_x = self.GetX(*to);
+        self.m_last_y = self.GetY(*to);
+        return 0;
+    }
+
+    static int LineTo(const FT_Vector* to, void* user)
+    {
+        auto& self = *static_cast<OutlineFlattener*>(user);
+        self.AddLine(self.GetX(*to), self.GetY(*to));
+        return 0;
+    }
+
+    static int ConicTo(const FT_Vector* control, const FT_Vector* to, void* user)
+    {
+        auto& self = *static_cast<OutlineFlattener*>(user);
+        const float x0 = self.m_last_x;
+        const float y0 = self.m_last_y;
+        const float x1 = self.GetX(*control);
+        const float y1 = self.GetY(*control);
+        const float x2 = self.GetX(*to);
+        const float y2 = self.GetY(*to);
+        for(uint32_t i = 1U; i <= s_curve_subdivisions; ++i)
+        {
+            const float t = static_cast<float>(i) / static_cast<float>(s_curve_subdivisions);
+            const float u = 1.F - t;
+            self.AddLine(u * u * x0 + 2.F * u * t * x1 + t * t * x2,
+                         u * u * y0 + 2.F * u * t * y1 + t * t * y2);
+        }
+        return 0;
+    }
+
+    static int CubicTo(const FT_Vector* control1, const FT_Vector* control2, const FT_Vector* to, void* user)
+    {
+        auto& self = *static_cast<OutlineFlattener*>(user);
+        const float x0 = self.m_last_x;
+        const float y0 = self.m_last_y;
+        const float x1 = self.GetX(*control1);
+        const float y1 = self.GetY(*control1);
+        const float x2 = self.GetX(*control2);
+        const float y2 = self.GetY(*control2);
+        const float x3 = self.GetX(*to);
+        const float y3 = self.GetY(*to);
+        for(uint32_t i = 1U; i <= s_curve_subdivisions; ++i)
+        {
+            const float t = static_cast<float>(i) / static_cast<float>(s_curve_subdivisions);
+            const float u = 1.F - t;
+            self.AddLine(u * u * u * x0 + 3.F * u * u * t * x1 + 3.F * u * t * t * x2 + t * t * t * x3,
+                         u * u * u * y0 + 3.F * u * u * t * y1 + 3.F * u * t * t * y2 + t * t * t * y3);
+        }
+        return 0;
+    }
+
+    const float                 m_origin_x;
+    const float                 m_origin_y;
+    float                       m_last_x = 0.F;
+    float                       m_last_y = 0.F;
+    std::vector<OutlineSegment> m_segments;
+};
+
+[[nodiscard]] float GetSquaredDistanceToSegment(float x, float y, const OutlineSegment& segment) noexcept
+{
+    const float seg_x = segment.end_x - segment.start_x;
+    const float seg_y = segment.end_y - segment.start_y;
+    const float rel_x = x - segment.start_x;
+    const float rel_y = y - segment.start_y;
+    const float seg_length_sq = seg_x * seg_x + seg_y * seg_y;
+    const float t = seg_length_sq > 0.F ? std::clamp((rel_x * seg_x + rel_y * seg_y) / seg_length_sq, 0.F, 1.F) : 0.F;
+    const float dist_x = rel_x - t * seg_x;
+    const float dist_y = rel_y - t * seg_y;
+    return dist_x * dist_x + dist_y * dist_y;
+}
+
+struct OutlineCrossing
+{
+    float   x;
+    int32_t winding;
+};
+
+// Collects crossings of the horizontal line with outline segments sorted by X coordinate,
+// so that non-zero winding number of every pixel in a row is calculated in one sweep
+void GetOutlineCrossings(float y, const std::vector<OutlineSegment>& segments, std::vector<OutlineCrossing>& crossings)
+{
+    crossings.clear();
+    for(const OutlineSegment& segment : segments)
+    {
+        if ((segment.start_y <= y) == (segment.end_y <= y))
+            continue;
+
+        const float t = (y - segment.start_y) / (segment.end_y - segment.start_y);
+        crossings.push_back({ segment.start_x + t * (segment.end_x - segment.start_x), segment.end_y > segment.start_y ? 1 : -1 });
+    }
+    std::ranges::sort(crossings, {}, &OutlineCrossing::x);
+}
+
+// Uniform grid of outline segment indices with cell size equal to glyph padding:
+// distances beyond padding are clamped in distance field, so only neighbour cells of the pixel cell are checked
+class OutlineSegmentsGrid
+{
+public:
+    OutlineSegmentsGrid(const std::vector<OutlineSegment>& segments, uint32_t width, uint32_t height, uint32_t cell_size)
+        : m_cell_size(static_cast<float>(cell_size))
+        , m_cols((width + cell_size - 1U) / cell_size)
+        , m_rows((height + cell_size - 1U) / cell_size)
+        , m_cells(static_cast<size_t>(m_cols) * m_rows)
+    {
+        META_FUNCTION_TASK();
+        for(uint32_t segment_index = 0U; segment_index < segments.size(); ++segment_index)
+        {
+            const OutlineSegment& segment = segments[segment_index];
+            const uint32_t left   = GetCellIndex(std::min(segment.start_x, segment.end_x), m_cols);
+            const uint32_t right  = GetCellIndex(std::max(segment.start_x, segment.end_x), m_cols);
+            const uint32_t top    = GetCellIndex(std::min(segment.start_y, segment.end_y), m_rows);
+            const uint32_t bottom = GetCellIndex(std::max(segment.start_y, segment.end_y), m_rows);
+            for(uint32_t row = top; row <= bottom; ++row)
+                for(uint32_t col = left; col <= right; ++col)
+                    m_cells[static_cast<size_t>(row) * m_cols + col].push_back(segment_index);
+        }
+    }
+
+    template<typename FuncType>
+    void ForEachNeighbourSegment(float x, float y, FuncType&& func) const
+    {
+        const uint32_t cell_col = GetCellIndex(x, m_cols);
+        const uint32_t cell_row = GetCellIndex(y, m_rows);
+        for(uint32_t row = cell_row ? cell_row - 1U : 0U; row <= std::min(cell_row + 1U, m_rows - 1U); ++row)
+            for(uint32_t col = cell_col ? cell_col - 1U : 0U; col <= std::min(cell_col + 1U, m_cols - 1U); ++col)
+                for(const uint32_t segment_index : m_cells[static_cast<size_t>(row) * m_cols + col])
+                    func(segment_index);
+    }
+
+private:
+    [[nodiscard]] uint32_t GetCellIndex(float coordinate, uint32_t cells_count) const noexcept
+    {
+        return static_cast<uint32_t>(std::clamp(coordinate / m_cell_size, 0.F, static_cast<float>(cells_count - 1U)));
+    }
+
+    const float                        m_cell_size;
+    const uint32_t                     m_cols;
+    const uint32_t                     m_rows;
+    std::vector<std::vector<uint32_t>> m_cells;
+};
+
+} // anonymous namespace
+
+void FontChar::GenerateDistanceField() const
+{
+    META_FUNCTION_TASK();
+    if (!m_rect.size || !m_padding)
+        return;
+
+    META_CHECK_NOT_NULL_DESCR(m_glyph_ptr, "Font character glyph is not initialized");
+    FT_Glyph ft_glyph = m_glyph_ptr->GetFreeTypeGlyph();
+    META_CHECK_EQUAL_DESCR(ft_glyph->format, FT_GLYPH_FORMAT_OUTLINE, "signed distance field can be generated only for outline glyphs");
+
+    // Atlas rect top-left corner in glyph coordinates relative to the pen position on base line with Y axis pointing down
+    const auto padding = static_cast<float>(m_padding);
+    OutlineFlattener outline_flattener(static_cast<float>(m_offset.GetX()) - padding,
+                                       padding - static_cast<float>(m_offset.GetY()));
+    const std::vector<OutlineSegment> segments = outline_flattener.Flatten(reinterpret_cast<FT_OutlineGlyph>(ft_glyph)->outline); // NOSONAR
+
+    // Distance is normalized to [0, 1] range with glyph edge at 0.5 value, inside distances are greater than 0.5
+    const uint32_t width  = m_rect.size.GetWidth();
+    const uint32_t height = m_rect.size.GetHeight();
+    const float    distance_scale = 0.5F / padding;
+    Data::Bytes    distance_field(static_cast<size_t>(width) * height, Data::Byte{});
+
+    const OutlineSegmentsGrid    segments_grid(segments, width, height, m_padding);
+    const float                  max_distance_sq = padding * padding;
+    std::vector<OutlineCrossing> row_crossings;
+
+    for(uint32_t row = 0U; row < height; ++row)
+    {
+        const float y = static_cast<float>(row) + 0.5F;
+        GetOutlineCrossings(y, segments, row_crossings);
+
+        // Winding number of the ray cast to the right accounts only crossings with X greater than pixel X
+        int32_t winding = 0;
+        for(const OutlineCrossing& crossing : row_crossings)
+            winding += crossing.winding;
+
+        auto crossing_it = row_crossings.begin();
+        for(uint32_t col = 0U; col < width; ++col)
+        {
+            const float x = static_cast<float>(col) + 0.5F;
+            for(; crossing_it != row_crossings.end() && crossing_it->x <= x; ++crossing_it)
+                winding -= crossing_it->winding;
+
+            float min_distance_sq = max_distance_sq;
+            segments_grid.ForEachNeighbourSegment(x, y, [&segments, &min_distance_sq, x, y](uint32_t segment_index)
+            {
+                min_distance_sq = std::min(min_distance_sq, GetSquaredDistanceToSegment(x, y, segments[segment_index]));
+            });
+
+            const float signed_distance = winding ? std::sqrt(min_distance_sq) : -std::sqrt(min_distance_sq);
+            const float distance_value  = std::clamp(0.5F + signed_distance * distance_scale, 0.F, 1.F);
+            distance_field[static_cast<size_t>(row) * width + col] = static_cast<Data::Byte>(std::lround(distance_value * 255.F));
+        }
+    }
+
+    m_glyph_ptr->SetDistanceField(std::move(distance_field));
+}
+
+bool FontChar::HasDistanceField() const
+{
+    META_FUNCTION_TASK();
+    return m_glyph_ptr && !m_glyph_ptr->GetDistanceField().empty();
+}
+
 void FontChar::DrawToAtlas(Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride) const
 {
     META_FUNCTION_TASK();
@@ -110,6 +374,23 @@ void FontChar::DrawToAtlas(Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride)
     META_CHECK_LESS_OR_EQUAL(m_rect.GetRight(), atlas_row_stride);
     META_CHECK_LESS_OR_EQUAL(m_rect.GetBottom(), atlas_bitmap.size() / atlas_row_stride);
 
+    if (m_padding)
+    {
+        // Distance field is generated in parallel for all new chars and drawn to atlas after generation
+        if (!HasDistanceField())
+            return;
+
+        // Copy signed distance field pixels to output bitmap row-by-row
+        const Data::Bytes& distance_field = m_glyph_ptr->GetDistanceField();
+        const uint32_t width = m_rect.size.GetWidth();
+        for (uint32_t y = 0; y < m_rect.size.GetHeight(); y++)
+        {
+            const uint32_t atlas_index = m_rect.origin.GetX() + (m_rect.origin.GetY() + y) * atlas_row_stride;
+            std::copy_n(distance_field.begin() + static_cast<ptrdiff_t>(y * width), width, atlas_bitmap.begin() + atlas_index);
+        }
+        return;
+    }
+
     // Draw glyph to bitmap
     FT_Glyph ft_glyph = m_glyph_ptr->GetFreeTypeGlyph();
     ThrowFreeTypeError(FT_Glyph_To_Bitmap(&ft_glyph, FT_RENDER_MODE_NORMAL, nullptr, false));
@@ -65,12 +65,16 @@ public:
         Glyph& operator=(const Glyph&) noexcept = delete;
         Glyph& operator=(Glyph&&) noexcept = default;
 
-        [[nodiscard]] FT_Glyph GetFreeTypeGlyph() const { return m_ft_glyph; }
-        [[nodiscard]] uint32_t GetFaceIndex() const     { return m_face_index; }
+        [[nodiscard]] FT_Glyph           GetFreeTypeGlyph() const { return m_ft_glyph; }
+        [[nodiscard]] uint32_t           GetFaceIndex() const     { return m_face_index; }
+        [[nodiscard]] const Data::Bytes& GetDistanceField() const { return m_distance_field; }
+
+        void SetDistanceField(Data::Bytes&& distance_field) { m_distance_field = std::move(distance_field); }
 
     private:
-        FT_Glyph m_ft_glyph;
-        uint32_t m_face_index;
+        FT_Glyph    m_ft_glyph;
+        uint32_t    m_face_index;
+        Data::Bytes m_distance_field;
     };
 
     class BinPack
@@ -87,7 +91,7 @@ public:
     FontChar() = default;
     explicit FontChar(Code code);
     FontChar(Code code, gfx::FrameRect rect, gfx::Point2I offset, gfx::Point2I advance,
-             FT_Glyph ft_glyph, uint32_t face_index);
+             FT_Glyph ft_glyph, uint32_t face_index, uint32_t padding = 0U);
 
     [[nodiscard]] Code GetCode() const noexcept
     { return m_code; }
@@ -110,12 +114,23 @@ public:
     [[nodiscard]] const gfx::FrameSize& GetVisualSize() const noexcept
     { return m_visual_size; }
 
+    // Padding around glyph in atlas rect, which is non-zero for signed distance field glyphs
+    [[nodiscard]] uint32_t GetPadding() const noexcept
+    { return m_padding; }
+
+    [[nodiscard]] bool IsDistanceField() const noexcept
+    { return m_padding > 0U; }
+
     [[nodiscard]] friend auto operator<=>(const FontChar& left, const FontChar& right) noexcept
     { return left.m_rect.size.GetPixelsCount() <=> right.m_rect.size.GetPixelsCount(); }
 
     [[nodiscard]] explicit operator bool() const noexcept
     { return m_code != 0U; }
 
+    // Generates signed distance field from glyph outline, can be called in parallel for different characters
+    void GenerateDistanceField() const;
+    [[nodiscard]] bool HasDistanceField() const;
+
     void DrawToAtlas(Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride) const;
     uint32_t GetGlyphIndex() const;
 
@@ -126,6 +141,7 @@ private:
     gfx::Point2I   m_offset;
     gfx::Point2I   m_advance;
     gfx::FrameSize m_visual_size;
+    uint32_t       m_padding = 0U;
     Ptr<Glyph>     m_glyph_ptr;
 };
 
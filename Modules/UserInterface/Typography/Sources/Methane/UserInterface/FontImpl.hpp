@@ -35,6 +35,9 @@ Font implementation.
 #include <Methane/Data/IProvider.h>
 #include <Methane/Data/Emitter.hpp>
 
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+
 #include <map>
 #include <string>
 #include <ranges>
@@ -70,6 +73,7 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
     using Description = FontDescription;
     using Settings    = FontSettings;
     using Library     = FontLibrary;
+    using RenderMode  = FontRenderMode;
     using Char        = FontChar;
     using CharBinPack = FontChar::BinPack;
     using Chars       = Refs<const Char>;
@@ -111,14 +115,15 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
             return FT_Get_Char_Index(m_ft_face, static_cast<FT_ULong>(char_code));
         }
 
-        Char LoadChar(Char::Code char_code)
+        // Non-zero distance field padding loads glyph outline for signed distance field generation instead of rendering its bitmap
+        Char LoadChar(Char::Code char_code, uint32_t distance_field_padding)
         {
             META_FUNCTION_TASK();
 
             uint32_t char_index = GetCharIndex(char_code);
             META_CHECK_NOT_ZERO_DESCR(char_index, "unicode character U+{} does not exist in font face", static_cast<uint32_t>(char_code));
 
-            ThrowFreeTypeError(FT_Load_Glyph(m_ft_face, char_index, FT_LOAD_RENDER));
+            ThrowFreeTypeError(FT_Load_Glyph(m_ft_face, char_index, distance_field_padding ? FT_LOAD_NO_BITMAP : FT_LOAD_RENDER));
             META_CHECK_NOT_NULL_DESCR(m_ft_face_rec.glyph, "glyph should not be null after loading from font face");
 
             FT_Glyph ft_glyph = nullptr;
@@ -135,7 +140,7 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
                              -static_cast<int32_t>(m_ft_face_rec.glyph->metrics.horiBearingY  / s_ft_dots_in_pixel)),
                 gfx::Point2I(static_cast<int32_t>(m_ft_face_rec.glyph->metrics.horiAdvance   / s_ft_dots_in_pixel),
                              static_cast<int32_t>(m_ft_face_rec.glyph->metrics.vertAdvance   / s_ft_dots_in_pixel)),
-                ft_glyph, char_index
+                ft_glyph, char_index, distance_field_padding
             );
         }
 
@@ -193,6 +198,7 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
     Face                   m_face;
     UniquePtr<CharBinPack> m_atlas_pack_ptr;
     CharByCode             m_char_by_code;
+    Refs<Char>             m_distance_field_pending_chars;
     Data::Bytes            m_atlas_bitmap;
     TextureByContext       m_atlas_textures;
     gfx::FrameSize         m_max_glyph_size;
@@ -253,6 +259,7 @@ public:
         META_FUNCTION_TASK();
         m_atlas_pack_ptr.reset();
         m_char_by_code.clear();
+        m_distance_field_pending_chars.clear();
         m_atlas_bitmap.clear();
 
         if (utf32_characters.empty())
@@ -279,6 +286,7 @@ public:
     void AddChars(const std::u32string& utf32_characters)
     {
         META_FUNCTION_TASK();
+        Refs<Char> new_chars;
         for (Char::Code char_code : utf32_characters)
         {
             if (!char_code)
@@ -287,8 +295,27 @@ public:
             if (HasChar(char_code))
                 continue;
 
-            AddChar(char_code);
+            new_chars.emplace_back(LoadChar(char_code));
         }
+
+        if (new_chars.empty())
+            return;
+
+        // Attempt to pack new chars into existing atlas
+        if (m_atlas_pack_ptr && m_atlas_pack_ptr->TryPack(new_chars))
+        {
+            // Draw chars to existing atlas bitmap and update textures
+            for (const Char& new_char : new_chars)
+            {
+                new_char.DrawToAtlas(m_atlas_bitmap, m_atlas_pack_ptr->GetSize().GetWidth());
+            }
+            UpdateAtlasTextures(true);
+            return;
+        }
+
+        // If new chars do not fit into existing atlas, repack all chars into new atlas
+        PackCharsToAtlas(2.F);
+        UpdateAtlasBitmap(true);
     }
 
     const FontChar& AddChar(Char::Code char_code)
@@ -297,13 +324,7 @@ public:
         if (const Char& font_char = GetChar(char_code); font_char)
             return font_char;
 
-        // Load char glyph and add it to the font characters map
-        const auto font_char_it = m_char_by_code.try_emplace(char_code, m_face.LoadChar(char_code)).first;
-        META_CHECK_DESCR(static_cast<uint32_t>(char_code), font_char_it != m_char_by_code.end(), "font character was not added to character map");
-
-        Char& new_font_char = font_char_it->second;
-        m_max_glyph_size.SetWidth( std::max(m_max_glyph_size.GetWidth(),  new_font_char.GetRect().size.GetWidth()));
-        m_max_glyph_size.SetHeight(std::max(m_max_glyph_size.GetHeight(), new_font_char.GetRect().size.GetHeight()));
+        Char& new_font_char = LoadChar(char_code);
 
         // Attempt to pack new char into existing atlas
         if (m_atlas_pack_ptr && m_atlas_pack_ptr->TryPack(new_font_char))
@@ -445,6 +466,65 @@ public:
     }
 
 private:
+    [[nodiscard]] uint32_t GetDistanceFieldPadding() const noexcept
+    {
+        return m_settings.render_mode == RenderMode::SignedDistanceField ? std::max(1U, m_settings.distance_spread_px) : 0U;
+    }
+
+    Char& LoadChar(Char::Code char_code)
+    {
+        META_FUNCTION_TASK();
+        // Load char glyph and add it to the font characters map
+        const auto font_char_it = m_char_by_code.try_emplace(char_code, m_face.LoadChar(char_code, GetDistanceFieldPadding())).first;
+        META_CHECK_DESCR(static_cast<uint32_t>(char_code), font_char_it != m_char_by_code.end(), "font character was not added to character map");
+
+        Char& new_font_char = font_char_it->second;
+        m_max_glyph_size.SetWidth( std::max(m_max_glyph_size.GetWidth(),  new_font_char.GetRect().size.GetWidth()));
+        m_max_glyph_size.SetHeight(std::max(m_max_glyph_size.GetHeight(), new_font_char.GetRect().size.GetHeight()));
+
+        // Distance field is generated with parallel executor of render context before uploading atlas texture
+        if (new_font_char.IsDistanceField())
+        {
+            m_distance_field_pending_chars.emplace_back(new_font_char);
+        }
+        return new_font_char;
+    }
+
+    void GenerateDistanceFields(const rhi::RenderContext& render_context)
+    {
+        META_FUNCTION_TASK();
+        if (m_distance_field_pending_chars.empty())
+            return;
+
+        if (m_distance_field_pending_chars.size() == 1U)
+        {
+            m_distance_field_pending_chars.front().get().GenerateDistanceField();
+        }
+        else
+        {
+            // Glyph outlines are loaded sequentially with FreeType face, while distance fields are generated in parallel
+            tf::Taskflow distance_task_flow;
+            distance_task_flow.for_each(m_distance_field_pending_chars.begin(), m_distance_field_pending_chars.end(),
+                [](const Ref<Char>& font_char)
+                {
+                    META_FUNCTION_TASK();
+                    font_char.get().GenerateDistanceField();
+                }
+            );
+            render_context.GetParallelExecutor().run(distance_task_flow).get();
+        }
+
+        // Chars without distance field were skipped on atlas bitmap update, so they are drawn now
+        if (m_atlas_pack_ptr && m_atlas_bitmap.size() == m_atlas_pack_ptr->GetSize().GetPixelsCount())
+        {
+            for (const Char& font_char : m_distance_field_pending_chars)
+            {
+                font_char.DrawToAtlas(m_atlas_bitmap, m_atlas_pack_ptr->GetSize().GetWidth());
+            }
+        }
+        m_distance_field_pending_chars.clear();
+    }
+
     Refs<FontChar> GetMutableChars()
     {
         META_FUNCTION_TASK();
@@ -494,6 +574,11 @@ private:
     AtlasTexture CreateAtlasTexture(const rhi::RenderContext& render_context, bool deferred_data_init)
     {
         META_FUNCTION_TASK();
+        if (!deferred_data_init)
+        {
+            GenerateDistanceFields(render_context);
+        }
+
         rhi::Texture atlas_texture(render_context,
                                    rhi::TextureSettings::ForImage(
                                        gfx::Dimensions(m_atlas_pack_ptr->GetSize()),
@@ -564,6 +649,7 @@ private:
     {
         META_FUNCTION_TASK();
         META_CHECK_TRUE_DESCR(atlas_texture.texture.IsInitialized(), "font atlas texture is not initialized");
+        GenerateDistanceFields(render_context);
 
         const gfx::FrameSize atlas_size = m_atlas_pack_ptr->GetSize();
         if (const gfx::Dimensions& texture_dimensions = atlas_texture.texture.GetSettings().dimensions;
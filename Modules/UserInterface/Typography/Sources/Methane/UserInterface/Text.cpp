@@ -25,6 +25,7 @@ Methane text rendering primitive.
 
 #include <Methane/UserInterface/Font.h>
 #include <Methane/UserInterface/Text.h>
+#include <Methane/UserInterface/BatchRenderer.h>
 #include <Methane/UserInterface/Context.h>
 
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
@@ -52,6 +53,7 @@ Methane text rendering primitive.
 
 #include <memory>
 #include <cassert>
+#include <cmath>
 
 namespace hlslpp // NOSONAR
 {
@@ -155,6 +157,11 @@ public:
         return m_index_buffer;
     }
 
+    [[nodiscard]] const rhi::Texture& GetAtlasTexture() const noexcept
+    {
+        return m_atlas_texture;
+    }
+
     [[nodiscard]] const rhi::ProgramBindings& GetProgramBindings() const noexcept
     {
         return m_program_bindings;
@@ -292,6 +299,7 @@ class Text::Impl // NOSONAR - class destructor is required
 private:
     using FrameResources = TextFrameResources;
     using PerFrameResources = std::vector<TextFrameResources>;
+    using BatchQuads = std::vector<BatchQuad>;
 
     Context&            m_ui_context;
     SettingsUtf32       m_settings;
@@ -303,6 +311,7 @@ private:
     rhi::ViewState      m_view_state;
     rhi::Sampler        m_atlas_sampler;
     PerFrameResources   m_frame_resources;
+    BatchQuads          m_batch_quads; // reused for adding glyph quads to batch renderer
     bool                m_is_viewport_dirty  = true;
 
 public:
@@ -317,13 +326,17 @@ public:
         m_font.Connect(*this);
         m_frame_rect = m_ui_context.ConvertTo<Units::Pixels>(m_settings.rect);
 
+        // Signed distance field fonts are rendered with a separate pixel shader and render state
+        const bool        is_distance_field = m_font.IsDistanceField();
+        const std::string render_state_name = is_distance_field ? m_settings.state_name + " SDF" : m_settings.state_name;
+
         rhi::ObjectRegistry gfx_objects_registry = ui_context.GetRenderContext().GetObjectRegistry();
-        m_render_state = gfx_objects_registry.GetGraphicsObject<rhi::RenderState>(m_settings.state_name);
+        m_render_state = gfx_objects_registry.GetGraphicsObject<rhi::RenderState>(render_state_name);
         if (m_render_state.IsInitialized())
         {
             META_CHECK_EQUAL_DESCR(m_render_state.GetSettings().render_pattern_ptr->GetSettings(), render_pattern.GetSettings(),
                                    "Text '{}' render state '{}' from cache has incompatible render pattern settings", m_settings.name,
-                                   m_settings.state_name);
+                                   render_state_name);
         }
         else
         {
@@ -336,7 +349,7 @@ public:
                         .shader_set = rhi::Program::ShaderSet
                         {
                             { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Text", "TextVS" }, {} } },
-                            { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Text", "TextPS" }, {} } },
+                            { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Text", is_distance_field ? "TextSdfPS" : "TextPS" }, {} } },
                         },
                         .input_buffer_layouts = rhi::ProgramInputBufferLayouts
                         {
@@ -376,10 +389,10 @@ public:
                     }}
                 }
             };
-            state_settings.program.SetName("Text Shading");
+            state_settings.program.SetName(is_distance_field ? "Text SDF Shading" : "Text Shading");
 
             m_render_state = m_ui_context.GetRenderContext().CreateRenderState(state_settings);
-            m_render_state.SetName(m_settings.state_name);
+            m_render_state.SetName(render_state_name);
 
             gfx_objects_registry.AddGraphicsObject(m_render_state);
         }
@@ -422,7 +435,8 @@ public:
                    settings.incremental_update,
                    settings.adjust_vertical_content_offset,
                    settings.mesh_buffers_reservation_multiplier,
-                   settings.state_name
+                   settings.state_name,
+                   settings.font_size_pt
                }
     )
     { }
@@ -624,6 +638,54 @@ public:
         cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle);
     }
 
+    void Draw(const BatchRenderer& batch_renderer)
+    {
+        META_FUNCTION_TASK();
+        if (m_frame_resources.empty() || !m_text_mesh_ptr)
+            return;
+
+        const FrameResources& frame_resources = GetCurrentFrameResources();
+        if (!frame_resources.IsAtlasInitialized())
+            return;
+
+        // Convert glyph quads from text model coordinates to frame pixel coordinates using the same
+        // aligned viewport rectangle, which is used for separate text rendering
+        const FrameRect viewport_rect = GetAlignedViewportRect();
+        const auto      origin_x      = static_cast<float>(viewport_rect.origin.GetX());
+        const auto      origin_y      = static_cast<float>(viewport_rect.origin.GetY());
+        const float     font_scale    = GetFontScale();
+        const auto      quad_mode     = m_font.IsDistanceField() ? BatchQuadMode::DistanceFieldTexture : BatchQuadMode::AlphaTexture;
+
+        // Glyph quads are clipped by viewport rectangle, which is used as scissor rectangle in separate text rendering
+        const FloatRect clip_rect(origin_x, origin_y,
+                                  static_cast<float>(viewport_rect.size.GetWidth()),
+                                  static_cast<float>(viewport_rect.size.GetHeight()));
+
+        // Each glyph quad has vertices ordered as: left-top, left-bottom, right-bottom, right-top in screen space
+        const TextMesh::Vertices& vertices = m_text_mesh_ptr->GetVertices();
+        m_batch_quads.clear();
+        m_batch_quads.reserve(vertices.size() / 4U);
+        for(size_t vertex_index = 0U; vertex_index + 3U < vertices.size(); vertex_index += 4U)
+        {
+            const TextMesh::Vertex& left_top     = vertices[vertex_index];
+            const TextMesh::Vertex& right_bottom = vertices[vertex_index + 2U];
+            m_batch_quads.push_back(BatchQuad{
+                FloatRect(origin_x + left_top.position.GetX() * font_scale,
+                          origin_y - left_top.position.GetY() * font_scale,
+                          (right_bottom.position.GetX() - left_top.position.GetX()) * font_scale,
+                          (left_top.position.GetY() - right_bottom.position.GetY()) * font_scale),
+                FloatRect(left_top.texcoord.GetX(),
+                          left_top.texcoord.GetY(),
+                          right_bottom.texcoord.GetX() - left_top.texcoord.GetX(),
+                          right_bottom.texcoord.GetY() - left_top.texcoord.GetY()),
+                m_settings.color,
+                quad_mode
+            });
+        }
+
+        batch_renderer.AddQuads(m_batch_quads, &frame_resources.GetAtlasTexture(), &clip_rect);
+    }
+
     // IFontCallback interface
     void OnFontAtlasTextureReset(Font& font, const rhi::Texture* old_atlas_texture_ptr, const rhi::Texture* new_atlas_texture_ptr) override
     {
@@ -726,17 +788,26 @@ private:
         if (!m_font.GetAtlasSize())
             return;
 
+        // Text mesh is built in font atlas pixels, which are scaled to frame pixels with the text font size
         const FrameRect::Size prev_frame_size = m_frame_rect.size;
+        FrameRect::Size       mesh_frame_size = ConvertToMeshSize(m_frame_rect.size);
         if (m_settings.incremental_update && m_text_mesh_ptr &&
-            m_text_mesh_ptr->IsUpdatable(m_settings.text, m_settings.layout, m_font, m_frame_rect.size))
+            m_text_mesh_ptr->IsUpdatable(m_settings.text, m_settings.layout, m_font, mesh_frame_size))
         {
-            m_text_mesh_ptr->Update(m_settings.text, m_frame_rect.size);
+            m_text_mesh_ptr->Update(m_settings.text, mesh_frame_size);
         }
         else
         {
-            m_text_mesh_ptr = std::make_unique<TextMesh>(m_settings.text, m_settings.layout, m_font, m_frame_rect.size);
+            m_text_mesh_ptr = std::make_unique<TextMesh>(m_settings.text, m_settings.layout, m_font, mesh_frame_size);
         }
 
+        // Zero frame dimensions are updated by text mesh with calculated content size
+        const FrameRect::Size content_frame_size = ConvertFromMeshSize(mesh_frame_size);
+        if (!m_frame_rect.size.GetWidth())
+            m_frame_rect.size.SetWidth(content_frame_size.GetWidth());
+        if (!m_frame_rect.size.GetHeight())
+            m_frame_rect.size.SetHeight(content_frame_size.GetHeight());
+
         if (m_frame_rect.size != prev_frame_size)
         {
             Emit(&ITextCallback::OnTextFrameRectChanged, m_frame_rect);
@@ -785,12 +856,47 @@ private:
         return { ui_rect_changed, ui_size_changed };
     }
 
+    float GetFontScale() const
+    {
+        META_FUNCTION_TASK();
+        const uint32_t atlas_font_size_pt = m_font.GetSettings().description.size_pt;
+        if (!m_settings.font_size_pt || m_settings.font_size_pt == atlas_font_size_pt)
+            return 1.F;
+
+        META_CHECK_TRUE_DESCR(m_font.IsDistanceField(),
+                              "text '{}' font size can differ from the font atlas size only for signed distance field fonts",
+                              m_settings.name);
+        return static_cast<float>(m_settings.font_size_pt) / static_cast<float>(atlas_font_size_pt);
+    }
+
+    FrameSize ConvertToMeshSize(const FrameSize& frame_size) const
+    {
+        META_FUNCTION_TASK();
+        const float font_scale = GetFontScale();
+        if (font_scale == 1.F)
+            return frame_size;
+
+        return FrameSize(static_cast<uint32_t>(std::floor(static_cast<float>(frame_size.GetWidth())  / font_scale)),
+                         static_cast<uint32_t>(std::floor(static_cast<float>(frame_size.GetHeight()) / font_scale)));
+    }
+
+    FrameSize ConvertFromMeshSize(const FrameSize& mesh_size) const
+    {
+        META_FUNCTION_TASK();
+        const float font_scale = GetFontScale();
+        if (font_scale == 1.F)
+            return mesh_size;
+
+        return FrameSize(static_cast<uint32_t>(std::ceil(static_cast<float>(mesh_size.GetWidth())  * font_scale)),
+                         static_cast<uint32_t>(std::ceil(static_cast<float>(mesh_size.GetHeight()) * font_scale)));
+    }
+
     FrameRect GetAlignedViewportRect() const
     {
         META_FUNCTION_TASK();
         META_CHECK_NOT_NULL_DESCR(m_text_mesh_ptr, "text mesh must be initialized");
 
-        FrameSize content_size = m_text_mesh_ptr->GetContentSize();
+        FrameSize content_size = ConvertFromMeshSize(m_text_mesh_ptr->GetContentSize());
         META_CHECK_NOT_ZERO_DESCR(content_size, "all dimension of text content size should be non-zero");
         META_CHECK_NOT_ZERO_DESCR(m_frame_rect.size, "all dimension of frame size should be non-zero");
 
@@ -800,7 +906,7 @@ private:
         if (m_settings.adjust_vertical_content_offset)
         {
             // Apply vertical offset to make top of content match the rect top coordinate
-            const uint32_t content_top_offset = m_text_mesh_ptr->GetContentTopOffset();
+            const auto content_top_offset = static_cast<uint32_t>(std::round(static_cast<float>(m_text_mesh_ptr->GetContentTopOffset()) * GetFontScale()));
             META_CHECK_LESS(content_top_offset, content_size.GetHeight() + 1);
 
             content_size.SetHeight(content_size.GetHeight() - content_top_offset);
@@ -965,4 +1071,9 @@ void Text::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDe
     GetImpl(m_impl_ptr).Draw(cmd_list, debug_group_ptr);
 }
 
+void Text::Draw(const BatchRenderer& batch_renderer) const
+{
+    GetImpl(m_impl_ptr).Draw(batch_renderer);
+}
+
 } // namespace Methane::Graphics
@@ -472,11 +472,13 @@ void TextMesh::AddCharQuad(const FontChar& font_char, const gfx::FramePoint& cha
 {
     META_FUNCTION_TASK();
 
-    // Char quad rectangle in text model coordinates [0, 0] x [width, height]
+    // Char quad rectangle in text model coordinates [0, 0] x [width, height],
+    // distance field glyphs are padded with spread margin around visible glyph bitmap
+    const auto char_padding = static_cast<int32_t>(font_char.GetPadding());
     const gfx::Rect<float, float> ver_rect {
         {
-            static_cast<float>(char_pos.GetX() + font_char.GetOffset().GetX()),
-            static_cast<float>(char_pos.GetY() + font_char.GetOffset().GetY() + static_cast<int32_t>(font_char.GetRect().size.GetHeight())) * -1.F,
+            static_cast<float>(char_pos.GetX() + font_char.GetOffset().GetX() - char_padding),
+            static_cast<float>(char_pos.GetY() + font_char.GetOffset().GetY() - char_padding + static_cast<int32_t>(font_char.GetRect().size.GetHeight())) * -1.F,
         },
         {
             static_cast<float>(font_char.GetRect().size.GetWidth()),
@@ -40,6 +40,8 @@ class ImageLoader;
 namespace Methane::UserInterface
 {
 
+class BatchRenderer;
+
 class Badge
     : public Item
     , public gfx::ScreenQuad
@@ -77,6 +79,9 @@ public:
     void SetCorner(FrameCorner frame_corner);
     void SetMargins(const UnitSize& margins);
 
+    using gfx::ScreenQuad::Draw;
+    void Draw(const BatchRenderer& batch_renderer) const;
+
 private:
     // Item overrides
     bool SetRect(const UnitRect& ui_rect) override;
@@ -78,6 +78,7 @@ public:
 
     void Update(const FrameSize& render_attachment_size);
     void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const override;
+    void Draw(const BatchRenderer& batch_renderer) const override;
 
 private:
     enum class TextBlock : size_t
@@ -98,6 +99,7 @@ private:
 
     void LayoutTextBlocks();
     void UpdateAllTextBlocks(const FrameSize& render_attachment_size) const;
+    [[nodiscard]] std::string GetCpuAndGpuTimeText(double cpu_time_percent) const;
 
     Settings           m_settings;
     const Font         m_major_font;
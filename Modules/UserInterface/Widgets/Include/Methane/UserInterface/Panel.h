@@ -35,6 +35,8 @@ class ImageLoader;
 namespace Methane::UserInterface
 {
 
+class BatchRenderer;
+
 class Panel
     : public Container
     , public gfx::ScreenQuad
@@ -53,6 +55,9 @@ public:
     // Item overrides
     bool SetRect(const UnitRect& ui_rect) override;
 
+    using gfx::ScreenQuad::Draw;
+    virtual void Draw(const BatchRenderer& batch_renderer) const;
+
 protected:
     using gfx::ScreenQuad::SetScreenRect;
 
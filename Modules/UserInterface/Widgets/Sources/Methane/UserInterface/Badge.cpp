@@ -21,6 +21,8 @@ Badge widget displaying texture in specific corner of the screen.
 
 ******************************************************************************/
 
+#include "ScreenQuadBatch.hpp"
+
 #include <Methane/UserInterface/Badge.h>
 #include <Methane/UserInterface/Context.h>
 
@@ -150,6 +152,12 @@ bool Badge::SetRect(const UnitRect& ui_rect)
     return true;
 }
 
+void Badge::Draw(const BatchRenderer& batch_renderer) const
+{
+    META_FUNCTION_TASK();
+    AddScreenQuadToBatch(*this, batch_renderer);
+}
+
 UnitRect Badge::GetBadgeRectInFrame(const Context& ui_context, const UnitSize& frame_size, const Settings& settings)
 {
     return GetBadgeRectInFrame(frame_size,
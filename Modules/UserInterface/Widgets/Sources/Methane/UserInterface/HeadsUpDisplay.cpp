@@ -36,6 +36,9 @@ Heads-Up-Display widget for displaying runtime rendering parameters.
 #include <Methane/UserInterface/Context.h>
 
 #include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/GpuTimingReport.h>
 #include <Methane/Graphics/RHI/System.h>
 #include <Methane/Data/IFpsCounter.h>
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
@@ -281,7 +284,7 @@ void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
     using enum TextBlock;
     GetTextBlock(Fps).SetText(fmt::format("{:d} FPS", fps_counter.GetFramesPerSecond()));
     GetTextBlock(FrameTime).SetText(fmt::format("{:.2f} ms", fps_counter.GetAverageFrameTiming().GetTotalTimeMSec()));
-    GetTextBlock(CpuTime).SetText(fmt::format("{:.2f}% cpu", fps_counter.GetAverageFrameTiming().GetCpuTimePercent()));
+    GetTextBlock(CpuTime).SetText(GetCpuAndGpuTimeText(fps_counter.GetAverageFrameTiming().GetCpuTimePercent()));
     GetTextBlock(GpuName).SetText(GetUIContext().GetRenderContext().GetDevice().GetAdapterName());
     GetTextBlock(FrameBuffersAndApi).SetText(fmt::format("{:d} x {:d}  {:d} FB  {:s}", // NOSONAR - string contains invisible NBSP symbols
                                                          context_settings.frame_size.GetWidth(),
@@ -296,6 +299,17 @@ void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
     m_update_timer.Reset();
 }
 
+std::string HeadsUpDisplay::GetCpuAndGpuTimeText(double cpu_time_percent) const
+{
+    META_FUNCTION_TASK();
+    // GPU frame time is available only when GPU instrumentation collects timestamps of the render command queue
+    const Opt<rhi::GpuTimingReport::Frame> gpu_frame_opt = GetUIContext().GetRenderContext().GetRenderCommandKit().GetQueue().GetGpuTimingReport().GetLastCompletedFrame();
+    if (!gpu_frame_opt || !gpu_frame_opt->GetDurationNs())
+        return fmt::format("{:.2f}% cpu", cpu_time_percent);
+
+    return fmt::format("{:.2f}% cpu  {:.2f} ms gpu", cpu_time_percent, gpu_frame_opt->GetDurationMs());
+}
+
 void HeadsUpDisplay::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr) const
 {
     META_FUNCTION_TASK();
@@ -307,6 +321,17 @@ void HeadsUpDisplay::Draw(const rhi::RenderCommandList& cmd_list, const rhi::Com
     }
 }
 
+void HeadsUpDisplay::Draw(const BatchRenderer& batch_renderer) const
+{
+    META_FUNCTION_TASK();
+    Panel::Draw(batch_renderer);
+
+    for(const Ptr<TextItem>& text_ptr : m_text_blocks)
+    {
+        text_ptr->Draw(batch_renderer);
+    }
+}
+
 TextItem& HeadsUpDisplay::GetTextBlock(TextBlock block) const
 {
     META_FUNCTION_TASK();
@@ -21,6 +21,8 @@ Panel widget with opaque background containing other widgets.
 
 ******************************************************************************/
 
+#include "ScreenQuadBatch.hpp"
+
 #include <Methane/UserInterface/Panel.h>
 #include <Methane/UserInterface/Context.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
@@ -60,4 +62,10 @@ bool Panel::SetRect(const UnitRect& ui_rect)
     return true;
 }
 
+void Panel::Draw(const BatchRenderer& batch_renderer) const
+{
+    META_FUNCTION_TASK();
+    AddScreenQuadToBatch(*this, batch_renderer);
+}
+
 } // namespace Methane::UserInterface
@@ -0,0 +1,69 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/ScreenQuadBatch.hpp
+Conversion of screen quad widgets to user interface batch renderer quads.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/UserInterface/BatchRenderer.h>
+#include <Methane/Graphics/ScreenQuad.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::UserInterface
+{
+
+[[nodiscard]] inline BatchQuadMode GetBatchQuadMode(gfx::ScreenQuad::TextureMode texture_mode)
+{
+    META_FUNCTION_TASK();
+    switch(texture_mode)
+    {
+    using enum gfx::ScreenQuad::TextureMode;
+    case Disabled:      return BatchQuadMode::Color;
+    case RgbaFloat:     return BatchQuadMode::RgbaTexture;
+    case RFloatToAlpha: return BatchQuadMode::AlphaTexture;
+    default:            META_UNEXPECTED_RETURN(texture_mode, BatchQuadMode::Color);
+    }
+}
+
+inline void AddScreenQuadToBatch(const gfx::ScreenQuad& screen_quad, const BatchRenderer& batch_renderer)
+{
+    META_FUNCTION_TASK();
+    const gfx::ScreenQuad::Settings& quad_settings = screen_quad.GetQuadSettings();
+    const FrameRect& screen_rect = quad_settings.screen_rect;
+    const BatchQuad batch_quad{
+        FloatRect(static_cast<float>(screen_rect.origin.GetX()),
+                  static_cast<float>(screen_rect.origin.GetY()),
+                  static_cast<float>(screen_rect.size.GetWidth()),
+                  static_cast<float>(screen_rect.size.GetHeight())),
+        FloatRect(0.F, 0.F, 1.F, 1.F),
+        quad_settings.blend_color,
+        GetBatchQuadMode(quad_settings.texture_mode)
+    };
+
+    if (batch_quad.mode == BatchQuadMode::Color)
+        batch_renderer.AddQuad(batch_quad);
+    else
+        batch_renderer.AddQuad(batch_quad, &screen_quad.GetTexture());
+}
+
+} // namespace Methane::UserInterface
@@ -0,0 +1,83 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/ScopeTimerBenchmark.cpp
+Benchmark of the scope timer overhead in single and multiple threads
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <Methane/ScopeTimer.h>
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Methane;
+
+static void RunScopeTimers(const ScopeTimer::Registration& registration, uint32_t scopes_count)
+{
+    for (uint32_t scope_index = 0U; scope_index < scopes_count; ++scope_index)
+    {
+        const ScopeTimer scope_timer(registration);
+    }
+}
+
+TEST_CASE("Scope Timer Overhead", "[instrumentation][scope-timer][benchmark]")
+{
+    constexpr uint32_t scopes_count = 10000U;
+    ScopeTimer::Aggregator& aggregator = ScopeTimer::Aggregator::Get();
+    const ScopeTimer::Registration registration = aggregator.RegisterScope("Benchmark Scope");
+
+    BENCHMARK("10000 scope timers in single thread")
+    {
+        RunScopeTimers(registration, scopes_count);
+        return registration.id;
+    };
+
+    for (const uint32_t threads_count : { 2U, 4U, 8U })
+    {
+        BENCHMARK(std::to_string(scopes_count) + " scope timers in each of " + std::to_string(threads_count) + " threads")
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(threads_count);
+            for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+            {
+                threads.emplace_back(RunScopeTimers, std::cref(registration), scopes_count);
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            return registration.id;
+        };
+    }
+
+    BENCHMARK("Frame completion with merge of thread timings")
+    {
+        RunScopeTimers(registration, 100U);
+        aggregator.CompleteFrame();
+        return registration.id;
+    };
+
+    CHECK(aggregator.GetStatistics()[registration.id].count > 0U);
+    aggregator.Reset();
+}
@@ -0,0 +1,229 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/ScopeTimerTest.cpp
+Unit tests of the scope timer histograms, per-thread aggregation, frame windows and reports
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/ScopeTimer.h>
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Methane;
+
+using Histogram  = ScopeTimer::Histogram;
+using Aggregator = ScopeTimer::Aggregator;
+
+TEST_CASE("Scope Timer Histogram", "[instrumentation][scope-timer][histogram]")
+{
+    SECTION("Bucket boundaries are continuous")
+    {
+        for (uint32_t bucket_index = 0U; bucket_index < Histogram::buckets_count - 1U; ++bucket_index)
+        {
+            const uint64_t bucket_max_value = Histogram::GetBucketMaxValue(bucket_index);
+            REQUIRE(Histogram::GetBucketIndex(bucket_max_value) == bucket_index);
+            REQUIRE(Histogram::GetBucketIndex(bucket_max_value + 1U) == bucket_index + 1U);
+        }
+        CHECK(Histogram::GetBucketIndex(std::numeric_limits<uint64_t>::max()) == Histogram::buckets_count - 1U);
+    }
+
+    SECTION("Empty histogram")
+    {
+        const Histogram histogram;
+        CHECK(histogram.GetCount() == 0U);
+        CHECK(histogram.GetMinValue() == 0U);
+        CHECK(histogram.GetMaxValue() == 0U);
+        CHECK(histogram.GetPercentileValue(50.0) == 0U);
+    }
+
+    SECTION("Percentiles of uniform values have bounded relative error")
+    {
+        Histogram histogram;
+        for (uint64_t value = 1U; value <= 10000U; ++value)
+        {
+            histogram.Add(value);
+        }
+        CHECK(histogram.GetCount() == 10000U);
+        CHECK(histogram.GetTotalValue() == 50005000U);
+        CHECK(histogram.GetMinValue() == 1U);
+        CHECK(histogram.GetMaxValue() == 10000U);
+
+        for (const double percentile : { 50.0, 95.0, 99.0 })
+        {
+            const auto exact_value = static_cast<double>(percentile * 100.0);
+            const auto value       = static_cast<double>(histogram.GetPercentileValue(percentile));
+            CHECK(value >= exact_value);
+            CHECK(value <= exact_value * (1.0 + 1.0 / Histogram::sub_buckets_count));
+        }
+        CHECK(histogram.GetPercentileValue(100.0) == 10000U);
+    }
+
+    SECTION("Merged histogram is equal to histogram of all values")
+    {
+        Histogram even_histogram;
+        Histogram odd_histogram;
+        Histogram all_histogram;
+        for (uint64_t value = 1U; value <= 1000U; ++value)
+        {
+            (value % 2U ? odd_histogram : even_histogram).Add(value * 1000U);
+            all_histogram.Add(value * 1000U);
+        }
+        even_histogram.Merge(odd_histogram);
+        CHECK(even_histogram.GetCount() == all_histogram.GetCount());
+        CHECK(even_histogram.GetTotalValue() == all_histogram.GetTotalValue());
+        CHECK(even_histogram.GetMinValue() == all_histogram.GetMinValue());
+        CHECK(even_histogram.GetMaxValue() == all_histogram.GetMaxValue());
+        CHECK(even_histogram.GetPercentileValue(95.0) == all_histogram.GetPercentileValue(95.0));
+
+        even_histogram.Reset();
+        CHECK(even_histogram.GetCount() == 0U);
+        CHECK(even_histogram.GetPercentileValue(95.0) == 0U);
+    }
+}
+
+TEST_CASE("Scope Timer Aggregation", "[instrumentation][scope-timer][aggregator]")
+{
+    Aggregator& aggregator = Aggregator::Get();
+    aggregator.Reset();
+
+    SECTION("Scope registration is reused by name")
+    {
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("Test Registered Scope");
+        const ScopeTimer::Registration same_registration = aggregator.RegisterScope(std::string("Test Registered Scope").c_str());
+        CHECK(registration.id == same_registration.id);
+        CHECK(registration.name == same_registration.name);
+        CHECK(registration.counter_ptr == same_registration.counter_ptr);
+
+        const ScopeTimer::Registration other_registration = aggregator.RegisterScope("Test Other Scope");
+        CHECK(other_registration.id != registration.id);
+        CHECK(other_registration.counter_ptr != registration.counter_ptr);
+    }
+
+    SECTION("Timings of multiple threads are aggregated")
+    {
+        constexpr uint32_t threads_count       = 4U;
+        constexpr uint32_t thread_scopes_count = 1000U;
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("Test Threads Scope");
+
+        std::vector<std::thread> threads;
+        for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&registration]()
+            {
+                for (uint32_t scope_index = 0U; scope_index < thread_scopes_count; ++scope_index)
+                {
+                    const ScopeTimer scope_timer(registration);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const Aggregator::Statistics statistics = aggregator.GetStatistics();
+        REQUIRE(registration.id < statistics.size());
+
+        const Aggregator::ScopeStatistics& scope_statistics = statistics[registration.id];
+        CHECK(std::string(scope_statistics.scope_name) == "Test Threads Scope");
+        CHECK(scope_statistics.count == threads_count * thread_scopes_count);
+        CHECK(scope_statistics.min_duration <= scope_statistics.p50_duration);
+        CHECK(scope_statistics.p50_duration <= scope_statistics.p95_duration);
+        CHECK(scope_statistics.p95_duration <= scope_statistics.p99_duration);
+        CHECK(scope_statistics.p99_duration <= scope_statistics.max_duration);
+        CHECK(scope_statistics.GetAverageDuration() <= scope_statistics.max_duration);
+    }
+
+    SECTION("Frame windows keep timings of the last frames")
+    {
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("Test Frames Scope");
+        aggregator.SetFrameWindowsCount(3U);
+
+        for (uint32_t frame_index = 0U; frame_index < 5U; ++frame_index)
+        {
+            for (uint32_t scope_index = 0U; scope_index <= frame_index; ++scope_index)
+            {
+                const ScopeTimer scope_timer(registration);
+            }
+            aggregator.CompleteFrame();
+        }
+
+        const Aggregator::FrameTimings frame_timings = aggregator.GetFrameTimings(registration.id);
+        REQUIRE(frame_timings.size() == 3U);
+        CHECK(frame_timings[0].frame_index == 2U);
+        CHECK(frame_timings[0].count == 3U);
+        CHECK(frame_timings[2].frame_index == 4U);
+        CHECK(frame_timings[2].count == 5U);
+        CHECK(aggregator.GetStatistics()[registration.id].count == 15U);
+
+        aggregator.SetFrameWindowsCount(1U);
+        CHECK(aggregator.GetFrameTimings(registration.id).size() == 1U);
+        aggregator.SetFrameWindowsCount(120U);
+    }
+
+    SECTION("Reset keeps scope registrations")
+    {
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("Test Reset Scope");
+        {
+            const ScopeTimer scope_timer(registration);
+        }
+        aggregator.CompleteFrame();
+        aggregator.Reset();
+
+        CHECK(aggregator.RegisterScope("Test Reset Scope").id == registration.id);
+        CHECK(aggregator.GetStatistics()[registration.id].count == 0U);
+        CHECK(aggregator.GetFrameTimings(registration.id).empty());
+    }
+
+    SECTION("JSON and CSV reports contain timed scopes")
+    {
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("Test \"Report\" Scope");
+        {
+            const ScopeTimer scope_timer(registration);
+        }
+        aggregator.CompleteFrame();
+
+        std::stringstream json_stream;
+        aggregator.WriteJson(json_stream);
+        const std::string json = json_stream.str();
+        CHECK(json.starts_with("{\"frames_count\":1,\"scopes\":[{\"name\":\"Test \\\"Report\\\" Scope\",\"count\":1,"));
+        CHECK(json.find("\"p99_ms\":") != std::string::npos);
+        CHECK(json.find("\"frames\":[{\"frame\":0,\"count\":1,") != std::string::npos);
+        CHECK(json.ends_with("]}]}"));
+
+        std::stringstream csv_stream;
+        aggregator.WriteCsv(csv_stream);
+        std::string csv_line;
+        REQUIRE(std::getline(csv_stream, csv_line));
+        CHECK(csv_line == "scope,count,total_ms,average_ms,min_ms,p50_ms,p95_ms,p99_ms,max_ms");
+        REQUIRE(std::getline(csv_stream, csv_line));
+        CHECK(csv_line.starts_with("\"Test \"\"Report\"\" Scope\",1,"));
+        CHECK(std::ranges::count(csv_line, ',') == 8);
+        CHECK_FALSE(std::getline(csv_stream, csv_line));
+    }
+
+    aggregator.Reset();
+}
@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/TraceEventsTest.cpp
+Unit tests of the trace events recorder ring buffers and Chrome JSON export
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/TraceEvents.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+
+using namespace Methane;
+
+using Recorder = TraceEventsRecorder;
+
+// Events are recorded in a separate thread to get a clean thread ring buffer in every test section
+template<typename RecordFuncType>
+static Recorder::Events RecordThreadEvents(const RecordFuncType& record_func)
+{
+    Recorder::Events events;
+    std::thread record_thread([&record_func, &events]()
+    {
+        record_func();
+        events = Recorder::Get().GetCurrentThreadEvents();
+    });
+    record_thread.join();
+    return events;
+}
+
+TEST_CASE("Trace Events Recorder", "[instrumentation][trace-events]")
+{
+    Recorder& recorder = Recorder::Get();
+
+    SECTION("Nested scopes are recorded on scope exit")
+    {
+        const Recorder::Events events = RecordThreadEvents([]()
+        {
+            const TraceEventsScope outer_scope("Outer Scope");
+            const TraceEventsScope inner_scope("Inner Scope");
+        });
+
+        REQUIRE(events.size() == 2U);
+        CHECK(std::string(events[0].name) == "Inner Scope");
+        CHECK(std::string(events[1].name) == "Outer Scope");
+        CHECK(events[0].type == Recorder::EventType::Scope);
+        CHECK(events[1].start_ns <= events[0].start_ns);
+        CHECK(events[0].start_ns + events[0].duration_ns <= events[1].start_ns + events[1].duration_ns);
+    }
+
+    SECTION("Frame events keep frame indices")
+    {
+        const Recorder::Events events = RecordThreadEvents([]()
+        {
+            Recorder::Get().AddFrameEvent(2U, 42U);
+        });
+
+        REQUIRE(events.size() == 1U);
+        CHECK(events[0].type == Recorder::EventType::Frame);
+        CHECK(events[0].frame_buffer_index == 2U);
+        CHECK(events[0].frame_index == 42U);
+        CHECK(events[0].duration_ns == 0U);
+    }
+
+    SECTION("Ring buffer keeps only the latest events")
+    {
+        constexpr uint32_t events_count = Recorder::thread_events_capacity + 10U;
+        const Recorder::Events events = RecordThreadEvents([]()
+        {
+            Recorder::Get().RegisterThread();
+            for (uint32_t event_index = 0U; event_index < events_count; ++event_index)
+            {
+                Recorder::Get().AddScopeEvent("Scope", event_index, event_index + 1U);
+            }
+        });
+
+        REQUIRE(events.size() == Recorder::thread_events_capacity);
+        CHECK(events.front().start_ns == 10U);
+        CHECK(events.back().start_ns == events_count - 1U);
+        CHECK(events.back().duration_ns == 1U);
+    }
+
+    SECTION("Scope events are dropped in threads without events buffer")
+    {
+        recorder.Clear();
+        std::stringstream json_stream;
+        std::thread unregistered_thread([]()
+        {
+            Recorder::Get().AddScopeEvent("Dropped Scope", 1000U, 2000U);
+        });
+        unregistered_thread.join();
+
+        recorder.WriteChromeJson(json_stream);
+        CHECK(json_stream.str().find("Dropped Scope") == std::string::npos);
+    }
+
+    SECTION("Chrome JSON contains thread names, scopes and frames")
+    {
+        recorder.Clear();
+        std::ignore = RecordThreadEvents([]()
+        {
+            Recorder::Get().SetThreadName("Test \"Trace\" Thread");
+            Recorder::Get().AddScopeEvent("Test Scope", 2000U, 5500U);
+            Recorder::Get().AddFrameEvent(1U, 3U);
+        });
+
+        std::stringstream json_stream;
+        recorder.WriteChromeJson(json_stream);
+        const std::string json = json_stream.str();
+        CHECK(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+        CHECK(json.find("\"ph\":\"M\"") != std::string::npos);
+        CHECK(json.find("\"args\":{\"name\":\"Test \\\"Trace\\\" Thread\"}") != std::string::npos);
+        CHECK(json.find("{\"name\":\"Test Scope\",\"cat\":\"Methane\",\"ph\":\"X\",\"ts\":2.000,\"dur\":3.500,") != std::string::npos);
+        CHECK(json.find("\"ph\":\"i\",\"s\":\"g\"") != std::string::npos);
+        CHECK(json.find("\"args\":{\"frame_index\":3,\"frame_buffer_index\":1}") != std::string::npos);
+        CHECK(json.ends_with("]}"));
+    }
+
+    SECTION("Output file path is stored for flush")
+    {
+        const std::string initial_file_path = recorder.GetOutputFilePath();
+        recorder.SetOutputFilePath("trace.json");
+        CHECK(recorder.GetOutputFilePath() == "trace.json");
+        recorder.SetOutputFilePath(initial_file_path);
+    }
+
+    recorder.Clear();
+}
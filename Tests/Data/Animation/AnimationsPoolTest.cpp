@@ -0,0 +1,165 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Animation/AnimationsPoolTest.cpp
+Unit tests of the animations pool driven by simulation clocks
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <Methane/Data/AnimationsPool.h>
+#include <Methane/Data/TimeAnimation.hpp>
+
+#include <vector>
+#include <limits>
+
+using namespace Methane;
+using namespace Methane::Data;
+using namespace std::chrono_literals;
+
+using ElapsedSeconds = std::vector<double>;
+
+static Ptr<Animation> CreateRecordingAnimation(ElapsedSeconds& elapsed_seconds, double duration_sec = std::numeric_limits<double>::max())
+{
+    return MakeTimeAnimationPtr([&elapsed_seconds](double elapsed_sec, double)
+    {
+        elapsed_seconds.push_back(elapsed_sec);
+        return true;
+    }, duration_sec);
+}
+
+static ElapsedSeconds RunAnimationFrames(IClock& clock, uint32_t frames_count)
+{
+    ElapsedSeconds elapsed_seconds;
+    AnimationsPool animations;
+    animations.push_back(CreateRecordingAnimation(elapsed_seconds));
+    animations.SetClock(clock);
+    animations.back()->Restart(); // exclude real time passed since animation creation
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        clock.Tick();
+        animations.Update();
+    }
+    return elapsed_seconds;
+}
+
+TEST_CASE("Fixed step clock", "[clock]")
+{
+    FixedStepClock clock(10ms);
+    const IClock::TimePoint start_time = clock.Now();
+    CHECK(clock.GetTimeStep() == 10ms);
+
+    clock.Tick();
+    clock.Tick();
+    CHECK(clock.Now() - start_time == 20ms);
+}
+
+TEST_CASE("Recorded clock", "[clock]")
+{
+    SECTION("Recorded time steps are summed up to clock time")
+    {
+        FixedStepClock source_clock(5ms);
+        RecordedClock recorded_clock(source_clock);
+        const IClock::TimePoint start_time = recorded_clock.Now();
+        source_clock.Tick();
+        recorded_clock.Tick();
+        source_clock.Tick();
+        source_clock.Tick();
+        recorded_clock.Tick();
+
+        CHECK_FALSE(recorded_clock.IsReplaying());
+        CHECK(recorded_clock.GetTimeSteps() == RecordedClock::TimeSteps{ 5ms, 10ms });
+        CHECK(recorded_clock.Now() - start_time == 15ms);
+    }
+
+    SECTION("Replay advances clock by recorded time steps")
+    {
+        RecordedClock replay_clock(RecordedClock::TimeSteps{ 5ms, 10ms });
+        const IClock::TimePoint start_time = replay_clock.Now();
+        CHECK(replay_clock.IsReplaying());
+
+        replay_clock.Tick();
+        CHECK(replay_clock.Now() - start_time == 5ms);
+        CHECK_FALSE(replay_clock.IsReplayCompleted());
+
+        replay_clock.Tick();
+        CHECK(replay_clock.Now() - start_time == 15ms);
+        CHECK(replay_clock.IsReplayCompleted());
+
+        replay_clock.Tick();
+        CHECK(replay_clock.Now() - start_time == 15ms);
+    }
+}
+
+TEST_CASE("Animations pool with simulation clock", "[animation]")
+{
+    SECTION("Fixed step clock drives animation time")
+    {
+        FixedStepClock clock(20ms);
+        const ElapsedSeconds elapsed_seconds = RunAnimationFrames(clock, 3U);
+        REQUIRE(elapsed_seconds.size() == 3U);
+        CHECK(elapsed_seconds[0] == Catch::Approx(0.02));
+        CHECK(elapsed_seconds[1] == Catch::Approx(0.04));
+        CHECK(elapsed_seconds[2] == Catch::Approx(0.06));
+    }
+
+    SECTION("Fixed step runs are deterministic")
+    {
+        FixedStepClock first_clock(16ms);
+        FixedStepClock second_clock(16ms);
+        CHECK(RunAnimationFrames(first_clock, 10U) == RunAnimationFrames(second_clock, 10U));
+    }
+
+    SECTION("Replay of recorded clock reproduces animation time")
+    {
+        RecordedClock recording_clock;
+        const ElapsedSeconds recorded_seconds = RunAnimationFrames(recording_clock, 5U);
+
+        RecordedClock replay_clock(recording_clock.GetTimeSteps());
+        CHECK(RunAnimationFrames(replay_clock, 5U) == recorded_seconds);
+    }
+
+    SECTION("Animation is completed by simulation time")
+    {
+        FixedStepClock clock(100ms);
+        ElapsedSeconds elapsed_seconds;
+        AnimationsPool animations;
+        animations.SetClock(clock);
+        animations.push_back(CreateRecordingAnimation(elapsed_seconds, 0.25));
+        for(uint32_t frame_index = 0U; frame_index < 3U; ++frame_index)
+        {
+            clock.Tick();
+            animations.Update();
+        }
+        CHECK(animations.empty());
+        CHECK(elapsed_seconds.size() == 2U);
+    }
+
+    SECTION("Animation added to pool is switched to pool clock")
+    {
+        FixedStepClock clock(10ms);
+        ElapsedSeconds elapsed_seconds;
+        AnimationsPool animations;
+        animations.SetClock(clock);
+        animations.push_back(CreateRecordingAnimation(elapsed_seconds));
+        animations.Update();
+        CHECK(&animations.front()->GetClock() == &clock);
+    }
+}
@@ -0,0 +1,133 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Animation/InterpolationAnimationsTest.cpp
+Unit tests of the data-oriented interpolation animations system
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <Methane/Data/InterpolationAnimations.hpp>
+#include <Methane/Data/AnimationsPool.h>
+
+#include <taskflow/core/executor.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Data;
+using namespace std::chrono_literals;
+
+static void UpdateFrames(FixedStepClock& clock, AnimationsPool& animations, uint32_t frames_count)
+{
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        clock.Tick();
+        animations.Update();
+    }
+}
+
+TEST_CASE("Interpolation animations", "[animation]")
+{
+    FixedStepClock clock(100ms);
+    AnimationsPool animations;
+    const Ptr<InterpolationAnimations<float>> interpolations_ptr = MakeInterpolationAnimationsPtr<float>();
+    animations.push_back(interpolations_ptr);
+    animations.SetClock(clock);
+    interpolations_ptr->Restart();
+
+    SECTION("Values are interpolated linearly until completion")
+    {
+        float value = 1.F;
+        const auto id = interpolations_ptr->Add(value, 3.F, 0.4);
+        UpdateFrames(clock, animations, 1U);
+        CHECK(value == Catch::Approx(1.5F));
+        CHECK(interpolations_ptr->IsRunning(id));
+
+        UpdateFrames(clock, animations, 3U);
+        CHECK(value == Catch::Approx(3.F));
+        CHECK_FALSE(interpolations_ptr->IsRunning(id));
+        CHECK(interpolations_ptr->IsEmpty());
+        CHECK(animations.size() == 1U);
+    }
+
+    SECTION("Completed animations are swap-removed")
+    {
+        std::vector<float> values{ 0.F, 0.F, 0.F };
+        const auto short_id  = interpolations_ptr->Add(values[0], 1.F, 0.1);
+        const auto long_id   = interpolations_ptr->Add(values[1], 1.F, 1.0);
+        const auto medium_id = interpolations_ptr->Add(values[2], 1.F, 0.5);
+        UpdateFrames(clock, animations, 1U);
+        CHECK(interpolations_ptr->GetCount() == 2U);
+        CHECK_FALSE(interpolations_ptr->IsRunning(short_id));
+        CHECK(interpolations_ptr->IsRunning(long_id));
+        CHECK(interpolations_ptr->IsRunning(medium_id));
+
+        UpdateFrames(clock, animations, 1U);
+        CHECK(values[0] == Catch::Approx(1.F));
+        CHECK(values[1] == Catch::Approx(0.2F));
+        CHECK(values[2] == Catch::Approx(0.4F));
+    }
+
+    SECTION("Removed animation does not update value")
+    {
+        float value = 0.F;
+        const auto id = interpolations_ptr->Add(value, 1.F, 1.0);
+        UpdateFrames(clock, animations, 1U);
+        CHECK(interpolations_ptr->Remove(id));
+        CHECK_FALSE(interpolations_ptr->Remove(id));
+        UpdateFrames(clock, animations, 1U);
+        CHECK(value == Catch::Approx(0.1F));
+    }
+}
+
+TEST_CASE("Interpolation animations parallel update", "[animation]")
+{
+    constexpr size_t values_count = InterpolationAnimations<float>::update_chunk_size * 4U + 17U;
+
+    tf::Executor executor;
+    FixedStepClock clock(250ms);
+    AnimationsPool animations;
+    const Ptr<InterpolationAnimations<float>> interpolations_ptr = MakeInterpolationAnimationsPtr<float>(&executor);
+    animations.push_back(interpolations_ptr);
+    animations.SetClock(clock);
+    interpolations_ptr->Restart();
+
+    std::vector<float> values(values_count, 0.F);
+    interpolations_ptr->Reserve(values_count);
+    for(size_t index = 0U; index < values_count; ++index)
+    {
+        interpolations_ptr->Add(values[index], static_cast<float>(index), index % 2U ? 1.0 : 0.5);
+    }
+
+    UpdateFrames(clock, animations, 1U);
+    CHECK(values[1] == Catch::Approx(0.25F));
+    CHECK(values[values_count - 1U] == Catch::Approx(static_cast<float>(values_count - 1U) * 0.5F));
+
+    UpdateFrames(clock, animations, 1U);
+    CHECK(interpolations_ptr->GetCount() == values_count / 2U);
+
+    UpdateFrames(clock, animations, 2U);
+    CHECK(interpolations_ptr->IsEmpty());
+    for(size_t index = 0U; index < values_count; ++index)
+    {
+        CHECK(values[index] == Catch::Approx(static_cast<float>(index)));
+    }
+}
@@ -0,0 +1,193 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/FramePacerTest.cpp
+Unit tests of the frame pacer with simulated CPU and GPU frame timings
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <Methane/Data/FramePacer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Data;
+using namespace std::chrono_literals;
+
+// Simulates application frames loop with frame phases executed on CPU and frames rendered on GPU one after another
+class FramesLoopSimulator
+{
+public:
+    struct FrameDurations
+    {
+        double update_ms;
+        double render_ms;
+        double gpu_ms;
+    };
+
+    explicit FramesLoopSimulator(uint32_t max_frames_in_flight)
+        : m_max_frames_in_flight(max_frames_in_flight)
+    {
+        m_pacer.SetMaxFramesInFlight(max_frames_in_flight);
+    }
+
+    FramePacer& GetPacer() noexcept { return m_pacer; }
+
+    void RunFrames(uint32_t frames_count, const FrameDurations& durations)
+    {
+        for (uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+        {
+            Advance(m_pacer.GetStartDelayMs());
+            m_pacer.OnFrameStarted();
+            Advance(durations.update_ms);
+            m_pacer.OnFrameRenderStarted();
+
+            // CPU waits for completion of the frame rendered max frames in flight before the current one
+            if (m_gpu_completion_times_ms.size() >= m_max_frames_in_flight)
+                Advance(std::max(0.0, m_gpu_completion_times_ms[m_gpu_completion_times_ms.size() - m_max_frames_in_flight] - m_time_ms));
+
+            m_pacer.OnFrameWaitCompleted(m_max_frames_in_flight);
+            Advance(durations.render_ms);
+
+            const double gpu_start_time_ms = m_gpu_completion_times_ms.empty() ? m_time_ms : std::max(m_time_ms, m_gpu_completion_times_ms.back());
+            m_gpu_completion_times_ms.push_back(gpu_start_time_ms + durations.gpu_ms);
+        }
+    }
+
+private:
+    void Advance(double duration_ms)
+    {
+        const auto ticks_count = static_cast<uint32_t>(std::lround(duration_ms * 10.0));
+        for (uint32_t tick_index = 0U; tick_index < ticks_count; ++tick_index)
+        {
+            m_clock.Tick();
+        }
+        m_time_ms += static_cast<double>(ticks_count) / 10.0;
+    }
+
+    const uint32_t      m_max_frames_in_flight;
+    FixedStepClock      m_clock{ 100us };
+    FramePacer          m_pacer{ m_clock };
+    double              m_time_ms = 0.0;
+    std::vector<double> m_gpu_completion_times_ms;
+};
+
+static constexpr FramesLoopSimulator::FrameDurations g_cpu_bound_frame{ 2.0, 3.0, 1.0 };
+static constexpr FramesLoopSimulator::FrameDurations g_gpu_bound_frame{ 2.0, 3.0, 10.0 };
+
+TEST_CASE("Frame pacer phase timings", "[frame-pacer]")
+{
+    FramesLoopSimulator frames_loop(1U);
+    frames_loop.RunFrames(3U, g_cpu_bound_frame);
+
+    const FramePacer::FramesTimings& frames_timings = frames_loop.GetPacer().GetFramesTimings();
+    REQUIRE(frames_timings.size() == 3U);
+
+    SECTION("CPU frame phase timings are measured")
+    {
+        CHECK(frames_timings[0].frame_index == 0U);
+        CHECK(frames_timings[1].frame_index == 1U);
+        CHECK(frames_timings[0].update_time_ms == Catch::Approx(2.0));
+        CHECK(frames_timings[0].wait_time_ms == Catch::Approx(0.0));
+        CHECK(frames_timings[0].render_time_ms == Catch::Approx(3.0));
+        CHECK(frames_timings[1].render_time_ms == Catch::Approx(3.0));
+    }
+
+    SECTION("Latency is measured up to observed GPU frame completion")
+    {
+        CHECK(frames_timings[0].is_completed);
+        CHECK(frames_timings[0].latency_ms == Catch::Approx(7.0));
+        CHECK(frames_timings[1].is_completed);
+        CHECK_FALSE(frames_timings[2].is_completed);
+        CHECK(frames_loop.GetPacer().GetFramesInFlightCount() == 1U);
+    }
+
+    SECTION("Average timings are calculated for completed frames")
+    {
+        const FramePacer::FrameTimings average_timings = frames_loop.GetPacer().GetAverageFrameTimings();
+        CHECK(average_timings.is_completed);
+        CHECK(average_timings.update_time_ms == Catch::Approx(2.0));
+        CHECK(average_timings.render_time_ms == Catch::Approx(3.0));
+        CHECK(average_timings.latency_ms == Catch::Approx(7.0));
+    }
+}
+
+TEST_CASE("Frame pacer frames in flight", "[frame-pacer]")
+{
+    FramesLoopSimulator single_frame_loop(1U);
+    FramesLoopSimulator triple_frames_loop(3U);
+    single_frame_loop.RunFrames(50U, g_gpu_bound_frame);
+    triple_frames_loop.RunFrames(50U, g_gpu_bound_frame);
+
+    CHECK(single_frame_loop.GetPacer().GetFramesInFlightCount() == 1U);
+    CHECK(triple_frames_loop.GetPacer().GetFramesInFlightCount() == 3U);
+
+    // More frames in flight keep GPU busy at the cost of higher latency
+    const FramePacer::FrameTimings single_frame_timings = single_frame_loop.GetPacer().GetAverageFrameTimings();
+    const FramePacer::FrameTimings triple_frames_timings = triple_frames_loop.GetPacer().GetAverageFrameTimings();
+    CHECK(single_frame_timings.latency_ms < triple_frames_timings.latency_ms);
+    CHECK(single_frame_timings.wait_time_ms > triple_frames_timings.wait_time_ms);
+}
+
+TEST_CASE("Frame pacer latency targeting", "[frame-pacer]")
+{
+    FramesLoopSimulator frames_loop(2U);
+    FramePacer& frame_pacer = frames_loop.GetPacer();
+
+    SECTION("Frame start is not delayed without target latency")
+    {
+        frames_loop.RunFrames(50U, g_gpu_bound_frame);
+        CHECK(frame_pacer.GetStartDelayMs() == 0.0);
+        CHECK(frame_pacer.GetAverageFrameTimings().wait_time_ms > 1.0);
+    }
+
+    SECTION("Frame start is delayed instead of waiting for GPU")
+    {
+        frame_pacer.SetTargetLatency(5.0);
+        frames_loop.RunFrames(50U, g_gpu_bound_frame);
+        frame_pacer.SetHistorySize(10U);
+
+        const FramePacer::FrameTimings average_timings = frame_pacer.GetAverageFrameTimings();
+        CHECK(frame_pacer.GetFramesTimings().size() == 10U);
+        CHECK(frame_pacer.GetStartDelayMs() > 0.0);
+        CHECK(average_timings.start_delay_ms > 0.0);
+        CHECK(average_timings.wait_time_ms < 1.0);
+    }
+
+    SECTION("Frame start delay is not used when latency is below target")
+    {
+        frame_pacer.SetTargetLatency(100.0);
+        frames_loop.RunFrames(50U, g_gpu_bound_frame);
+        CHECK(frame_pacer.GetStartDelayMs() == 0.0);
+    }
+
+    SECTION("Frame start delay is reset with target latency")
+    {
+        frame_pacer.SetTargetLatency(5.0);
+        frames_loop.RunFrames(10U, g_gpu_bound_frame);
+        REQUIRE(frame_pacer.GetStartDelayMs() > 0.0);
+        frame_pacer.SetTargetLatency(0.0);
+        CHECK(frame_pacer.GetStartDelayMs() == 0.0);
+        CHECK_THROWS(frame_pacer.SetTargetLatency(-1.0));
+    }
+}
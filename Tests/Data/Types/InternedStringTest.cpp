@@ -0,0 +1,108 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Types/InternedStringTest.cpp
+Unit-tests of the InternedString data type.
+
+******************************************************************************/
+
+#include <Methane/Data/InternedString.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace Methane::Data;
+
+TEST_CASE("Interned String", "[data][string]")
+{
+    SECTION("Default string is empty")
+    {
+        const InternedString str;
+        CHECK(str.IsEmpty());
+        CHECK(str.GetId() == InternedString::empty_id);
+        CHECK(str.GetString().empty());
+        CHECK(str == InternedString(""));
+    }
+
+    SECTION("Equal strings are interned with the same id and storage")
+    {
+        const std::string text = "Interned Test String";
+        const InternedString first_str(text);
+        const InternedString second_str(std::string_view(text).substr(0U));
+        CHECK_FALSE(first_str.IsEmpty());
+        CHECK(first_str == second_str);
+        CHECK(first_str.GetId() == second_str.GetId());
+        CHECK(&first_str.GetString() == &second_str.GetString());
+        CHECK(first_str == std::string_view("Interned Test String"));
+        CHECK(first_str.GetView() == text);
+    }
+
+    SECTION("Different strings are interned with different ids")
+    {
+        const InternedString first_str("Interned String A");
+        const InternedString second_str("Interned String B");
+        CHECK_FALSE(first_str == second_str);
+        CHECK(first_str.GetId() != second_str.GetId());
+        CHECK(std::hash<InternedString>()(first_str) != std::hash<InternedString>()(second_str));
+    }
+
+    SECTION("Find does not intern missing strings")
+    {
+        const size_t interned_count = InternedString::GetInternedCount();
+        CHECK_FALSE(InternedString::Find("Not Interned String"));
+        CHECK(InternedString::GetInternedCount() == interned_count);
+
+        const InternedString str("Found Interned String");
+        const std::optional<InternedString> found_str_opt = InternedString::Find("Found Interned String");
+        REQUIRE(found_str_opt);
+        CHECK(*found_str_opt == str);
+    }
+
+    SECTION("Strings are interned from multiple threads")
+    {
+        constexpr uint32_t threads_count = 4U;
+        constexpr uint32_t strings_count = 1000U;
+        std::vector<std::vector<InternedString::Id>> thread_ids(threads_count);
+        std::vector<std::thread> threads;
+        for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&ids = thread_ids[thread_index]]()
+            {
+                for (uint32_t string_index = 0U; string_index < strings_count; ++string_index)
+                {
+                    ids.push_back(InternedString("Thread String " + std::to_string(string_index)).GetId());
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const std::unordered_set<InternedString::Id> unique_ids(thread_ids[0].begin(), thread_ids[0].end());
+        CHECK(unique_ids.size() == strings_count);
+        for (uint32_t thread_index = 1U; thread_index < threads_count; ++thread_index)
+        {
+            CHECK(thread_ids[thread_index] == thread_ids[0]);
+        }
+    }
+}
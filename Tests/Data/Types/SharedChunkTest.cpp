@@ -0,0 +1,136 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Types/SharedChunkTest.cpp
+Unit-tests of the SharedChunk data type and zero-copy sharing of data chunks.
+
+******************************************************************************/
+
+#include <Methane/Data/Chunk.hpp>
+#include <Methane/Data/SharedChunk.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane::Data;
+
+static Bytes CreateTestBytes(size_t size)
+{
+    Bytes bytes(size);
+    for (size_t index = 0U; index < size; ++index)
+    {
+        bytes[index] = static_cast<Byte>(index);
+    }
+    return bytes;
+}
+
+TEST_CASE("Shared Data Chunk", "[data][chunk]")
+{
+    SECTION("Bytes container is owned without copying")
+    {
+        Bytes bytes = CreateTestBytes(16U);
+        const ConstRawPtr bytes_ptr = bytes.data();
+        const ChunkCopyScope copy_scope;
+        const SharedChunk shared_chunk(std::move(bytes));
+        CHECK(shared_chunk.GetDataPtr() == bytes_ptr);
+        CHECK(shared_chunk.GetDataSize() == 16U);
+        CHECK(shared_chunk.GetOwnersCount() == 1);
+        CHECK(copy_scope.GetCopiedBytes() == 0U);
+    }
+
+    SECTION("Slice references the same owner")
+    {
+        const SharedChunk shared_chunk(CreateTestBytes(16U));
+        const SharedChunk slice = shared_chunk.Slice(4U, 8U);
+        CHECK(slice.GetDataPtr() == shared_chunk.GetDataPtr() + 4U);
+        CHECK(slice.GetDataSize() == 8U);
+        CHECK(slice.GetDataPtr()[0] == Byte{ 4 });
+        CHECK(slice.GetOwnerPtr() == shared_chunk.GetOwnerPtr());
+        CHECK(shared_chunk.GetOwnersCount() == 2);
+        CHECK(shared_chunk.Slice(16U, 0U).IsEmptyOrNull());
+    }
+
+    SECTION("Custom deleter is called when the last reference is released")
+    {
+        Bytes bytes = CreateTestBytes(8U);
+        uint32_t release_count = 0U;
+        {
+            const SharedChunk shared_chunk = SharedChunk::Own(bytes.data(), 8U, [&release_count](ConstRawPtr) { release_count++; });
+            const SharedChunk slice = shared_chunk.Slice(2U, 2U);
+            const Chunk chunk(slice);
+            CHECK(chunk.IsDataShared());
+            CHECK(chunk.GetDataPtr() == bytes.data() + 2U);
+            CHECK(release_count == 0U);
+        }
+        CHECK(release_count == 1U);
+    }
+
+    SECTION("Externally owned data is shared without copying")
+    {
+        Bytes bytes = CreateTestBytes(16U);
+        const ChunkCopyScope copy_scope;
+        const SharedChunk shared_chunk = SharedChunk::Own(bytes.data(), 16U, [](ConstRawPtr) { });
+        const Chunk chunk(shared_chunk.Slice(4U, 8U));
+        CHECK(chunk.GetDataPtr() == bytes.data() + 4U);
+        CHECK(chunk.GetDataSize() == 8U);
+        CHECK(copy_scope.GetCopiedBytes() == 0U);
+    }
+
+    SECTION("Copied bytes are counted")
+    {
+        const Bytes bytes = CreateTestBytes(16U);
+        const ChunkCopyScope copy_scope;
+        const SharedChunk shared_chunk = SharedChunk::CopyFrom(bytes.data(), 16U);
+        CHECK(shared_chunk.GetDataPtr() != bytes.data());
+        CHECK(copy_scope.GetCopiedBytes() == 16U);
+    }
+}
+
+TEST_CASE("Data Chunk Sharing", "[data][chunk]")
+{
+    SECTION("Copy of shared chunk references the same data")
+    {
+        const Chunk chunk(SharedChunk(CreateTestBytes(16U)));
+        const ChunkCopyScope copy_scope;
+        const Chunk chunk_copy(chunk);
+        CHECK(chunk_copy.IsDataShared());
+        CHECK(chunk_copy.GetDataPtr() == chunk.GetDataPtr());
+        CHECK(chunk_copy.GetDataSize() == 16U);
+        CHECK(copy_scope.GetCopiedBytes() == 0U);
+    }
+
+    SECTION("Copy of stored chunk is counted")
+    {
+        Chunk chunk(CreateTestBytes(16U));
+        const ChunkCopyScope copy_scope;
+        const Chunk chunk_copy(chunk);
+        CHECK(chunk_copy.IsDataStored());
+        CHECK(chunk_copy.GetDataPtr() != chunk.GetDataPtr());
+        CHECK(copy_scope.GetCopiedBytes() == 16U);
+    }
+
+    SECTION("Stored chunk data is shared without copying")
+    {
+        Chunk chunk(CreateTestBytes(16U));
+        const ConstRawPtr data_ptr = chunk.GetDataPtr();
+        const ChunkCopyScope copy_scope;
+        const SharedChunk shared_chunk = std::move(chunk).Share();
+        CHECK(shared_chunk.GetDataPtr() == data_ptr);
+        CHECK(shared_chunk.GetDataSize() == 16U);
+        CHECK(copy_scope.GetCopiedBytes() == 0U);
+    }
+}
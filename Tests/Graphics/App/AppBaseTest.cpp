@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/App/AppBaseTest.cpp
+Unit-tests of the Graphics Application headless run with Null RHI
+
+******************************************************************************/
+
+#include <Methane/Graphics/App.hpp>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <filesystem>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+struct HeadlessTestFrame final : AppFrame
+{
+    Rhi::RenderCommandList render_cmd_list;
+    Rhi::CommandListSet    execute_cmd_list_set;
+    using AppFrame::AppFrame;
+};
+
+using GraphicsApp = Graphics::App<HeadlessTestFrame>;
+class HeadlessGraphicsTestApp final // NOSONAR - destructor required
+    : public GraphicsApp
+{
+public:
+    HeadlessGraphicsTestApp()
+        : GraphicsApp(CombinedAppSettings{
+            Platform::AppSettings{ "Headless Graphics Test App", { 0.5F, 0.5F } },
+            Graphics::AppSettings{ .show_hud_in_window_title = false },
+            Rhi::RenderContextSettings{ .clear_color = Color4F(0.F, 0.F, 0.F, 1.F) }
+        })
+    { }
+
+    ~HeadlessGraphicsTestApp() override
+    {
+        WaitForRenderComplete();
+    }
+
+    void Init() override
+    {
+        GraphicsApp::Init();
+
+        const Rhi::CommandQueue& cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
+        for (HeadlessTestFrame& frame : GetFrames())
+        {
+            frame.render_cmd_list = cmd_queue.CreateRenderCommandList(frame.screen_pass);
+            frame.render_cmd_list.SetName(fmt::format("Render Headless Frame {}", frame.index));
+            frame.execute_cmd_list_set = Rhi::CommandListSet({ frame.render_cmd_list.GetInterface() }, frame.index);
+        }
+
+        GraphicsApp::CompleteInitialization();
+        ++m_init_count;
+    }
+
+    bool Render() override
+    {
+        if (!GraphicsApp::Render())
+            return false;
+
+        const HeadlessTestFrame& frame = GetCurrentFrame();
+        frame.render_cmd_list.Reset();
+        frame.render_cmd_list.Commit();
+
+        GetRenderContext().GetRenderCommandKit().GetQueue().Execute(frame.execute_cmd_list_set);
+        GetRenderContext().Present();
+
+        ++m_render_count;
+        return true;
+    }
+
+    void OnContextReleased(Rhi::IContext& context) override
+    {
+        ++m_release_count;
+        GraphicsApp::OnContextReleased(context);
+    }
+
+    using GraphicsApp::GetRenderContext;
+
+    uint32_t GetInitCount() const noexcept    { return m_init_count; }
+    uint32_t GetRenderCount() const noexcept  { return m_render_count; }
+    uint32_t GetReleaseCount() const noexcept { return m_release_count; }
+
+private:
+    uint32_t m_init_count    = 0U;
+    uint32_t m_render_count  = 0U;
+    uint32_t m_release_count = 0U;
+};
+
+template<size_t args_count>
+static int RunApp(HeadlessGraphicsTestApp& app, const std::array<const char*, args_count>& args)
+{
+    return app.Run(Platform::AppRunArgs{ static_cast<int>(args.size()), const_cast<const char**>(args.data()) });
+}
+
+TEST_CASE("Graphics Application Headless Run", "[app][headless]")
+{
+    SECTION("Fixed number of frames is rendered with Null RHI without window")
+    {
+        HeadlessGraphicsTestApp app;
+        CHECK(RunApp(app, std::array{ "HeadlessGraphicsTestApp", "--headless", "--frames", "5" }) == 0);
+        CHECK(app.IsHeadless());
+        CHECK(app.GetInitCount() == 1U);
+        CHECK(app.GetRenderCount() == 5U);
+        CHECK(app.GetReleaseCount() == 0U);
+        CHECK(app.GetUpdatedFramesCount() == 5U);
+        REQUIRE(app.GetRenderContext().IsInitialized());
+        CHECK(app.GetRenderContext().GetSettings().frame_size == FrameSize(960U, 540U));
+    }
+
+    SECTION("Frame timings and pacing statistics are written to dump directory")
+    {
+        const std::filesystem::path dump_dir_path = std::filesystem::temp_directory_path() / "MethaneGraphicsHeadlessTest";
+        const std::string dump_dir = dump_dir_path.string();
+        std::filesystem::remove_all(dump_dir_path);
+
+        HeadlessGraphicsTestApp app;
+        CHECK(RunApp(app, std::array{ "HeadlessGraphicsTestApp", "--headless", "--frames", "3", "--dump-dir", dump_dir.c_str() }) == 0);
+        CHECK(app.GetRenderCount() == 3U);
+        CHECK(std::filesystem::exists(dump_dir_path / "frame_timings.csv"));
+        CHECK(std::filesystem::exists(dump_dir_path / "frame_pacing.csv"));
+        std::filesystem::remove_all(dump_dir_path);
+    }
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Camera/InstanceTransformSystemBenchmark.cpp
+Benchmark of instance transform system culling and MVP matrices composition for a million of instances
+
+******************************************************************************/
+
+#include <Methane/Graphics/InstanceTransformSystem.h>
+#include <Methane/Graphics/Camera.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <random>
+#include <string>
+#include <thread>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_instances_count = 1000000U;
+static constexpr float    g_scene_size      = 200.F;
+
+static InstanceTransformSystem CreateRandomInstances()
+{
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-g_scene_size / 2.F, g_scene_size / 2.F);
+    std::uniform_real_distribution<float> angle_distribution(0.F, 6.28F);
+    std::uniform_real_distribution<float> scale_distribution(0.5F, 2.F);
+
+    InstanceTransformSystem system(0.87F);
+    system.Resize(g_instances_count);
+    for(uint32_t instance_index = 0U; instance_index < g_instances_count; ++instance_index)
+    {
+        const hlslpp::float3 position(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float3 axis(position_distribution(rng), position_distribution(rng), 1.F);
+        system.SetTransform(instance_index, position,
+                            InstanceTransformSystem::GetAxisRotation(axis, angle_distribution(rng)),
+                            scale_distribution(rng));
+    }
+    return system;
+}
+
+TEST_CASE("Instance Transform System Culling and Composition", "[instance][transform][benchmark]")
+{
+    InstanceTransformSystem system = CreateRandomInstances();
+
+    Camera camera;
+    camera.Resize(Data::FloatSize{ 1920.F, 1080.F });
+    camera.ResetOrientation({ { 0.F, 0.F, -g_scene_size }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } });
+
+    for (const uint32_t threads_count : { 1U, std::max(1U, std::thread::hardware_concurrency()) })
+    {
+        tf::Executor parallel_executor(threads_count);
+        BENCHMARK(std::to_string(g_instances_count) + " instances updated by " + std::to_string(threads_count) + " threads")
+        {
+            system.Update(camera, parallel_executor);
+            return system.GetVisibleInstancesCount();
+        };
+    }
+}
@@ -0,0 +1,180 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Camera/InstanceTransformSystemTest.cpp
+Unit tests of instance transform system with frustum culling and MVP matrices composition
+
+******************************************************************************/
+
+#include <Methane/Graphics/InstanceTransformSystem.h>
+#include <Methane/Graphics/Camera.h>
+#include <Methane/HlslCatchHelpers.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <numbers>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+
+static tf::Executor              g_parallel_executor;
+static const float               g_precision        = 0.0001F;
+static const hlslpp::float3      g_axis_x           { 1.F, 0.F, 0.F };
+static const hlslpp::float3      g_axis_z           { 0.F, 0.F, 1.F };
+static const hlslpp::float4      g_no_rotation      { 0.F, 0.F, 0.F, 1.F };
+static const Camera::Orientation g_test_orientation { { 0.F, 0.F, -10.F }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } };
+
+static Camera CreateTestCamera()
+{
+    Camera camera;
+    camera.Resize(Data::FloatSize{ 640.F, 480.F });
+    camera.ResetOrientation(g_test_orientation);
+    return camera;
+}
+
+// Transforms point with transposed MVP matrix of visible instance, which is equivalent to mul(point, mvp)
+static hlslpp::float4 TransformPoint(const InstanceTransformSystem& system, uint32_t visible_index, const hlslpp::float3& point)
+{
+    return hlslpp::mul(system.GetVisibleMvpMatrices()[visible_index], hlslpp::float4(point, 1.F));
+}
+
+TEST_CASE("Instance transform system initialization", "[instance][transform]")
+{
+    InstanceTransformSystem system(0.5F);
+    CHECK(system.GetBoundingSphereRadius() == 0.5F);
+    CHECK(system.GetInstancesCount() == 0U);
+
+    system.Resize(3U);
+    REQUIRE(system.GetInstancesCount() == 3U);
+    for(uint32_t instance_index = 0U; instance_index < 3U; ++instance_index)
+    {
+        CHECK_THAT(system.GetPosition(instance_index), HlslVectorEquals(hlslpp::float3(0.F, 0.F, 0.F)));
+        CHECK_THAT(system.GetRotation(instance_index), HlslVectorEquals(g_no_rotation));
+        CHECK(system.GetScale(instance_index) == 1.F);
+    }
+
+    system.SetTransform(1U, hlslpp::float3(1.F, 2.F, 3.F), hlslpp::float4(0.F, 1.F, 0.F, 0.F), 4.F);
+    CHECK_THAT(system.GetPosition(1U), HlslVectorEquals(hlslpp::float3(1.F, 2.F, 3.F)));
+    CHECK_THAT(system.GetRotation(1U), HlslVectorEquals(hlslpp::float4(0.F, 1.F, 0.F, 0.F)));
+    CHECK(system.GetScale(1U) == 4.F);
+    CHECK_THROWS(system.SetScale(3U, 1.F));
+}
+
+TEST_CASE("Instance transform system MVP matrices composition", "[instance][transform][mvp]")
+{
+    InstanceTransformSystem system(0.1F);
+    system.Resize(1U);
+
+    SECTION("Identity transformation with camera view-projection")
+    {
+        const Camera camera = CreateTestCamera();
+        system.Update(camera, g_parallel_executor);
+        REQUIRE(system.GetVisibleInstancesCount() == 1U);
+
+        const hlslpp::float3 point(0.5F, -0.25F, 1.F);
+        CHECK_THAT(TransformPoint(system, 0U, point),
+                   HlslVectorApproxEquals(hlslpp::mul(hlslpp::float4(point, 1.F), camera.GetViewProjMatrix()), g_precision));
+    }
+
+    SECTION("Scale, rotation and translation are applied in order")
+    {
+        const float half_pi = std::numbers::pi_v<float> / 2.F;
+        system.SetTransform(0U, hlslpp::float3(0.1F, 0.2F, 0.5F), InstanceTransformSystem::GetAxisRotation(g_axis_z, half_pi), 0.5F);
+        system.Update(hlslpp::float4x4::identity(), g_parallel_executor);
+        REQUIRE(system.GetVisibleInstancesCount() == 1U);
+        CHECK_THAT(TransformPoint(system, 0U, hlslpp::float3(1.F, 0.F, 0.F)), HlslVectorApproxEquals(hlslpp::float4(0.1F, 0.7F, 0.5F, 1.F), g_precision));
+    }
+}
+
+TEST_CASE("Instance transform system rotations", "[instance][transform][rotation]")
+{
+    const float half_pi = std::numbers::pi_v<float> / 2.F;
+    const hlslpp::float4 x_rotation = InstanceTransformSystem::GetAxisRotation(g_axis_x, half_pi);
+    const hlslpp::float4 z_rotation = InstanceTransformSystem::GetAxisRotation(g_axis_z, half_pi);
+
+    SECTION("Axis rotations are combined to rotation by sum of angles")
+    {
+        CHECK_THAT(InstanceTransformSystem::CombineRotations(z_rotation, z_rotation),
+                   HlslVectorApproxEquals(InstanceTransformSystem::GetAxisRotation(g_axis_z, std::numbers::pi_v<float>), g_precision));
+    }
+
+    SECTION("First rotation is applied before the second one")
+    {
+        InstanceTransformSystem system(0.1F);
+        system.Resize(2U);
+        system.SetTransform(0U, hlslpp::float3(0.F, 0.F, 0.5F), InstanceTransformSystem::CombineRotations(x_rotation, z_rotation), 0.1F);
+        system.SetTransform(1U, hlslpp::float3(0.F, 0.F, 0.5F), InstanceTransformSystem::CombineRotations(z_rotation, x_rotation), 0.1F);
+        system.Update(hlslpp::float4x4::identity(), g_parallel_executor);
+        REQUIRE(system.GetVisibleInstancesCount() == 2U);
+        CHECK_THAT(TransformPoint(system, 0U, hlslpp::float3(0.F, 1.F, 0.F)), HlslVectorApproxEquals(hlslpp::float4(0.F, 0.F, 0.6F, 1.F), g_precision));
+        CHECK_THAT(TransformPoint(system, 1U, hlslpp::float3(0.F, 1.F, 0.F)), HlslVectorApproxEquals(hlslpp::float4(-0.1F, 0.F, 0.5F, 1.F), g_precision));
+    }
+}
+
+TEST_CASE("Instance transform system frustum culling", "[instance][transform][culling]")
+{
+    const Camera camera = CreateTestCamera();
+    InstanceTransformSystem system(1.F);
+
+    SECTION("Instances outside of frustum are culled")
+    {
+        system.Resize(6U);
+        system.SetPosition(0U, hlslpp::float3(    0.F, 0.F,    0.F)); // in front of camera
+        system.SetPosition(1U, hlslpp::float3(    0.F, 0.F,  -20.F)); // behind camera
+        system.SetPosition(2U, hlslpp::float3( 1000.F, 0.F,    0.F)); // right of frustum
+        system.SetPosition(3U, hlslpp::float3(    0.F, 0.F,  500.F)); // beyond far plane
+        system.SetPosition(4U, hlslpp::float3(    2.F, 1.F,    5.F)); // in front of camera
+        system.SetPosition(5U, hlslpp::float3(   16.F, 0.F,    0.F)); // intersects right plane with scaled bounding sphere
+        system.SetScale(5U, 5.F);
+        system.Update(camera, g_parallel_executor);
+
+        CHECK(system.GetVisibleInstances() == InstanceTransformSystem::InstanceIndices{ 0U, 4U, 5U });
+        CHECK(system.GetVisibleMvpMatrices().size() == 3U);
+    }
+
+    SECTION("Visible instances are compacted in original order across chunks")
+    {
+        const uint32_t instances_count = InstanceTransformSystem::chunk_size * 2U + 123U;
+        system.Resize(instances_count);
+        for(uint32_t instance_index = 0U; instance_index < instances_count; ++instance_index)
+        {
+            system.SetPosition(instance_index, hlslpp::float3(0.F, 0.F, instance_index % 3U ? -100.F : 0.F));
+        }
+        system.Update(camera, g_parallel_executor);
+
+        const InstanceTransformSystem::InstanceIndices& visible_instances = system.GetVisibleInstances();
+        REQUIRE(visible_instances.size() == (instances_count + 2U) / 3U);
+        for(uint32_t visible_index = 0U; visible_index < visible_instances.size(); ++visible_index)
+        {
+            CHECK(visible_instances[visible_index] == visible_index * 3U);
+        }
+    }
+
+    SECTION("Visibility is updated after instance transformation change")
+    {
+        system.Resize(1U);
+        system.Update(camera, g_parallel_executor);
+        CHECK(system.GetVisibleInstancesCount() == 1U);
+
+        system.SetPosition(0U, hlslpp::float3(0.F, 0.F, -50.F));
+        system.Update(camera, g_parallel_executor);
+        CHECK(system.GetVisibleInstancesCount() == 0U);
+        CHECK(system.GetVisibleMvpMatrices().empty());
+    }
+}
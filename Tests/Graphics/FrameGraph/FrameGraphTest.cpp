@@ -0,0 +1,365 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/FrameGraph/FrameGraphTest.cpp
+Unit tests of frame graph compilation and execution with transient textures aliasing
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrameGraph.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/Device.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using ResourceState   = Rhi::ResourceState;
+using StateTransition = FrameGraph::StateTransition;
+
+static tf::Executor g_parallel_executor;
+
+static const Rhi::TextureSettings g_color_settings = Rhi::TextureSettings::ForImage(
+    Dimensions(640U, 480U), {}, PixelFormat::RGBA8Unorm, false,
+    Rhi::ResourceUsageMask{ Rhi::ResourceUsage::RenderTarget, Rhi::ResourceUsage::ShaderRead });
+static const Rhi::TextureSettings g_depth_settings = Rhi::TextureSettings::ForDepthStencil(
+    Dimensions(640U, 480U), PixelFormat::Depth32Float, {},
+    Rhi::ResourceUsageMask{ Rhi::ResourceUsage::RenderTarget, Rhi::ResourceUsage::ShaderRead });
+
+static Rhi::ICommandList* ExecuteEmptyPass(const FrameGraph::PassContext&) { return nullptr; }
+
+static FrameGraph::PassId AddTestPass(FrameGraph& frame_graph, const std::string& name,
+                                      FrameGraph::ResourceAccesses reads, FrameGraph::ResourceAccesses writes,
+                                      bool has_side_effects = false)
+{
+    return frame_graph.AddPass(FrameGraph::PassSettings{ name, std::move(reads), std::move(writes), has_side_effects }, &ExecuteEmptyPass);
+}
+
+// Deferred-like graph: shadow and geometry passes are independent, lighting pass combines them,
+// debug view pass reads geometry buffer but its result is not used and should be culled
+struct DeferredFrameGraph
+{
+    FrameGraph             graph;
+    FrameGraph::ResourceId shadow_map    = graph.AddTexture("Shadow Map", g_depth_settings);
+    FrameGraph::ResourceId albedo        = graph.AddTexture("Albedo", g_color_settings);
+    FrameGraph::ResourceId normals       = graph.AddTexture("Normals", g_color_settings);
+    FrameGraph::ResourceId depth         = graph.AddTexture("Depth", g_depth_settings);
+    FrameGraph::ResourceId debug_view    = graph.AddTexture("Debug View", g_color_settings);
+    FrameGraph::ResourceId lighting      = graph.AddTexture("Lighting", g_color_settings);
+    FrameGraph::ResourceId screen        = graph.AddTexture("Screen", g_color_settings);
+    FrameGraph::PassId     shadow_pass   = AddTestPass(graph, "Shadow", {}, { { shadow_map, ResourceState::DepthWrite } });
+    FrameGraph::PassId     gbuffer_pass  = AddTestPass(graph, "GBuffer", {},
+        { { albedo, ResourceState::RenderTarget }, { normals, ResourceState::RenderTarget }, { depth, ResourceState::DepthWrite } });
+    FrameGraph::PassId     debug_pass    = AddTestPass(graph, "Debug", { { normals, ResourceState::ShaderResource } },
+                                                       { { debug_view, ResourceState::RenderTarget } });
+    FrameGraph::PassId     lighting_pass = AddTestPass(graph, "Lighting",
+        { { shadow_map, ResourceState::ShaderResource }, { albedo, ResourceState::ShaderResource },
+          { normals, ResourceState::ShaderResource }, { depth, ResourceState::ShaderResource } },
+        { { lighting, ResourceState::RenderTarget } });
+    FrameGraph::PassId     post_pass     = AddTestPass(graph, "Post", { { lighting, ResourceState::ShaderResource } },
+                                                       { { screen, ResourceState::RenderTarget } });
+
+    DeferredFrameGraph()
+    {
+        graph.MarkOutput(screen);
+        graph.Compile();
+    }
+};
+
+TEST_CASE("Frame graph passes ordering and culling", "[frame-graph][compile]")
+{
+    SECTION("Independent passes share dependency level and unused passes are culled")
+    {
+        const DeferredFrameGraph deferred;
+        const FrameGraph& graph = deferred.graph;
+        CHECK(graph.IsCompiled());
+        CHECK(graph.GetLevelsCount() == 3U);
+        CHECK(graph.GetPassLevel(deferred.shadow_pass) == 0U);
+        CHECK(graph.GetPassLevel(deferred.gbuffer_pass) == 0U);
+        CHECK(graph.GetPassLevel(deferred.lighting_pass) == 1U);
+        CHECK(graph.GetPassLevel(deferred.post_pass) == 2U);
+        CHECK(graph.IsPassCulled(deferred.debug_pass));
+        CHECK_FALSE(graph.IsPassCulled(deferred.lighting_pass));
+        CHECK(graph.GetExecutionOrder() == std::vector<FrameGraph::PassId>{
+            deferred.shadow_pass, deferred.gbuffer_pass, deferred.lighting_pass, deferred.post_pass });
+    }
+
+    SECTION("Passes of the same level are executed in declaration order")
+    {
+        FrameGraph graph;
+        const FrameGraph::ResourceId first  = graph.AddTexture("First", g_color_settings);
+        const FrameGraph::ResourceId second = graph.AddTexture("Second", g_color_settings);
+        const FrameGraph::PassId independent_pass = AddTestPass(graph, "Independent", {}, {}, true);
+        const FrameGraph::PassId producer_pass    = AddTestPass(graph, "Producer", {}, { { first, ResourceState::RenderTarget } });
+        const FrameGraph::PassId consumer_pass    = AddTestPass(graph, "Consumer", { { first, ResourceState::ShaderResource } },
+                                                                { { second, ResourceState::RenderTarget } });
+        graph.MarkOutput(second);
+        graph.Compile();
+        CHECK(graph.GetExecutionOrder() == std::vector<FrameGraph::PassId>{ independent_pass, producer_pass, consumer_pass });
+        CHECK(graph.GetPassLevel(independent_pass) == 0U);
+        CHECK(graph.GetPassLevel(consumer_pass) == 1U);
+    }
+
+    SECTION("Write after read is ordered after the reading pass")
+    {
+        FrameGraph graph;
+        const FrameGraph::ResourceId target = graph.AddTexture("Target", g_color_settings);
+        const FrameGraph::PassId write_pass     = AddTestPass(graph, "Write", {}, { { target, ResourceState::RenderTarget } });
+        const FrameGraph::PassId read_pass      = AddTestPass(graph, "Read", { { target, ResourceState::ShaderResource } }, {}, true);
+        const FrameGraph::PassId overwrite_pass = AddTestPass(graph, "Overwrite", {}, { { target, ResourceState::RenderTarget } });
+        graph.MarkOutput(target);
+        graph.Compile();
+        CHECK(graph.GetPassLevel(write_pass) == 0U);
+        CHECK(graph.GetPassLevel(read_pass) == 1U);
+        CHECK(graph.GetPassLevel(overwrite_pass) == 2U);
+    }
+
+    SECTION("Reads of the same resource in different states are ordered in separate levels")
+    {
+        FrameGraph graph;
+        const FrameGraph::ResourceId source = graph.AddTexture("Source", g_color_settings);
+        const FrameGraph::PassId write_pass         = AddTestPass(graph, "Write", {}, { { source, ResourceState::RenderTarget } });
+        const FrameGraph::PassId shader_read_pass   = AddTestPass(graph, "Shader Read", { { source, ResourceState::ShaderResource } }, {}, true);
+        const FrameGraph::PassId copy_read_pass     = AddTestPass(graph, "Copy Read", { { source, ResourceState::CopySource } }, {}, true);
+        const FrameGraph::PassId shader_reread_pass = AddTestPass(graph, "Shader Reread", { { source, ResourceState::ShaderResource } }, {}, true);
+        graph.Compile();
+        CHECK(graph.GetPassLevel(write_pass) == 0U);
+        CHECK(graph.GetPassLevel(shader_read_pass) == 1U);
+        CHECK(graph.GetPassLevel(copy_read_pass) == 2U);
+        CHECK(graph.GetPassLevel(shader_reread_pass) == 3U);
+        CHECK(graph.GetPassTransitions(shader_read_pass) == FrameGraph::StateTransitions{
+            StateTransition{ source, ResourceState::RenderTarget, ResourceState::ShaderResource } });
+        CHECK(graph.GetPassTransitions(copy_read_pass) == FrameGraph::StateTransitions{
+            StateTransition{ source, ResourceState::ShaderResource, ResourceState::CopySource } });
+        CHECK(graph.GetPassTransitions(shader_reread_pass) == FrameGraph::StateTransitions{
+            StateTransition{ source, ResourceState::CopySource, ResourceState::ShaderResource } });
+    }
+
+    SECTION("Passes with side effects and their producers are not culled")
+    {
+        FrameGraph graph;
+        const FrameGraph::ResourceId target = graph.AddTexture("Target", g_color_settings);
+        const FrameGraph::PassId producer_pass = AddTestPass(graph, "Producer", {}, { { target, ResourceState::RenderTarget } });
+        const FrameGraph::PassId readback_pass = AddTestPass(graph, "Readback", { { target, ResourceState::CopySource } }, {}, true);
+        const FrameGraph::PassId unused_pass   = AddTestPass(graph, "Unused", { { target, ResourceState::ShaderResource } }, {});
+        graph.Compile();
+        CHECK_FALSE(graph.IsPassCulled(producer_pass));
+        CHECK_FALSE(graph.IsPassCulled(readback_pass));
+        CHECK(graph.IsPassCulled(unused_pass));
+    }
+}
+
+TEST_CASE("Frame graph resource state transitions", "[frame-graph][compile][barriers]")
+{
+    const DeferredFrameGraph deferred;
+    const FrameGraph& graph = deferred.graph;
+
+    SECTION("First access transitions from the state at frame start")
+    {
+        CHECK(graph.GetPassTransitions(deferred.shadow_pass) == FrameGraph::StateTransitions{
+            StateTransition{ deferred.shadow_map, std::nullopt, ResourceState::DepthWrite } });
+    }
+
+    SECTION("Written resources are transitioned to read state once before reading pass")
+    {
+        const FrameGraph::StateTransitions& transitions = graph.GetPassTransitions(deferred.lighting_pass);
+        CHECK(transitions.size() == 5U);
+        CHECK(std::ranges::find(transitions, StateTransition{ deferred.shadow_map, ResourceState::DepthWrite, ResourceState::ShaderResource }) != transitions.end());
+        CHECK(std::ranges::find(transitions, StateTransition{ deferred.albedo, ResourceState::RenderTarget, ResourceState::ShaderResource }) != transitions.end());
+        CHECK(std::ranges::find(transitions, StateTransition{ deferred.depth, ResourceState::DepthWrite, ResourceState::ShaderResource }) != transitions.end());
+        CHECK(transitions.back() == StateTransition{ deferred.lighting, std::nullopt, ResourceState::RenderTarget });
+    }
+
+    SECTION("Culled passes have no transitions")
+    {
+        CHECK(graph.GetPassTransitions(deferred.debug_pass).empty());
+    }
+
+    SECTION("Resource accessed in the same state is not transitioned again")
+    {
+        FrameGraph readers_graph;
+        const FrameGraph::ResourceId source = readers_graph.AddTexture("Source", g_color_settings);
+        const FrameGraph::ResourceId target = readers_graph.AddTexture("Target", g_color_settings);
+        AddTestPass(readers_graph, "Producer", {}, { { source, ResourceState::RenderTarget } });
+        const FrameGraph::PassId first_reader  = AddTestPass(readers_graph, "First Reader", { { source, ResourceState::ShaderResource } }, {}, true);
+        const FrameGraph::PassId second_reader = AddTestPass(readers_graph, "Second Reader", { { source, ResourceState::ShaderResource } },
+                                                             { { target, ResourceState::RenderTarget } });
+        readers_graph.MarkOutput(target);
+        readers_graph.Compile();
+        CHECK(readers_graph.GetPassTransitions(first_reader).size() == 1U);
+        CHECK(readers_graph.GetPassTransitions(second_reader) == FrameGraph::StateTransitions{
+            StateTransition{ target, std::nullopt, ResourceState::RenderTarget } });
+    }
+}
+
+TEST_CASE("Frame graph transient textures aliasing", "[frame-graph][compile][aliasing]")
+{
+    SECTION("Textures with non-overlapping lifetimes share allocation")
+    {
+        FrameGraph graph;
+        const FrameGraph::ResourceId first  = graph.AddTexture("First", g_color_settings);
+        const FrameGraph::ResourceId second = graph.AddTexture("Second", g_color_settings);
+        const FrameGraph::ResourceId third  = graph.AddTexture("Third", g_color_settings);
+        const FrameGraph::ResourceId output = graph.AddTexture("Output", g_depth_settings);
+        AddTestPass(graph, "First", {}, { { first, ResourceState::RenderTarget } });
+        AddTestPass(graph, "Second", { { first, ResourceState::ShaderResource } }, { { second, ResourceState::RenderTarget } });
+        const FrameGraph::PassId third_pass = AddTestPass(graph, "Third", { { second, ResourceState::ShaderResource } },
+                                                          { { third, ResourceState::RenderTarget } });
+        AddTestPass(graph, "Output", { { third, ResourceState::ShaderResource } }, { { output, ResourceState::DepthWrite } });
+        graph.MarkOutput(output);
+        graph.Compile();
+
+        CHECK(graph.GetTextureAllocationsCount() == 3U);
+        CHECK(graph.GetTextureAllocationIndex(third) == graph.GetTextureAllocationIndex(first));
+        CHECK(graph.GetTextureAllocationIndex(second) != graph.GetTextureAllocationIndex(first));
+        CHECK(graph.GetTextureAllocationIndex(output) != graph.GetTextureAllocationIndex(first));
+
+        // Aliased texture is transitioned from the last state of the previous texture in the same allocation
+        CHECK(graph.GetPassTransitions(third_pass) == FrameGraph::StateTransitions{
+            StateTransition{ second, ResourceState::RenderTarget, ResourceState::ShaderResource },
+            StateTransition{ third, ResourceState::ShaderResource, ResourceState::RenderTarget } });
+
+        const FrameGraph::MemoryReport memory_report = graph.GetMemoryReport();
+        CHECK(memory_report.transient_textures_count == 4U);
+        CHECK(memory_report.allocated_textures_count == 3U);
+        CHECK(memory_report.GetSavedMemorySize() == FrameGraph::GetTextureMemorySize(g_color_settings));
+    }
+
+    SECTION("Textures with different settings or used in the same level are not aliased")
+    {
+        const DeferredFrameGraph deferred;
+        const FrameGraph& graph = deferred.graph;
+        CHECK(graph.GetTextureAllocationIndex(deferred.debug_view) == FrameGraph::invalid_id);
+        CHECK(graph.GetTextureAllocationIndex(deferred.albedo) != graph.GetTextureAllocationIndex(deferred.normals));
+        CHECK(graph.GetTextureAllocationIndex(deferred.shadow_map) != graph.GetTextureAllocationIndex(deferred.depth));
+        CHECK(graph.GetTextureAllocationIndex(deferred.screen) == graph.GetTextureAllocationIndex(deferred.albedo));
+        CHECK(graph.GetTextureAllocationsCount() == 5U);
+    }
+
+    SECTION("Texture memory size includes mip levels and array slices")
+    {
+        const Rhi::TextureSettings mipmapped_settings = Rhi::TextureSettings::ForImage(Dimensions(4U, 2U), 3U, PixelFormat::RGBA8Unorm, true);
+        CHECK(FrameGraph::GetTextureMemorySize(mipmapped_settings) == (8U + 2U + 1U) * 3U * 4U);
+        CHECK(FrameGraph::GetTextureMemorySize(g_color_settings) == 640U * 480U * 4U);
+    }
+}
+
+TEST_CASE("Frame graph declaration errors", "[frame-graph][compile][errors]")
+{
+    FrameGraph graph;
+    const FrameGraph::ResourceId target = graph.AddTexture("Target", g_color_settings);
+
+    SECTION("Pass can not access unknown resource")
+    {
+        CHECK_THROWS(AddTestPass(graph, "Unknown", { { target + 1U, ResourceState::ShaderResource } }, {}));
+    }
+
+    SECTION("Pass can not access resource in different states")
+    {
+        CHECK_THROWS(AddTestPass(graph, "Conflict", { { target, ResourceState::ShaderResource } }, { { target, ResourceState::RenderTarget } }));
+    }
+
+    SECTION("Output resource must be written by some pass")
+    {
+        graph.MarkOutput(target);
+        CHECK_THROWS(graph.Compile());
+    }
+
+    SECTION("Compiled graph is invalidated on declaration change")
+    {
+        AddTestPass(graph, "Producer", {}, { { target, ResourceState::RenderTarget } }, true);
+        graph.Compile();
+        CHECK(graph.IsCompiled());
+        std::ignore = graph.AddTexture("Other", g_color_settings);
+        CHECK_FALSE(graph.IsCompiled());
+        CHECK_THROWS(graph.GetExecutionOrder());
+    }
+}
+
+TEST_CASE("Frame graph execution on Null backend", "[frame-graph][execute]")
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    REQUIRE_FALSE(devices.empty());
+
+    const Platform::AppEnvironment  test_app_env{ nullptr };
+    const Rhi::RenderContextSettings context_settings{ .frame_size = { 640U, 480U } };
+    const Rhi::RenderContext render_context(test_app_env, devices[0], g_parallel_executor, context_settings);
+
+    DeferredFrameGraph deferred;
+    FrameGraph& graph = deferred.graph;
+    graph.CreateTransientTextures(render_context.GetInterface());
+
+    const FrameGraph::MemoryReport memory_report = graph.GetMemoryReport();
+    UNSCOPED_INFO(memory_report.ToString());
+    CHECK(memory_report.transient_textures_count == 6U);
+    CHECK(memory_report.allocated_textures_count == 5U);
+    CHECK(memory_report.GetSavedMemorySize() > 0U);
+
+    SECTION("Aliased resources are backed by the same texture")
+    {
+        CHECK(&graph.GetTexture(deferred.screen) == &graph.GetTexture(deferred.albedo));
+        CHECK(&graph.GetTexture(deferred.lighting) != &graph.GetTexture(deferred.albedo));
+        CHECK_THROWS(graph.GetTexture(deferred.debug_view));
+    }
+
+    SECTION("Passes are executed in dependency order with resources transitioned to declared states")
+    {
+        for (uint32_t frame_index = 0U; frame_index < 2U; ++frame_index)
+        {
+            const Refs<Rhi::ICommandList> command_lists = graph.Execute(g_parallel_executor);
+            CHECK(command_lists.empty());
+            CHECK(graph.GetTexture(deferred.shadow_map).GetState() == ResourceState::ShaderResource);
+            CHECK(graph.GetTexture(deferred.lighting).GetState() == ResourceState::ShaderResource);
+            CHECK(graph.GetTexture(deferred.screen).GetState() == ResourceState::RenderTarget);
+        }
+    }
+
+    SECTION("Pass context provides textures declared by the pass only")
+    {
+        bool is_undeclared_texture_access_rejected = false;
+        FrameGraph graph_with_checks;
+        const FrameGraph::ResourceId source = graph_with_checks.AddTexture("Source", g_color_settings);
+        const FrameGraph::ResourceId target = graph_with_checks.AddTexture("Target", g_color_settings);
+        graph_with_checks.AddPass(FrameGraph::PassSettings{ "Producer", {}, { { source, ResourceState::RenderTarget } } },
+            [&is_undeclared_texture_access_rejected, target](const FrameGraph::PassContext& pass_context) -> Rhi::ICommandList*
+            {
+                try
+                {
+                    std::ignore = pass_context.GetTexture(target);
+                }
+                catch (const std::invalid_argument&)
+                {
+                    is_undeclared_texture_access_rejected = true;
+                }
+                return nullptr;
+            });
+        AddTestPass(graph_with_checks, "Consumer", { { source, ResourceState::ShaderResource } }, { { target, ResourceState::RenderTarget } });
+        graph_with_checks.MarkOutput(target);
+        graph_with_checks.Compile();
+        graph_with_checks.CreateTransientTextures(render_context.GetInterface());
+        std::ignore = graph_with_checks.Execute(g_parallel_executor);
+        CHECK(is_undeclared_texture_access_rejected);
+    }
+}
@@ -0,0 +1,208 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/BufferHeapTest.cpp
+Unit-tests of the Base Buffer Heap sub-allocator
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/Base/BufferHeap.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+static constexpr Data::Size g_block_size = 64U * 1024U;
+static constexpr Data::Size g_alignment  = 256U;
+
+TEST_CASE("RHI Buffer Heap Allocations", "[rhi][buffer][heap]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Ptr<Base::BufferHeap> heap_ptr = Base::BufferHeap::Create(compute_context.GetInterface(), {
+        Rhi::BufferSettings::ForConstantBuffer(g_block_size, true, true),
+        g_alignment
+    });
+    Base::BufferHeap& heap = *heap_ptr;
+
+    SECTION("Empty heap has no blocks")
+    {
+        const Base::BufferHeap::Statistics statistics = heap.GetStatistics();
+        CHECK(statistics.blocks_count == 0U);
+        CHECK(statistics.allocations_count == 0U);
+        CHECK(statistics.reserved_size == 0U);
+        CHECK(statistics.GetFragmentation() == 0.F);
+    }
+
+    SECTION("Allocations are aligned and do not overlap")
+    {
+        std::vector<UniquePtr<Base::BufferHeap::Allocation>> allocations;
+        for (Data::Size size : { 4U, 100U, 256U, 257U, 1000U, 16U })
+        {
+            allocations.emplace_back(heap.Allocate(size));
+            CHECK(allocations.back()->GetDataSize() == size);
+            CHECK(allocations.back()->GetDataOffset() % g_alignment == 0U);
+            CHECK(allocations.back()->GetBufferRange().GetLength() % g_alignment == 0U);
+        }
+
+        for (size_t i = 0U; i < allocations.size(); ++i)
+            for (size_t j = i + 1U; j < allocations.size(); ++j)
+                CHECK_FALSE(allocations[i]->GetBufferRange().IsOverlapping(allocations[j]->GetBufferRange()));
+
+        const Base::BufferHeap::Statistics statistics = heap.GetStatistics();
+        CHECK(statistics.blocks_count == 1U);
+        CHECK(statistics.allocations_count == 6U);
+        CHECK(statistics.allocated_size == 10U * g_alignment);
+        CHECK(statistics.free_size == g_block_size - 10U * g_alignment);
+    }
+
+    SECTION("Allocations share backing buffer with resource views")
+    {
+        const UniquePtr<Base::BufferHeap::Allocation> allocation_a = heap.Allocate(64U);
+        const UniquePtr<Base::BufferHeap::Allocation> allocation_b = heap.Allocate(64U);
+        CHECK(std::addressof(allocation_a->GetBuffer()) == std::addressof(allocation_b->GetBuffer()));
+
+        const Rhi::ResourceView resource_view = allocation_b->GetResourceView();
+        CHECK(resource_view.GetOffset() == allocation_b->GetDataOffset());
+        CHECK(resource_view.GetSize() == 64U);
+    }
+
+    SECTION("Allocation data is set in the sub-range of backing buffer")
+    {
+        const UniquePtr<Base::BufferHeap::Allocation> allocation_a = heap.Allocate(64U);
+        const UniquePtr<Base::BufferHeap::Allocation> allocation_b = heap.Allocate(64U);
+        const std::array<uint32_t, 4> data{ 1U, 2U, 3U, 4U };
+        Rhi::ICommandQueue& transfer_queue = compute_context.GetDefaultCommandKit(Rhi::CommandListType::Transfer).GetQueue().GetInterface();
+        REQUIRE_NOTHROW(allocation_b->SetData(transfer_queue, Data::Chunk(data)));
+        CHECK(allocation_b->GetBuffer().GetDataSize(Data::MemoryState::Initialized) == allocation_b->GetDataOffset() + sizeof(data));
+    }
+
+    SECTION("Allocation larger than block size gets dedicated block")
+    {
+        const UniquePtr<Base::BufferHeap::Allocation> small_allocation = heap.Allocate(64U);
+        const UniquePtr<Base::BufferHeap::Allocation> large_allocation = heap.Allocate(2U * g_block_size);
+        CHECK(small_allocation->GetBlockIndex() != large_allocation->GetBlockIndex());
+        CHECK(large_allocation->GetBuffer().GetSettings().size == 2U * g_block_size);
+        CHECK(heap.GetStatistics().blocks_count == 2U);
+    }
+
+    SECTION("Freed ranges are merged and reused")
+    {
+        std::vector<UniquePtr<Base::BufferHeap::Allocation>> allocations;
+        for (uint32_t i = 0U; i < 8U; ++i)
+            allocations.emplace_back(heap.Allocate(g_alignment));
+
+        const Data::Size freed_offset = allocations[2]->GetDataOffset();
+        allocations[2].reset();
+        allocations[3].reset();
+        CHECK(heap.GetStatistics().free_ranges_count == 2U);
+
+        const UniquePtr<Base::BufferHeap::Allocation> reused_allocation = heap.Allocate(2U * g_alignment);
+        CHECK(reused_allocation->GetDataOffset() == freed_offset);
+        CHECK(heap.GetStatistics().free_ranges_count == 1U);
+
+        allocations.clear();
+    }
+
+    SECTION("Best fit allocation prefers smallest suitable free range")
+    {
+        std::vector<UniquePtr<Base::BufferHeap::Allocation>> allocations;
+        for (uint32_t i = 0U; i < 8U; ++i)
+            allocations.emplace_back(heap.Allocate(g_alignment));
+
+        allocations[1].reset();
+        allocations[4].reset();
+        allocations[5].reset();
+        const Data::Size small_hole_offset = g_alignment;
+
+        const UniquePtr<Base::BufferHeap::Allocation> fit_allocation = heap.Allocate(g_alignment);
+        CHECK(fit_allocation->GetDataOffset() == small_hole_offset);
+        allocations.clear();
+    }
+
+    SECTION("Fragmentation statistics and release of empty blocks")
+    {
+        std::vector<UniquePtr<Base::BufferHeap::Allocation>> allocations;
+        const uint32_t allocations_count = 2U * g_block_size / g_alignment;
+        for (uint32_t i = 0U; i < allocations_count; ++i)
+            allocations.emplace_back(heap.Allocate(g_alignment));
+
+        CHECK(heap.GetStatistics().blocks_count == 2U);
+        CHECK(heap.GetStatistics().free_size == 0U);
+
+        // Free every second allocation in the first block to get maximum fragmentation
+        for (uint32_t i = 0U; i < allocations_count / 2U; i += 2U)
+            allocations[i].reset();
+
+        Base::BufferHeap::Statistics statistics = heap.GetStatistics();
+        CHECK(statistics.free_ranges_count == allocations_count / 4U);
+        CHECK(statistics.largest_free_range_size == g_alignment);
+        CHECK(statistics.GetFragmentation() > 0.99F);
+
+        // Free all allocations of the second block and release it
+        for (uint32_t i = allocations_count / 2U; i < allocations_count; ++i)
+            allocations[i].reset();
+
+        CHECK(heap.ReleaseEmptyBlocks() == 1U);
+        statistics = heap.GetStatistics();
+        CHECK(statistics.blocks_count == 1U);
+        CHECK(statistics.reserved_size == g_block_size);
+        allocations.clear();
+    }
+
+    SECTION("Random allocations and releases keep heap consistent")
+    {
+        std::mt19937 random_engine(1234U);
+        std::uniform_int_distribution<Data::Size> size_distribution(1U, 4096U);
+        std::vector<UniquePtr<Base::BufferHeap::Allocation>> allocations;
+        for (uint32_t i = 0U; i < 1000U; ++i)
+        {
+            if (!allocations.empty() && random_engine() % 3U == 0U)
+            {
+                const size_t release_index = random_engine() % allocations.size();
+                std::swap(allocations[release_index], allocations.back());
+                allocations.pop_back();
+            }
+            else
+            {
+                allocations.emplace_back(heap.Allocate(size_distribution(random_engine)));
+            }
+        }
+
+        const Base::BufferHeap::Statistics statistics = heap.GetStatistics();
+        CHECK(statistics.allocations_count == allocations.size());
+        CHECK(statistics.allocated_size + statistics.free_size == statistics.reserved_size);
+
+        allocations.clear();
+        const Base::BufferHeap::Statistics empty_statistics = heap.GetStatistics();
+        CHECK(empty_statistics.allocations_count == 0U);
+        CHECK(empty_statistics.free_size == empty_statistics.reserved_size);
+        CHECK(empty_statistics.free_ranges_count == empty_statistics.blocks_count);
+        CHECK(empty_statistics.GetFragmentation() == 0.F || empty_statistics.blocks_count > 1U);
+    }
+}
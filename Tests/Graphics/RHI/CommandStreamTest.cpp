@@ -0,0 +1,386 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/CommandStreamTest.cpp
+Unit-tests of the render command list in command stream mode and execution of recorded Base Command Streams
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+#include "RhiSettings.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Base/CommandStream.h>
+#include <Methane/Graphics/Base/ParallelRenderCommandList.h>
+#include <Methane/Graphics/Base/RenderState.h>
+#include <Methane/Graphics/Base/BufferSet.h>
+#include <Methane/Graphics/Base/ViewState.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+#include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Null/Buffer.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static const Platform::AppEnvironment test_app_env{ nullptr };
+static const Rhi::RenderContextSettings render_context_settings = Test::GetRenderContextSettings();
+static const Rhi::RenderPatternSettings render_pattern_settings = Test::GetRenderPatternSettings();
+
+TEST_CASE("RHI Command Stream Functions", "[rhi][list][render][stream]")
+{
+    const Rhi::RenderContext render_context   = Rhi::RenderContext(test_app_env, GetTestDevice(), g_parallel_executor, render_context_settings);
+    const Rhi::CommandQueue  render_cmd_queue = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::RenderPattern render_pattern   = render_context.CreateRenderPattern(render_pattern_settings);
+    const Rhi::Program       render_program   = [&render_context, &render_pattern]()
+    {
+        using enum Rhi::ShaderType;
+        Rhi::Program render_program = render_context.CreateProgram(
+            Rhi::ProgramSettingsImpl
+            {
+                .shader_set = Rhi::ProgramSettingsImpl::ShaderSet
+                {
+                    { Vertex, { Data::ShaderProvider::Get(), { "Render", "MainVS" } } },
+                    { Pixel,  { Data::ShaderProvider::Get(), { "Render", "MainPS" } } }
+                },
+                .input_buffer_layouts = Rhi::ProgramInputBufferLayouts
+                {
+                    Rhi::ProgramInputBufferLayout
+                    {
+                        .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "COLOR" },
+                        .step_type = Rhi::ProgramInputBufferLayout::StepType::PerVertex,
+                        .step_rate = 1U
+                    },
+                    Rhi::ProgramInputBufferLayout
+                    {
+                        .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "NORMAL" , "TANGENT" },
+                        .step_type = Rhi::ProgramInputBufferLayout::StepType::PerVertex,
+                        .step_rate = 1U
+                    }
+                },
+                .attachment_formats = render_pattern.GetAttachmentFormats()
+            });
+        dynamic_cast<Null::Program&>(render_program.GetInterface()).SetArgumentBindings({});
+        return render_program;
+    }();
+
+    const Test::RenderPassResources render_pass_resources = Test::GetRenderPassResources(render_pattern);
+    const Rhi::RenderPass  render_pass  = render_pattern.CreateRenderPass(render_pass_resources.settings);
+    const Rhi::RenderState render_state = render_context.CreateRenderState(Test::GetRenderStateSettings(render_context, render_pattern, render_program));
+    const Rhi::ViewState   view_state(Test::GetViewStateSettings());
+
+    Rhi::Buffer vertex_buffer_one = [&render_context]()
+    {
+        Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(144U, 12U, true));
+        vertex_buffer.SetName("Vertex Buffer 1");
+        dynamic_cast<Null::Buffer&>(vertex_buffer.GetInterface()).SetInitializedDataSize(144U * 12U);
+        return vertex_buffer;
+    }();
+    Rhi::Buffer vertex_buffer_two = [&render_context]()
+    {
+        Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(144U, 12U, true));
+        vertex_buffer.SetName("Vertex Buffer 2");
+        dynamic_cast<Null::Buffer&>(vertex_buffer.GetInterface()).SetInitializedDataSize(144U * 12U);
+        return vertex_buffer;
+    }();
+    const Rhi::BufferSet vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer_one, vertex_buffer_two });
+
+    constexpr uint32_t draws_count = 100U;
+    const auto record_commands = [&](const Rhi::RenderCommandList& cmd_list)
+    {
+        cmd_list.SetRenderState(render_state);
+        cmd_list.SetViewState(view_state);
+        cmd_list.SetVertexBuffers(vertex_buffer_set);
+        for (uint32_t draw_index = 0U; draw_index < draws_count; ++draw_index)
+        {
+            cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 12U, draw_index, 1U, 0U);
+        }
+    };
+    const auto record_stream = [&](Base::CommandStream& command_stream)
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+        null_cmd_list.SetCommandStreamEnabled(true);
+        cmd_list.Reset();
+        record_commands(cmd_list);
+        command_stream = null_cmd_list.GetCommandStream();
+    };
+
+    SECTION("Empty Command Stream")
+    {
+        const Base::CommandStream command_stream;
+        CHECK(command_stream.IsEmpty());
+        CHECK(command_stream.GetCommandsCount() == 0U);
+        CHECK(command_stream.GetDataSize() == 0U);
+        CHECK(command_stream.GetObjectsCount() == 0U);
+    }
+
+    SECTION("Commands are Recorded to Compact Stream and Encoded on Commit")
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+        null_cmd_list.SetCommandStreamEnabled(true);
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(record_commands(cmd_list));
+
+        const Base::CommandStream& command_stream = null_cmd_list.GetCommandStream();
+        CHECK(command_stream.GetCommandsCount() == draws_count + 3U);
+        CHECK(command_stream.GetObjectsCount() == 3U);
+
+        constexpr size_t header_size = sizeof(Base::CommandStream::CommandHeader);
+        CHECK(command_stream.GetDataSize() == header_size * (draws_count + 3U)
+                                              + sizeof(Base::CommandStream::SetRenderStateArgs)
+                                              + sizeof(Base::CommandStream::SetViewStateArgs)
+                                              + sizeof(Base::CommandStream::SetVertexBuffersArgs)
+                                              + sizeof(Base::CommandStream::DrawArgs) * draws_count);
+
+        // Recorded drawing state is tracked for validation of the next commands before encoding
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().vertex_buffer_set_ptr.get() == vertex_buffer_set.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetEncodedDrawsCount() == 0U);
+
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        CHECK(null_cmd_list.GetEncodedDrawsCount() == draws_count);
+        CHECK(cmd_list.GetState() == Rhi::CommandListState::Committed);
+    }
+
+    SECTION("Invalid Commands are not Recorded to Stream")
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+        null_cmd_list.SetCommandStreamEnabled(true);
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK_THROWS(cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 12U, 0U, 1U, 0U));
+        CHECK(null_cmd_list.GetCommandStream().IsEmpty());
+    }
+
+    SECTION("Redundant Commands are not Recorded and Objects are Referenced Once in Stream")
+    {
+        const Rhi::BufferSet other_vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer_two, vertex_buffer_one });
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+        null_cmd_list.SetCommandStreamEnabled(true);
+        REQUIRE_NOTHROW(cmd_list.Reset());
+
+        cmd_list.SetViewState(view_state);
+        cmd_list.SetViewState(view_state);
+        cmd_list.SetVertexBuffers(vertex_buffer_set);
+        cmd_list.SetVertexBuffers(other_vertex_buffer_set);
+        cmd_list.SetVertexBuffers(vertex_buffer_set);
+
+        const Base::CommandStream& command_stream = null_cmd_list.GetCommandStream();
+        CHECK(command_stream.GetCommandsCount() == 4U);
+        CHECK(command_stream.GetObjectsCount() == 3U);
+    }
+
+    SECTION("Inspect Recorded Commands")
+    {
+        Base::CommandStream command_stream;
+        record_stream(command_stream);
+
+        using Command = Base::CommandStream::Command;
+        std::vector<Command> commands;
+        uint32_t expected_start_vertex = 0U;
+        command_stream.ForEachCommand([&](Command command, const std::byte* args_data)
+        {
+            commands.push_back(command);
+            switch (command)
+            {
+            case Command::SetRenderState:
+            {
+                const auto args = Base::CommandStream::GetArgs<Base::CommandStream::SetRenderStateArgs>(args_data);
+                CHECK(&command_stream.GetStreamObject<Base::RenderState>(args.render_state) == &dynamic_cast<Base::RenderState&>(render_state.GetInterface()));
+                CHECK(args.apply_state_groups == ~0U);
+                CHECK(args.state_groups == ~0U);
+                break;
+            }
+            case Command::SetViewState:
+            {
+                const auto args = Base::CommandStream::GetArgs<Base::CommandStream::SetViewStateArgs>(args_data);
+                CHECK(&command_stream.GetStreamObject<Base::ViewState>(args.view_state) == &dynamic_cast<Base::ViewState&>(view_state.GetInterface()));
+                break;
+            }
+            case Command::Draw:
+            {
+                const auto args = Base::CommandStream::GetArgs<Base::CommandStream::DrawArgs>(args_data);
+                CHECK(args.vertex_count == 12U);
+                CHECK(args.start_vertex == expected_start_vertex++);
+                break;
+            }
+            default:
+                break;
+            }
+        });
+
+        REQUIRE(commands.size() == draws_count + 3U);
+        CHECK(commands[0] == Command::SetRenderState);
+        CHECK(commands[1] == Command::SetViewState);
+        CHECK(commands[2] == Command::SetVertexBuffers);
+        CHECK(commands.back() == Command::Draw);
+        CHECK(expected_start_vertex == draws_count);
+    }
+
+    SECTION("Stream Retains Recorded Objects")
+    {
+        Base::CommandStream command_stream;
+        {
+            const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+            auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+            null_cmd_list.SetCommandStreamEnabled(true);
+            cmd_list.Reset();
+
+            const Rhi::ViewState temp_view_state(Test::GetViewStateSettings());
+            cmd_list.SetViewState(temp_view_state);
+            command_stream = null_cmd_list.GetCommandStream();
+        }
+        REQUIRE(command_stream.GetObjectsCount() == 1U);
+        command_stream.ForEachCommand([&command_stream](Base::CommandStream::Command, const std::byte* args_data)
+        {
+            const auto args = Base::CommandStream::GetArgs<Base::CommandStream::SetViewStateArgs>(args_data);
+            CHECK(command_stream.GetStreamObject<Base::ViewState>(args.view_state).GetSettings().viewports.size() == 1U);
+        });
+    }
+
+    SECTION("Execute Recorded Stream in Multiple Frames")
+    {
+        Base::CommandStream command_stream;
+        record_stream(command_stream);
+
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        const Rhi::CommandListSet    cmd_list_set({ cmd_list.GetInterface() });
+        auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+        for (uint32_t frame_index = 0U; frame_index < 2U; ++frame_index)
+        {
+            REQUIRE_NOTHROW(cmd_list.Reset());
+            const size_t retained_resources_count = null_cmd_list.GetCommandState().retained_resources.size();
+            const uint32_t encoded_draws_count = null_cmd_list.GetEncodedDrawsCount();
+
+            REQUIRE_NOTHROW(null_cmd_list.ExecuteCommandStream(command_stream));
+            CHECK(null_cmd_list.GetEncodedDrawsCount() == encoded_draws_count + draws_count);
+            CHECK(null_cmd_list.GetCommandState().retained_resources.size() == retained_resources_count + command_stream.GetRetainedObjects().size());
+            CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+            CHECK(null_cmd_list.GetDrawingState().view_state_ptr == &view_state.GetInterface());
+            CHECK(null_cmd_list.GetDrawingState().vertex_buffer_set_ptr.get() == vertex_buffer_set.GetInterfacePtr().get());
+            CHECK(null_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
+
+            REQUIRE_NOTHROW(cmd_list.Commit());
+            REQUIRE_NOTHROW(render_cmd_queue.Execute(cmd_list_set));
+            dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+            CHECK(cmd_list.GetState() == Rhi::CommandListState::Pending);
+        }
+        CHECK(command_stream.GetCommandsCount() == draws_count + 3U);
+    }
+
+    SECTION("Disabling Command Stream Mode Encodes Pending Commands")
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+        null_cmd_list.SetCommandStreamEnabled(true);
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(record_commands(cmd_list));
+        CHECK(null_cmd_list.GetEncodedDrawsCount() == 0U);
+
+        null_cmd_list.SetCommandStreamEnabled(false);
+        CHECK(null_cmd_list.GetEncodedDrawsCount() == draws_count);
+
+        // Immediate encoding continues from the drawing state of encoded commands
+        REQUIRE_NOTHROW(cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 12U, 0U, 1U, 0U));
+        CHECK(null_cmd_list.GetEncodedDrawsCount() == draws_count + 1U);
+        CHECK(null_cmd_list.GetCommandStream().GetCommandsCount() == draws_count + 3U);
+    }
+
+    SECTION("Clear Command Stream")
+    {
+        Base::CommandStream command_stream;
+        record_stream(command_stream);
+        command_stream.Clear();
+        CHECK(command_stream.IsEmpty());
+        CHECK(command_stream.GetDataSize() == 0U);
+        CHECK(command_stream.GetObjectsCount() == 0U);
+        CHECK(command_stream.GetRetainedObjects().empty());
+    }
+
+    SECTION("Parallel Render Command List Encodes Thread Streams on Commit")
+    {
+        const Rhi::ParallelRenderCommandList cmd_list = render_cmd_queue.CreateParallelRenderCommandList(render_pass);
+        dynamic_cast<Base::ParallelRenderCommandList&>(cmd_list.GetInterface()).SetCommandStreamEnabled(true);
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(2U));
+        REQUIRE_NOTHROW(cmd_list.Reset());
+
+        for (const Rhi::RenderCommandList& thread_cmd_list : cmd_list.GetParallelCommandLists())
+        {
+            const auto& null_thread_cmd_list = dynamic_cast<Null::RenderCommandList&>(thread_cmd_list.GetInterface());
+            CHECK(null_thread_cmd_list.IsCommandStreamEnabled());
+            REQUIRE_NOTHROW(record_commands(thread_cmd_list));
+            CHECK(null_thread_cmd_list.GetEncodedDrawsCount() == 0U);
+        }
+
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        for (const Rhi::RenderCommandList& thread_cmd_list : cmd_list.GetParallelCommandLists())
+        {
+            CHECK(dynamic_cast<Null::RenderCommandList&>(thread_cmd_list.GetInterface()).GetEncodedDrawsCount() == draws_count);
+        }
+    }
+
+    SECTION("Translate Streams to Parallel Render Command List")
+    {
+        Base::CommandStream first_stream;
+        Base::CommandStream second_stream;
+        record_stream(first_stream);
+        record_stream(second_stream);
+
+        const Rhi::ParallelRenderCommandList cmd_list = render_cmd_queue.CreateParallelRenderCommandList(render_pass);
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(2U));
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(Base::CommandStream::Translate({ &first_stream, &second_stream }, cmd_list.GetInterface()));
+
+        for (const Rhi::RenderCommandList& thread_cmd_list : cmd_list.GetParallelCommandLists())
+        {
+            const auto& null_thread_cmd_list = dynamic_cast<Null::RenderCommandList&>(thread_cmd_list.GetInterface());
+            CHECK(null_thread_cmd_list.GetEncodedDrawsCount() == draws_count);
+            CHECK(null_thread_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+            CHECK(null_thread_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
+        }
+    }
+
+    SECTION("Parallel Translate Fails on Streams Count Mismatch")
+    {
+        Base::CommandStream command_stream;
+        record_stream(command_stream);
+
+        const Rhi::ParallelRenderCommandList cmd_list = render_cmd_queue.CreateParallelRenderCommandList(render_pass);
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(2U));
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK_THROWS(Base::CommandStream::Translate({ &command_stream }, cmd_list.GetInterface()));
+    }
+}
@@ -43,10 +43,12 @@ Unit-tests of the RHI Compute Command List
 #include <Methane/Graphics/Null/ComputeState.h>
 #include <Methane/Graphics/Null/CommandListDebugGroup.h>
 #include <Methane/Graphics/Null/ProgramBindings.h>
+#include <Methane/Graphics/Null/ComputeKernel.h>
 
 #include <chrono>
 #include <future>
 #include <memory>
+#include <cstring>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <thread>
@@ -373,3 +375,116 @@ TEST_CASE("RHI Compute Command List Functions", "[rhi][list][compute]")
         dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
     }
 }
+
+TEST_CASE("RHI Compute Command List CPU Kernels", "[rhi][list][compute][kernel]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ShaderEntryFunction fill_entry_function{ "Fill", "MainCS" };
+
+    const Rhi::Program compute_program = [&compute_context, &fill_entry_function]()
+    {
+        using enum Rhi::ShaderType;
+        const Rhi::ProgramArgumentAccessor constants_accessor{ Compute, "g_constants", Rhi::ProgramArgumentAccessType::Constant,
+                                                               Rhi::ProgramArgumentValueType::RootConstantValue };
+        const Rhi::ProgramArgumentAccessor texture_accessor  { Compute, "g_texture", Rhi::ProgramArgumentAccessType::Mutable };
+        Rhi::Program compute_program = compute_context.CreateProgram(
+            Rhi::ProgramSettingsImpl
+            {
+                Rhi::ProgramSettingsImpl::ShaderSet
+                {
+                    { Compute, { Data::ShaderProvider::Get(), fill_entry_function } }
+                },
+                Rhi::ProgramInputBufferLayouts{ },
+                Rhi::ProgramArgumentAccessors
+                {
+                    constants_accessor,
+                    texture_accessor
+                }
+            });
+        dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+            { constants_accessor, { Rhi::ResourceType::Buffer,  1U, 4U } },
+            { texture_accessor,   { Rhi::ResourceType::Texture, 1U, 0U } },
+        });
+        return compute_program;
+    }();
+
+    const Rhi::ComputeState compute_state = compute_context.CreateComputeState({
+        compute_program,
+        Rhi::ThreadGroupSize(16, 16, 1)
+    });
+
+    const Dimensions      texture_dimensions(40U, 24U);
+    const Rhi::Texture    texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(texture_dimensions, {}, PixelFormat::R32Uint, false));
+    const Rhi::ProgramBindings program_bindings = compute_program.CreateBindings({
+        { { Rhi::ShaderType::Compute, "g_constants" }, Rhi::RootConstant(100U) },
+        { { Rhi::ShaderType::Compute, "g_texture"   }, texture.GetResourceView() },
+    });
+
+    // Kernel writes the sum of pixel linear index and constant value to each texture pixel
+    Null::ComputeKernelRegistry::Get().Register(fill_entry_function,
+        [](const Null::ComputeKernelBindings& bindings, const Null::ComputeThreadGroup& thread_group)
+        {
+            const auto                      base_value = bindings.GetRootConstantValue<uint32_t>("g_constants");
+            const Null::ComputeKernelTexture texture   = bindings.GetTexture("g_texture");
+            const std::span<uint32_t>       pixels     = texture.GetPixels<uint32_t>();
+            thread_group.ForEachThread([&](const Point3U& id)
+            {
+                if (id.GetX() >= texture.dimensions.GetWidth() || id.GetY() >= texture.dimensions.GetHeight())
+                    return;
+
+                const uint32_t pixel_index = id.GetY() * texture.dimensions.GetWidth() + id.GetX();
+                pixels[pixel_index] = base_value + pixel_index;
+            });
+        });
+
+    const Rhi::ComputeCommandList cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+
+    SECTION("Dispatch registered kernel and read back texture data")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(program_bindings));
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(3U, 2U, 1U)));
+        CHECK(dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface()).GetKernelDispatchesCount() == 1U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_cmd_queue.Execute(cmd_list_set));
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+
+        const Rhi::SubResource texture_data = texture.GetData(compute_cmd_queue, Rhi::SubResource::Index{}, Rhi::BytesRangeOpt{});
+        REQUIRE(texture_data.GetDataSize() == texture_dimensions.GetPixelsCount() * sizeof(uint32_t));
+
+        std::vector<uint32_t> pixels(texture_dimensions.GetPixelsCount());
+        std::memcpy(pixels.data(), texture_data.GetDataPtr(), texture_data.GetDataSize());
+        bool all_pixels_match = true;
+        for(uint32_t pixel_index = 0U; pixel_index < pixels.size(); ++pixel_index)
+            all_pixels_match &= pixels[pixel_index] == 100U + pixel_index;
+        CHECK(all_pixels_match);
+    }
+
+    SECTION("Dispatch without registered kernel is not executed")
+    {
+        Null::ComputeKernelRegistry::Get().Unregister(fill_entry_function);
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(program_bindings));
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(3U, 2U, 1U)));
+        CHECK(dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface()).GetKernelDispatchesCount() == 0U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_cmd_queue.Execute(cmd_list_set));
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(texture.GetData(compute_cmd_queue, Rhi::SubResource::Index{}, Rhi::BytesRangeOpt{}).IsEmptyOrNull());
+    }
+
+    SECTION("Texture CPU data is allocated on dispatch recording before parallel execution")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(program_bindings));
+        CHECK(texture.GetData(compute_cmd_queue, Rhi::SubResource::Index{}, Rhi::BytesRangeOpt{}).IsEmptyOrNull());
+
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(3U, 2U, 1U)));
+        CHECK(texture.GetData(compute_cmd_queue, Rhi::SubResource::Index{}, Rhi::BytesRangeOpt{}).GetDataSize() ==
+              texture_dimensions.GetPixelsCount() * sizeof(uint32_t));
+    }
+
+    Null::ComputeKernelRegistry::Get().Unregister(fill_entry_function);
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/DescriptorManagerBenchmark.cpp
+Benchmark of program bindings registration contention in the Base Descriptor Manager
+
+******************************************************************************/
+
+#include "DescriptorManagerTestHelpers.hpp"
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+static constexpr uint32_t g_bindings_count = 4096U;
+
+static size_t MeasureParallelBindingsCreation(const Rhi::ComputeContext& compute_context, const Rhi::Program& program,
+                                              const Rhi::Buffer& buffer, uint32_t threads_count,
+                                              Catch::Benchmark::Chronometer meter)
+{
+    size_t created_bindings_count = 0U;
+    meter.measure([&]()
+    {
+        const std::vector<Rhi::ProgramBindings> program_bindings =
+            Test::CreateProgramBindingsInParallel(program, buffer, threads_count, g_bindings_count / threads_count);
+        compute_context.CompleteInitialization();
+        created_bindings_count += program_bindings.size();
+    });
+    return created_bindings_count;
+}
+
+TEST_CASE("RHI Descriptor Manager Bindings Registration Contention", "[rhi][descriptor][manager][benchmark]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Program compute_program = Test::CreateDescriptorManagerTestProgram(compute_context);
+    const Rhi::Buffer  buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024, false, true));
+
+    for (const uint32_t threads_count : { 1U, 2U, 4U, 8U, 16U, 32U })
+    {
+        BENCHMARK_ADVANCED(std::to_string(g_bindings_count) + " bindings created by " + std::to_string(threads_count) + " threads")
+            (Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureParallelBindingsCreation(compute_context, compute_program, buffer, threads_count, meter);
+        };
+    }
+}
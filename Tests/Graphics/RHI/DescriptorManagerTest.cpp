@@ -0,0 +1,94 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/DescriptorManagerTest.cpp
+Unit-tests of the Base Descriptor Manager program bindings registry
+
+******************************************************************************/
+
+#include "DescriptorManagerTestHelpers.hpp"
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Descriptor Manager Program Bindings Registry", "[rhi][descriptor][manager]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Program compute_program = Test::CreateDescriptorManagerTestProgram(compute_context);
+    const Rhi::Buffer  buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024, false, true));
+    Base::DescriptorManager& descriptor_manager = Test::GetBaseDescriptorManager(compute_context);
+
+    SECTION("Register Program Bindings Created from Single Thread")
+    {
+        const size_t initial_bindings_count = descriptor_manager.GetProgramBindingsCount();
+        std::vector<Rhi::ProgramBindings> program_bindings = Test::CreateProgramBindingsInParallel(compute_program, buffer, 1U, 100U);
+        CHECK(descriptor_manager.GetProgramBindingsCount() == initial_bindings_count + 100U);
+    }
+
+    SECTION("Register Program Bindings Created from Multiple Threads")
+    {
+        const size_t initial_bindings_count = descriptor_manager.GetProgramBindingsCount();
+        std::vector<Rhi::ProgramBindings> program_bindings = Test::CreateProgramBindingsInParallel(compute_program, buffer, 32U, 50U);
+        CHECK(program_bindings.size() == 1600U);
+        CHECK(descriptor_manager.GetProgramBindingsCount() == initial_bindings_count + 1600U);
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(descriptor_manager.GetProgramBindingsCount() == initial_bindings_count + 1600U);
+    }
+
+    SECTION("Compact Expired Program Bindings on Complete Initialization")
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings = Test::CreateProgramBindingsInParallel(compute_program, buffer, 8U, 100U);
+        program_bindings.resize(200U);
+        const uint32_t compaction_epoch = descriptor_manager.GetCompactionEpoch();
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(descriptor_manager.GetCompactionEpoch() == compaction_epoch + 1U);
+        CHECK(descriptor_manager.GetProgramBindingsCount() == 200U);
+    }
+
+    SECTION("Release Program Bindings Registry")
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings = Test::CreateProgramBindingsInParallel(compute_program, buffer, 4U, 10U);
+        REQUIRE_NOTHROW(descriptor_manager.Release());
+        CHECK(descriptor_manager.GetProgramBindingsCount() == 0U);
+    }
+}
+
+TEST_CASE("RHI Descriptor Manager Bindless Descriptors", "[rhi][descriptor][manager][bindless]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024, false, true));
+    Rhi::IDescriptorManager& descriptor_manager = compute_context.GetDescriptorManager();
+
+    SECTION("Descriptor Manager is accessible from RHI context")
+    {
+        CHECK(&descriptor_manager == &Test::GetBaseDescriptorManager(compute_context));
+    }
+
+    SECTION("Bindless Descriptors are not supported without device feature")
+    {
+        const Rhi::ResourceView buffer_view(buffer.GetInterface());
+        CHECK_FALSE(descriptor_manager.IsBindlessEnabled());
+        CHECK_THROWS(descriptor_manager.AcquireBindlessDescriptor(buffer_view));
+        CHECK_NOTHROW(descriptor_manager.ReleaseBindlessDescriptor(buffer_view));
+    }
+}
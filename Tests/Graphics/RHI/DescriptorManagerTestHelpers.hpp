@@ -0,0 +1,109 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/DescriptorManagerTestHelpers.hpp
+Helper functions for Descriptor Manager tests and benchmarks
+
+******************************************************************************/
+
+#pragma once
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/DescriptorManager.h>
+#include <Methane/Graphics/Null/Program.h>
+
+#include <thread>
+#include <vector>
+
+namespace Methane::Graphics::Test
+{
+
+inline Rhi::Program CreateDescriptorManagerTestProgram(const Rhi::ComputeContext& compute_context)
+{
+    const Rhi::ProgramArgumentAccessor out_buffer_accessor{
+        Rhi::ShaderType::Compute, "OutBuffer",
+        Rhi::ProgramArgumentAccessType::Mutable,
+        Rhi::ProgramArgumentValueType::ResourceView
+    };
+
+    Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors{ out_buffer_accessor }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { out_buffer_accessor, { Rhi::ResourceType::Buffer, 1U, 0U } },
+    });
+    return compute_program;
+}
+
+inline Base::DescriptorManager& GetBaseDescriptorManager(const Rhi::ComputeContext& compute_context)
+{
+    auto& base_context = dynamic_cast<Base::Context&>(compute_context.GetInterface());
+    return dynamic_cast<Base::DescriptorManager&>(base_context.GetDescriptorManager());
+}
+
+inline std::vector<Rhi::ProgramBindings> CreateProgramBindingsInParallel(const Rhi::Program& program,
+                                                                         const Rhi::Buffer& buffer,
+                                                                         uint32_t threads_count,
+                                                                         uint32_t bindings_per_thread_count)
+{
+    std::vector<std::vector<Rhi::ProgramBindings>> program_bindings_per_thread(threads_count);
+    std::vector<std::thread> creator_threads;
+    creator_threads.reserve(threads_count);
+
+    for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        creator_threads.emplace_back([&program, &buffer, bindings_per_thread_count,
+                                      &thread_program_bindings = program_bindings_per_thread[thread_index]]()
+        {
+            thread_program_bindings.reserve(bindings_per_thread_count);
+            for (uint32_t binding_index = 0U; binding_index < bindings_per_thread_count; ++binding_index)
+            {
+                thread_program_bindings.emplace_back(program.CreateBindings({
+                    { { Rhi::ShaderType::Compute, "OutBuffer" }, buffer.GetResourceView() }
+                }));
+            }
+        });
+    }
+
+    for (std::thread& creator_thread : creator_threads)
+        creator_thread.join();
+
+    std::vector<Rhi::ProgramBindings> program_bindings;
+    program_bindings.reserve(static_cast<size_t>(threads_count) * bindings_per_thread_count);
+    for (std::vector<Rhi::ProgramBindings>& thread_program_bindings : program_bindings_per_thread)
+    {
+        std::move(thread_program_bindings.begin(), thread_program_bindings.end(), std::back_inserter(program_bindings));
+    }
+    return program_bindings;
+}
+
+} // namespace Methane::Graphics::Test
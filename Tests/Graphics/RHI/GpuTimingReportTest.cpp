@@ -0,0 +1,203 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/GpuTimingReportTest.cpp
+Unit-tests of the GPU timing report and synthesized timestamps of Null command queue
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/GpuTimingReport.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+
+#include <sstream>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("GPU Timing Report", "[rhi][gpu-timing]")
+{
+    using Timings = Rhi::GpuTimingReport::Timings;
+
+    Rhi::GpuTimingReport timing_report(2U);
+    timing_report.SetQueueName("Render Queue");
+    timing_report.SetCalibratedTimestamps({ 5000U, 1000U }, 1000000000U);
+
+    SECTION("Frame is completed when timings of the next frame are added")
+    {
+        timing_report.AddTimings(0U, Timings{ { "Cmd List A", 0U, 2000U, 1000U }, { "Pass", 1U, 2100U, 500U } });
+        timing_report.AddTimings(0U, Timings{ { "Cmd List B", 0U, 1000U, 500U } });
+        CHECK_FALSE(timing_report.GetLastCompletedFrame());
+
+        timing_report.AddTimings(1U, Timings{ { "Cmd List A", 0U, 9000U, 100U } });
+        const Opt<Rhi::GpuTimingReport::Frame> frame_opt = timing_report.GetLastCompletedFrame();
+        REQUIRE(frame_opt);
+        CHECK(frame_opt->frame_index == 0U);
+        CHECK(frame_opt->frame_number == 0U);
+        CHECK(frame_opt->queue_name == "Render Queue");
+        CHECK(frame_opt->gpu_frequency == 1000000000U);
+        CHECK(frame_opt->calibrated_timestamps.gpu_ts == 5000U);
+        CHECK(frame_opt->calibrated_timestamps.cpu_ts == 1000U);
+        REQUIRE(frame_opt->timings.size() == 3U);
+        CHECK(frame_opt->timings[0].name == "Cmd List B");
+        CHECK(frame_opt->timings[1].name == "Cmd List A");
+        CHECK(frame_opt->timings[2].name == "Pass");
+        CHECK(frame_opt->GetStartNs() == 1000U);
+        CHECK(frame_opt->GetEndNs() == 3000U);
+        CHECK(frame_opt->GetDurationNs() == 2000U);
+    }
+
+    SECTION("Timings without frame index are added to the collected frame")
+    {
+        timing_report.AddTimings(2U, Timings{ { "Cmd List", 0U, 1000U, 500U } });
+        timing_report.AddTimings({}, Timings{ { "Upload", 0U, 1600U, 400U } });
+        timing_report.CompleteFrame();
+
+        const Opt<Rhi::GpuTimingReport::Frame> frame_opt = timing_report.GetLastCompletedFrame();
+        REQUIRE(frame_opt);
+        CHECK(frame_opt->frame_index == 2U);
+        CHECK(frame_opt->timings.size() == 2U);
+        CHECK(frame_opt->GetDurationNs() == 1000U);
+    }
+
+    SECTION("Only maximum count of last completed frames is kept")
+    {
+        for (Data::Index frame_index = 0U; frame_index < 5U; ++frame_index)
+        {
+            timing_report.AddTimings(frame_index % 3U, Timings{ { "Cmd List", 0U, frame_index * 1000U, 100U } });
+        }
+        timing_report.CompleteFrame();
+
+        const Rhi::GpuTimingReport::Frames frames = timing_report.GetCompletedFrames();
+        REQUIRE(frames.size() == timing_report.GetMaxFramesCount());
+        CHECK(frames[0].frame_number == 3U);
+        CHECK(frames[1].frame_number == 4U);
+        CHECK(frames[1].GetStartNs() == 4000U);
+    }
+
+    SECTION("Frame is converted to text report")
+    {
+        timing_report.AddTimings(0U, Timings{ { "Cmd List", 0U, 1000U, 2000000U }, { "Pass", 1U, 1000U, 1500000U } });
+        timing_report.CompleteFrame();
+
+        const Opt<Rhi::GpuTimingReport::Frame> frame_opt = timing_report.GetLastCompletedFrame();
+        REQUIRE(frame_opt);
+        CHECK(static_cast<std::string>(*frame_opt) == "Render Queue GPU frame 0: 2.000 ms\n"
+                                                      "  Cmd List: 2.000 ms\n"
+                                                      "    Pass: 1.500 ms");
+    }
+
+    SECTION("Completed frames are written to JSON")
+    {
+        timing_report.AddTimings(1U, Timings{ { "Cmd \"List\"", 0U, 1000U, 500U } });
+        timing_report.CompleteFrame();
+
+        std::stringstream json_stream;
+        timing_report.WriteJson(json_stream);
+        CHECK(json_stream.str() == "{\"frames\":[{\"frame\":0,\"frame_index\":1,\"queue\":\"Render Queue\","
+                                   "\"gpu_frequency\":1000000000,\"calibration\":{\"gpu_ts\":5000,\"cpu_ts\":1000},"
+                                   "\"start_ns\":1000,\"duration_ns\":500,"
+                                   "\"timings\":[{\"name\":\"Cmd \\\"List\\\"\",\"depth\":0,\"start_ns\":1000,\"duration_ns\":500}]}]}");
+    }
+
+    SECTION("Report is cleared")
+    {
+        timing_report.AddTimings(0U, Timings{ { "Cmd List", 0U, 1000U, 500U } });
+        timing_report.CompleteFrame();
+        timing_report.Clear();
+        CHECK_FALSE(timing_report.GetLastCompletedFrame());
+        CHECK(timing_report.GetCompletedFrames().empty());
+    }
+}
+
+TEST_CASE("GPU Timing Report of Null Command Queue", "[rhi][gpu-timing][queue]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue   compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+
+    SECTION("Null timestamp queries are synthesized from CPU clock")
+    {
+        const Ptr<Rhi::ITimestampQueryPool>& query_pool_ptr = compute_cmd_queue.GetTimestampQueryPoolPtr();
+        REQUIRE(query_pool_ptr);
+        CHECK(query_pool_ptr->GetGpuFrequency() == 1000000000U);
+
+        const Rhi::ITimestampQueryPool::CalibratedTimestamps calibrated_timestamps = query_pool_ptr->Calibrate();
+        CHECK(calibrated_timestamps.gpu_ts == calibrated_timestamps.cpu_ts);
+        CHECK(query_pool_ptr->GetGpuTimeOffset() == 0);
+
+        const Ptr<Rhi::ITimestampQuery> begin_query_ptr = query_pool_ptr->CreateTimestampQuery(compute_cmd_list.GetInterface());
+        const Ptr<Rhi::ITimestampQuery> end_query_ptr   = query_pool_ptr->CreateTimestampQuery(compute_cmd_list.GetInterface());
+        REQUIRE(begin_query_ptr);
+        REQUIRE(end_query_ptr);
+
+        begin_query_ptr->InsertTimestamp();
+        end_query_ptr->InsertTimestamp();
+        CHECK(begin_query_ptr->GetGpuTimestamp() >= calibrated_timestamps.gpu_ts);
+        CHECK(end_query_ptr->GetGpuTimestamp() >= begin_query_ptr->GetGpuTimestamp());
+        CHECK(end_query_ptr->GetCpuNanoseconds() == end_query_ptr->GetGpuTimestamp());
+    }
+
+    SECTION("Command queue name is used in timing report")
+    {
+        CHECK(compute_cmd_queue.SetName("Compute Queue"));
+        const Rhi::GpuTimingReport& timing_report = compute_cmd_queue.GetGpuTimingReport();
+        CHECK_FALSE(timing_report.GetLastCompletedFrame());
+    }
+
+#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
+    SECTION("Debug group timings are reported on command list completion")
+    {
+        const Rhi::CommandListDebugGroup outer_debug_group("Outer Group");
+        const Rhi::CommandListDebugGroup inner_debug_group("Inner Group");
+
+        const Rhi::CommandListSet cmd_list_set({ compute_cmd_list.GetInterface() }, 0U);
+        const Rhi::CommandListSet next_cmd_list_set({ compute_cmd_list.GetInterface() }, 1U);
+        for (const Rhi::CommandListSet* cmd_list_set_ptr : { &cmd_list_set, &next_cmd_list_set })
+        {
+            compute_cmd_list.Reset(&outer_debug_group);
+            compute_cmd_list.PushDebugGroup(inner_debug_group);
+            compute_cmd_list.PopDebugGroup();
+            compute_cmd_list.Commit();
+            compute_cmd_queue.Execute(*cmd_list_set_ptr);
+            dynamic_cast<Null::CommandListSet&>(cmd_list_set_ptr->GetInterface()).Complete();
+        }
+
+        const Opt<Rhi::GpuTimingReport::Frame> frame_opt = compute_cmd_queue.GetGpuTimingReport().GetLastCompletedFrame();
+        REQUIRE(frame_opt);
+        CHECK(frame_opt->frame_index == 0U);
+        REQUIRE(frame_opt->timings.size() == 2U);
+        CHECK(frame_opt->timings[0].name == "Outer Group");
+        CHECK(frame_opt->timings[0].depth == 1U);
+        CHECK(frame_opt->timings[1].name == "Inner Group");
+        CHECK(frame_opt->timings[1].depth == 2U);
+        CHECK(frame_opt->timings[1].start_ns >= frame_opt->timings[0].start_ns);
+        CHECK(frame_opt->timings[1].GetEndNs() <= frame_opt->timings[0].GetEndNs());
+    }
+#endif
+}
@@ -0,0 +1,91 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ObjectNamingBenchmark.cpp
+Benchmark of naming program bindings with formatted names set eagerly versus lazily,
+as it is done on initialization of the Parallel Rendering tutorial
+
+******************************************************************************/
+
+#include "DescriptorManagerTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ObjectRegistry.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <fmt/format.h>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+static constexpr uint32_t g_bindings_count = 10000U;
+
+TEST_CASE("RHI Object Naming Time", "[rhi][object][name][benchmark]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Program compute_program = Test::CreateDescriptorManagerTestProgram(compute_context);
+    const Rhi::Buffer  buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024, false, true));
+    const std::vector<Rhi::ProgramBindings> program_bindings =
+        Test::CreateProgramBindingsInParallel(compute_program, buffer, 1U, g_bindings_count);
+
+    uint32_t frame_index = 0U;
+    BENCHMARK(std::to_string(g_bindings_count) + " bindings named with formatted names")
+    {
+        frame_index++;
+        for (uint32_t binding_index = 0U; binding_index < g_bindings_count; ++binding_index)
+        {
+            program_bindings[binding_index].SetName(fmt::format("Cube {} Bindings {}", binding_index, frame_index));
+        }
+        return frame_index;
+    };
+
+    BENCHMARK(std::to_string(g_bindings_count) + " bindings named with lazy names")
+    {
+        frame_index++;
+        for (uint32_t binding_index = 0U; binding_index < g_bindings_count; ++binding_index)
+        {
+            program_bindings[binding_index].SetLazyName([binding_index, frame_index]()
+            {
+                return fmt::format("Cube {} Bindings {}", binding_index, frame_index);
+            });
+        }
+        return frame_index;
+    };
+
+    BENCHMARK(std::to_string(g_bindings_count) + " bindings added to registry and found by name")
+    {
+        Rhi::ObjectRegistry object_registry = compute_context.GetObjectRegistry();
+        size_t found_bindings_count = 0U;
+        for (const Rhi::ProgramBindings& bindings : program_bindings)
+        {
+            object_registry.AddGraphicsObject(bindings);
+        }
+        for (const Rhi::ProgramBindings& bindings : program_bindings)
+        {
+            found_bindings_count += object_registry.HasGraphicsObject(std::string(bindings.GetName()));
+            object_registry.RemoveGraphicsObject(bindings);
+        }
+        return found_bindings_count;
+    };
+
+    CHECK(program_bindings.back().GetName() == fmt::format("Cube {} Bindings {}", g_bindings_count - 1U, frame_index));
+}
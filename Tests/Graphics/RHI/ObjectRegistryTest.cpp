@@ -99,6 +99,14 @@ TEST_CASE("RHI Object Registry Functions", "[rhi][object-registry]")
         CHECK_THROWS_AS(object_registry.RemoveGraphicsObject(buffer), ArgumentException);
     }
 
+    SECTION("Renamed Object is Found by New Name")
+    {
+        REQUIRE_NOTHROW(object_registry.AddGraphicsObject(constant_buffer_one));
+        CHECK(constant_buffer_one.SetName("Renamed Constant Buffer"));
+        CHECK_FALSE(object_registry.HasGraphicsObject("Constant Buffer 1"));
+        CHECK(object_registry.GetGraphicsObject<Rhi::Buffer>("Renamed Constant Buffer").IsInitialized());
+    }
+
     SECTION("Automatically Remove Destroyed Objects from Registry")
     {
         {
@@ -248,6 +248,30 @@ TEST_CASE("RHI Program Bindings Functions", "[rhi][program][bindings]")
         CHECK_FALSE(object_callback_tester.IsObjectNameChanged());
     }
 
+    SECTION("Object Lazy Name Setup")
+    {
+        uint32_t format_calls_count = 0U;
+        CHECK(program_bindings.SetLazyName([&format_calls_count]()
+        {
+            format_calls_count++;
+            return std::string("Lazy Program Bindings");
+        }));
+        CHECK(format_calls_count == 0U);
+        CHECK(program_bindings.GetName() == "Lazy Program Bindings");
+        CHECK(program_bindings.GetName() == "Lazy Program Bindings");
+        CHECK(format_calls_count == 1U);
+    }
+
+    SECTION("Object Lazy Name Change Callback")
+    {
+        CHECK(program_bindings.SetName("My Program Bindings"));
+        ObjectCallbackTester object_callback_tester(program_bindings);
+        CHECK(program_bindings.SetLazyName([]() { return std::string("Our Program Bindings"); }));
+        CHECK(object_callback_tester.IsObjectNameChanged());
+        CHECK(object_callback_tester.GetCurObjectName() == "Our Program Bindings");
+        CHECK(object_callback_tester.GetOldObjectName() == "My Program Bindings");
+    }
+
     SECTION("Add to Objects Registry")
     {
         program_bindings.SetName("Program Bindings");
@@ -0,0 +1,62 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandBundleBenchmark.cpp
+Benchmark of CPU encoding time of static geometry draws re-encoded every frame
+versus executed from the pre-recorded Render Command Bundle
+
+******************************************************************************/
+
+#include "RenderCommandBundleTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Render Command Bundle Encoding Time", "[rhi][list][render][bundle][benchmark]")
+{
+    const Test::RenderCommandBundleScene scene(g_parallel_executor);
+    const Rhi::RenderCommandList cmd_list = scene.render_cmd_queue.CreateRenderCommandList(scene.render_pass);
+    Rhi::IRenderCommandList& cmd_list_interface = cmd_list.GetInterface();
+
+    for (const uint32_t draws_count : { 100U, 1000U, 10000U })
+    {
+        BENCHMARK(std::to_string(draws_count) + " draws re-encoded")
+        {
+            cmd_list.Reset();
+            scene.Record(cmd_list_interface, draws_count);
+            return cmd_list.GetState();
+        };
+
+        const Ptr<Rhi::IRenderCommandBundle> bundle_ptr = scene.CreateBundle(draws_count);
+        BENCHMARK(std::to_string(draws_count) + " draws executed from bundle")
+        {
+            cmd_list.Reset();
+            cmd_list.ExecuteBundle(*bundle_ptr);
+            return cmd_list.GetState();
+        };
+
+        CHECK(bundle_ptr->GetRecordingsCount() == 1U);
+    }
+}
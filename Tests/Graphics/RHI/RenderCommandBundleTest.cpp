@@ -0,0 +1,185 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandBundleTest.cpp
+Unit-tests of the Render Command Bundle recording, execution and invalidation
+
+******************************************************************************/
+
+#include "RenderCommandBundleTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/Base/RenderCommandBundle.h>
+#include <Methane/Graphics/Base/RenderState.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Render Command Bundle Functions", "[rhi][list][render][bundle]")
+{
+    const Test::RenderCommandBundleScene scene(g_parallel_executor);
+    const Rhi::RenderCommandList cmd_list = scene.render_cmd_queue.CreateRenderCommandList(scene.render_pass);
+    auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+
+    constexpr uint32_t draws_count = 16U;
+    const Ptr<Rhi::IRenderCommandBundle> bundle_ptr = scene.CreateBundle(draws_count);
+    REQUIRE(bundle_ptr);
+    const auto& base_bundle = dynamic_cast<const Base::RenderCommandBundle&>(*bundle_ptr);
+
+    SECTION("Bundle is Recorded on First Execution")
+    {
+        CHECK_FALSE(bundle_ptr->IsValid());
+        CHECK(bundle_ptr->GetRecordingsCount() == 0U);
+        CHECK_FALSE(base_bundle.GetCommandStreamPtr());
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+
+        CHECK(bundle_ptr->IsValid());
+        CHECK(bundle_ptr->GetRecordingsCount() == 1U);
+        REQUIRE(base_bundle.GetCommandStreamPtr());
+        CHECK(base_bundle.GetCommandStreamPtr()->GetCommandsCount() == draws_count + 5U);
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == scene.render_state.GetInterfacePtr().get());
+        CHECK(dynamic_cast<const Rhi::IBuffer*>(null_cmd_list.GetDrawingState().index_buffer_ptr.get()) == scene.index_buffer.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetProgramBindingsPtr() == scene.program_bindings.GetInterfacePtr().get());
+    }
+
+    SECTION("Bundle is Executed in Multiple Frames without Re-Recording")
+    {
+        for (uint32_t frame_index = 0U; frame_index < 3U; ++frame_index)
+        {
+            REQUIRE_NOTHROW(cmd_list.Reset());
+            REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+            CHECK(null_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
+            REQUIRE_NOTHROW(cmd_list.Commit());
+        }
+        CHECK(bundle_ptr->GetRecordingsCount() == 1U);
+    }
+
+    SECTION("Bundle is Recorded from Empty Drawing State of Command List")
+    {
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.SetRenderState(scene.render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(scene.view_state));
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+
+        // Render and view states already set in command list are still recorded to bundle
+        CHECK(base_bundle.GetCommandStreamPtr()->GetCommandsCount() == draws_count + 5U);
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == scene.render_state.GetInterfacePtr().get());
+    }
+
+    SECTION("Bundle Commands are Executed in Command Stream Mode after Recorded Commands")
+    {
+        null_cmd_list.SetCommandStreamEnabled(true);
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.SetViewState(scene.view_state));
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+
+        // Bundle commands are not recorded to the command stream of the command list
+        CHECK(null_cmd_list.GetCommandStream().GetCommandsCount() == 1U);
+        CHECK(null_cmd_list.IsCommandStreamEnabled());
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Bundle is Re-Recorded after Manual Invalidation")
+    {
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+        CHECK(bundle_ptr->IsValid());
+
+        bundle_ptr->Invalidate();
+        CHECK_FALSE(bundle_ptr->IsValid());
+
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+        CHECK(bundle_ptr->IsValid());
+        CHECK(bundle_ptr->GetRecordingsCount() == 2U);
+        CHECK(base_bundle.GetCommandStreamPtr()->GetCommandsCount() == draws_count + 5U);
+    }
+
+    SECTION("Bundle is Invalidated on Program Bindings Resource Change")
+    {
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+        REQUIRE(bundle_ptr->IsValid());
+
+        Rhi::IProgramArgumentBinding& buffer_binding = scene.program_bindings.Get({ Rhi::ShaderType::Vertex, "OutBuffer" });
+        REQUIRE_NOTHROW(buffer_binding.SetResourceView(scene.other_constant_buffer.GetResourceView()));
+        CHECK_FALSE(bundle_ptr->IsValid());
+
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+        CHECK(bundle_ptr->IsValid());
+        CHECK(bundle_ptr->GetRecordingsCount() == 2U);
+    }
+
+    SECTION("Bundle is not Invalidated by Unreferenced Program Bindings")
+    {
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+
+        const Rhi::ProgramBindings other_program_bindings = scene.CreateProgramBindings();
+        Rhi::IProgramArgumentBinding& buffer_binding = other_program_bindings.Get({ Rhi::ShaderType::Vertex, "OutBuffer" });
+        REQUIRE_NOTHROW(buffer_binding.SetResourceView(scene.other_constant_buffer.GetResourceView()));
+        CHECK(bundle_ptr->IsValid());
+    }
+
+    SECTION("Command List State is Restored on Bundle Recording Failure")
+    {
+        const Ptr<Rhi::IRenderCommandBundle> failing_bundle_ptr = Rhi::IRenderCommandBundle::Create(scene.render_cmd_queue.GetInterface(),
+            [&scene](Rhi::IRenderCommandList& bundle_cmd_list)
+            {
+                bundle_cmd_list.SetRenderState(scene.render_state.GetInterface());
+                throw std::runtime_error("Bundle recording failure");
+            });
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.SetViewState(scene.view_state));
+        CHECK_THROWS_AS(cmd_list.ExecuteBundle(*failing_bundle_ptr), std::runtime_error);
+
+        CHECK_FALSE(failing_bundle_ptr->IsValid());
+        CHECK(failing_bundle_ptr->GetRecordingsCount() == 0U);
+        CHECK_FALSE(null_cmd_list.GetDrawingState().render_state_ptr);
+        CHECK(null_cmd_list.GetDrawingState().view_state_ptr);
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(*bundle_ptr));
+    }
+
+    SECTION("Debug Groups can not be Recorded to Bundle")
+    {
+        const Rhi::CommandListDebugGroup debug_group("Bundle Debug Group");
+        const Ptr<Rhi::IRenderCommandBundle> debug_bundle_ptr = Rhi::IRenderCommandBundle::Create(scene.render_cmd_queue.GetInterface(),
+            [&debug_group](Rhi::IRenderCommandList& bundle_cmd_list)
+            {
+                bundle_cmd_list.PushDebugGroup(debug_group.GetInterface());
+            });
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK_THROWS(cmd_list.ExecuteBundle(*debug_bundle_ptr));
+        CHECK_FALSE(debug_bundle_ptr->IsValid());
+    }
+
+    SECTION("Bundle can be Created only with Render Command Queue")
+    {
+        const Rhi::CommandQueue transfer_cmd_queue = scene.render_context.CreateCommandQueue(Rhi::CommandListType::Transfer);
+        CHECK_THROWS(Rhi::IRenderCommandBundle::Create(transfer_cmd_queue.GetInterface(), [](Rhi::IRenderCommandList&) { }));
+    }
+}
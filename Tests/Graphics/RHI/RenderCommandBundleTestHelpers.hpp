@@ -0,0 +1,170 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandBundleTestHelpers.hpp
+Helper scene of static geometry draws for Render Command Bundle tests and benchmarks
+
+******************************************************************************/
+
+#pragma once
+
+#include "RhiTestHelpers.hpp"
+#include "RhiSettings.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/IRenderCommandBundle.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+#include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Null/Buffer.h>
+
+#include <taskflow/taskflow.hpp>
+
+namespace Methane::Graphics::Test
+{
+
+struct RenderCommandBundleScene
+{
+    static constexpr uint32_t vertex_count = 1024U;
+    static constexpr uint32_t index_count  = 36U;
+
+    explicit RenderCommandBundleScene(tf::Executor& parallel_executor)
+        : render_context(app_env, GetTestDevice(), parallel_executor, GetRenderContextSettings())
+        , render_cmd_queue(render_context.CreateCommandQueue(Rhi::CommandListType::Render))
+        , render_pattern(render_context.CreateRenderPattern(GetRenderPatternSettings()))
+        , render_program(CreateProgram(render_context, render_pattern))
+        , render_pass_resources(GetRenderPassResources(render_pattern))
+        , render_pass(render_pattern.CreateRenderPass(render_pass_resources.settings))
+        , render_state(render_context.CreateRenderState(GetRenderStateSettings(render_context, render_pattern, render_program)))
+        , view_state(GetViewStateSettings())
+        , vertex_buffer_one(CreateVertexBuffer(render_context))
+        , vertex_buffer_two(CreateVertexBuffer(render_context))
+        , vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer_one, vertex_buffer_two })
+        , index_buffer(CreateIndexBuffer(render_context))
+        , constant_buffer(render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U, false, true)))
+        , other_constant_buffer(render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U, false, true)))
+        , program_bindings(CreateProgramBindings())
+    { }
+
+    [[nodiscard]] Rhi::ProgramBindings CreateProgramBindings() const
+    {
+        return render_program.CreateBindings({
+            { { Rhi::ShaderType::Vertex, "OutBuffer" }, constant_buffer.GetResourceView() }
+        });
+    }
+
+    // Encodes static geometry draw commands either to the render command list or to the render command bundle
+    void Record(Rhi::IRenderCommandList& cmd_list, uint32_t draws_count) const
+    {
+        cmd_list.SetRenderState(render_state.GetInterface());
+        cmd_list.SetViewState(view_state.GetInterface());
+        cmd_list.SetProgramBindings(program_bindings.GetInterface());
+        cmd_list.SetVertexBuffers(vertex_buffer_set.GetInterface());
+        cmd_list.SetIndexBuffer(index_buffer.GetInterface());
+        for (uint32_t draw_index = 0U; draw_index < draws_count; ++draw_index)
+        {
+            cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle, index_count, 0U, draw_index % (vertex_count - index_count), 1U, 0U);
+        }
+    }
+
+    [[nodiscard]] Ptr<Rhi::IRenderCommandBundle> CreateBundle(uint32_t draws_count) const
+    {
+        return Rhi::IRenderCommandBundle::Create(render_cmd_queue.GetInterface(), [this, draws_count](Rhi::IRenderCommandList& cmd_list)
+        {
+            Record(cmd_list, draws_count);
+        });
+    }
+
+    const Platform::AppEnvironment app_env{ nullptr };
+    const Rhi::RenderContext       render_context;
+    const Rhi::CommandQueue        render_cmd_queue;
+    const Rhi::RenderPattern       render_pattern;
+    const Rhi::Program             render_program;
+    const RenderPassResources      render_pass_resources;
+    const Rhi::RenderPass          render_pass;
+    const Rhi::RenderState         render_state;
+    const Rhi::ViewState           view_state;
+    Rhi::Buffer                    vertex_buffer_one;
+    Rhi::Buffer                    vertex_buffer_two;
+    const Rhi::BufferSet           vertex_buffer_set;
+    const Rhi::Buffer              index_buffer;
+    const Rhi::Buffer              constant_buffer;
+    const Rhi::Buffer              other_constant_buffer;
+    const Rhi::ProgramBindings     program_bindings;
+
+private:
+    [[nodiscard]] static Rhi::Program CreateProgram(const Rhi::RenderContext& render_context, const Rhi::RenderPattern& render_pattern)
+    {
+        using enum Rhi::ShaderType;
+        const Rhi::ProgramArgumentAccessor buffer_accessor{ Vertex, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable };
+        Rhi::Program render_program = render_context.CreateProgram(
+            Rhi::ProgramSettingsImpl
+            {
+                .shader_set = Rhi::ProgramSettingsImpl::ShaderSet
+                {
+                    { Vertex, { Data::ShaderProvider::Get(), { "Render", "MainVS" } } },
+                    { Pixel,  { Data::ShaderProvider::Get(), { "Render", "MainPS" } } }
+                },
+                .input_buffer_layouts = Rhi::ProgramInputBufferLayouts
+                {
+                    Rhi::ProgramInputBufferLayout
+                    {
+                        .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "COLOR" },
+                        .step_type = Rhi::ProgramInputBufferLayout::StepType::PerVertex,
+                        .step_rate = 1U
+                    },
+                    Rhi::ProgramInputBufferLayout
+                    {
+                        .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "NORMAL" , "TANGENT" },
+                        .step_type = Rhi::ProgramInputBufferLayout::StepType::PerVertex,
+                        .step_rate = 1U
+                    }
+                },
+                .argument_accessors = Rhi::ProgramArgumentAccessors{ buffer_accessor },
+                .attachment_formats = render_pattern.GetAttachmentFormats()
+            });
+        dynamic_cast<Null::Program&>(render_program.GetInterface()).SetArgumentBindings({
+            { buffer_accessor, { Rhi::ResourceType::Buffer, 1U } },
+        });
+        return render_program;
+    }
+
+    [[nodiscard]] static Rhi::Buffer CreateVertexBuffer(const Rhi::RenderContext& render_context)
+    {
+        Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(vertex_count * 12U, 12U, true));
+        dynamic_cast<Null::Buffer&>(vertex_buffer.GetInterface()).SetInitializedDataSize(vertex_count * 12U);
+        return vertex_buffer;
+    }
+
+    [[nodiscard]] static Rhi::Buffer CreateIndexBuffer(const Rhi::RenderContext& render_context)
+    {
+        Rhi::Buffer index_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(index_count * 2U, PixelFormat::R16Uint));
+        dynamic_cast<Null::Buffer&>(index_buffer.GetInterface()).SetInitializedDataSize(index_count * 2U);
+        return index_buffer;
+    }
+};
+
+} // namespace Methane::Graphics::Test
@@ -0,0 +1,243 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ResourceBarriersBatchTest.cpp
+Unit-tests of the Base Resource Barriers Batch accumulated in command lists
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/Base/ResourceBarriersBatch.h>
+#include <Methane/Graphics/Null/ComputeCommandList.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+using State = Rhi::ResourceState;
+
+TEST_CASE("RHI Resource Barriers Batch", "[rhi][barriers][batch]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Buffer buffer_a = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024U, false, true));
+    const Rhi::Buffer buffer_b = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024U, false, true));
+    Rhi::IResource& resource_a = buffer_a.GetInterface();
+    Rhi::IResource& resource_b = buffer_b.GetInterface();
+
+    Base::ResourceBarriersBatch batch;
+
+    SECTION("Empty batch is not flushed")
+    {
+        CHECK_FALSE(batch.HasPendingBarriers());
+        CHECK(batch.Flush() == nullptr);
+        CHECK(batch.GetStatistics().flushes_count == 0U);
+    }
+
+    SECTION("Transitions of different resources are flushed in one barriers set")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ConstantBuffer));
+        batch.Add(Rhi::ResourceBarrier(resource_b, State::Common, State::ShaderResource));
+
+        const Rhi::IResourceBarriers* barriers_ptr = batch.Flush();
+        REQUIRE(barriers_ptr != nullptr);
+        CHECK(barriers_ptr->GetMap().size() == 2U);
+        CHECK(barriers_ptr->GetSet().contains(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ConstantBuffer)));
+        CHECK(barriers_ptr->GetSet().contains(Rhi::ResourceBarrier(resource_b, State::Common, State::ShaderResource)));
+        CHECK_FALSE(batch.HasPendingBarriers());
+
+        const Base::ResourceBarriersBatch::Statistics& statistics = batch.GetStatistics();
+        CHECK(statistics.added_count == 2U);
+        CHECK(statistics.flushed_count == 2U);
+        CHECK(statistics.flushes_count == 1U);
+        CHECK(statistics.eliminated_count == 0U);
+    }
+
+    SECTION("Consecutive transitions of resource are merged")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::ShaderResource, State::UnorderedAccess));
+
+        const Rhi::IResourceBarriers* barriers_ptr = batch.Flush();
+        REQUIRE(barriers_ptr != nullptr);
+        CHECK(barriers_ptr->GetSet() == Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(resource_a, State::CopyDest, State::UnorderedAccess)
+        });
+        CHECK(batch.GetStatistics().merged_count == 1U);
+        CHECK(batch.GetStatistics().eliminated_count == 1U);
+    }
+
+    SECTION("Transitions returning resource to initial state are eliminated")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::ShaderResource, State::CopyDest));
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+        batch.Add(Rhi::ResourceBarrier(resource_b, State::Common, State::Common));
+
+        CHECK_FALSE(batch.HasPendingBarriers());
+        CHECK(batch.Flush() == nullptr);
+        CHECK(batch.GetStatistics().added_count == 3U);
+        CHECK(batch.GetStatistics().eliminated_count == 3U);
+    }
+
+    SECTION("Unordered access synchronization barriers are not eliminated")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::UnorderedAccess, State::UnorderedAccess));
+        batch.Add(Rhi::ResourceBarrier(resource_b, State::UnorderedAccess, State::ShaderResource));
+        batch.Add(Rhi::ResourceBarrier(resource_b, State::ShaderResource, State::UnorderedAccess));
+
+        const Rhi::IResourceBarriers* barriers_ptr = batch.Flush();
+        REQUIRE(barriers_ptr != nullptr);
+        CHECK(barriers_ptr->GetSet() == Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(resource_a, State::UnorderedAccess, State::UnorderedAccess),
+            Rhi::ResourceBarrier(resource_b, State::UnorderedAccess, State::UnorderedAccess)
+        });
+        CHECK(batch.GetStatistics().merged_count == 1U);
+    }
+
+    SECTION("Transition to already flushed resource state is not eliminated")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+        CHECK(batch.Flush() != nullptr);
+
+        // Resource state could be changed after flush by barriers set to command list bypassing the batch
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+        CHECK(batch.HasPendingBarriers());
+        CHECK(batch.GetStatistics().eliminated_count == 0U);
+    }
+
+    SECTION("Owner transitions are merged separately from state transitions")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, 0U, 1U));
+        batch.Add(Rhi::ResourceBarrier(resource_a, 1U, 2U));
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+
+        CHECK(batch.GetPendingBarriers().size() == 2U);
+        const Rhi::IResourceBarriers* barriers_ptr = batch.Flush();
+        REQUIRE(barriers_ptr != nullptr);
+        CHECK(barriers_ptr->GetSet().contains(Rhi::ResourceBarrier(resource_a, 0U, 2U)));
+    }
+
+    SECTION("Batch barriers object is reused between flushes")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+        const Rhi::IResourceBarriers* first_barriers_ptr = batch.Flush();
+
+        batch.Add(Rhi::ResourceBarrier(resource_b, State::CopyDest, State::ShaderResource));
+        const Rhi::IResourceBarriers* second_barriers_ptr = batch.Flush();
+
+        CHECK(first_barriers_ptr == second_barriers_ptr);
+        REQUIRE(second_barriers_ptr != nullptr);
+        CHECK(second_barriers_ptr->GetSet() == Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(resource_b, State::CopyDest, State::ShaderResource)
+        });
+    }
+
+    SECTION("Reset clears pending barriers and statistics")
+    {
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+        CHECK(batch.Flush() != nullptr);
+        batch.Add(Rhi::ResourceBarrier(resource_b, State::CopyDest, State::ShaderResource));
+        batch.Reset();
+
+        CHECK_FALSE(batch.HasPendingBarriers());
+        CHECK(batch.GetStatistics().added_count == 0U);
+
+        batch.Add(Rhi::ResourceBarrier(resource_a, State::CopyDest, State::ShaderResource));
+        CHECK(batch.HasPendingBarriers());
+    }
+}
+
+TEST_CASE("RHI Command List Resource Barriers Batching", "[rhi][barriers][batch][list]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    auto& null_cmd_list = dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface());
+
+    const Rhi::Buffer buffer_a = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024U, false, true));
+    const Rhi::Buffer buffer_b = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024U, false, true));
+    const Ptr<Rhi::IResourceBarriers> barriers_a_ptr = Rhi::IResourceBarriers::Create({
+        Rhi::ResourceBarrier(buffer_a.GetInterface(), State::CopyDest, State::ShaderResource)
+    });
+    const Ptr<Rhi::IResourceBarriers> barriers_b_ptr = Rhi::IResourceBarriers::Create({
+        Rhi::ResourceBarrier(buffer_b.GetInterface(), State::CopyDest, State::UnorderedAccess)
+    });
+
+    REQUIRE_NOTHROW(cmd_list.Reset());
+
+    SECTION("Accumulated barriers are set in one batch before dispatch")
+    {
+        null_cmd_list.AddResourceBarriers(*barriers_a_ptr);
+        null_cmd_list.AddResourceBarriers(*barriers_b_ptr);
+        CHECK(null_cmd_list.GetSetResourceBarriersCount() == 0U);
+
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(1U, 1U, 1U)));
+        CHECK(null_cmd_list.GetSetResourceBarriersCount() == 1U);
+        CHECK(null_cmd_list.GetLastResourceBarriers().size() == 2U);
+
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(1U, 1U, 1U)));
+        CHECK(null_cmd_list.GetSetResourceBarriersCount() == 1U);
+    }
+
+    SECTION("Barriers are not eliminated across dispatches after direct barriers")
+    {
+        null_cmd_list.AddResourceBarriers(*barriers_a_ptr);
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(1U, 1U, 1U)));
+
+        // Resource is transitioned back to copy destination state bypassing the batch
+        const Ptr<Rhi::IResourceBarriers> copy_barriers_ptr = Rhi::IResourceBarriers::Create({
+            Rhi::ResourceBarrier(buffer_a.GetInterface(), State::ShaderResource, State::CopyDest)
+        });
+        REQUIRE_NOTHROW(null_cmd_list.SetResourceBarriers(*copy_barriers_ptr));
+
+        null_cmd_list.AddResourceBarriers(*barriers_a_ptr);
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(1U, 1U, 1U)));
+
+        CHECK(null_cmd_list.GetSetResourceBarriersCount() == 3U);
+        CHECK(null_cmd_list.GetLastResourceBarriers() == Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(buffer_a.GetInterface(), State::CopyDest, State::ShaderResource)
+        });
+        CHECK(null_cmd_list.GetResourceBarriersStatistics().eliminated_count == 0U);
+    }
+
+    SECTION("Pending barriers are set before barriers set directly to command list")
+    {
+        null_cmd_list.AddResourceBarriers(*barriers_a_ptr);
+        REQUIRE_NOTHROW(null_cmd_list.SetResourceBarriers(*barriers_b_ptr));
+
+        CHECK(null_cmd_list.GetSetResourceBarriersCount() == 2U);
+        CHECK(null_cmd_list.GetLastResourceBarriers() == barriers_b_ptr->GetSet());
+        CHECK(null_cmd_list.GetResourceBarriersStatistics().flushes_count == 1U);
+    }
+
+    SECTION("Pending barriers are set on commit")
+    {
+        null_cmd_list.AddResourceBarriers(*barriers_a_ptr);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        CHECK(null_cmd_list.GetSetResourceBarriersCount() == 1U);
+        CHECK(cmd_list.GetState() == Rhi::CommandListState::Committed);
+    }
+}
@@ -542,6 +542,20 @@ TEST_CASE("RHI Resource Barriers Container", "[rhi][resource][barriers]")
         CHECK(test_barriers.HasOwnerTransition(new_buffer.GetInterface(), new_owner_change.GetQueueFamilyBefore(), new_owner_change.GetQueueFamilyAfter()));
     }
 
+    SECTION("Apply Unordered Access Synchronization Barrier")
+    {
+        Rhi::IResource& resource = test_buffer_refs[0].get();
+        const Rhi::ResourceBarriers uav_barriers(Rhi::ResourceBarriers::Set{
+            Rhi::ResourceBarrier(resource, Rhi::ResourceState::UnorderedAccess, Rhi::ResourceState::UnorderedAccess)
+        });
+        CHECK_FALSE(uav_barriers.IsEmpty());
+        CHECK(uav_barriers.HasStateTransition(resource, Rhi::ResourceState::UnorderedAccess, Rhi::ResourceState::UnorderedAccess));
+
+        CHECK(resource.SetState(Rhi::ResourceState::UnorderedAccess));
+        REQUIRE_NOTHROW(uav_barriers.ApplyTransitions());
+        CHECK(resource.GetState() == Rhi::ResourceState::UnorderedAccess);
+    }
+
     SECTION("Apply Transitions")
     {
         for (const Rhi::ResourceBarrier& barrier : test_barriers_set)
@@ -0,0 +1,114 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RootConstantBufferTest.cpp
+Unit-tests of the Base Root Constant Buffer with dirty ranges uploading
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/RootConstantBuffer.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+static constexpr uint32_t   g_root_constants_count = 16U;
+static constexpr Data::Size g_root_constant_size   = 16U;
+static constexpr Data::Size g_root_constant_stride = 256U;
+
+struct TestRootConstant
+{
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    uint32_t d;
+};
+
+static_assert(sizeof(TestRootConstant) == g_root_constant_size);
+
+TEST_CASE("RHI Root Constant Buffer Uploads", "[rhi][root][constant][buffer]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    Base::RootConstantBuffer root_constant_buffer(dynamic_cast<Base::Context&>(compute_context.GetInterface()), "Root Constant Buffer");
+    std::vector<UniquePtr<Base::RootConstantAccessor>> accessors;
+
+    for (uint32_t i = 0U; i < g_root_constants_count; ++i)
+    {
+        accessors.emplace_back(root_constant_buffer.ReserveRootConstant(g_root_constant_size));
+        accessors.back()->SetRootConstant(Rhi::RootConstant(TestRootConstant{ i, i, i, i }));
+    }
+
+    REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+
+    SECTION("Initial upload of the whole buffer")
+    {
+        const Base::RootConstantBuffer::UploadCounters& counters = root_constant_buffer.GetUploadCounters();
+        CHECK(counters.uploaded_data_size == g_root_constants_count * g_root_constant_stride);
+        CHECK(counters.copy_regions_count == 1U);
+        CHECK(counters.total_uploaded_size == g_root_constants_count * g_root_constant_stride);
+    }
+
+    SECTION("No upload of unchanged buffer")
+    {
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(root_constant_buffer.GetUploadCounters().uploaded_data_size == 0U);
+        CHECK(root_constant_buffer.GetUploadCounters().copy_regions_count == 0U);
+    }
+
+    SECTION("Upload of single changed root constant")
+    {
+        CHECK(accessors[3]->SetRootConstant(Rhi::RootConstant(TestRootConstant{ 1U, 2U, 3U, 4U })));
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(root_constant_buffer.GetUploadCounters().uploaded_data_size == g_root_constant_size);
+        CHECK(root_constant_buffer.GetUploadCounters().copy_regions_count == 1U);
+    }
+
+    SECTION("Upload of the same root constant value is skipped")
+    {
+        CHECK_FALSE(accessors[3]->SetRootConstant(Rhi::RootConstant(TestRootConstant{ 3U, 3U, 3U, 3U })));
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(root_constant_buffer.GetUploadCounters().uploaded_data_size == 0U);
+    }
+
+    SECTION("Upload of distant changed root constants in separate regions")
+    {
+        CHECK(accessors[0]->SetRootConstant(Rhi::RootConstant(TestRootConstant{ 1U, 2U, 3U, 4U })));
+        CHECK(accessors[15]->SetRootConstant(Rhi::RootConstant(TestRootConstant{ 1U, 2U, 3U, 4U })));
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(root_constant_buffer.GetUploadCounters().uploaded_data_size == 2U * g_root_constant_size);
+        CHECK(root_constant_buffer.GetUploadCounters().copy_regions_count == 2U);
+    }
+
+    SECTION("Upload of nearby changed root constants in coalesced region")
+    {
+        CHECK(accessors[2]->SetRootConstant(Rhi::RootConstant(TestRootConstant{ 1U, 2U, 3U, 4U })));
+        CHECK(accessors[4]->SetRootConstant(Rhi::RootConstant(TestRootConstant{ 1U, 2U, 3U, 4U })));
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(root_constant_buffer.GetUploadCounters().uploaded_data_size == 2U * g_root_constant_stride + g_root_constant_size);
+        CHECK(root_constant_buffer.GetUploadCounters().copy_regions_count == 1U);
+    }
+
+    accessors.clear();
+}
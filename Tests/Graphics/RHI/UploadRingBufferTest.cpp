@@ -0,0 +1,147 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/UploadRingBufferTest.cpp
+Unit-tests of the Base Upload Ring Buffer allocator
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/UploadRingBuffer.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+static constexpr Data::Size  g_alignment     = 256U;
+static constexpr Data::Size  g_capacity      = 16U * g_alignment;
+static constexpr Data::Index g_frames_count  = 3U;
+
+TEST_CASE("RHI Upload Ring Buffer Allocations", "[rhi][buffer][upload][ring]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    Base::UploadRingBuffer ring_buffer(dynamic_cast<Base::Context&>(compute_context.GetInterface()), {
+        g_capacity, g_alignment, "Test Upload Ring Buffer"
+    });
+
+    SECTION("Backing buffer is created with ring buffer capacity")
+    {
+        CHECK(ring_buffer.GetBuffer().GetSettings().size == g_capacity);
+        CHECK(ring_buffer.GetStatistics().capacity == g_capacity);
+        CHECK(ring_buffer.GetStatistics().in_flight_size == 0U);
+    }
+
+    SECTION("Allocations in frame are aligned, sequential and CPU-writable")
+    {
+        ring_buffer.BeginFrame(0U);
+        const Base::UploadRingBuffer::Allocation alloc_a = ring_buffer.Allocate(16U);
+        const Base::UploadRingBuffer::Allocation alloc_b = ring_buffer.Allocate(300U);
+        const Base::UploadRingBuffer::Allocation alloc_c = ring_buffer.AllocateData(Data::Chunk(std::array<uint32_t, 4>{ 1U, 2U, 3U, 4U }));
+
+        CHECK(alloc_a.offset == 0U);
+        CHECK(alloc_b.offset == g_alignment);
+        CHECK(alloc_c.offset == 3U * g_alignment);
+        CHECK(alloc_b.size == 300U);
+        CHECK(alloc_b.data.size() == 300U);
+        CHECK(reinterpret_cast<const uint32_t*>(alloc_c.data.data())[3] == 4U); // NOSONAR
+
+        const Rhi::ResourceView view = ring_buffer.GetResourceView(alloc_b);
+        CHECK(view.GetOffset() == g_alignment);
+        CHECK(view.GetSize() == 300U);
+
+        const Base::UploadRingBuffer::Statistics statistics = ring_buffer.GetStatistics();
+        CHECK(statistics.frame_allocated_size == 4U * g_alignment);
+        CHECK(statistics.frame_allocations_count == 3U);
+        CHECK(statistics.frame_high_water_mark == 4U * g_alignment);
+    }
+
+    SECTION("Allocated ranges are uploaded on context resources upload")
+    {
+        ring_buffer.BeginFrame(0U);
+        const Base::UploadRingBuffer::Allocation allocation = ring_buffer.Allocate(100U);
+        std::fill(allocation.data.begin(), allocation.data.end(), Data::Byte{ 7U });
+
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(ring_buffer.GetStatistics().uploaded_size == g_alignment);
+
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(ring_buffer.GetStatistics().uploaded_size == g_alignment);
+    }
+
+    SECTION("Frame ranges are retired when frame index is reused")
+    {
+        for (Data::Index frame_index = 0U; frame_index < g_frames_count; ++frame_index)
+        {
+            ring_buffer.BeginFrame(frame_index);
+            CHECK_FALSE(ring_buffer.Allocate(4U * g_alignment).IsEmpty());
+        }
+        CHECK(ring_buffer.GetStatistics().in_flight_size == 3U * 4U * g_alignment);
+
+        ring_buffer.BeginFrame(0U);
+        CHECK(ring_buffer.GetStatistics().in_flight_size == 2U * 4U * g_alignment);
+        CHECK(ring_buffer.GetStatistics().in_flight_high_water_mark == 3U * 4U * g_alignment);
+    }
+
+    SECTION("Allocations wrap around buffer end without splitting ranges")
+    {
+        for (uint32_t frame = 0U; frame < 10U; ++frame)
+        {
+            const Data::Index frame_index = frame % g_frames_count;
+            ring_buffer.BeginFrame(frame_index);
+            const Base::UploadRingBuffer::Allocation allocation = ring_buffer.Allocate(3U * g_alignment);
+            CHECK(allocation.offset + allocation.size <= g_capacity);
+            REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        }
+        CHECK(ring_buffer.GetStatistics().in_flight_high_water_mark <= g_capacity);
+    }
+
+    SECTION("Ring buffer overflow throws exception")
+    {
+        ring_buffer.BeginFrame(0U);
+        CHECK_NOTHROW(ring_buffer.Allocate(10U * g_alignment));
+        CHECK_THROWS(ring_buffer.Allocate(10U * g_alignment));
+        CHECK_THROWS(ring_buffer.Allocate(g_capacity + 1U));
+    }
+
+    SECTION("Failed wrapping allocation does not advance ring buffer head")
+    {
+        ring_buffer.BeginFrame(0U);
+        CHECK_NOTHROW(ring_buffer.Allocate(12U * g_alignment));
+        CHECK_THROWS(ring_buffer.Allocate(8U * g_alignment));
+
+        Base::UploadRingBuffer::Allocation allocation;
+        REQUIRE_NOTHROW(allocation = ring_buffer.Allocate(4U * g_alignment));
+        CHECK(allocation.offset == 12U * g_alignment);
+        CHECK(ring_buffer.GetStatistics().in_flight_size == g_capacity);
+    }
+
+    SECTION("Empty allocation does not consume ring buffer space")
+    {
+        ring_buffer.BeginFrame(0U);
+        CHECK(ring_buffer.Allocate(0U).IsEmpty());
+        CHECK(ring_buffer.GetStatistics().frame_allocated_size == 0U);
+    }
+}
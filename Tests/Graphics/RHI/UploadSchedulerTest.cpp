@@ -0,0 +1,179 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/UploadSchedulerTest.cpp
+Unit-tests of the Base Upload Scheduler of asynchronous resource uploads
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/UploadScheduler.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+#include <Methane/Data/SharedChunk.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+static constexpr Data::Size g_buffer_size = 1024U;
+
+static bool IsReady(const Base::UploadScheduler::Readiness& readiness)
+{
+    return readiness.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+static void CompleteUploads(const Rhi::ComputeContext& compute_context)
+{
+    dynamic_cast<Null::CommandListSet&>(compute_context.GetUploadCommandKit().GetListSet().GetInterface()).Complete();
+}
+
+TEST_CASE("RHI Upload Scheduler", "[rhi][buffer][upload][scheduler]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(g_buffer_size, false, true));
+    const Rhi::CommandQueue upload_cmd_queue = compute_context.GetUploadCommandKit().GetQueue();
+    Base::UploadScheduler upload_scheduler(dynamic_cast<Base::Context&>(compute_context.GetInterface()), {
+        g_buffer_size, 256U, 16U
+    });
+
+    SECTION("Non-owned data is copied to shared staging pages")
+    {
+        const std::vector<std::byte> test_data(100U, std::byte(3));
+        const Data::ChunkCopyScope copy_scope;
+        const Base::UploadScheduler::Readiness readiness_a = upload_scheduler.Schedule(buffer.GetInterface(), Rhi::SubResource(test_data.data(), 100U), upload_cmd_queue.GetInterface());
+        const Base::UploadScheduler::Readiness readiness_b = upload_scheduler.Schedule(buffer.GetInterface(), Rhi::SubResource(test_data.data(), 100U), upload_cmd_queue.GetInterface());
+        const Base::UploadScheduler::Readiness readiness_c = upload_scheduler.Schedule(buffer.GetInterface(), Rhi::SubResource(test_data.data(), 100U), upload_cmd_queue.GetInterface());
+        CHECK(copy_scope.GetCopiedBytes() == 300U);
+        CHECK_FALSE(IsReady(readiness_a));
+
+        const Base::UploadScheduler::Statistics statistics = upload_scheduler.GetStatistics();
+        CHECK(statistics.requests_count == 3U);
+        CHECK(statistics.staged_size == 300U);
+        CHECK(statistics.shared_size == 0U);
+        CHECK(statistics.staging_pages_count == 2U);
+        CHECK(statistics.closed_batches_count == 0U);
+    }
+
+    SECTION("Owned data is shared without copying")
+    {
+        const Data::ChunkCopyScope copy_scope;
+        const Base::UploadScheduler::Readiness readiness = upload_scheduler.Schedule(buffer.GetInterface(),
+            Rhi::SubResource(Data::SharedChunk(Data::Bytes(512U, std::byte(5)))), upload_cmd_queue.GetInterface());
+        CHECK(copy_scope.GetCopiedBytes() == 0U);
+
+        const Base::UploadScheduler::Statistics statistics = upload_scheduler.GetStatistics();
+        CHECK(statistics.shared_size == 512U);
+        CHECK(statistics.staged_size == 0U);
+        CHECK(statistics.staging_pages_count == 0U);
+    }
+
+    SECTION("Batch is closed when its data size exceeds the limit")
+    {
+        const Base::UploadScheduler::Readiness readiness_a = upload_scheduler.Schedule(buffer.GetInterface(),
+            Rhi::SubResource(Data::Bytes(g_buffer_size, std::byte(1))), upload_cmd_queue.GetInterface());
+        const Base::UploadScheduler::Readiness readiness_b = upload_scheduler.Schedule(buffer.GetInterface(),
+            Rhi::SubResource(Data::Bytes(16U, std::byte(2))), upload_cmd_queue.GetInterface());
+        CHECK(upload_scheduler.GetStatistics().closed_batches_count == 1U);
+
+        upload_scheduler.Submit();
+        CHECK(upload_scheduler.GetStatistics().encoded_batches_count == 2U);
+        CompleteUploads(compute_context);
+        CHECK(IsReady(readiness_a));
+        CHECK(IsReady(readiness_b));
+    }
+
+    SECTION("Requests of the same batch share readiness future")
+    {
+        const Base::UploadScheduler::Readiness readiness_a = upload_scheduler.Schedule(buffer.GetInterface(),
+            Rhi::SubResource(Data::Bytes(16U, std::byte(1))), upload_cmd_queue.GetInterface());
+        const Base::UploadScheduler::Readiness readiness_b = upload_scheduler.Schedule(buffer.GetInterface(),
+            Rhi::SubResource(Data::Bytes(16U, std::byte(2))), upload_cmd_queue.GetInterface());
+        CHECK(upload_scheduler.GetStatistics().closed_batches_count == 0U);
+
+        upload_scheduler.Submit();
+        CHECK(upload_scheduler.GetStatistics().encoded_batches_count == 1U);
+        CHECK_FALSE(IsReady(readiness_a));
+        CHECK_FALSE(IsReady(readiness_b));
+
+        CompleteUploads(compute_context);
+        CHECK(IsReady(readiness_a));
+        CHECK(IsReady(readiness_b));
+    }
+
+    SECTION("Submitted batches are ready after upload command list completion")
+    {
+        const std::vector<std::byte> test_data(g_buffer_size, std::byte(7));
+        const Base::UploadScheduler::Readiness readiness = upload_scheduler.Schedule(buffer.GetInterface(),
+            Rhi::SubResource(test_data.data(), g_buffer_size), upload_cmd_queue.GetInterface());
+
+        upload_scheduler.Submit();
+        CHECK(upload_scheduler.GetStatistics().encoded_batches_count == 1U);
+        CHECK_FALSE(IsReady(readiness));
+
+        CompleteUploads(compute_context);
+        CHECK(IsReady(readiness));
+        CHECK(upload_scheduler.GetStatistics().completed_batches_count == 1U);
+
+        const Rhi::SubResource buffer_data = buffer.GetData(upload_cmd_queue);
+        REQUIRE(buffer_data.GetDataSize() == g_buffer_size);
+        CHECK(buffer_data.GetDataPtr()[g_buffer_size - 1U] == std::byte(7));
+    }
+
+    SECTION("Requests are scheduled from multiple threads in parallel")
+    {
+        constexpr uint32_t threads_count = 4U;
+        std::vector<Base::UploadScheduler::Readiness> readiness_list(threads_count);
+        std::vector<std::thread> threads;
+        const std::vector<std::byte> test_data(64U, std::byte(9));
+        for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&, thread_index]
+            {
+                readiness_list[thread_index] = upload_scheduler.Schedule(buffer.GetInterface(),
+                    Rhi::SubResource(test_data.data(), 64U, Rhi::SubResource::Index(), Rhi::BytesRange(thread_index * 64U, (thread_index + 1U) * 64U)),
+                    upload_cmd_queue.GetInterface());
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(upload_scheduler.GetStatistics().staged_size == threads_count * 64U);
+        upload_scheduler.Submit();
+        CompleteUploads(compute_context);
+        for (const Base::UploadScheduler::Readiness& readiness : readiness_list)
+        {
+            CHECK(IsReady(readiness));
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/Vulkan/BindlessDescriptorsTest.cpp
+Unit-tests of the Vulkan bindless descriptors running on GPU device
+with descriptor indexing support, like Mesa software rasterizer lavapipe.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/Device.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/RHI/IDescriptorManager.h>
+#include <Methane/Graphics/Vulkan/DescriptorManager.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <optional>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static std::optional<Rhi::Device> GetBindlessTestDevice()
+{
+    // Headless device is requested without present to window feature
+    const Rhi::DeviceCaps device_caps = Rhi::DeviceCaps().SetFeatures({ Rhi::DeviceFeature::BindlessDescriptors });
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices(device_caps);
+    if (devices.empty())
+        return std::nullopt;
+
+    return devices[0];
+}
+
+TEST_CASE("Vulkan Bindless Descriptors", "[vulkan][descriptor][bindless]")
+{
+    const std::optional<Rhi::Device> device_opt = GetBindlessTestDevice();
+    if (!device_opt)
+        SKIP("No Vulkan device with descriptor indexing support, install Mesa lavapipe driver to run bindless tests");
+
+    const Rhi::ComputeContext compute_context(*device_opt, g_parallel_executor, {});
+    Rhi::IDescriptorManager& descriptor_manager = compute_context.GetDescriptorManager();
+    auto& vk_descriptor_manager = dynamic_cast<Vulkan::DescriptorManager&>(descriptor_manager);
+    REQUIRE(descriptor_manager.IsBindlessEnabled());
+
+    const Rhi::Texture texture_a = compute_context.CreateTexture(
+        Rhi::TextureSettings::ForImage(Dimensions(16U, 16U), std::nullopt, PixelFormat::RGBA8Unorm, false));
+    const Rhi::Texture texture_b = compute_context.CreateTexture(
+        Rhi::TextureSettings::ForImage(Dimensions(16U, 16U), std::nullopt, PixelFormat::RGBA8Unorm, false));
+    const Rhi::Sampler sampler = compute_context.CreateSampler({
+        Rhi::SamplerFilter(Rhi::SamplerFilter::MinMag::Linear),
+        Rhi::SamplerAddress(Rhi::SamplerAddress::Mode::ClampToEdge)
+    });
+    const Rhi::Buffer storage_buffer = compute_context.CreateBuffer(Rhi::BufferSettings{
+        Rhi::BufferType::Storage, Rhi::ResourceUsageMask(Rhi::ResourceUsage::ShaderRead),
+        1024U, 0U, PixelFormat::Unknown, Rhi::BufferStorageMode::Private
+    });
+
+    const Rhi::ResourceView texture_a_view(texture_a.GetInterface());
+    const Rhi::ResourceView texture_b_view(texture_b.GetInterface());
+    const Rhi::ResourceView sampler_view(sampler.GetInterface());
+    const Rhi::ResourceView buffer_view(storage_buffer.GetInterface());
+
+    SECTION("Resource views get separate indices in arrays of their descriptor types")
+    {
+        CHECK(descriptor_manager.AcquireBindlessDescriptor(texture_a_view) == 0U);
+        CHECK(descriptor_manager.AcquireBindlessDescriptor(texture_b_view) == 1U);
+        CHECK(descriptor_manager.AcquireBindlessDescriptor(sampler_view) == 0U);
+        CHECK(descriptor_manager.AcquireBindlessDescriptor(buffer_view) == 0U);
+
+        CHECK(vk_descriptor_manager.GetBindlessDescriptorsCount(vk::DescriptorType::eSampledImage) == 2U);
+        CHECK(vk_descriptor_manager.GetBindlessDescriptorsCount(vk::DescriptorType::eSampler) == 1U);
+        CHECK(vk_descriptor_manager.GetBindlessDescriptorsCount(vk::DescriptorType::eStorageBuffer) == 1U);
+    }
+
+    SECTION("Same resource view reuses acquired index until it is released by all owners")
+    {
+        const uint32_t texture_index = descriptor_manager.AcquireBindlessDescriptor(texture_a_view);
+        CHECK(descriptor_manager.AcquireBindlessDescriptor(texture_a_view) == texture_index);
+
+        descriptor_manager.ReleaseBindlessDescriptor(texture_a_view);
+        CHECK(vk_descriptor_manager.GetBindlessDescriptorsCount(vk::DescriptorType::eSampledImage) == 1U);
+
+        descriptor_manager.ReleaseBindlessDescriptor(texture_a_view);
+        CHECK(vk_descriptor_manager.GetBindlessDescriptorsCount(vk::DescriptorType::eSampledImage) == 0U);
+
+        // Released index is reused by another resource view
+        CHECK(descriptor_manager.AcquireBindlessDescriptor(texture_b_view) == texture_index);
+    }
+
+    SECTION("Acquired texture is transitioned to shader resource state")
+    {
+        CHECK(texture_a.GetState() != Rhi::ResourceState::ShaderResource);
+        const uint32_t texture_index = descriptor_manager.AcquireBindlessDescriptor(texture_a_view);
+        CHECK(texture_a.GetState() == Rhi::ResourceState::ShaderResource);
+
+        // Transition barrier is executed on GPU with upload command list
+        REQUIRE_NOTHROW(compute_context.CompleteInitialization());
+        CHECK(descriptor_manager.AcquireBindlessDescriptor(texture_a_view) == texture_index);
+        CHECK(texture_a.GetState() == Rhi::ResourceState::ShaderResource);
+    }
+
+    SECTION("Bindless descriptors are cleared on descriptor manager release")
+    {
+        CHECK_NOTHROW(descriptor_manager.AcquireBindlessDescriptor(texture_a_view));
+        CHECK_NOTHROW(descriptor_manager.AcquireBindlessDescriptor(buffer_view));
+        REQUIRE_NOTHROW(descriptor_manager.Release());
+        CHECK(vk_descriptor_manager.GetBindlessDescriptorsCount(vk::DescriptorType::eSampledImage) == 0U);
+        CHECK(vk_descriptor_manager.GetBindlessDescriptorsCount(vk::DescriptorType::eStorageBuffer) == 0U);
+    }
+}
@@ -0,0 +1,160 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Platform/App/AppBaseTest.cpp
+Unit-tests of the Platform Application headless run loop
+
+******************************************************************************/
+
+#include <Methane/Platform/AppBase.h>
+#include <Methane/Platform/AppEnvironment.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <filesystem>
+#include <limits>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Platform;
+
+class HeadlessTestApp final : public AppBase
+{
+public:
+    explicit HeadlessTestApp(uint32_t resize_required_frame = std::numeric_limits<uint32_t>::max())
+        : AppBase(AppSettings{ "Headless Test App", { 0.5F, 0.5F } })
+        , m_resize_required_frame(resize_required_frame)
+    { }
+
+    // IApp overrides
+    int Run(const RunArgs& args) override
+    {
+        if (const int error_code = AppBase::Run(args))
+            return error_code;
+
+        return RunHeadless(AppEnvironment{});
+    }
+
+    void InitContext(const AppEnvironment&, const Data::FrameSize& frame_size) override
+    {
+        m_context_frame_size = frame_size;
+        ++m_init_context_count;
+    }
+
+    bool Update() override
+    {
+        ++m_update_count;
+        return true;
+    }
+
+    bool Render() override
+    {
+        if (m_render_count++ == m_resize_required_frame)
+            throw AppViewResizeRequiredError();
+        return true;
+    }
+
+    void     SetWindowTitle(const std::string&) override { /* no window in headless mode */ }
+    float    GetContentScalingFactor() const override    { return 1.F; }
+    uint32_t GetFontResolutionDpi() const override       { return 96U; }
+    void     Close() override                            { /* no window in headless mode */ }
+
+    const Data::FrameSize&       GetContextFrameSize() const noexcept   { return m_context_frame_size; }
+    uint32_t                     GetInitContextCount() const noexcept   { return m_init_context_count; }
+    uint32_t                     GetUpdateCount() const noexcept        { return m_update_count; }
+    uint32_t                     GetRenderCount() const noexcept        { return m_render_count; }
+    const std::vector<uint32_t>& GetRenderedFrameIndices() const noexcept { return m_rendered_frame_indices; }
+
+protected:
+    // AppBase overrides
+    AppView GetView() const override { return AppView{ nullptr }; }
+    void OnHeadlessFrameRendered(uint32_t frame_index) override { m_rendered_frame_indices.push_back(frame_index); }
+
+private:
+    const uint32_t        m_resize_required_frame;
+    Data::FrameSize       m_context_frame_size;
+    uint32_t              m_init_context_count = 0U;
+    uint32_t              m_update_count = 0U;
+    uint32_t              m_render_count = 0U;
+    std::vector<uint32_t> m_rendered_frame_indices;
+};
+
+template<size_t args_count>
+static int RunApp(HeadlessTestApp& app, const std::array<const char*, args_count>& args)
+{
+    return app.Run(AppRunArgs{ static_cast<int>(args.size()), const_cast<const char**>(args.data()) });
+}
+
+static size_t GetFileLinesCount(const std::filesystem::path& file_path)
+{
+    std::ifstream file(file_path);
+    size_t lines_count = 0U;
+    for (std::string line; std::getline(file, line);)
+        ++lines_count;
+    return lines_count;
+}
+
+TEST_CASE("Platform Application Headless Run", "[app][headless]")
+{
+    SECTION("Fixed number of frames is rendered without window")
+    {
+        HeadlessTestApp app;
+        CHECK(RunApp(app, std::array{ "HeadlessTestApp", "--headless", "--frames", "5" }) == 0);
+        CHECK(app.IsHeadless());
+        CHECK(app.GetInitContextCount() == 1U);
+        CHECK(app.GetUpdateCount() == 5U);
+        CHECK(app.GetRenderCount() == 5U);
+        CHECK(app.GetUpdatedFramesCount() == 5U);
+        CHECK(app.GetRenderedFrameIndices() == std::vector<uint32_t>{ 0U, 1U, 2U, 3U, 4U });
+    }
+
+    SECTION("Window size ratio is applied to Full HD frame size")
+    {
+        HeadlessTestApp app;
+        CHECK(RunApp(app, std::array{ "HeadlessTestApp", "--headless", "--frames", "1" }) == 0);
+        CHECK(app.GetContextFrameSize() == Data::FrameSize(960U, 540U));
+        CHECK(app.GetFrameSize() == Data::FrameSize(960U, 540U));
+    }
+
+    SECTION("Frame timings are written to dump directory")
+    {
+        const std::filesystem::path dump_dir_path = std::filesystem::temp_directory_path() / "MethaneHeadlessTest";
+        const std::string dump_dir = dump_dir_path.string();
+        std::filesystem::remove_all(dump_dir_path);
+
+        HeadlessTestApp app;
+        CHECK(RunApp(app, std::array{ "HeadlessTestApp", "--headless", "--frames", "3", "--dump-dir", dump_dir.c_str() }) == 0);
+        CHECK(app.GetHeadlessDumpDir() == dump_dir);
+
+        const std::filesystem::path timings_file_path = dump_dir_path / "frame_timings.csv";
+        REQUIRE(std::filesystem::exists(timings_file_path));
+        CHECK(GetFileLinesCount(timings_file_path) == 4U); // header and 3 frame lines
+        std::filesystem::remove_all(dump_dir_path);
+    }
+
+    SECTION("Headless run is stopped when render requires resize")
+    {
+        HeadlessTestApp app(2U);
+        CHECK(RunApp(app, std::array{ "HeadlessTestApp", "--headless", "--frames", "5" }) == 0);
+        CHECK(app.GetRenderCount() == 3U);
+        CHECK(app.GetRenderedFrameIndices() == std::vector<uint32_t>{ 0U, 1U, 2U });
+    }
+}
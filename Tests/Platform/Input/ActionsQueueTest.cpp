@@ -0,0 +1,142 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Platform/Input/ActionsQueueTest.cpp
+Unit tests of the lock-free input actions queue
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Platform/Input/ActionsQueue.h>
+#include <Methane/Platform/Input/State.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace Methane;
+using namespace Methane::Platform::Input;
+
+TEST_CASE("Input actions queue dispatch", "[input][queue]")
+{
+    State         input_state;
+    ActionsQueue  actions_queue(8U);
+    CHECK(actions_queue.GetCapacity() == 8U);
+    CHECK(actions_queue.IsEmpty());
+
+    SECTION("Queued actions are dispatched to target controller in one batch")
+    {
+        actions_queue.OnMouseInWindowChanged(true);
+        actions_queue.OnMouseButtonChanged(Mouse::Button::Left, Mouse::ButtonState::Pressed);
+        actions_queue.OnKeyboardChanged(Keyboard::Key::W, Keyboard::KeyState::Pressed);
+        CHECK_FALSE(actions_queue.IsEmpty());
+        CHECK(input_state.GetKeyboardState().GetPressedKeys().empty());
+
+        CHECK(actions_queue.Dispatch(input_state) == 3U);
+        CHECK(actions_queue.IsEmpty());
+        CHECK(input_state.GetMouseState().IsInWindow());
+        CHECK(input_state.GetMouseState().GetPressedButtons() == Mouse::Buttons{ Mouse::Button::Left });
+        CHECK(input_state.GetKeyboardState().GetPressedKeys() == Keyboard::Keys{ Keyboard::Key::W });
+    }
+
+    SECTION("Consecutive mouse position changes are collapsed")
+    {
+        actions_queue.OnMousePositionChanged(Mouse::Position(1, 2));
+        actions_queue.OnMousePositionChanged(Mouse::Position(3, 4));
+        actions_queue.OnMouseButtonChanged(Mouse::Button::Right, Mouse::ButtonState::Pressed);
+        actions_queue.OnMousePositionChanged(Mouse::Position(5, 6));
+        actions_queue.OnMousePositionChanged(Mouse::Position(7, 8));
+
+        CHECK(actions_queue.Dispatch(input_state) == 3U);
+        CHECK(input_state.GetMouseState().GetPosition() == Mouse::Position(7, 8));
+        CHECK(input_state.GetMouseState().GetPressedButtons() == Mouse::Buttons{ Mouse::Button::Right });
+    }
+
+    SECTION("Actions pushed to full queue are coalesced")
+    {
+        for (uint32_t action_index = 0U; action_index < 10U; ++action_index)
+        {
+            actions_queue.OnMouseScrollChanged(Mouse::Scroll(0.F, 1.F));
+        }
+        CHECK(actions_queue.GetCoalescedCount() == 2U);
+        CHECK_FALSE(actions_queue.Push(RecordedAction{ 0U, RecordedAction::Type::MouseInWindow, 0U, 1U }));
+
+        // Coalesced scroll deltas are accumulated and dispatched after queued actions
+        CHECK(actions_queue.Dispatch(input_state) == 10U);
+        CHECK(actions_queue.IsEmpty());
+        CHECK(input_state.GetMouseState().IsInWindow());
+        CHECK(input_state.GetMouseState().GetScroll() == Mouse::Scroll(0.F, 10.F));
+        CHECK(actions_queue.Push(RecordedAction{ 0U, RecordedAction::Type::MouseInWindow, 0U, 0U }));
+    }
+
+    SECTION("Key release is not lost when queue is full")
+    {
+        for (uint32_t action_index = 0U; action_index < 7U; ++action_index)
+        {
+            actions_queue.OnMousePositionChanged(Mouse::Position(static_cast<int>(action_index), 0));
+        }
+        actions_queue.OnKeyboardChanged(Keyboard::Key::W, Keyboard::KeyState::Pressed);
+        actions_queue.OnKeyboardChanged(Keyboard::Key::A, Keyboard::KeyState::Pressed);
+        actions_queue.OnKeyboardChanged(Keyboard::Key::A, Keyboard::KeyState::Released);
+        actions_queue.OnKeyboardChanged(Keyboard::Key::W, Keyboard::KeyState::Released);
+        CHECK(actions_queue.GetCoalescedCount() == 3U);
+
+        actions_queue.Dispatch(input_state);
+        CHECK(actions_queue.IsEmpty());
+        CHECK(input_state.GetKeyboardState().GetPressedKeys().empty());
+    }
+}
+
+TEST_CASE("Input actions queue capacity", "[input][queue]")
+{
+    CHECK(ActionsQueue().GetCapacity() == ActionsQueue::default_capacity);
+    CHECK(ActionsQueue(100U).GetCapacity() == 128U);
+    CHECK(ActionsQueue(1U).GetCapacity() == 2U);
+    CHECK_THROWS(ActionsQueue(0U));
+}
+
+TEST_CASE("Input actions queue producer and consumer threads", "[input][queue]")
+{
+    constexpr uint32_t actions_count = 10000U;
+    ActionsQueue actions_queue(64U);
+    State        input_state;
+
+    std::atomic<bool> is_producer_finished{ false };
+    std::thread producer_thread([&actions_queue, &is_producer_finished]()
+    {
+        for (uint32_t action_index = 0U; action_index < actions_count; ++action_index)
+        {
+            const auto key_state = action_index % 2U ? Keyboard::KeyState::Released : Keyboard::KeyState::Pressed;
+            actions_queue.OnKeyboardChanged(Keyboard::Key::Space, key_state);
+        }
+        is_producer_finished = true;
+    });
+
+    uint32_t dispatched_count = 0U;
+    while (!is_producer_finished || !actions_queue.IsEmpty())
+    {
+        dispatched_count += actions_queue.Dispatch(input_state);
+    }
+    producer_thread.join();
+
+    // Actions are never dropped: every action is either dispatched or coalesced with the later actions
+    CHECK(dispatched_count <= actions_count);
+    CHECK(dispatched_count >= actions_count - actions_queue.GetCoalescedCount());
+    CHECK(actions_queue.IsEmpty());
+    CHECK(input_state.GetKeyboardState().GetPressedKeys().empty());
+}
@@ -0,0 +1,125 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Platform/Input/ActionsRecorderTest.cpp
+Unit tests of the input actions recording and replay
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Platform/Input/ActionsRecorder.h>
+#include <Methane/Platform/Input/State.h>
+
+#include <filesystem>
+
+using namespace Methane;
+using namespace Methane::Platform::Input;
+using namespace std::chrono_literals;
+
+static void RecordTestActions(ActionsRecorder& recorder)
+{
+    recorder.StartFrame(0U);
+    recorder.OnMouseInWindowChanged(true);
+    recorder.OnMousePositionChanged(Mouse::Position(12, 34));
+    recorder.StartFrame(1U);
+    recorder.OnMouseButtonChanged(Mouse::Button::Left, Mouse::ButtonState::Pressed);
+    recorder.OnKeyboardChanged(Keyboard::Key::W, Keyboard::KeyState::Pressed);
+    recorder.StartFrame(3U);
+    recorder.OnMouseScrollChanged(Mouse::Scroll(0.5F, -1.25F));
+    recorder.OnModifiersChanged(Keyboard::ModifierMask{ Keyboard::Modifier::Shift });
+}
+
+TEST_CASE("Input actions recording", "[input][recording]")
+{
+    State input_state;
+    ActionsRecorder recorder(input_state);
+    RecordTestActions(recorder);
+
+    SECTION("Actions are recorded with frame indices")
+    {
+        const RecordedActions& actions = recorder.GetActions();
+        REQUIRE(actions.size() == 6U);
+        CHECK(actions[0].frame_index == 0U);
+        CHECK(actions[0].type == RecordedAction::Type::MouseInWindow);
+        CHECK(actions[2].frame_index == 1U);
+        CHECK(actions[2].type == RecordedAction::Type::MouseButton);
+        CHECK(actions[5].frame_index == 3U);
+        CHECK(actions[5].type == RecordedAction::Type::Modifiers);
+    }
+
+    SECTION("Actions are forwarded to target controller")
+    {
+        CHECK(input_state.GetMouseState().IsInWindow());
+        CHECK(input_state.GetMouseState().GetPosition() == Mouse::Position(12, 34));
+        CHECK(input_state.GetMouseState().GetPressedButtons() == Mouse::Buttons{ Mouse::Button::Left });
+        CHECK(input_state.GetKeyboardState().GetPressedKeys() == Keyboard::Keys{ Keyboard::Key::W });
+    }
+}
+
+TEST_CASE("Input actions replay", "[input][recording]")
+{
+    State recorded_state;
+    ActionsRecorder recorder(recorded_state);
+    RecordTestActions(recorder);
+
+    State replayed_state;
+    ActionsRecorder player(replayed_state, recorder.GetActions());
+    CHECK(player.IsReplaying());
+
+    SECTION("Actions are replayed frame by frame")
+    {
+        player.StartFrame(0U);
+        CHECK(replayed_state.GetMouseState().GetPosition() == Mouse::Position(12, 34));
+        CHECK(replayed_state.GetMouseState().GetPressedButtons().empty());
+
+        player.StartFrame(1U);
+        player.StartFrame(2U);
+        CHECK(replayed_state.GetMouseState().GetPressedButtons() == Mouse::Buttons{ Mouse::Button::Left });
+        CHECK_FALSE(player.IsReplayCompleted());
+
+        player.StartFrame(3U);
+        CHECK(player.IsReplayCompleted());
+        CHECK(replayed_state.GetMouseState() == recorded_state.GetMouseState());
+        CHECK(replayed_state.GetKeyboardState().GetPressedKeys() == recorded_state.GetKeyboardState().GetPressedKeys());
+    }
+
+    SECTION("Live actions are ignored on replay")
+    {
+        player.OnMousePositionChanged(Mouse::Position(100, 200));
+        CHECK(replayed_state.GetMouseState().GetPosition() == Mouse::Position(0, 0));
+        CHECK(player.GetActions().size() == recorder.GetActions().size());
+    }
+}
+
+TEST_CASE("Input actions recording file", "[input][recording]")
+{
+    State input_state;
+    ActionsRecorder recorder(input_state);
+    RecordTestActions(recorder);
+
+    const ActionsRecording recording{ recorder.GetActions(), { 16ms, 17ms, 15ms, 16ms } };
+    const std::string file_path = (std::filesystem::temp_directory_path() / "MethaneInputRecordingTest.txt").string();
+    recording.SaveToFile(file_path);
+
+    const ActionsRecording loaded_recording = ActionsRecording::LoadFromFile(file_path);
+    std::filesystem::remove(file_path);
+
+    CHECK(loaded_recording.actions == recording.actions);
+    CHECK(loaded_recording.frame_time_steps == recording.frame_time_steps);
+}
@@ -177,3 +177,41 @@ TEST_CASE("Keyboard state getters and converters", "[keyboard-state]")
         CHECK(static_cast<bool>(keyboard_state));
     }
 }
+
+TEST_CASE("Keyboard key mask operations", "[keyboard-state][key-mask]")
+{
+    SECTION("Keys are set and counted")
+    {
+        KeyMask key_mask{ Key::A, Key::Enter, Key::F12, Key::Menu };
+        CHECK(key_mask.GetCount() == 4U);
+        CHECK(key_mask.IsSet(Key::Enter));
+        CHECK_FALSE(key_mask.IsSet(Key::B));
+
+        key_mask.Set(Key::Enter, false);
+        CHECK(key_mask.GetKeys() == Keys{ Key::A, Key::F12, Key::Menu });
+    }
+
+    SECTION("Unknown key is ignored")
+    {
+        const KeyMask key_mask{ Key::Unknown };
+        CHECK(key_mask.IsEmpty());
+        CHECK_FALSE(key_mask.IsSet(Key::Unknown));
+    }
+
+    SECTION("Masks are combined with bitwise operations")
+    {
+        const KeyMask key_mask_a{ Key::A, Key::B, Key::Up };
+        const KeyMask key_mask_b{ Key::B, Key::Up, Key::Down };
+        CHECK((key_mask_a ^ key_mask_b) == KeyMask{ Key::A, Key::Down });
+        CHECK((key_mask_a | key_mask_b) == KeyMask{ Key::A, Key::B, Key::Up, Key::Down });
+        CHECK((key_mask_a & key_mask_b) == KeyMask{ Key::B, Key::Up });
+    }
+
+    SECTION("Changed keys between keyboard states")
+    {
+        const State keyboard_state_a{ Key::LeftControl, Key::W, Key::A };
+        const State keyboard_state_b{ Key::LeftControl, Key::W, Key::D };
+        CHECK(keyboard_state_a.GetChangedKeys(keyboard_state_b).GetKeys() == Keys{ Key::A, Key::D });
+        CHECK(keyboard_state_a.GetPressedKeysCount() == 2U);
+    }
+}
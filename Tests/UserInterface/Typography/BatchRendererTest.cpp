@@ -0,0 +1,175 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/BatchRendererTest.cpp
+Unit-tests of the User Interface BatchRenderer
+
+******************************************************************************/
+
+#include "FakePlatformApp.hpp"
+
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/ObjectRegistry.h>
+#include <Methane/Graphics/Null/Program.h>
+
+#include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/BatchRenderer.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Platform;
+using namespace Methane::UserInterface;
+
+static const FakeApp   g_fake_app(1.F, 96);
+static const FrameSize g_frame_size(640U, 480U);
+static tf::Executor    g_parallel_executor;
+
+static Rhi::Device GetTestDevice()
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    CHECK(devices.size() > 0);
+    return devices[0];
+}
+
+static void InitBatchProgramArguments(const Rhi::RenderContext& render_context)
+{
+    // Null program has no shader reflection, so arguments of batch shaders are declared explicitly
+    const Rhi::RenderState batch_render_state = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::RenderState>("UI Batch Render State");
+    REQUIRE(batch_render_state.IsInitialized());
+    dynamic_cast<Null::Program&>(batch_render_state.GetProgram().GetInterface()).SetArgumentBindings({
+        { { Rhi::ShaderType::Pixel, "g_texture" }, { Rhi::ResourceType::Texture, 1U, 0U } },
+        { { Rhi::ShaderType::Pixel, "g_sampler" }, { Rhi::ResourceType::Sampler, 1U, 0U } },
+    });
+}
+
+static BatchQuad GetColorQuad(float left, float top, float width, float height)
+{
+    return BatchQuad{ FloatRect(left, top, width, height) };
+}
+
+static BatchQuad GetTextureQuad(float left, float top, float width, float height)
+{
+    return BatchQuad{ FloatRect(left, top, width, height), FloatRect(0.F, 0.F, 1.F, 1.F),
+                      Color4F(1.F, 1.F, 1.F, 1.F), BatchQuadMode::AlphaTexture };
+}
+
+TEST_CASE("UI Batch Renderer Batching", "[ui][batch][render]")
+{
+    const Rhi::RenderContext render_context(AppEnvironment{}, GetTestDevice(), g_parallel_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::CommandQueue  render_cmd_queue(render_context, Rhi::CommandListType::Render);
+    const Rhi::RenderPattern render_pattern(render_context, Rhi::RenderPatternSettings{});
+    const Rhi::RenderPass    render_pass = render_pattern.CreateRenderPass(Rhi::RenderPassSettings{ {}, g_frame_size });
+    const Rhi::RenderCommandList render_cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+    UserInterface::Context ui_context(g_fake_app, render_cmd_queue, render_pattern);
+
+    const BatchRenderer batch_renderer(ui_context);
+    InitBatchProgramArguments(render_context);
+
+    const Rhi::Texture atlas_texture = render_context.CreateTexture(
+        Rhi::TextureSettings::ForImage(Dimensions(16U, 16U), std::nullopt, PixelFormat::R8Unorm, false));
+    const Rhi::Texture image_texture = render_context.CreateTexture(
+        Rhi::TextureSettings::ForImage(Dimensions(16U, 16U), std::nullopt, PixelFormat::RGBA8Unorm, false));
+
+    batch_renderer.Begin();
+
+    SECTION("Nothing is drawn without quads")
+    {
+        REQUIRE_NOTHROW(batch_renderer.Draw(render_cmd_list));
+        CHECK(batch_renderer.GetStatistics().quads_count == 0U);
+        CHECK(batch_renderer.GetStatistics().draw_calls_count == 0U);
+    }
+
+    SECTION("Colored panels are drawn with one draw call")
+    {
+        batch_renderer.AddQuad(GetColorQuad(0.F,   0.F, 100.F, 50.F));
+        batch_renderer.AddQuad(GetColorQuad(200.F, 0.F, 100.F, 50.F));
+        batch_renderer.AddQuad(GetColorQuad(400.F, 0.F, 100.F, 50.F));
+        REQUIRE_NOTHROW(batch_renderer.Draw(render_cmd_list));
+
+        const BatchStatistics& statistics = batch_renderer.GetStatistics();
+        CHECK(statistics.quads_count == 3U);
+        CHECK(statistics.materials_count == 1U);
+        CHECK(statistics.draw_calls_count == 1U);
+        CHECK(statistics.unbatched_draw_calls_count == 3U);
+    }
+
+    SECTION("Non-overlapping widgets are batched by texture")
+    {
+        const std::array<BatchQuad, 2> glyph_quads{ GetTextureQuad(10.F, 10.F, 8.F, 8.F), GetTextureQuad(20.F, 10.F, 8.F, 8.F) };
+        batch_renderer.AddQuad(GetColorQuad(0.F, 0.F, 100.F, 50.F));
+        batch_renderer.AddQuads(glyph_quads, &atlas_texture);
+        batch_renderer.AddQuad(GetColorQuad(0.F, 100.F, 100.F, 50.F));
+        batch_renderer.AddQuads(glyph_quads, &atlas_texture);
+        REQUIRE_NOTHROW(batch_renderer.Draw(render_cmd_list));
+
+        const BatchStatistics& statistics = batch_renderer.GetStatistics();
+        CHECK(statistics.quads_count == 6U);
+        CHECK(statistics.materials_count == 2U);
+        CHECK(statistics.draw_calls_count == 2U);
+        CHECK(statistics.unbatched_draw_calls_count == 4U);
+    }
+
+    SECTION("Overlapping widgets keep drawing order")
+    {
+        batch_renderer.AddQuad(GetColorQuad(0.F, 0.F, 100.F, 100.F));
+        batch_renderer.AddQuad(GetTextureQuad(50.F, 50.F, 100.F, 100.F), &image_texture);
+        // Panel overlapping the image can not be merged into the first panel batch drawn below the image
+        batch_renderer.AddQuad(GetColorQuad(100.F, 100.F, 100.F, 100.F));
+        REQUIRE_NOTHROW(batch_renderer.Draw(render_cmd_list));
+
+        const BatchStatistics& statistics = batch_renderer.GetStatistics();
+        CHECK(statistics.materials_count == 2U);
+        CHECK(statistics.draw_calls_count == 3U);
+    }
+
+    SECTION("Quads are clipped by widget clip rectangle")
+    {
+        const FloatRect clip_rect(0.F, 0.F, 50.F, 20.F);
+        const std::array<BatchQuad, 3> glyph_quads{
+            GetTextureQuad(10.F, 10.F, 8.F, 8.F),  // inside clip rectangle
+            GetTextureQuad(45.F, 15.F, 10.F, 10.F), // partially clipped
+            GetTextureQuad(60.F, 10.F, 8.F, 8.F),  // outside of clip rectangle
+        };
+        batch_renderer.AddQuads(glyph_quads, &atlas_texture, &clip_rect);
+        batch_renderer.AddQuads(std::array{ GetTextureQuad(0.F, 30.F, 8.F, 8.F) }, &atlas_texture, &clip_rect);
+        REQUIRE_NOTHROW(batch_renderer.Draw(render_cmd_list));
+
+        const BatchStatistics& statistics = batch_renderer.GetStatistics();
+        CHECK(statistics.quads_count == 2U);
+        CHECK(statistics.draw_calls_count == 1U);
+        CHECK(statistics.unbatched_draw_calls_count == 1U);
+    }
+
+    SECTION("Textured quad requires texture")
+    {
+        CHECK_THROWS(batch_renderer.AddQuad(GetTextureQuad(0.F, 0.F, 8.F, 8.F)));
+    }
+}
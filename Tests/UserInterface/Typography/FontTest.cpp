@@ -0,0 +1,113 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/FontTest.cpp
+Unit-tests of the User Interface Font atlas rendering in signed distance field mode
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <Methane/UserInterface/FontLibrary.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static const FrameSize g_frame_size(640U, 480U);
+static tf::Executor    g_parallel_executor;
+
+static Rhi::Device GetTestDevice()
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    CHECK(devices.size() > 0);
+    return devices[0];
+}
+
+static FontSettings GetFontSettings(const std::u32string& characters, FontRenderMode render_mode)
+{
+    return FontSettings{ { "Roboto", "Fonts/Roboto/Roboto-Regular.ttf", 20U }, 96U, characters, render_mode, 4U };
+}
+
+static Data::Bytes GetAtlasData(const Font& font, const Rhi::RenderContext& render_context)
+{
+    // Atlas texture data is set on context resources upload
+    const Rhi::Texture& atlas_texture = font.GetAtlasTexture(render_context);
+    REQUIRE(atlas_texture.IsInitialized());
+    REQUIRE_NOTHROW(render_context.CompleteInitialization());
+
+    const Rhi::SubResource atlas_data = font.GetAtlasTexture(render_context).GetData(render_context.GetRenderCommandKit().GetQueue());
+    REQUIRE(atlas_data.GetDataSize() == font.GetAtlasSize().GetPixelsCount());
+    return Data::Bytes(atlas_data.GetDataPtr(), atlas_data.GetDataEndPtr());
+}
+
+static size_t GetPixelsCount(const Data::Bytes& atlas_data, uint8_t min_value, uint8_t max_value)
+{
+    return static_cast<size_t>(std::ranges::count_if(atlas_data, [min_value, max_value](Data::Byte value)
+    {
+        return static_cast<uint8_t>(value) >= min_value && static_cast<uint8_t>(value) <= max_value;
+    }));
+}
+
+TEST_CASE("UI Font Signed Distance Field Atlas", "[ui][font][sdf]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const FontLibrary font_lib;
+
+    SECTION("Distance field glyphs have edge gradient around outline")
+    {
+        const Font& font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings(U"IO", FontRenderMode::SignedDistanceField));
+        CHECK(font.IsDistanceField());
+
+        const Data::Bytes atlas_data = GetAtlasData(font, render_context);
+        CHECK(GetPixelsCount(atlas_data, 0U, 0U) > 0U);       // empty atlas space
+        CHECK(GetPixelsCount(atlas_data, 1U, 95U) > 0U);      // outside glyph within distance spread
+        CHECK(GetPixelsCount(atlas_data, 96U, 160U) > 0U);    // glyph edge at 0.5 distance value
+        CHECK(GetPixelsCount(atlas_data, 129U, 255U) > 0U);   // inside glyph
+        CHECK(GetPixelsCount(atlas_data, 255U, 255U) == 0U);  // thin strokes never reach saturated distance
+    }
+
+    SECTION("Chars added after atlas upload are drawn with distance fields")
+    {
+        const Font& font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings(U"I", FontRenderMode::SignedDistanceField));
+        const size_t inside_pixels_count = GetPixelsCount(GetAtlasData(font, render_context), 129U, 255U);
+        CHECK(inside_pixels_count > 0U);
+
+        font.AddChars(U"OW");
+        CHECK(GetPixelsCount(GetAtlasData(font, render_context), 129U, 255U) > inside_pixels_count);
+    }
+
+    SECTION("Bitmap glyphs are rasterized with full coverage inside")
+    {
+        const Font& font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings(U"IO", FontRenderMode::Bitmap));
+        CHECK_FALSE(font.IsDistanceField());
+
+        const Data::Bytes atlas_data = GetAtlasData(font, render_context);
+        CHECK(GetPixelsCount(atlas_data, 255U, 255U) > 0U);
+    }
+}